@@ -64,11 +64,54 @@ public:
     bool  MaximumAssignment(TCap cDeg) throw();
     bool  MaximumAssignment(TCap *pLower,TCap *pDeg = NULL) throw();
 
+    /// \brief  Methods for the weighted assignment problem
+    enum TMethAssignment {
+        MCA_FLOW             = 0, ///< Transform to a min-cost st-flow problem
+        MCA_AUCTION          = 1, ///< Apply the forward / reverse auction method
+        MCA_JONKER_VOLGENANT = 2  ///< Apply the Jonker / Volgenant method
+    };
+
     bool  MinCAssignment() throw();
     bool  MinCAssignment(TCap cDeg) throw();
     bool  MinCAssignment(TCap *pLower,TCap *pDeg = NULL) throw();
     bool  PMHeuristicsCandidates() throw();
 
+protected:
+
+    /// \brief  Check if a min-cost assignment can be computed without network transformation
+    ///
+    /// \param cDeg   The desired constant node degree
+    /// \retval true  The assignment solvers selected by #goblinController::methAssignment apply
+    ///
+    /// This is the case for perfect 1-matchings in a bigraph with n1==n2 and
+    /// without lower degree bounds, if methAssignment is not MCA_FLOW.
+    bool  NativeAssignment(TCap cDeg) throw();
+
+    /// \brief  Determine a minimum-cost perfect assignment by the auction method
+    ///
+    /// \retval true  A perfect assignment has been found
+    ///
+    /// This runs the forward / reverse auction method with epsilon-scaling.
+    /// The bids of the unassigned left-hand nodes are computed concurrently
+    /// by a #parallelAuction object. The method depends on integral arc
+    /// lengths. For other instances, MCA_JonkerVolgenant() is called instead.
+    bool  MCA_Auction() throw();
+
+    /// \brief  Determine a minimum-cost perfect assignment by the Jonker / Volgenant method
+    ///
+    /// \retval true  A perfect assignment has been found
+    ///
+    /// The initial assignment and node potentials are obtained by column
+    /// reduction, reduction transfer and augmenting row reduction. The
+    /// remaining left-hand nodes are assigned by shortest augmenting paths.
+    /// If the graph is dense or has at least n1*n1/4 arcs, the shortest path
+    /// search scans all right-hand nodes without a priority queue. Otherwise,
+    /// a binary heap is used.
+    bool  MCA_JonkerVolgenant() throw();
+
+public:
+
+
     bool  MaximumMatching() throw()
                         {return MaximumAssignment();};
     bool  MaximumMatching(TCap cDeg) throw()
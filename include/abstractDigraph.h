@@ -14,6 +14,7 @@
 #define _ABSTRACT_DIGRAPH_H_
 
 #include "abstractMixedGraph.h"
+#include "staticQueue.h"
 
 
 /// \brief The base class for all kinds of directed graph objects
@@ -209,7 +210,42 @@ private:
     TFloat  MXF_EdmondsKarp(TNode,TNode) throw(ERRange);
     TFloat  MXF_CapacityScaling(TNode,TNode) throw(ERRange);
     TFloat  MXF_PushRelabel(TNode,TNode) throw(ERRange);
+    template <class TScanner> TFloat  MXF_PushRelabel(const TScanner&,TNode,TNode) throw(ERRange);
+
+    /// \brief  Compute exact distance labels for the push / relabel method
+    ///
+    /// \param I           An incidence scanner object, see #genericScanner
+    /// \param s           The source node
+    /// \param t           The target node
+    /// \param dist        The distance labels to be updated
+    /// \param Admissible  The admissible arcs, indexed by their start nodes
+    /// \param Q           The queue of active nodes
+    /// \param labelCount  The number of nodes for every label below n, or NULL
+    ///
+    /// The labels are the BFS distances to t in the residual network. Nodes
+    /// which cannot reach t are labelled n plus the BFS distance to s. After
+    /// that, the lists of admissible arcs and the queue of active nodes are
+    /// rebuilt.
+    template <class TScanner> void  MXF_GlobalRelabel(const TScanner& I,TNode s,TNode t,
+                TNode* dist,staticQueue<TArc,TFloat>** Admissible,
+                goblinQueue<TNode,TFloat>* Q,TNode* labelCount) throw();
+
+    /// \brief  Apply the gap heuristics of the push / relabel method
+    ///
+    /// \param I           An incidence scanner object, see #genericScanner
+    /// \param gap         A distance label below n which is not assigned to any node
+    /// \param dist        The distance labels to be updated
+    /// \param Admissible  The admissible arcs, indexed by their start nodes
+    /// \param labelCount  The number of nodes for every label below n
+    /// \return            The number of lifted nodes
+    ///
+    /// All nodes with labels between the gap and n are lifted to n+1, since
+    /// these nodes cannot reach the target node anymore.
+    template <class TScanner> TNode  MXF_GapRelabel(const TScanner& I,TNode gap,
+                TNode* dist,staticQueue<TArc,TFloat>** Admissible,
+                TNode* labelCount) throw();
     TFloat  MXF_Dinic(TNode,TNode) throw(ERRange);
+    TFloat  MXF_PushRelabelParallel(TNode,TNode) throw(ERRange);
 
     /// @}
 
@@ -235,6 +271,7 @@ private:
     TFloat  MCF_CycleCanceling() throw();
     TFloat  MCF_MinMeanCycleCanceling() throw();
     TFloat  MCF_CostScaling(TMethMCF) throw();
+    TFloat  MCF_EnhancedCostScaling() throw();
     TFloat  MCF_NWSimplex() throw();
     TFloat  MCF_CapacityScaling(bool = true) throw(ERRejected);
     TFloat  MCF_ShortestAugmentingPath() throw(ERRejected)
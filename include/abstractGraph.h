@@ -16,6 +16,9 @@
 #include "abstractMixedGraph.h"
 
 
+class gomoryHuTree;
+
+
 /// \brief The base class for all kinds of undirected graph objects
 
 class abstractGraph : public abstractMixedGraph
@@ -109,6 +112,20 @@ protected:
     /// is done!
     bool  TSP_2Exchange(TArc* pred,TFloat limit=0) throw(ERRejected);
 
+    /// \brief  Refine a given tour by Lin-Kernighan and Or-opt moves
+    ///
+    /// \param pred   An array of predecessor arcs, describing an Hamiltonian cycle
+    /// \retval true  If the tour has been changed
+    ///
+    /// This improves a given tour until it is locally optimal with respect to
+    /// the following moves: Lin-Kernighan moves composed from up to 50 path
+    /// reversals, and Or-opt moves which shift paths of up to 3 nodes. Only
+    /// edges to the CT.methCandidates nearest neighbours and the edges of the
+    /// initial tour are considered for insertion. Nodes are scanned with
+    /// don't-look bits, and the tour is maintained in a #twoLevelTour object
+    /// so that path reversals take O(sqrt(n)) time.
+    bool  TSP_LinKernighan(TArc* pred) throw(ERRejected);
+
     // Documented in the class abstractMixedGraph
     TFloat  TSP_SubOpt1Tree(TRelaxTSP method,TNode root,TFloat& bestUpper,
                         bool branchAndBound) throw(ERRange);
@@ -189,6 +206,20 @@ protected:
     /// by their lenght.
     TFloat  PMHeuristicsRandom() throw();
 
+    /// \brief  Determine a minimum-cost perfect 1-matching by a native blossom method
+    ///
+    /// \retval true  A perfect matching has been found
+    ///
+    /// This solves the matching problem on the graph itself, without the
+    /// balanced network transformation. The node demands are ignored, and every
+    /// node is matched exactly once. Edges with zero capacity and loops are
+    /// not used. The dual variables are initialized greedily, and the
+    /// remaining exposed nodes are matched by one alternating tree at a time.
+    /// The dual updates are postponed by a single offset value, and the tree
+    /// events are handled in the order of a priority queue. Hence, a tree
+    /// search only takes time for the nodes and edges which are reached.
+    bool  PMWeightedBlossom() throw();
+
 public:
 
     /// \brief  Provide a minimum length edge cover by the edge colour register
@@ -241,6 +272,24 @@ public:
     /// @}
 
 
+    /// \addtogroup groupMinCut
+    /// @{
+
+public:
+
+    /// \brief  Compute a Gomory-Hu cut tree
+    ///
+    /// \param method  A #TMethMXF value specifying the applied max-flow method
+    /// \return        A new #gomoryHuTree object which is owned by the caller
+    ///
+    /// The tree encodes the minimum cut capacities of all node pairs and is
+    /// constructed with n-1 max-flow computations. Pairwise cut capacities are
+    /// then queried by gomoryHuTree::MinCutValue().
+    gomoryHuTree*  GomoryHuTree(TMethMXF method = MXF_DEFAULT) throw();
+
+    /// @}
+
+
     /// \addtogroup maxCut
     /// @{
 
@@ -22,6 +22,9 @@
 #include "attributePool.h"
 
 class graphRepresentation;
+class csrRepresentation;
+class adjacencyIndex;
+class nodeSplitting;
 
 
 /// \brief The base class for all kinds of graph objects
@@ -51,7 +54,9 @@ private:
     mutable THandle                             LH,RH;
         // Data structures for investigator access
 
-    mutable goblinHashTable<TArc,TArc>*  adj; ///< Hash table for node adjacencies
+    mutable adjacencyIndex*  adj; ///< Sorted neighbour lists for node adjacencies
+
+    mutable csrRepresentation*  frozen; ///< Compressed incidence lists, generated by Freeze()
 
 protected:
 
@@ -73,6 +78,16 @@ protected:
     /// The concrete heap type depends on the context parameter methPQ
     goblinQueue<TArc,TFloat>*  NewArcHeap() throw(ERRejected);
 
+    /// \brief  Create a priority queue for monotone, non-negative integral keys
+    ///
+    /// \return  A pointer to the new heap object
+    ///
+    /// This is intended for Dijkstra-like methods with integral length labels.
+    /// If the context parameter methPQ selects binary heaps (the default) or
+    /// radix heaps, a radix heap is returned. Otherwise, this is the same as
+    /// NewNodeHeap()
+    goblinQueue<TNode,TFloat>* NewMonotoneNodeHeap() throw(ERRejected);
+
     TFloat*  sDeg;    ///< Explicit degree labels, counting all undirected edges
     TFloat*  sDegIn;  ///< Explicit degree labels, counting all backward arcs
     TFloat*  sDegOut; ///< Explicit degree labels, counting all forward arcs
@@ -452,6 +467,15 @@ public:
     /// \retval true  All arc length labels coincide
     virtual bool  CLength() const throw();
 
+    /// \brief  Check if the arc length labels are all non-negative integers
+    ///
+    /// \retval true  All arc length labels are non-negative integers, and
+    ///               all path lengths are bounded by #MaxRadixHeapKey
+    ///
+    /// This is O(m) in general, but O(1) for frozen graph objects and for
+    /// constant length labels
+    bool  IntegralLengths() const throw();
+
     /// @}
 
 
@@ -541,6 +565,17 @@ public:
     /// \return  The metric type
     TMetricType  MetricType() const throw();
 
+    /// \brief  Compute the geometric distance of two nodes
+    ///
+    /// \param metricType  A #TMetricType value other than #METRIC_DISABLED
+    /// \param u           A node index ranged [0,1,..,n-1]
+    /// \param v           A node index ranged [0,1,..,n-1]
+    /// \return            The distance of u and v with respect to the given metric
+    ///
+    /// This is the unrounded value from which the length labels are derived
+    /// if MetricType()==metricType holds.
+    TFloat  MetricDistance(TMetricType metricType,TNode u,TNode v) const throw(ERRange);
+
     /// @}
 
 
@@ -684,8 +719,9 @@ public:
     /// \return         The index of any arc connecting u and v, or NoArc
     ///
     /// This function logically implements a node-node adjacency matrix.
-    /// In the default implementation, such a matrix is physically generated
-    /// or, if ADJ_SEARCH is passed, the incidence list of u is searched.
+    /// In the default implementation, an #adjacencyIndex is generated which
+    /// answers every query in O(log deg(u)) time or, if ADJ_SEARCH is passed
+    /// and no index exists, the incidence list of u is searched.
     ///
     /// All implementations prefer non-blocking arcs and, if there is more than
     /// one candidate arc even then, return the arc with the least possible index.
@@ -695,17 +731,26 @@ public:
     ///
     /// \param  u   A node index in the range [0,1..,n-1]
     /// \param  v   A node index in the range [0,1..,n-1]
-    /// \param  a   An arc index in the range [0,1..,2*m-1]
+    /// \param  a   An arc index in the range [0,1..,2*m-1], or NoArc
     ///
-    /// Update a potential node-node adjacency matrix which might have been
-    /// materialized due to previous Adjacency() calls. In particular, set
-    /// the arc index to be returned for the node pair u,v.
+    /// Update a potential adjacency index which might have been materialized
+    /// due to previous Adjacency() calls. In particular, register the arc a
+    /// for the node pair u,v and the arc a^1 for the node pair v,u. If NoArc
+    /// is passed, all arcs connecting u and v are removed from the index.
     void  MarkAdjacency(TNode u,TNode v,TArc a) throw(ERRange,ERRejected);
 
+    /// \brief  Remove an arc from the node adjacency references
+    ///
+    /// \param  a   An arc index in the range [0,1..,2*m-1]
+    ///
+    /// Remove the arcs a and a^1 from a potential adjacency index. This must
+    /// be called before the end nodes of a are changed.
+    void  UnmarkAdjacency(TArc a) throw(ERRange);
+
     /// \brief  Delete the node adjacency references
     ///
-    /// Delete a potential node-node adjacency matrix which have been
-    /// materialized due to previous Adjacency() calls.
+    /// Delete a potential adjacency index which has been materialized due
+    /// to previous Adjacency() calls.
     void  ReleaseAdjacencies() throw();
 
     /// @}
@@ -1229,7 +1274,9 @@ public:
         FDP_SPRING = 1,         ///< Apply the spring embedder method
         FDP_RESTRICTED = 2,     ///< Apply the restricted GEM method
         FDP_LAYERED = 4,        ///< Apply the 1D force directed method
-        FDP_LAYERED_RESTR = 6   ///< Apply the restricted 1D force directed method
+        FDP_LAYERED_RESTR = 6,  ///< Apply the restricted 1D force directed method
+        FDP_BARNES_HUT = 8,     ///< Apply the GEM method with approximate repelling forces
+        FDP_MULTILEVEL = 16     ///< Apply the approximate GEM method to a hierarchy of coarsened graphs
     };
 
     /// \brief Refine a given graph drawing according to a model of forces
@@ -1271,6 +1318,22 @@ private:
     /// That is, this procedure maintains a given (almost) planar drawing.
     void  Layout_GEMDrawing(TOptFDP method=FDP_GEM,int spacing=0) throw(ERRejected);
 
+    /// \brief Refine or compute a straight-line drawing of a large graph according to a model of forces
+    ///
+    /// \param method   Either #FDP_BARNES_HUT or #FDP_MULTILEVEL
+    /// \param spacing  The minimum node distance or 0
+    ///
+    /// This applies the force model of Layout_GEMDrawing(), but moves all nodes
+    /// in rounds. The repelling forces are approximated by a quadtree which is
+    /// rebuilt in every round (Barnes-Hut). By that, a round takes O(n log n)
+    /// rather than O(n^2) operations for evenly distributed nodes.
+    ///
+    /// If #FDP_BARNES_HUT is specified, the given drawing is refined. If
+    /// #FDP_MULTILEVEL is specified, the graph is coarsened recursively by
+    /// contracting matchings. The coarsest graph is drawn from scratch, and
+    /// every drawing is refined on the next finer level.
+    void  Layout_MultilevelFDP(TOptFDP method=FDP_MULTILEVEL,int spacing=0) throw(ERRejected);
+
     /// \brief Refine a given layered drawing according to a model of forces
     ///
     /// \param method   Either #FDP_GEM or #FDP_RESTRICTED
@@ -1541,6 +1604,30 @@ public:
     /// \brief  Compress the list of managed investigator objects
     void  StripInvestigators() const throw();
 
+    /// \brief  Pack the node incidences for a series of read-only solver runs
+    ///
+    /// This generates a #csrRepresentation object which stores the incidence
+    /// list of every node contiguously, together with the end nodes, the length
+    /// labels and the arc eligibility. Graph search methods like BFS(),
+    /// SPX_Dijkstra() and MXF_PushRelabel() then scan this copy instead of
+    /// calling First() and Right() for every arc. The frozen copy is discarded
+    /// implicitly with the next manipulation of the graph skeleton or the arc
+    /// attributes, and explicitly by Unfreeze().
+    void  Freeze() const throw(ERRejected);
+
+    /// \brief  Discard the compressed incidence lists generated by Freeze()
+    void  Unfreeze() const throw();
+
+    /// \brief  Check if compressed incidence lists are available
+    ///
+    /// \retval true  The graph has been frozen, and not changed since then
+    bool  IsFrozen() const throw() {return (frozen!=NULL);};
+
+    /// \brief  Obtain direct access to the compressed incidence lists
+    ///
+    /// \return  A pointer to the #csrRepresentation object or NULL
+    const csrRepresentation*  FrozenIncidences() const throw() {return frozen;};
+
     /// @}
 
 
@@ -2210,6 +2297,22 @@ public:
     /// \param fileName  The destination file name
     virtual void  Write(const char* fileName) const throw(ERFile);
 
+    /// \brief  Write this graph object to a file in the binary format
+    ///
+    /// \param fileName  The destination file name
+    ///
+    /// The binary format stores the incidence lists and all numeric attributes
+    /// as raw arrays, so that files can be loaded without any parsing by the
+    /// file constructors of the sparse graph classes. See #goblinBinaryImport
+    /// for the file layout. This is not available for dense graph objects.
+    void  WriteBinary(const char* fileName) const throw(ERFile,ERRejected);
+
+    /// \brief  Query the class label which identifies this object in files
+    ///
+    /// \return  One of "mixed", "graph", "digraph", "bigraph", "balanced_fnw",
+    ///          "dense_graph", "dense_digraph" or "dense_bigraph"
+    const char*  FileClassLabel() const throw();
+
     // This method is documented in class goblinRootObject
     void  WriteSpecial(goblinExport& F,const attributePool& pool,TPoolEnum token) const throw();
 
@@ -2287,6 +2390,16 @@ protected:
     /// read in advance.
     void  ReadAllData(goblinImport& F) throw(ERParse);
 
+    /// \brief  Read a complete graph object from a binary file
+    ///
+    /// \param F  A mapped binary file
+    ///
+    /// This reads the graph dimensions, the incidence lists, all attribute
+    /// pools and the context parameters. The default source, target and root
+    /// nodes are passed by the context variables, as it is done for the native
+    /// text format.
+    void  ReadBinary(const goblinBinaryImport& F) throw(ERParse);
+
     /// \brief  Read the number of nodes from file
     ///
     /// \param F  An input file stream
@@ -2344,7 +2457,9 @@ public:
         SPX_BELLMAN  =  2,  ///< Apply the Bellman label correcting method
         SPX_BFS      =  3,  ///< Apply breadth first search
         SPX_DAG      =  4,  ///< Apply a method for directed acyclic graphs
-        SPX_TJOIN    =  5   ///< Apply the T-join method for undirected graphs
+        SPX_TJOIN    =  5,  ///< Apply the T-join method for undirected graphs
+        SPX_BIDIRECTIONAL = 6, ///< Apply the bidirectional Dijkstra method (point-to-point)
+        SPX_ASTAR    =  7   ///< Apply the goal-directed A* method (point-to-point)
     };
 
     /// \brief  Options for implicit modification of the searched graph
@@ -2353,7 +2468,8 @@ public:
         SPX_SUBGRAPH = 1,   ///< Search the current subgraph and neglect arc orientations
         SPX_RESIDUAL = 2,   ///< Search the current residual graph
         SPX_REDUCED  = 4,   ///< Apply the reduced length labels
-        SPX_RED_RES  = 6    ///< Search the current residual graph with reduced length labels
+        SPX_RED_RES  = 6,   ///< Search the current residual graph with reduced length labels
+        SPX_REVERSE  = 8    ///< Traverse the arcs backwards, towards the root node (BFS only)
     };
 
     /// \brief  Compute a shortest path or a shortest path tree by using the default method
@@ -2423,6 +2539,10 @@ public:
     /// This determines a predecessor tree where every node is reached from s
     /// on a path with a minimum number of arcs. If a target node t is passed,
     /// the procedure stops prematurely when t is reached.
+    ///
+    /// If #SPX_REVERSE is added to the characteristic, an arc uv is traversed
+    /// from v to u, and the result is a tree of shortest paths which end at s.
+    /// In that case, the predecessor arcs point towards s.
     bool  BFS(TOptSPX characteristic,TNode s,TNode t=NoNode) throw(ERRange);
 
 protected:
@@ -2455,6 +2575,60 @@ protected:
     TNode  SPX_Dijkstra(TOptSPX characteristic,const indexSet<TNode>& S,const indexSet<TNode>& T)
                 throw(ERRange,ERRejected);
 
+private:
+
+    /// \brief  Breadth first search kernel for a specific incidence scanner type
+    ///
+    /// \param I               An incidence scanner object, see #genericScanner
+    /// \param characteristic  Either SPX_SUBGRAPH, SPX_RESIDUAL or SPX_PLAIN
+    /// \param s               The node where the search tree is rooted at
+    /// \param t               An optional target node
+    /// \retval true           The target node could be reached
+    template <class TScanner> bool  BFS(const TScanner& I,TOptSPX characteristic,
+                TNode s,TNode t) throw(ERRange);
+
+    /// \brief  Dijkstra kernel for a specific incidence scanner type
+    ///
+    /// \param I               An incidence scanner object, see #genericScanner
+    /// \param characteristic  A #TOptSPX value
+    /// \param S               An index set of source nodes
+    /// \param T               An index set of target nodes
+    /// \return                The first-reached target node index or NoNode
+    template <class TScanner> TNode  SPX_Dijkstra(const TScanner& I,TOptSPX characteristic,
+                const indexSet<TNode>& S,const indexSet<TNode>& T) throw(ERRange,ERRejected);
+
+    /// \brief  Bidirectional Dijkstra kernel for a specific incidence scanner type
+    ///
+    /// \param I               An incidence scanner object, see #genericScanner
+    /// \param characteristic  A #TOptSPX value
+    /// \param s               A source node
+    /// \param t               A target node
+    /// \retval true           If t is reachable from s
+    template <class TScanner> bool  SPX_Bidirectional(const TScanner& I,
+                TOptSPX characteristic,TNode s,TNode t) throw(ERRange,ERRejected);
+
+    /// \brief  A* kernel for a specific incidence scanner type
+    ///
+    /// \param I               An incidence scanner object, see #genericScanner
+    /// \param characteristic  A #TOptSPX value
+    /// \param s               A source node
+    /// \param t               A target node
+    /// \retval true           If t is reachable from s
+    template <class TScanner> bool  SPX_AStar(const TScanner& I,
+                TOptSPX characteristic,TNode s,TNode t) throw(ERRange,ERRejected);
+
+    /// \brief  Compute a scaling factor for the geometric A* heuristics
+    ///
+    /// \return  A factor c such that c*MetricDistance(u,v) <= Length(a)
+    ///          for every arc a=uv, or 0 if the metric is disabled
+    ///
+    /// Since the length labels are rounded, the plain geometric distances
+    /// do not give a consistent estimate. This is O(m) in general, but O(1)
+    /// for frozen graph objects.
+    TFloat  MetricLengthRatio() const throw();
+
+protected:
+
     /// \brief  Perform the FIFO label correcting shortest-path search
     ///
     /// \param characteristic  A #TOptSPX value
@@ -2478,6 +2652,45 @@ protected:
     bool  SPX_BellmanFord(TOptSPX characteristic,TNode s,TNode t=NoNode)
                 throw(ERRange,ERCheck);
 
+    /// \brief  Perform a bidirectional Dijkstra search for a shortest st-path
+    ///
+    /// \param characteristic  A #TOptSPX value
+    /// \param s               A source node
+    /// \param t               A target node
+    /// \retval true           If t is reachable from s
+    ///
+    /// Two Dijkstra searches are grown from s in forward direction and from t
+    /// in backward direction, always expanding the search with the smaller
+    /// tentative distance. The procedure stops when the sum of both minimum
+    /// tentative distances exceeds the length of the shortest st-path found
+    /// so far. Non-negative arc lengths are required.
+    ///
+    /// On return, the predecessor labels encode the shortest st-path, and the
+    /// distance labels are exact for the nodes on this path only.
+    bool  SPX_Bidirectional(TOptSPX characteristic,TNode s,TNode t)
+                throw(ERRange,ERRejected);
+
+    /// \brief  Perform a goal-directed A* search for a shortest st-path
+    ///
+    /// \param characteristic  A #TOptSPX value
+    /// \param s               A source node
+    /// \param t               A target node
+    /// \retval true           If t is reachable from s
+    ///
+    /// This is Dijkstra's method where the node with the minimum sum of its
+    /// distance label and an estimate of its distance to t is expanded next.
+    /// If the length labels are derived from the node coordinates, see
+    /// MetricType(), the geometric distances are used as this estimate. In
+    /// any other case, or when residual graphs or reduced length labels are
+    /// searched, the estimates are zero, and this is Dijkstra's method with
+    /// the same early termination.
+    ///
+    /// The procedure stops when t is expanded. On return, the predecessor
+    /// labels encode the shortest st-path, and the distance labels are exact
+    /// for the expanded nodes only.
+    bool  SPX_AStar(TOptSPX characteristic,TNode s,TNode t)
+                throw(ERRange,ERRejected);
+
     /// @}
 
 
@@ -2493,12 +2706,21 @@ public:
         CONN_RIGHT_HAND = 2  ///< Specifies a right-hand node
     };
 
+    /// \brief  Methods for the computation of connected, strong and 2-connected components
+    enum TMethComponents {
+        COMP_DFS      = 0, ///< Apply depth first search
+        COMP_PARALLEL = 1  ///< Apply the parallel methods with #goblinController::maxThreads worker threads
+    };
+
     /// \brief  Connectivity test
     ///
     /// \retval true   The graph is connected
     ///
     /// Assigns node colours such that equally coloured nodes are in the same
-    /// connected component. The predecessor labels encode a DFS tree / forest
+    /// connected component. The predecessor labels encode a DFS tree / forest.
+    /// If #goblinController::methComponents is COMP_PARALLEL, the same node
+    /// colours are computed concurrently, and the predecessor labels encode an
+    /// arbitrary spanning tree / forest
     bool  Connected() throw();
 
     /// \brief  Test for k-connectivity
@@ -2531,7 +2753,10 @@ public:
     /// the nodes coloured 0 are the cut nodes, and the other colour classes define
     /// the non-trivial 2-blocks. Edge colours are assigned such that equally coloured
     /// edge denote edges in the same 2-connected component. The procedure is capable
-    /// to export additional information by the arrays order[] and lowArc[]
+    /// to export additional information by the arrays order[] and lowArc[].
+    /// If none of the optional parameters is specified, and if
+    /// #goblinController::methComponents is COMP_PARALLEL, the blocks are
+    /// computed concurrently from an arbitrary spanning tree / forest
     TRetDFS  CutNodes(TArc rootArc = NoArc,TNode* order = NULL,TArc* lowArc = NULL) throw();
 
     /// \brief  2-edge connectivity test
@@ -2539,8 +2764,12 @@ public:
     /// \retval true  The graph is 2-edge connected
     ///
     /// Assigns node colours such that equally coloured nodes are in the same
-    /// 2-edge connected component. Edge colours and predecessor labels are as
-    /// for #CutNodes()
+    /// 2-edge connected component. Isolated nodes remain uncoloured, and an
+    /// edge which forms a connected component on its own is not considered a
+    /// bridge. Edge colours and predecessor labels are as for #CutNodes().
+    /// If #goblinController::methComponents is COMP_PARALLEL, the components
+    /// are numbered from 1 by increasing minimum nodes, and edges with zero
+    /// capacity remain uncoloured
     bool  Biconnected() throw();
 
     /// \brief  Bipolar numbering and open ear decomposition
@@ -2569,7 +2798,9 @@ public:
     ///
     /// Perform a reverse and a forward DFS. Assigns node colours such that
     /// equally coloured nodes are in the same strong component. The predecessor
-    /// labels represent a forest spanning the strong components
+    /// labels represent a forest spanning the strong components. If
+    /// #goblinController::methComponents is COMP_PARALLEL, a concurrent
+    /// forward-backward search and the colouring method are applied instead
     bool  StronglyConnected() throw();
 
     /// \brief  Test for strong k-connectivity
@@ -2584,6 +2815,15 @@ public:
     /// \retval true  If the graph is strongly k-edge connected
     virtual bool  StronglyEdgeConnected(TCap k) throw();
 
+private:
+
+    bool     ParallelConnected() throw();
+    bool     ParallelStronglyConnected() throw();
+    TRetDFS  ParallelCutNodes() throw();
+    bool     ParallelBiconnected() throw();
+
+public:
+
     /// @}
 
 
@@ -2594,7 +2834,8 @@ public:
     enum TOptNodeSplitting {
         MCC_UNIT_CAPACITIES = 0, ///< Assume unit node capacities and infinite arc capacities
         MCC_MAP_DEMANDS     = 1, ///< Instead of taking unit node capacities, apply the node demands
-        MCC_MAP_UNDERLYING  = 2  ///< Ignore the arc orientations, do as if all arcs are undirected
+        MCC_MAP_UNDERLYING  = 2, ///< Ignore the arc orientations, do as if all arcs are undirected
+        MCC_ALL_PAIRS       = 4  ///< Evaluate all non-adjacent node pairs, not only the Esfahanian-Hakimi selection
     };
 
     /// \brief  Compute a global minimum node cut
@@ -2606,7 +2847,11 @@ public:
     ///
     /// Provided that all node demands are 1 or that mode==0, this determines a
     /// minimum node cut as in the standard terminology, by splitting the nodes
-    /// and computing maximum st-flows for all node pairs. The optimal node cut
+    /// and computing maximum st-flows for node pairs. Unless MCC_ALL_PAIRS is
+    /// set, or unless some arc is cheaper than its end nodes, only the O(n+d^2)
+    /// pairs of the Esfahanian-Hakimi method are evaluated, where d denotes
+    /// the minimum degree. The flows are computed concurrently, with up to
+    /// #goblinController::maxThreads split graph copies. The optimal node cut
     /// is exported by the node colour register where colour indices are
     /// interpreted as follows:
     /// - 0: Cut nodes
@@ -2620,7 +2865,8 @@ public:
         MCC_MAXFLOW        =  0, ///< Apply an iterated nax-flow method
         MCC_PREFLOW_FIFO   =  1, ///< Apply a FIFO push & relabel method
         MCC_PREFLOW_HIGH   =  2, ///< Apply a highest order push & relabel method
-        MCC_IDENTIFICATION =  3  ///< Apply a node identification method
+        MCC_IDENTIFICATION =  3, ///< Apply a node identification method
+        MCC_STOER_WAGNER   =  4  ///< Apply the contraction-free Stoer-Wagner method with Nagamochi-Ibaraki contractions
     };
 
     /// \brief  Compute a global minimum edge cut
@@ -2658,8 +2904,9 @@ public:
     /// \return  The strong connectivity number (the minimum number of separating nodes)
     ///
     /// Provided that all node demands are 1 or that mode==0, this determines a
-    /// minimum node cut as in the standard terminology.
-    /// by splitting the nodes and computing maximum st-flows for all node pairs.
+    /// minimum node cut as in the standard terminology, by splitting the nodes
+    /// and computing maximum st-flows for node pairs. The pair selection and
+    /// the concurrent evaluation are as for NodeConnectivity().
     /// The optimal node cut is exported by the node colour register where colour
     /// indices are interpreted as follows:
     /// - 0: Cut nodes
@@ -2692,6 +2939,19 @@ public:
 
 private:
 
+    /// \brief  Compute a minimum node cut for the unspecified node pairs
+    ///
+    /// \param G        A split graph of this graph
+    /// \param options  The #TOptNodeSplitting value by which G has been constructed
+    /// \param timer    The timer to which the bounds are reported
+    /// \return         The minimum cut capacity, or InfFloat if all node pairs are adjacent
+    ///
+    /// This evaluates the Esfahanian-Hakimi node pairs if G.NodeCutsOnly() holds
+    /// and MCC_ALL_PAIRS is not set. Otherwise, all non-adjacent node pairs are
+    /// evaluated row by row. The optimal node cut is exported by the node colour
+    /// register as in NodeConnectivity().
+    TCap  MCC_NodeSplittingPairs(nodeSplitting& G,TOption options,TTimer timer) throw();
+
     /// \brief  Compute a global minimum edge cut in the directed sense
     ///
     /// \return  The strong edge connectivity number (the minimum number of separation edges)
@@ -2762,6 +3022,24 @@ private:
     /// - 1: Right-hand nodes
     TCap  MCC_NodeIdentification() throw(ERRejected);
 
+    /// \brief  Compute a global minimum edge cut by logical node identification
+    ///
+    /// \return  The edge connectivity number (the capacity in a minimum edge cut)
+    ///
+    /// Other than MCC_NodeIdentification(), this neither copies the graph nor
+    /// contracts any arcs. Identified nodes are merged in a disjoint set family,
+    /// and every phase computes a maximum adjacency ordering of the node sets by
+    /// scanning the incidence lists of all set members. A single node heap is
+    /// used for all phases.
+    ///
+    /// Following Nagamochi and Ibaraki, all node pairs whose connectivity is
+    /// shown to be at least the best known cut capacity are identified after a
+    /// phase, not only the final node pair. The best cut is tracked as a range of
+    /// the member lists, which are only concatenated, so that no node colours
+    /// need to be updated on improvements. The optimal edge cut is exported by
+    /// the node colour register as in MCC_NodeIdentification().
+    TCap  MCC_StoerWagner() throw();
+
     /// @}
 
 
@@ -3168,6 +3446,16 @@ private:
     /// \return                Either the length or reduced length label of the specified arc
     TFloat  MST_Length(TOptMST characteristic,TFloat* potential,TArc arcIndex) throw(ERRange);
 
+    /// \brief  Prim kernel for a specific incidence scanner type
+    ///
+    /// \param I               An incidence scanner object, see #genericScanner
+    /// \param method          Either #MST_PRIM or #MST_PRIM2
+    /// \param characteristic  A bit combination of #TOptMST modifiers
+    /// \param root            The root node of the arborescence
+    /// \return                The total arc length of the derived subgraph
+    template <class TScanner> TFloat  MST_Prim(const TScanner& I,TMethMST method,
+                TOptMST characteristic,TNode root) throw(ERRange,ERRejected);
+
     /// @}
 
 
@@ -3231,7 +3519,18 @@ public:
         MXF_PREFLOW_FIFO  =  2,   ///< Apply the FIFO push / relabel method
         MXF_PREFLOW_HIGH  =  3,   ///< Apply the highest label push / relabel method
         MXF_PREFLOW_SCALE =  4,   ///< Apply the excess scaling push / relabel method
-        MXF_SAP_SCALE     =  5    ///< Apply a shortest path method with scaled capacities
+        MXF_SAP_SCALE     =  5,   ///< Apply a shortest path method with scaled capacities
+        MXF_PREFLOW_PARALLEL = 6  ///< Apply the synchronous push / relabel method with #goblinController::maxThreads worker threads
+    };
+
+    /// \brief  Heuristics for the push / relabel maximum flow methods
+    ///
+    /// The values can be combined bitwise. The default is set in #goblinController::methMXFHeur
+    enum TOptMXF {
+        MXF_HEUR_NONE   = 0,  ///< Apply the plain push / relabel method
+        MXF_HEUR_GAP    = 1,  ///< Lift nodes above a gap in the distance labels
+        MXF_HEUR_GLOBAL = 2,  ///< Compute exact distance labels periodically
+        MXF_HEUR_ALL    = 3   ///< Apply both heuristics
     };
 
     /// \brief  Compute a maximum st-flow by using a default method
@@ -3344,7 +3643,8 @@ public:
         MCF_BF_SIMPLEX =  5,    ///< Apply the network simplex algorithm
         MCF_BF_LINEAR  =  6,    ///< Solve by transformation to a linear program
         MCF_BF_CAPA    =  7,    ///< Apply a capacity scaling method
-        MCF_BF_PHASE1  =  8     ///< Stop after an admissible b-flow has been found
+        MCF_BF_PHASE1  =  8,    ///< Stop after an admissible b-flow has been found
+        MCF_BF_ENHANCED = 9     ///< Apply the cost scaling method with look-ahead, price refinement, global updates and arc fixing
     };
 
     /// \brief  Compute a minimum cost st-flow by using the specified method
@@ -3628,7 +3928,9 @@ protected:
     /// \return      The length of the final tour
     ///
     /// This takes a given tour and applies the procedures TSP_NodeExchange() and
-    /// TSP_2Exchange() until no further improvement is achieved.
+    /// TSP_2Exchange() until no further improvement is achieved. For undirected
+    /// graphs and CT.methLocal==#LOCAL_LIN_KERNIGHAN, TSP_LinKernighan() is
+    /// applied instead.
     TFloat  TSP_LocalSearch(TArc* pred) throw(ERRejected);
 
     /// \brief  Refine a given tour by a node exchange step
@@ -0,0 +1,110 @@
+
+//  This file forms part of the GOBLIN C++ Class Library.
+//
+//  Initially written by the GOBLIN developers, October 2026
+//
+//  Copying, compiling, distribution and modification
+//  of this source code is permitted only in accordance
+//  with the GOBLIN general licence information.
+
+/// \file   adjacencyIndex.h
+/// \brief  #adjacencyIndex class interface
+
+#ifndef _ADJACENCY_INDEX_H_
+#define _ADJACENCY_INDEX_H_
+
+#include "abstractMixedGraph.h"
+
+
+/// \brief  A node-node adjacency index based on sorted neighbour lists
+///
+/// For every graph node u, this stores the arcs with start node u, ordered by
+/// the end nodes and, for parallel arcs, by the arc indices. The end nodes and
+/// the arc indices are kept in separate arrays so that a node pair u,v is
+/// looked up by a binary search on the neighbour list of u. Other than a hash
+/// table keyed by u*n+v, the memory usage is proportional to the number of arcs,
+/// and the key range does not depend on the number of nodes.
+///
+/// Objects of this class are generated by abstractMixedGraph::Adjacency() and
+/// are maintained by MarkAdjacency() and UnmarkAdjacency() when arcs are
+/// inserted, cancelled or re-routed.
+
+class adjacencyIndex : public virtual managedObject
+{
+private:
+
+    TNode       n;          ///< Number of graph nodes
+    TArc*       degree;     ///< Number of list entries for every node
+    TArc*       capacity;   ///< Allocated list length for every node
+    TNode**     neighbour;  ///< Sorted end node lists
+    TArc**      arc;        ///< Arc indices, parallel to the end node lists
+
+    /// \brief  Find the position of a list entry
+    ///
+    /// \param u  The node whose list is searched
+    /// \param v  An end node index
+    /// \param a  An arc index
+    /// \return   The first position in the list of u whose entry is not smaller than (v,a)
+    TArc  LowerBound(TNode u,TNode v,TArc a) const throw();
+
+public:
+
+    /// \brief  Index all arcs of a given graph
+    ///
+    /// \param G  The graph to be indexed
+    ///
+    /// This takes O(n+m) time by a two-pass bucket sort. Cancelled arcs are
+    /// not indexed.
+    adjacencyIndex(const abstractMixedGraph& G) throw();
+    ~adjacencyIndex() throw();
+
+    unsigned long  Size() const throw();
+    unsigned long  Allocated() const throw();
+
+    /// \brief  Query the number of indexed nodes
+    inline TNode  N() const throw() {return n;};
+
+    /// \brief  Add an isolated node with index n
+    void  AppendNode() throw();
+
+    /// \brief  Add an arc to the list of its start node
+    ///
+    /// \param u  The start node of a
+    /// \param v  The end node of a
+    /// \param a  An arc index
+    void  Insert(TNode u,TNode v,TArc a) throw();
+
+    /// \brief  Remove an arc from the list of its start node
+    ///
+    /// \param u  The start node of a
+    /// \param v  The end node of a
+    /// \param a  An arc index. If a is not in the list, nothing happens
+    void  Delete(TNode u,TNode v,TArc a) throw();
+
+    /// \brief  Remove all arcs with a given start node and a given end node
+    void  DeleteAll(TNode u,TNode v) throw();
+
+    /// \brief  Find the first list entry for a node pair
+    ///
+    /// \param u  A start node index
+    /// \param v  An end node index
+    /// \return   The position of the arc with start node u, end node v and the
+    ///           least index, or NoArc if there is no such arc
+    ///
+    /// This takes O(log deg(u)) time. All arcs connecting u and v are stored in
+    /// the consecutive positions where Neighbour(u,k)==v.
+    TArc  First(TNode u,TNode v) const throw();
+
+    /// \brief  Query the length of the list of a node
+    inline TArc  Degree(TNode u) const throw() {return degree[u];};
+
+    /// \brief  Query the end node of a list entry
+    inline TNode  Neighbour(TNode u,TArc k) const throw() {return neighbour[u][k];};
+
+    /// \brief  Query the arc index of a list entry
+    inline TArc  Arc(TNode u,TArc k) const throw() {return arc[u][k];};
+
+};
+
+
+#endif
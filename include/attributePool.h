@@ -18,6 +18,7 @@
 #include "attribute.h"
 #include "fileImport.h"
 #include "fileExport.h"
+#include "fileBinary.h"
 
 
 /// \brief A class for graph attribute management
@@ -81,6 +82,22 @@ public:
     /// \brief Write all pool data to file
     void WritePool(const goblinRootObject&,goblinExport&,const char*) const throw();
 
+    /// \brief Restore all pool attributes from a binary file
+    ///
+    /// \param X     The data object to which the attributes belong
+    /// \param F     A mapped binary file
+    /// \param pool  The TBinaryPool value which identifies this pool in F
+    ///
+    /// The attribute values are copied from the mapped file without any
+    /// conversion. Blocks for special tokens are left to the owning object
+    void ReadBinary(goblinRootObject& X,const goblinBinaryImport& F,unsigned short pool) throw();
+
+    /// \brief Write all non-special pool attributes to a binary file
+    ///
+    /// \param F     An export object in binary mode
+    /// \param pool  The TBinaryPool value which identifies this pool
+    void WriteBinary(goblinExport& F,unsigned short pool) const throw();
+
     /// \brief Allocate a new attribute and add it to the pool
     /// \param X              The data object to which the attributes belong
     /// \param _token         The index of the attribute in the pool table
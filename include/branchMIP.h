@@ -48,9 +48,9 @@ public:
     unsigned long   Size() const throw();
     unsigned long   Allocated() const throw();
 
-    TNode           SelectVariable() throw();        // Select variable to branch with
-    TBranchDir      DirectionConstructive(TArc) throw(ERRange);
-    TBranchDir      DirectionExhaustive(TArc) throw(ERRange);
+    TVar            SelectVariable() throw();        // Select variable to branch with
+    TBranchDir      DirectionConstructive(TVar) throw(ERRange);
+    TBranchDir      DirectionExhaustive(TVar) throw(ERRange);
                         // Select branching direction
 
     branchNode<TVar,TFloat>* Clone() throw();      // Generate a copy of the branch node
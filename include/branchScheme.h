@@ -15,6 +15,8 @@
 
 #include "sparseDigraph.h"
 
+#include <pthread.h>
+
 
 template <class TIndex,class TObj>
 class branchScheme;
@@ -167,9 +169,38 @@ private:
     diGraph*        Tree;       // Branch tree (for tracing)
     THandle         LH;         // Handle for compound log entries
 
+    double          progressEstimate;   // Filtered progress counter
+
+    // Parallel node evaluation
+
+    unsigned        nThreads;   // Number of worker threads
+    pthread_mutex_t schemeLock; // Protects the branch scheme and the context
+    pthread_cond_t  poolChanged;// Signals when nodes are queued or workers exit
+    TIndex          nBusy;      // Number of branch nodes which are evaluated
+    char*           busy;       // Marks the workers which evaluate a branch node
+    TObj*           busyBound;  // Objective values of the evaluated branch nodes
+    bool            finished;   // Tells the worker threads to exit
+
+    struct TWorkerArg
+    {
+        branchScheme<TIndex,TObj>*  S;
+        unsigned                    id;
+    };
+
+    /// \brief  Thread entry point
+    ///
+    /// \param arg  A pointer to a #TWorkerArg structure
+    static void* WorkerEntry(void* arg) throw();
+
+    void    Worker(unsigned id) throw();
+    TObj    GlobalBound() const throw();
+    void    ReportProgress() throw();
+
 protected:
 
     void Optimize() throw();
+    void OptimizeParallel() throw();
+    bool Proceed(TObj) throw();
     bool Inspect(branchNode<TIndex,TObj>*) throw();
     branchNode<TIndex,TObj>* SelectActiveNode() throw();
     void QueueExploredNode(branchNode<TIndex,TObj>*) throw();
@@ -194,6 +225,12 @@ public:
 
     TSearchLevel level;
 
+    /// \brief  Evaluation of branch nodes
+    enum TMethBranch {
+        BRANCH_SEQUENTIAL = 0, ///< Evaluate one branch node at a time
+        BRANCH_PARALLEL   = 1  ///< Evaluate branch nodes concurrently by #goblinController::NumThreads() threads
+    };
+
     TFloat  sign;           // Object sense imported from the root node
     TObj    savedObjective;
     TObj    bestBound;
@@ -213,6 +250,19 @@ public:
     /// \brief  Query the current search state
     TSearchState SearchState() throw();
 
+    /// \brief  Query the search progress from a branch node relaxation
+    ///
+    /// \param thisIterations  Returns the number of evaluated subproblems
+    /// \param thisState       Returns the current search state
+    /// \param thisObjective   Returns the objective value of the incumbent
+    ///
+    /// During parallel node evaluation, the relaxations run concurrently with
+    /// the scheme updates. Then the values are read while holding the scheme
+    /// lock, so that they are consistent. The relaxations must not access the
+    /// respective data members directly
+    void    Snapshot(TIndex& thisIterations,TSearchState& thisState,
+                TObj& thisObjective) throw();
+
     unsigned long   Size() const throw();
     unsigned long   Allocated() const throw();
 
@@ -22,10 +22,13 @@
 
 
 /* (1) Alternative Sizes of Node/Arc Indices   */
+/*     _INDEX_32_ selects 32-bit node and arc  */
+/*     indices and overrides _BIG_NODES_       */
 
 //  #define _SMALL_NODES_
 //  #define _BIG_ARCS_
     #define _BIG_NODES_
+//  #define _INDEX_32_
 
 
 /* (2) Optional Writing of Logging Information */
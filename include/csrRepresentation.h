@@ -0,0 +1,134 @@
+
+//  This file forms part of the GOBLIN C++ Class Library.
+//
+//  Initially written by the GOBLIN developers, October 2026
+//
+//  Copying, compiling, distribution and modification
+//  of this source code is permitted only in accordance
+//  with the GOBLIN general licence information.
+
+/// \file   csrRepresentation.h
+/// \brief  #csrRepresentation class interface
+
+#ifndef _CSR_REPRESENTATION_H_
+#define _CSR_REPRESENTATION_H_
+
+#include "abstractMixedGraph.h"
+
+
+/// \brief  A frozen, compressed sparse row copy of the node incidences
+///
+/// This packs the incidence list of every graph node into a contiguous range
+/// of slots [First(v),..,Stop(v)-1]. With every slot, the arc index, the end
+/// node, the arc length and the capacity and orientation status are stored
+/// so that graph search methods can stream memory instead of following the
+/// circular right-hand incidence lists. The slot order matches the order of
+/// the incidence lists at the time when the object is generated.
+///
+/// Objects of this class are generated by abstractMixedGraph::Freeze() and
+/// are discarded with any manipulation of the graph skeleton, the length
+/// labels, the capacity bounds or the arc orientations.
+
+class csrRepresentation : public virtual managedObject
+{
+private:
+
+    TNode       n;      ///< Number of graph nodes
+    TArc        nSlots; ///< Number of slots, the number of arcs counted twice
+
+    TArc*       offset; ///< Slot ranges [offset[v],offset[v+1]) for every node v
+    TArc*       arc;    ///< Arc indices
+    TNode*      head;   ///< End node indices
+    TFloat*     length; ///< Arc length labels
+    char*       status; ///< Combination of TSlotStatus flags
+    bool        integralLengths; ///< All length labels are non-negative integers
+    TFloat      maxLength;       ///< The maximum length label
+    TFloat      metricLengthRatio; ///< See abstractMixedGraph::MetricLengthRatio()
+
+public:
+
+    /// \brief  Flags which are stored with every slot
+    enum TSlotStatus {
+        SLOT_CAPACITY = 1, ///< The arc has a positive upper capacity bound
+        SLOT_BLOCKING = 2, ///< The arc is a backward arc of a directed edge
+        SLOT_REVERSE_BLOCKING = 4 ///< The reverse arc is a backward arc of a directed edge
+    };
+
+    /// \brief  Pack the incidence lists of a given graph
+    ///
+    /// \param G  The graph object to be frozen
+    csrRepresentation(const abstractMixedGraph& G) throw();
+    ~csrRepresentation() throw();
+
+    unsigned long  Size() const throw();
+    unsigned long  Allocated() const throw();
+
+    /// \brief  Query the number of graph nodes
+    inline TNode  N() const throw() {return n;};
+
+    /// \brief  Query the total number of slots
+    inline TArc  NSlots() const throw() {return nSlots;};
+
+    /// \brief  Check if all length labels are non-negative integers
+    inline bool  IntegralLengths() const throw() {return integralLengths;};
+
+    /// \brief  Query the maximum length label
+    inline TFloat  MaxLength() const throw() {return maxLength;};
+
+    /// \brief  Query the scaling factor for geometric distance estimates
+    inline TFloat  MetricLengthRatio() const throw() {return metricLengthRatio;};
+
+    /// \brief  Retrieve the first slot of a node incidence list
+    ///
+    /// \param v  A node index ranged [0,1,..,n-1]
+    /// \return   The slot index of the first incidence of v
+    inline TArc  First(TNode v) const throw() {return offset[v];};
+
+    /// \brief  Retrieve the slot right after a node incidence list
+    ///
+    /// \param v  A node index ranged [0,1,..,n-1]
+    /// \return   The slot index following the last incidence of v
+    inline TArc  Stop(TNode v) const throw() {return offset[v+1];};
+
+    /// \brief  Retrieve the arc index stored in a slot
+    ///
+    /// \param k  A slot index ranged [0,1,..,2m-1]
+    /// \return   An arc index ranged [0,1,..,2m-1]
+    inline TArc  Arc(TArc k) const throw() {return arc[k];};
+
+    /// \brief  Retrieve the end node of the arc stored in a slot
+    ///
+    /// \param k  A slot index ranged [0,1,..,2m-1]
+    /// \return   A node index ranged [0,1,..,n-1]
+    inline TNode  EndNode(TArc k) const throw() {return head[k];};
+
+    /// \brief  Retrieve the length of the arc stored in a slot
+    ///
+    /// \param k  A slot index ranged [0,1,..,2m-1]
+    /// \return   The length label at the time of freezing
+    inline TFloat  Length(TArc k) const throw() {return length[k];};
+
+    /// \brief  Check if the arc stored in a slot has a positive capacity
+    ///
+    /// \param k      A slot index ranged [0,1,..,2m-1]
+    /// \retval true  The upper capacity bound is positive
+    inline bool  Capacitated(TArc k) const throw() {return status[k] & SLOT_CAPACITY;};
+
+    /// \brief  Check if the arc stored in a slot can be traversed in a plain search
+    ///
+    /// \param k      A slot index ranged [0,1,..,2m-1]
+    /// \retval true  The arc is non-blocking and has a positive capacity
+    inline bool  PlainEligible(TArc k) const throw()
+        {return (status[k] & (SLOT_CAPACITY|SLOT_BLOCKING))==SLOT_CAPACITY;};
+
+    /// \brief  Check if the reverse of the arc stored in a slot can be traversed in a plain search
+    ///
+    /// \param k      A slot index ranged [0,1,..,2m-1]
+    /// \retval true  The reverse arc is non-blocking and has a positive capacity
+    inline bool  ReversePlainEligible(TArc k) const throw()
+        {return (status[k] & (SLOT_CAPACITY|SLOT_REVERSE_BLOCKING))==SLOT_CAPACITY;};
+
+};
+
+
+#endif
@@ -0,0 +1,78 @@
+
+//  This file forms part of the GOBLIN C++ Class Library.
+//
+//  Initially written by the GOBLIN developers, October 2026
+//
+//  Copying, compiling, distribution and modification
+//  of this source code is permitted only in accordance
+//  with the GOBLIN general licence information.
+
+/// \file   dAryHeap.h
+/// \brief  #dAryHeap class interface
+
+#ifndef _D_ARY_HEAP_H_
+#define _D_ARY_HEAP_H_
+
+#include "goblinQueue.h"
+
+
+/// \addtogroup priorityQueues
+/// @{
+
+/// \brief Implementation of a priority queue using a d-ary tree
+///
+/// Other than binary heaps, the tree is stored in a zero-based array, and
+/// the d children of a tree node are stored consecutively. For d=4, the
+/// children of every tree node share a cache line in most cases, and the
+/// trees are only half as deep as binary heaps.
+
+template <class TItem,class TKey>
+class dAryHeap : public goblinQueue<TItem,TKey>
+{
+private:
+
+    TItem*          v;
+    TItem*          index;
+    TKey*           key;
+
+    TItem           maxIndex;
+    TItem           n;
+    TItem           d;
+    TItem           UITEM_MAX() const throw() {return TItem(-1);};
+
+public:
+
+    /// \brief  Constructor for d-ary heaps
+    ///
+    /// \param nn           The maximum number of queue elements
+    /// \param thisContext  The context to which this object is attached
+    /// \param dd           The number of children of every tree node
+    dAryHeap(TItem nn,goblinController &thisContext,TItem dd = 4) throw();
+    ~dAryHeap() throw();
+
+    void            Init() throw();
+    unsigned long   Size() const throw();
+    unsigned long   Allocated() const throw();
+    char*           Display() const throw();
+
+private:
+
+    void            UpHeap(TItem i) throw();
+    void            DownHeap(TItem i) throw();
+
+public:
+
+    void            Insert(TItem w,TKey alpha) throw(ERRange,ERRejected);
+    TItem           Delete() throw(ERRejected);
+    void            Delete(TItem w) throw(ERRange);
+    TKey            Key(TItem w) const throw(ERRange);
+    void            ChangeKey(TItem w,TKey alpha) throw(ERRange);
+    TItem           Peek() const throw(ERRejected);
+    bool            Empty() const throw() {return (maxIndex==0);};
+    TItem           Cardinality() const throw() {return maxIndex;};
+
+};
+
+/// @}
+
+#endif
@@ -0,0 +1,136 @@
+
+//  This file forms part of the GOBLIN C++ Class Library.
+//
+//  Initially written by the GOBLIN developers, October 2026
+//
+//  Copying, compiling, distribution and modification
+//  of this source code is permitted only in accordance
+//  with the GOBLIN general licence information.
+
+/// \file   depthFirstSearch.h
+/// \brief  #depthFirstSearch class interface
+
+#ifndef _DEPTH_FIRST_SEARCH_H_
+#define _DEPTH_FIRST_SEARCH_H_
+
+#include "abstractMixedGraph.h"
+#include "staticStack.h"
+
+
+/// \brief  A non-recursive depth first search engine
+///
+/// The current search path is kept by a #staticStack, and the incidence lists
+/// are traversed by a graph investigator. So the memory usage is fixed by the
+/// number of nodes when the object is instanciated, and the search depth is not
+/// limited by the size of the program stack.
+///
+/// Derived classes customize the search by overloading the callback methods:
+/// PreVisit() is called when a node is reached for the first time, PostVisit()
+/// when a node is left for the last time, and NonTreeArc() for every eligible
+/// arc which ends at a node reached before. The latter includes the reverse
+/// arcs of the tree arcs. Eligible() restricts the set of traversed arcs. The
+/// incidences of every node are traversed in the order of the investigator, that
+/// is, in the order of the incidence lists for sparse graphs.
+
+class depthFirstSearch : public managedObject
+{
+protected:
+
+    const abstractMixedGraph &G;    ///< The graph to be searched
+
+    TNode       n;          ///< Number of graph nodes
+    THandle     H;          ///< Handle of the investigator
+    investigator*  I;       ///< Investigator for the incidence lists
+
+    staticStack<TNode,TFloat>  S;   ///< The current search path
+
+    TArc*       treeArc;    ///< Arcs by which the nodes have been reached
+    TNode*      preOrder;   ///< Preorder numbers, NoNode for unreached nodes
+    TNode*      postOrder;  ///< Postorder numbers, NoNode for unfinished nodes
+
+    TNode       nPre;       ///< Number of reached nodes
+    TNode       nPost;      ///< Number of finished nodes
+
+public:
+
+    /// \brief  Constructor for depth first search engines
+    ///
+    /// \param GC  The graph to be searched
+    depthFirstSearch(const abstractMixedGraph& GC) throw();
+    virtual ~depthFirstSearch() throw();
+
+    unsigned long   Size() const throw();
+    unsigned long   Allocated() const throw();
+
+    /// \brief  Search the nodes reachable from a given root node
+    ///
+    /// \param r  The root node
+    /// \return   The number of newly reached nodes, which is zero if r has been
+    ///           reached in a previous search
+    TNode           Search(TNode r) throw(ERRange);
+
+    /// \brief  Search all graph nodes
+    ///
+    /// \return  The number of search trees
+    ///
+    /// This starts a new search tree at every node which has not been reached
+    /// by the previous searches, in the order of increasing node indices
+    TNode           SearchAll() throw();
+
+    /// \brief  Discard all search results
+    void            Reset() throw();
+
+    /// \brief  Check if a node has been reached
+    inline bool     Reached(TNode v) const throw() {return preOrder[v]!=NoNode;};
+
+    /// \brief  Check if a node is on the current search path
+    ///
+    /// During a search, the nodes on the search path are exactly the nodes
+    /// which have been reached but not finished.
+    inline bool     OnPath(TNode v) const throw() {return S.IsMember(v);};
+
+    /// \brief  Query the arc by which a node has been reached
+    ///
+    /// \return  The tree arc ending at v, or NoArc for the root nodes and the unreached nodes
+    inline TArc     TreeArc(TNode v) const throw() {return treeArc[v];};
+
+    /// \brief  Query the preorder number of a node
+    ///
+    /// \return  The number of nodes reached before v, or NoNode if v has not been reached
+    inline TNode    PreOrder(TNode v) const throw() {return preOrder[v];};
+
+    /// \brief  Query the postorder number of a node
+    ///
+    /// \return  The number of nodes finished before v, or NoNode if v has not been finished
+    inline TNode    PostOrder(TNode v) const throw() {return postOrder[v];};
+
+protected:
+
+    /// \brief  Check if an arc is traversed by the search
+    ///
+    /// The default implementation accepts all arcs
+    virtual bool    Eligible(TArc a) throw() {return true;};
+
+    /// \brief  Callback for reaching a node
+    ///
+    /// \param v  The reached node
+    /// \param a  The tree arc ending at v, or NoArc if v is a root node
+    virtual void    PreVisit(TNode v,TArc a) throw() {};
+
+    /// \brief  Callback for finishing a node
+    ///
+    /// \param v  The finished node. All descendants of v are already finished
+    /// \param a  The tree arc ending at v, or NoArc if v is a root node
+    virtual void    PostVisit(TNode v,TArc a) throw() {};
+
+    /// \brief  Callback for eligible arcs which end at previously reached nodes
+    ///
+    /// \param a  An eligible arc which does not lead to a new node. Backward arcs
+    ///           are recognized by OnPath(EndNode(a)), and forward or cross arcs by
+    ///           comparing the preorder numbers of the end nodes
+    virtual void    NonTreeArc(TArc a) throw() {};
+
+};
+
+
+#endif
@@ -0,0 +1,149 @@
+
+//  This file forms part of the GOBLIN C++ Class Library.
+//
+//  Initially written by the GOBLIN developers, October 2026
+//
+//  Copying, compiling, distribution and modification
+//  of this source code is permitted only in accordance
+//  with the GOBLIN general licence information.
+
+/// \file   fileBinary.h
+/// \brief  Binary graph file layout and the #goblinBinaryImport class interface
+
+#ifndef _FILE_BINARY_H_
+#define _FILE_BINARY_H_
+
+#include "goblinController.h"
+
+
+/// \addtogroup groupObjectImport
+/// @{
+
+/// \brief  Version of the binary file layout written by this library
+const unsigned short BinaryFormatVersion = 2;
+
+/// \brief  Leading bytes of every binary graph file
+extern const char BinaryFormatMagic[8];
+
+
+/// \brief  Attribute pools which can be referenced by binary data blocks
+enum TBinaryPool {
+    BIN_POOL_END            = 0, ///< Marks the end of the block list
+    BIN_POOL_REPRESENTATION = 1, ///< Tokens refer to listOfReprPars[]
+    BIN_POOL_GEOMETRY       = 2, ///< Tokens refer to listOfGeometryPars[]
+    BIN_POOL_LAYOUT         = 3, ///< Tokens refer to listOfLayoutPars[]
+    BIN_POOL_REGISTERS      = 4, ///< Tokens refer to listOfRegisters[]
+    BIN_POOL_CONFIGURATION  = 5  ///< A single block with token 0 holding the context parameters
+};
+
+
+/// \brief  Leading record of a binary graph file
+///
+/// The type sizes and the byte order mark are compared with the reading
+/// library. Files are not portable between different index type profiles.
+struct TBinaryFileHeader
+{
+    char            magic[8];       ///< BinaryFormatMagic
+    unsigned short  version;        ///< BinaryFormatVersion
+    unsigned short  byteOrder;      ///< 0x0102 in the byte order of the writer
+    unsigned char   typeSize[8];    ///< Sizes of TNode, TArc, TFloat, TCap, TIndex, TVar, TRestr, unsigned long
+    char            objectClass[16];///< Class label as in the native text format
+    unsigned long   n;              ///< Number of graph nodes
+    unsigned long   n1;             ///< Number of left-hand nodes, or n for non-bipartite graphs
+    unsigned long   ni;             ///< Number of layout points
+    unsigned long   m;              ///< Number of arcs
+    unsigned long   source;         ///< Default source node
+    unsigned long   target;         ///< Default target node
+    unsigned long   root;           ///< Default root node
+};
+
+
+/// \brief  Leading record of a binary data block
+///
+/// Every data block is an array of length items of the given base type. It
+/// is followed by the next block header, at the next offset which is a
+/// multiple of 8. Boolean values are stored as single bytes. String blocks
+/// are sequences of zero terminated character strings, with one item per
+/// character.
+struct TBinaryBlockHeader
+{
+    unsigned short  pool;           ///< A TBinaryPool value
+    unsigned short  token;          ///< An index in the pool table
+    unsigned char   baseType;       ///< A TBaseType value
+    unsigned char   itemSize;       ///< Number of bytes per item
+    unsigned short  reserved;
+    unsigned long   length;         ///< Number of items
+    char            defaultValue[8];///< Value applying to the non-represented indices
+};
+
+
+/// \brief  Class for reading data objects from memory mapped binary files
+///
+/// The constructor maps the whole file into the address space and checks
+/// the header and the block boundaries. No values are parsed or converted,
+/// so that the data blocks can be copied directly into the graph objects.
+
+class goblinBinaryImport : public goblinRootObject
+{
+private:
+
+    goblinController&           CT;
+    int                         fileDescriptor;
+    size_t                      fileSize;
+    const char*                 image;      ///< The mapped file contents
+    const TBinaryBlockHeader**  block;      ///< Block headers in the order of the file
+    unsigned long               nBlocks;    ///< Number of data blocks
+
+    void            Release() throw();
+    void            Reject(const char* reason) throw(ERParse);
+
+public:
+
+    goblinBinaryImport(const char* impFileName,goblinController& = goblinDefaultContext)
+        throw(ERFile,ERParse);
+    ~goblinBinaryImport() throw();
+
+    char*           Display() const throw() {return NULL;};
+    const char*     Label() const throw() {return NULL;};
+    unsigned long   Size() const throw() {return 0;};
+
+    /// \brief  Check if a file starts with the binary format magic
+    static bool     IsBinaryFile(const char* fileName) throw();
+
+    /// \brief  Query the number of bytes per item for a given base type
+    ///
+    /// \return  The item size, or zero for special attributes
+    static size_t   ItemSize(TBaseType baseType) throw();
+
+    const TBinaryFileHeader&  Header() const throw()
+        {return *reinterpret_cast<const TBinaryFileHeader*>(image);};
+
+    /// \brief  Check the object class recorded in the file header
+    void            CheckObjectClass(const char* objectClass) throw(ERParse);
+
+    unsigned long   NumBlocks() const throw() {return nBlocks;};
+    const TBinaryBlockHeader&  Block(unsigned long i) const throw() {return *block[i];};
+
+    /// \brief  Export the item array of a data block
+    const void*     Data(unsigned long i) const throw()
+        {return reinterpret_cast<const char*>(block[i])+sizeof(TBinaryBlockHeader);};
+
+    /// \brief  Lookup for a data block
+    ///
+    /// \param pool   A TBinaryPool value
+    /// \param token  An index in the pool table
+    /// \return       The block index, or nBlocks if there is no such block
+    unsigned long   FindBlock(unsigned short pool,unsigned short token) const throw();
+
+    /// \brief  Apply the context parameters stored in the file
+    ///
+    /// The parameter list is passed to goblinController::Configure() as
+    /// in the native text format. Files of format version 1 do not hold
+    /// any context parameters.
+    void            ReadConfiguration() const throw();
+
+};
+
+/// @}
+
+#endif
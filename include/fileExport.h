@@ -28,13 +28,21 @@ private:
     char                currentLevel;
     char                currentPos;
     char                currentType;
+    bool                binaryMode;
     ofstream            expFile;
     goblinController&   CT;
 
 public:
 
+    /// \brief  Output file formats
+    enum TExportMode {
+        EXP_TEXT   = 0, ///< The native tree like text format
+        EXP_BINARY = 1  ///< The memory mappable binary format, see #goblinBinaryImport
+    };
+
     goblinExport(const char* expFileName,
-        goblinController &thisContext = goblinDefaultContext) throw(ERFile);
+        goblinController &thisContext = goblinDefaultContext,
+        TExportMode mode = EXP_TEXT) throw(ERFile);
     ~goblinExport() throw();
 
     char*           Display() const throw() {return NULL;};
@@ -51,8 +59,48 @@ public:
     template <typename T> void MakeItem(T value,char length) throw();
     void    MakeNoItem(char length) throw();
 
+    /// \brief  Write a sequence of items to the current tuple
+    ///
+    /// \param array      The item values
+    /// \param size       The number of items
+    /// \param undefined  The value which is written as "*"
+    /// \param length     The field width
+    ///
+    /// This is equivalent with calling MakeItem() or MakeNoItem() for every
+    /// array entry. Long numeric arrays are formatted concurrently by up to
+    /// goblinController::NumThreads() threads into memory buffers, and the
+    /// buffers are written in the original order.
+    template <typename T> void MakeItems(const T* array,size_t size,T undefined,char length) throw();
+
     template <typename T> void WriteAttribute(T*,const char*,size_t,T) throw();
 
+    /// \brief  Write the leading record of a binary file
+    ///
+    /// \param objectClass  The class label as in the native text format
+    /// \param n            The number of graph nodes
+    /// \param n1           The number of left-hand nodes
+    /// \param ni           The number of layout points
+    /// \param m            The number of arcs
+    /// \param source       The default source node
+    /// \param target       The default target node
+    /// \param root         The default root node
+    void    WriteBinaryHeader(const char* objectClass,TNode n,TNode n1,TNode ni,TArc m,
+                TNode source,TNode target,TNode root) throw();
+
+    /// \brief  Write a data block to a binary file
+    ///
+    /// \param pool          A TBinaryPool value
+    /// \param token         An index in the pool table
+    /// \param baseType      The type of the items
+    /// \param length        The number of items
+    /// \param data          The item array. This may be NULL if length==0
+    /// \param defaultValue  A pointer to a single item
+    void    WriteBinaryBlock(unsigned short pool,unsigned short token,TBaseType baseType,
+                unsigned long length,const void* data,const void* defaultValue) throw();
+
+    /// \brief  Write the closing record of a binary file
+    void    WriteBinaryEnd() throw();
+
     enum    TConfig {CONF_DIFF=0,CONF_FULL=1};
 
     void    WriteConfiguration(const goblinRootObject*) throw();
@@ -40,6 +40,20 @@ private:
     TArc            m;
     TNode           ni;
 
+    /// \brief  Read the values of a long numeric tuple
+    ///
+    /// \param arrayType  The value type
+    /// \param reqLength  The required number of values
+    /// \param _array     The destination array
+    ///
+    /// The tuple text is read up to the closing parenthesis in a single
+    /// operation, split into chunks at white space positions, and the chunks
+    /// are converted concurrently by up to goblinController::NumThreads()
+    /// threads. The result is the same as for the token-wise conversion
+    /// in ReadTupleValues().
+    void            ReadLongTuple(TBaseType arrayType,size_t reqLength,void* _array)
+                        throw(ERParse);
+
 public:
 
     goblinImport(const char*,goblinController& = goblinDefaultContext) throw(ERFile);
@@ -47,7 +47,11 @@ using namespace std;
 
 // Basic Types
 
-#if defined(_BIG_NODES_)
+#if defined(_INDEX_32_)
+
+typedef unsigned int    TNode;
+
+#elif defined(_BIG_NODES_)
 
 typedef unsigned long   TNode;
 
@@ -62,6 +66,10 @@ typedef unsigned short  TNode;
 
 typedef unsigned short  TArc;
 
+#elif defined(_INDEX_32_)
+
+typedef unsigned int    TArc;
+
 #else
 
 typedef unsigned long   TArc;
@@ -168,7 +176,14 @@ enum TModule {
     ModLayeredFDP = 82,         ModFeedbackArcSet = 83,
     ModLayering = 84,           ModSeriesParallel = 85,
     ModStaircase = 86,          ModPlanarityHoTa = 87,
-    ModStrongConn = 88,         NoModule = 89
+    ModStrongConn = 88,         ModBidirectional = 89,
+    ModAStar = 90,              ModPushRelabelParallel = 91,
+    ModLUFactor = 92,           ModLinKernighan = 93,
+    ModBarnesHut = 94,          ModMultilevelFDP = 95,
+    ModEnhancedCostScaling = 96, ModParallelComponents = 97,
+    ModParallelStrongComp = 98, ModAuction = 99,
+    ModJonkerVolgenant = 100,
+    NoModule = 101
 };
 
 enum TAuthor {
@@ -192,7 +207,12 @@ enum TReference {
     RefKan96 = 48,      RefEad84 = 49,      RefFLM94 = 50,      RefSch03 = 51,
     RefBre79 = 52,      RefBiKa94 = 53,     RefBMT97 = 54,      RefKaWa01 = 55,
     RefRoTa86 = 56,     RefKan93 = 57,      RefVTL82 = 58,      RefFKK96 = 59,
-    RefHoTa74 = 60,     RefWil84 = 61,      RefEis06 = 62,      NoReference = 63
+    RefHoTa74 = 60,     RefWil84 = 61,      RefEis06 = 62,      RefPoh71 = 63,
+    RefHNR68 = 64,      RefAnSe95 = 65,     RefMar57 = 66,      RefLiKe73 = 67,
+    RefFJMO95 = 68,     RefBaHu86 = 69,     RefWal03 = 70,      RefHaJu05 = 71,
+    RefGol97 = 72,      RefShVi82 = 73,     RefTaVi85 = 74,     RefFHP00 = 75,
+    RefBer88 = 76,      RefJoVo87 = 77,
+    NoReference = 78
 };
 
 
@@ -454,6 +474,15 @@ extern long unsigned goblinNFragments;
 extern long unsigned goblinNAllocs;
 extern long unsigned goblinNObjects;
 
+/// \brief  Account for a new heap fragment in the global memory counters
+void GoblinHeapAcquire(size_t size) throw();
+
+/// \brief  Account for a released heap fragment in the global memory counters
+void GoblinHeapRelease(size_t size) throw();
+
+/// \brief  Account for a reallocated heap fragment in the global memory counters
+void GoblinHeapResize(size_t oldSize,size_t newSize) throw();
+
 void* GoblinRealloc(void* p,size_t size) throw (std::bad_alloc);
 
 #if defined(_HEAP_MON_GLOBAL_)
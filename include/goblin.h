@@ -26,9 +26,13 @@
 #include <abstractDigraph.h>
 #include <abstractBalanced.h>
 #include <investigator.h>
+#include <csrRepresentation.h>
+#include <adjacencyIndex.h>
+#include <incidenceScanner.h>
 
 #include <fileImport.h>
 #include <fileExport.h>
+#include <fileBinary.h>
 
 #include <graphRepresentation.h>
 #include <sparseRepresentation.h>
@@ -49,6 +53,10 @@
 #include <bigraphToDigraph.h>
 #include <surfaceGraph.h>
 #include <auxiliaryNetwork.h>
+#include <parallelPushRelabel.h>
+#include <parallelAuction.h>
+#include <parallelComponents.h>
+#include <depthFirstSearch.h>
 #include <shrinkingNetwork.h>
 
 #include <goblinQueue.h>
@@ -61,8 +69,12 @@
 #include <basicHeap.h>
 #include <binaryHeap.h>
 #include <fibonacciHeap.h>
+#include <dAryHeap.h>
+#include <radixHeap.h>
 
 #include <matrix.h>
+#include <sparseLUFactor.h>
+#include <twoLevelTour.h>
 #include <hashTable.h>
 #include <dictionary.h>
 
@@ -16,6 +16,8 @@
 #include "globals.h"
 #include "timers.h"
 
+#include <pthread.h>
+
 
 // Forward declarations
 class goblinImport;
@@ -44,8 +46,8 @@ protected:
 
 public:
 
-    goblinRootObject() : OH(THandle(0)) {goblinNObjects++;};
-    virtual ~goblinRootObject() throw(ERParse) {goblinNObjects--;};
+    goblinRootObject() : OH(THandle(0)) {__sync_add_and_fetch(&goblinNObjects,1);};
+    virtual ~goblinRootObject() throw(ERParse) {__sync_sub_and_fetch(&goblinNObjects,1);};
 
     virtual char*  Display() const throw(ERFile,ERRejected) = 0;
     virtual const char*  Label() const throw() = 0;
@@ -306,6 +308,12 @@ public:
 
     THandle (*newObjectHandler)();
 
+private:
+
+    pthread_mutex_t     objectLock;   // Serializes InsertObject() and DeleteObject()
+
+public:
+
 
     // *************************************************************** //
     //           Logging                                               //
@@ -373,7 +381,11 @@ public:
     void PlainLogEventHandler(msgType,TModule,THandle,char*) throw();
     void DefaultLogEventHandler(msgType,TModule,THandle,char*) throw();
 
-    mutable char logBuffer[LOGBUFFERSIZE];
+    /// \brief  Buffer to compose log messages
+    ///
+    /// The buffer is shared by all contexts but thread local. So log entries
+    /// can be composed concurrently in distinct threads
+    static __thread char logBuffer[LOGBUFFERSIZE];
     mutable bool compoundLogEntry;
 
 private:
@@ -475,6 +487,10 @@ public:
     /// Default method for the max-flow solver according to #abstractMixedGraph::TMethMXF
     int methMXF;
 
+    /// Heuristics applied by the push / relabel max-flow methods according to #abstractMixedGraph::TOptMXF.
+    /// No heuristics are applied by default
+    int methMXFHeur;
+
     /// Default method for the min-cut solver according to #abstractMixedGraph::TMethMCC
     int methMCC;
 
@@ -484,6 +500,10 @@ public:
     /// Default method for the min-cost flow solver according to #abstractMixedGraph::TMethMCF
     int methMCF;
     int methNWPricing;
+
+    /// Factor by which epsilon is divided in every phase of the enhanced cost scaling method and of the auction method
+    int costScalingFactor;
+
     int methMaxBalFlow;
     int methBNS;
     int methDSU;
@@ -494,6 +514,10 @@ public:
     int methPrimalDual;
     int methModLength;
     int methCandidates;
+
+    /// Method for the weighted assignment problem according to #abstractBiGraph::TMethAssignment
+    int methAssignment;
+
     int methColour;
     int methHeurTSP;
     int methRelaxTSP1;
@@ -508,6 +532,35 @@ public:
     int maxBBIterations;
     int maxBBNodes;
 
+    /// Evaluation of branch nodes according to #branchScheme::TMethBranch
+    int methBranch;
+
+    /// Method for the connected, strong and 2-connected components according to #abstractMixedGraph::TMethComponents
+    int methComponents;
+
+    /// Maximum number of worker threads for the parallel solver methods.
+    /// If this is zero, the number of online processors is used
+    int maxThreads;
+
+    /// \brief  Determine the number of worker threads for parallel solver methods
+    ///
+    /// \return  The number of worker threads, at least 1
+    unsigned  NumThreads() const throw();
+
+    /// \brief  Mark the calling thread as a worker thread of a parallel solver method
+    ///
+    /// Worker threads do not write to the logging, tracing, progress and
+    /// timer data of any context. That is, log entries, folds and timer
+    /// operations issued by a worker thread are silently ignored.
+    ///
+    /// \param isWorker  True when entering the worker code, false when leaving it
+    static void  SetWorkerThread(bool isWorker) throw();
+
+    /// \brief  Check if the calling thread is a worker thread of a parallel solver method
+    ///
+    /// \retval true  The calling thread has been marked by #SetWorkerThread()
+    static bool  WorkerThread() throw();
+
     int methFDP;
 
     /// Default plane embedding method according to #abstractMixedGraph::TMethPlanarity
@@ -553,6 +606,17 @@ public:
     TFloat          SignedRand() throw();
     void            SetRandomBounds(long int,long int) throw(ERRejected);
 
+    /// \brief  Reinitialize the random generator of this context
+    ///
+    /// Every context maintains its own random generator state. So random
+    /// instances generated in distinct contexts do not interfere, even if
+    /// the contexts are used by concurrent threads.
+    ///
+    /// \param seed  The new random seed
+    void            SetRandomSeed(unsigned seed) throw() {randSeed = seed;};
+
+    unsigned    randSeed;
+
     int     randMin;
     int     randMax;
 
@@ -606,7 +670,8 @@ public:
     enum TFileFormat {
         FMT_GOBLIN      = 0, ///< Index representing the native file format
         FMT_DIMACS_MCF  = 1, ///< Index representing the Dimacs minCostFlow format
-        FMT_DIMACS_EDGE = 2  ///< Index representing the Dimacs format for plain undirected graphs
+        FMT_DIMACS_EDGE = 2, ///< Index representing the Dimacs format for plain undirected graphs
+        FMT_GOBLIN_BINARY = 3 ///< Index representing the memory mappable binary format
     };
 
     goblinRootObject*   ImportFromFile(const char* filename, TFileFormat format) throw(ERParse);
@@ -615,6 +680,7 @@ private:
 
     goblinRootObject*   Import_DimacsMCF(const char* filename) throw(ERParse);
     goblinRootObject*   Import_DimacsEdge(const char* filename) throw(ERParse);
+    goblinRootObject*   Import_Goblin(const char* filename,TFileFormat format) throw(ERParse);
 
 };
 
@@ -276,8 +276,8 @@ public:
 
     enum TSimplexMethod {SIMPLEX_AUTO=0,SIMPLEX_PRIMAL=1,SIMPLEX_DUAL=2};
     enum TStartBasis    {START_AUTO=0,START_LRANGE=1,START_CURRENT=2};
-    enum TPricing       {VAR_PRICING=0,FIRST_FIT=1};
-    enum TQTest         {EXACT=0,MAX_ABS=1};
+    enum TPricing       {VAR_PRICING=0,FIRST_FIT=1,DEVEX=2,STEEPEST_EDGE=3};
+    enum TQTest         {EXACT=0,MAX_ABS=1,BOUND_FLIPPING=2};
 
     virtual TFloat  SolvePrimal() throw() = 0;      // Phase II
     virtual TFloat  SolveDual() throw() = 0;        // Phase II
@@ -0,0 +1,172 @@
+
+//  This file forms part of the GOBLIN C++ Class Library.
+//
+//  Initially written by the GOBLIN developers, October 2026
+//
+//  Copying, compiling, distribution and modification
+//  of this source code is permitted only in accordance
+//  with the GOBLIN general licence information.
+
+/// \file   incidenceScanner.h
+/// \brief  #genericScanner, #sparseScanner and #frozenScanner class interfaces
+
+#ifndef _INCIDENCE_SCANNER_H_
+#define _INCIDENCE_SCANNER_H_
+
+#include "sparseRepresentation.h"
+#include "csrRepresentation.h"
+
+
+/// \addtogroup investigators
+/// @{
+
+/// \brief  Incidence scanners for the template solver kernels
+///
+/// The classes in this file are not derived from a common base class, but
+/// share a common, fully inlined interface. They are passed as a template
+/// parameter to the graph search kernels so that the compiler can resolve
+/// all incidence list accesses statically:
+///
+/// \code
+/// for (TArc k=S.First(u);k!=NoArc;k=S.Next(u,k))
+/// {
+///     TArc a = S.Arc(k);
+///     TNode v = S.EndNode(k);
+///     ...
+/// }
+/// \endcode
+///
+/// The slot index k is an arc index for the #genericScanner and #sparseScanner
+/// classes, and a #csrRepresentation slot index for the #frozenScanner class.
+/// ReversePlainEligible(k) tells whether the arc Arc(k)^1 can be traversed,
+/// this is needed by backward searches.
+/// Every scanner supports only one traversal of a given incidence list at a
+/// time. This is not a limitation for the kernels which scan the incidence
+/// list of a node completely before proceeding to another node.
+
+/// \brief  Incidence scanner which is based on a managed investigator
+///
+/// This is the fallback for all graph objects without an explicit sparse
+/// representation, and for graph objects which implement their own
+/// investigator classes. Every access is still a virtual function call.
+
+class genericScanner
+{
+private:
+
+    const abstractMixedGraph&   G;
+    THandle                     H;
+    investigator&               I;
+
+public:
+
+    genericScanner(const abstractMixedGraph& _G) throw(ERRejected) :
+        G(_G), H(_G.Investigate()), I(_G.Investigator(H)) {};
+    ~genericScanner() throw() {G.Close(H);};
+
+    inline TArc  First(TNode v) const throw(ERRange,ERRejected)
+        {I.Reset(v); return (I.Active(v)) ? I.Read(v) : NoArc;};
+    inline TArc  Next(TNode v,TArc k) const throw(ERRange,ERRejected)
+        {return (I.Active(v)) ? I.Read(v) : NoArc;};
+
+    inline TArc  Arc(TArc k) const throw() {return k;};
+    inline TNode  EndNode(TArc k) const throw(ERRange) {return G.EndNode(k);};
+    inline TFloat  Length(TArc k) const throw(ERRange) {return G.Length(k);};
+    inline bool  Capacitated(TArc k) const throw(ERRange) {return G.UCap(k)>0;};
+    inline bool  PlainEligible(TArc k) const throw(ERRange)
+        {return (G.UCap(k)>0 && !G.Blocking(k));};
+    inline bool  ReversePlainEligible(TArc k) const throw(ERRange)
+        {return (G.UCap(k)>0 && !G.Blocking(k^1));};
+
+};
+
+
+/// \brief  Incidence scanner for sparse represented graph objects
+///
+/// This reads the start node indices and the right-hand incidences from the
+/// #sparseRepresentation arrays, and the length labels, capacity bounds and
+/// orientations from the respective attributes. It can be used for all graph
+/// objects for which IsSparse() holds.
+
+class sparseScanner
+{
+private:
+
+    const abstractMixedGraph&   G;
+    const TNode*                SN;
+    const TArc*                 right;
+    const TArc*                 first;
+
+    attribute<TFloat>*          pLength;
+    attribute<TCap>*            pUCap;
+    attribute<char>*            pOrientation;
+    bool                        explicitLength;
+
+public:
+
+    sparseScanner(const abstractMixedGraph& _G) throw();
+
+    inline TArc  First(TNode v) const throw() {return first[v];};
+    inline TArc  Next(TNode v,TArc k) const throw()
+        {return (right[k]==first[v]) ? NoArc : right[k];};
+
+    inline TArc  Arc(TArc k) const throw() {return k;};
+    inline TNode  EndNode(TArc k) const throw() {return SN[k^1];};
+
+    inline TFloat  Length(TArc k) const throw(ERRange)
+    {
+        if (!explicitLength) return G.Length(k);
+
+        return (pLength) ? pLength->GetValue(k>>1) : graphRepresentation::defaultLength;
+    };
+
+    inline bool  Capacitated(TArc k) const throw()
+        {return ((pUCap) ? pUCap->GetValue(k>>1) : graphRepresentation::defaultUCap)>0;};
+
+    inline bool  PlainEligible(TArc k) const throw()
+    {
+        if (!Capacitated(k)) return false;
+
+        return !((k&1) && ((pOrientation) ? pOrientation->GetValue(k>>1)
+                    : graphRepresentation::defaultOrientation));
+    };
+
+    inline bool  ReversePlainEligible(TArc k) const throw()
+        {return PlainEligible(k^1);};
+
+};
+
+
+/// \brief  Incidence scanner for frozen graph objects
+///
+/// This streams the slots of a #csrRepresentation object, as generated by
+/// abstractMixedGraph::Freeze().
+
+class frozenScanner
+{
+private:
+
+    const csrRepresentation&    X;
+
+public:
+
+    frozenScanner(const csrRepresentation& _X) throw() : X(_X) {};
+
+    inline TArc  First(TNode v) const throw()
+        {return (X.First(v)<X.Stop(v)) ? X.First(v) : NoArc;};
+    inline TArc  Next(TNode v,TArc k) const throw()
+        {return (k+1<X.Stop(v)) ? k+1 : NoArc;};
+
+    inline TArc  Arc(TArc k) const throw() {return X.Arc(k);};
+    inline TNode  EndNode(TArc k) const throw() {return X.EndNode(k);};
+    inline TFloat  Length(TArc k) const throw() {return X.Length(k);};
+    inline bool  Capacitated(TArc k) const throw() {return X.Capacitated(k);};
+    inline bool  PlainEligible(TArc k) const throw() {return X.PlainEligible(k);};
+    inline bool  ReversePlainEligible(TArc k) const throw() {return X.ReversePlainEligible(k);};
+
+};
+
+/// @}
+
+
+#endif
@@ -50,18 +50,18 @@ public:
 
             if (counter==0)
             {
-                sprintf(this->CT.logBuffer,"%ld",i);
+                sprintf(this->CT.logBuffer,"%ld",(unsigned long)i);
                 this -> LogAppend(LH,this->CT.logBuffer);
             }
             else if (counter%10==0)
             {
                 this -> LogEnd(LH,",");
-                sprintf(this->CT.logBuffer,"   %ld",i);
+                sprintf(this->CT.logBuffer,"   %ld",(unsigned long)i);
                 LH = this->LogStart(MSG_TRACE2,this->CT.logBuffer);
             }
             else
             {
-                sprintf(this->CT.logBuffer,", %ld",i);
+                sprintf(this->CT.logBuffer,", %ld",(unsigned long)i);
                 this -> LogAppend(LH,this->CT.logBuffer);
             }
 
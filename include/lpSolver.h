@@ -15,7 +15,8 @@
 #define _LP_SOLVER_H_
 
 #include "ilpWrapper.h"
-#include "matrix.h"
+#include "sparseLUFactor.h"
+#include "hashTable.h"
 #include "dictionary.h"
 
 
@@ -81,8 +82,18 @@ private:
     mutable TFloat* x;      // Primal solution induced by current basis
     mutable TFloat* y;      // Dual solution induced by current basis
 
-    mutable denseMatrix<TIndex,TFloat> *baseInv;   // Inverse of basis matrix
-    mutable denseMatrix<TIndex,TFloat> *keptInv;   // Kept for basis evaluations
+    mutable sparseLUFactor* baseFactor;
+                            // LU factorization of the transposed basis matrix
+    mutable TFloat* tabRow; // Row of the basis inverse, computed by BTRAN
+    mutable TVar    tabRowIndex;    // Basis row associated with tabRow
+    mutable TFloat* workVec;        // Work vector for FTRAN / BTRAN
+    mutable TFloat* pivotAlpha;     // Tableau column of the entering row
+
+    TFloat* refWeight;      // Reference weights for Devex / steepest edge pricing
+
+    mutable TIndex* rowFirst;   // Compressed rows of the coefficient matrix
+    mutable TVar*   rowVar;     // Variable indices of the compressed rows
+    mutable TFloat* rowCoeff;   // Coefficients of the compressed rows
 
     mutable bool    baseInitial;    // Indicates the default basis (lower ranges)
     mutable bool    baseValid;      // Is the basis inverse up to date?
@@ -220,8 +231,21 @@ private:
     void    EvaluateBasis() const throw(ERRejected);
     void    DefaultBasisInverse() const throw(ERRejected);
 
+    void    AllocateBasisData() const throw();
+    void    ReleaseBasisData() const throw();
+
+    void    CompressRows() const throw();
+    void    ReleaseCompressedRows() const throw();
+    // Compressed rows are kept while the coefficient matrix is unchanged
+
+    void    FactorizeBasis() const throw(ERRejected);
+    // Computes a sparse LU factorization of the basis matrix
+
+    void    RestrFTran(TRestr,TFloat*) const throw(ERRange);
+    // RestrFTran(i,alpha) sets alpha[k]=Tableau(Index(k),i) for all k
+
     void    BasisUpdate(TRestr,TVar) const throw(ERRange,ERRejected);
-    // Updates baseInv after a call of Pivot
+    // Updates baseFactor after a call of Pivot
 
     void    SolutionUpdate() const throw(ERRejected);
     // Updates primal and dual solution
@@ -238,10 +262,23 @@ private:
     TRestr  PriceDual() throw(ERRejected);
     TVar    QTestDual(TRestr) throw(ERRejected);
 
+    TVar    BoundFlippingTest(TRestr,short) throw();
+    // Long step ratio test. Passed boxed restrictions are moved to the opposite bound
+
+    void    InitPricingWeights(bool) throw();
+    // Sets the reference weights for PricePrimal() (false) or PriceDual() (true)
+
+    void    UpdatePrimalWeights(TRestr,TVar) throw();
+    void    UpdateDualWeights(TRestr,TVar) throw();
+    // Update the reference weights before a call of Pivot
+
+    void    ReleasePricingWeights() throw();
+
 public:
 
     TFloat  X(TVar) const throw(ERRange);
     TFloat  Y(TRestr,TLowerUpper) const throw(ERRange);
+    TFloat  Slack(TRestr,TLowerUpper) const throw(ERRange);
 
     TFloat  Tableau(TIndex,TIndex) const throw(ERRange,ERRejected);
     // Tableau(i,j)=A_j(A_B)^(-1)e_i
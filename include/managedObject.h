@@ -73,7 +73,8 @@ public:
     enum TMethLocal {
         LOCAL_DEFAULT  = -1, ///< Apply the default method set in #goblinController::methLocal
         LOCAL_DISABLED =  0, ///< Do not apply post optimization procedures
-        LOCAL_OPTIMIZE =  1  ///< Apply certain post optimization procedures
+        LOCAL_OPTIMIZE =  1, ///< Apply certain post optimization procedures
+        LOCAL_LIN_KERNIGHAN = 2 ///< Same as #LOCAL_OPTIMIZE, but improve symmetric TSP tours by Lin-Kernighan and Or-opt moves
     };
 
 
@@ -178,8 +179,10 @@ public:
     void  CancelledArc(char* methodName,TArc) const throw(ERRejected);
     void  NoSuchHandle(char* methodName,THandle) const throw(ERRejected);
     void  NoSuchItem(char* methodName,unsigned long) const throw(ERRange);
+    void  NoSuchItem(char* methodName,unsigned int) const throw(ERRange);
     void  NoSuchItem(char* methodName,unsigned short) const throw(ERRange);
     void  NoSuchIndex(char* methodName,unsigned long) const throw(ERRange);
+    void  NoSuchIndex(char* methodName,unsigned int) const throw(ERRange);
     void  NoSuchIndex(char* methodName,unsigned short) const throw(ERRange);
     void  NoSuchCoordinate(char* methodName,TDim) const throw(ERRange);
     void  UnknownOption(char* methodName,int) const throw(ERRejected);
@@ -277,7 +280,7 @@ inline void managedObject::ExportToAscii(const char* fileName,TOption format) co
 
 
 #define InternalError(scope,event) {sprintf(this->CT.logBuffer,"%s (%s, line: %d)",event,__FILE__,__LINE__); this->Error(ERR_INTERNAL,scope,this->CT.logBuffer);}
-#define InternalError1(scope) {sprintf(this->CT.logBuffer,"%s (%s, line: %d)",this->CT.logBuffer,__FILE__,__LINE__); this->Error(ERR_INTERNAL,scope,this->CT.logBuffer);}
+#define InternalError1(scope) {sprintf(this->CT.logBuffer+strlen(this->CT.logBuffer)," (%s, line: %d)",__FILE__,__LINE__); this->Error(ERR_INTERNAL,scope,this->CT.logBuffer);}
 
 
 #endif
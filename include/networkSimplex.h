@@ -17,9 +17,26 @@
 
 
 /// \brief  Encapsulates auxiliary data structures and procedures of the network simplex method
+///
+/// The end nodes, the lengths and the residual capacities of the arcs are
+/// copied into plain arrays on construction. Pricing and the ratio test only
+/// read from these arrays, and the flow changes are forwarded to the graph
+/// object by Push() operations on the pivot cycle arcs.
 
 class networkSimplex : public managedObject
 {
+public:
+
+    /// \brief  Pricing rules, selected by the context parameter methNWPricing
+    enum TPricingRule {
+        PARTIAL_PRICING = 0,
+        MULTIPLE_PARTIAL = 1,
+        DANTZIG = 2,
+        FIRST_ELIGIBLE = 3,
+        BLOCK_SEARCH = 4,
+        ALTERING_LIST = 5
+    };
+
 private:
 
     abstractDiGraph &G; // Related graph Object
@@ -40,6 +57,22 @@ private:
     TArc*   hotList;
     TArc*   swapList;
 
+    TArc    blockSize;  // Number of arcs scanned in a single block
+    TArc    headLength; // Number of candidates kept by ALTERING_LIST
+    TArc    nextArc;    // Arc where the next block search starts
+    TArc    nCand;      // Current length of candList
+
+    TArc*   candList;   // Candidate arcs for ALTERING_LIST
+    TFloat* candCost;   // Reduced lengths of the candidate arcs
+
+    TNode*  tail;       // Start nodes of the forward arcs
+    TNode*  head;       // End nodes of the forward arcs
+    TFloat* cost;       // Lengths of the forward arcs
+    TFloat* resCap;     // Residual capacities, indexed like the graph arcs
+
+    TArc*   cycleLeft;  // Pivot cycle arcs between the pivot start node and the apex
+    TArc*   cycleRight; // Pivot cycle arcs between the pivot end node and the apex
+
     TNode*  thread;     // Follow up the nodes in the tree defined by P
     TNode*  depth;      // Distance from the root in the tree solution
 
@@ -56,11 +89,36 @@ public:
     TArc            DantzigPricing() throw();
     TArc            FirstEligiblePricing() throw();
 
+    /// \brief  Block search pricing
+    ///
+    /// \return  The arc with the most negative reduced length in the first
+    ///          block of about sqrt(m) consecutive arcs which contains an
+    ///          admissible arc, or NoArc if the solution is optimal
+    ///
+    /// Blocks are traversed cyclically, starting where the previous search
+    /// has stopped.
+    TArc            BlockSearchPricing() throw();
+
+    /// \brief  Altering candidate list pricing
+    ///
+    /// \return  The arc with the most negative reduced length in the candidate
+    ///          list, or NoArc if the solution is optimal
+    ///
+    /// The candidate list is rechecked first and then extended by block
+    /// searches. Only the few best candidates are kept for the next call.
+    TArc            AlteringListPricing() throw();
+
     void            InitThreadIndex() throw();
     void            ComputePotentials() throw();
     TNode           UpdateThread(TNode,TNode,TNode) throw();
     bool            PivotOperation(TArc) throw();
 
+private:
+
+    TNode           Start(TArc a) const throw();
+    TFloat          RedCost(TArc a) const throw();
+    TArc            Admissible(TArc a,TFloat& redCost) const throw();
+
 };
 
 
@@ -0,0 +1,131 @@
+
+//  This file forms part of the GOBLIN C++ Class Library.
+//
+//  Initially written by the GOBLIN developers, October 2026
+//
+//  Copying, compiling, distribution and modification
+//  of this source code is permitted only in accordance
+//  with the GOBLIN general licence information.
+
+/// \file   parallelAuction.h
+/// \brief  #parallelAuction class interface
+
+#ifndef _PARALLEL_AUCTION_H_
+#define _PARALLEL_AUCTION_H_
+
+#include "abstractBigraph.h"
+#include "csrRepresentation.h"
+
+#include <pthread.h>
+
+
+/// \brief  Encapsulates the data structures and the worker threads of the auction method for assignment problems
+///
+/// The left-hand nodes (persons) bid for the right-hand nodes (objects) of
+/// a bigraph with n1==n2. Arc lengths are negated and multiplied by n1+1,
+/// so that an assignment which satisfies epsilon-complementary slackness
+/// for epsilon=1 is optimal for integral arc lengths. Epsilon is divided by
+/// the factor CT.costScalingFactor in every phase.
+///
+/// Within a phase, forward and reverse iterations alternate. The switch is
+/// done whenever the number of assigned persons has increased. Forward
+/// iterations work in synchronous rounds: All unassigned persons compute
+/// their bids concurrently with respect to the prices at the beginning of
+/// the round. Then every object is assigned to the highest bidder. Reverse
+/// iterations are performed by the master thread, one unassigned object at
+/// a time, and lower the object prices.
+///
+/// If no perfect assignment exists, the prices or the profits eventually
+/// exceed a bound which is valid for all feasible instances. This is checked
+/// to terminate the method.
+
+class parallelAuction : public managedObject
+{
+private:
+
+    abstractBiGraph &G; // Related graph object
+
+    TNode   n1;         // Number of persons and of objects
+
+    const csrRepresentation* X; // Node incidences
+    csrRepresentation* localX;  // Node incidences if the graph is not frozen
+
+    TFloat  scale;      // Factor applied to the arc lengths
+    TFloat  epsilon;    // The current epsilon
+    TFloat  alpha;      // Factor by which epsilon is divided
+
+    TFloat  range;      // Difference of the maximum and the minimum benefit
+
+    TFloat* price;      // Object prices, indexed by the right-hand nodes minus n1
+    TFloat* profit;     // Person profits, indexed by the left-hand nodes
+    TNode*  assigned;   // The object assigned to every person, or NoNode
+    TArc*   assignedArc; // The arc which assigns every person
+    TNode*  owner;      // The person assigned to every object, or NoNode
+    TNode   nAssigned;  // The number of assigned persons
+
+    TNode*  bidder;     // The unassigned persons in the current round
+    TNode   nBidders;   // The number of unassigned persons in the current round
+    TNode*  nextBidder; // The unassigned persons for the next round
+    TNode*  freeObject; // A stack of objects which might be unassigned
+    TNode   nFreeObjects; // The current stack depth
+    char*   stacked;    // Marks the objects in freeObject[]
+
+    TArc*   bidSlot;    // The slot on which every person in bidder[] bids
+    TFloat* bidPrice;   // The price offered by every person in bidder[]
+    TFloat* bidProfit;  // The profit of every person in bidder[] if the bid is accepted
+    TNode*  winner;     // The position of the best bid for every object in bidder[]
+    unsigned long* bidRound;  // The latest round in which an object has received a bid
+
+    TFloat  priceBound;  // Upper bound on the prices for feasible instances
+    TFloat  profitBound; // Upper bound on the profits for feasible instances
+    bool    infeasible;  // A price or a profit bound has been exceeded
+
+    unsigned  nThreads; // Number of worker threads
+    pthread_barrier_t  barrier;
+    bool    finished;   // Tells the worker threads to exit
+
+    unsigned long nRounds;      // Number of forward rounds
+    unsigned long nBids;        // Number of forward bids
+    unsigned long nReverseBids; // Number of reverse bids
+
+public:
+
+    /// \brief  Constructor for the auction method
+    ///
+    /// \param GC  The bigraph to be solved. It must satisfy N1()==N2()
+    parallelAuction(abstractBiGraph& GC) throw(ERRejected);
+    ~parallelAuction() throw();
+
+    unsigned long   Size() const throw();
+    unsigned long   Allocated() const throw();
+
+    /// \brief  Run the method and write the assignment to the subgraph of the graph object
+    ///
+    /// \retval true  A perfect assignment has been found
+    bool            Solve() throw();
+
+    /// \brief  Thread entry point
+    ///
+    /// \param arg  A pointer to a #TWorkerArg structure
+    static void*    WorkerEntry(void* arg) throw();
+
+private:
+
+    struct TWorkerArg
+    {
+        parallelAuction*    P;
+        unsigned            id;
+    };
+
+    void            Worker(unsigned id) throw();
+    void            Barrier() throw();
+
+    bool            Phase() throw();
+    void            ComputeBids(TNode lo,TNode hi) throw();
+    void            ForwardRound() throw();
+    void            ReverseBid(TNode j) throw();
+
+};
+
+
+#endif
@@ -0,0 +1,212 @@
+
+//  This file forms part of the GOBLIN C++ Class Library.
+//
+//  Initially written by the GOBLIN developers, October 2026
+//
+//  Copying, compiling, distribution and modification
+//  of this source code is permitted only in accordance
+//  with the GOBLIN general licence information.
+
+/// \file   parallelComponents.h
+/// \brief  #parallelComponents class interface
+
+#ifndef _PARALLEL_COMPONENTS_H_
+#define _PARALLEL_COMPONENTS_H_
+
+#include "abstractMixedGraph.h"
+#include "csrRepresentation.h"
+
+#include <pthread.h>
+
+
+/// \brief  Encapsulates the data structures and the worker threads of the parallel component methods
+///
+/// The incidence lists are read from the #csrRepresentation object of the
+/// graph if it has been frozen before, and are copied otherwise. All graph
+/// registers are allocated by the master thread and are only written by the
+/// worker threads.
+///
+/// Connected components are computed by a lock-free union-find structure
+/// in the spirit of Shiloach and Vishkin: For every edge, the two tree roots
+/// are determined, and the root with the higher node index is hooked to the
+/// other root by a compare-and-swap operation. The edges which have been
+/// hooked successfully form a spanning forest. Every component is rooted at
+/// its minimum node index, and the components are numbered by increasing roots,
+/// just like the depth first search method does.
+///
+/// Blocks and cut nodes are computed by the method of Tarjan and Vishkin:
+/// The spanning forest is oriented and numbered in preorder, and two tree
+/// edges are merged in a second union-find structure if they share a cycle
+/// with a single non-tree edge. The tree operations take O(n) steps and are
+/// performed by the master thread, all edge scans are distributed.
+///
+/// Strong components are computed by a single forward-backward search for
+/// the giant component, by trimming the nodes without any incoming or outgoing
+/// arcs, and by the colouring method for the remaining nodes. Trimming cascades
+/// by means of degree counters, and colours are only propagated from nodes
+/// whose colour has changed. All searches are breadth first, where each layer
+/// is processed concurrently.
+
+class parallelComponents : public managedObject
+{
+private:
+
+    abstractMixedGraph &G; // Related graph object
+
+    TNode   n;          // Number of graph nodes
+
+    const csrRepresentation*  X;    // The incidence lists
+    csrRepresentation*  localX;     // A copy of the incidence lists, if G is not frozen
+
+    unsigned  nThreads; // Number of worker threads
+    pthread_barrier_t  barrier;
+
+    TNode*  nodeLo;     // First node index handled by a thread
+    TNode*  count;      // Per thread counters for prefix sums
+
+    volatile TNode*  parent;    // Union-find forest
+    TArc*   hookArcs;   // Arcs by which trees have been hooked, indexed by the roots
+
+    TArc*   pred;       // Predecessor register of G
+    TNode*  nodeColour; // Node colour register of G
+    TArc*   edgeColour; // Edge colour register of G
+
+    TNode*  sequence;   // The nodes in preorder
+    TNode*  up;         // Parent nodes in the spanning forest
+    TNode*  pre;        // Preorder numbers in the spanning forest
+    TNode*  size;       // Number of descendants, including the node itself
+    TNode*  low;        // Minimum preorder number adjacent with a subtree
+    TNode*  high;       // Maximum preorder number adjacent with a subtree
+    TNode*  firstChild; // Some child node in the spanning forest
+    TNode*  block;      // Block index of the tree edge entering a node
+    char*   cutNode;    // Marks the cut nodes
+
+    volatile TNode*  rep;       // Strong component representatives
+    volatile TNode*  colour;    // Colours in the colouring method
+    char*   visited;    // Marks nodes in the forward-backward search
+    TArc*   fwPred;     // Predecessors in the forward search
+    volatile TNode*  inDegree;  // Number of eligible arcs from unassigned nodes
+    volatile TNode*  outDegree; // Number of eligible arcs to unassigned nodes
+
+    TNode*  active;     // Nodes not yet assigned to a strong component
+    TNode   nActive;    // The number of unassigned nodes
+    TNode*  next;       // The next BFS layer / work list
+    TNode   nNext;      // The next BFS layer length
+    TNode*  current;    // The current BFS layer
+    TNode   nCurrent;   // The current BFS layer length
+
+    TNode   nComponents;    // Number of components found
+    TNode   nBlocks;        // Number of blocks found
+    TNode   nCutNodes;      // Number of cut nodes found
+    TNode   pivot;          // The forward-backward search root node
+    bool    changed;        // Colours have changed in the current round
+
+    enum TTask {
+        TASK_CONNECTED = 0,
+        TASK_LOW_HIGH = 1,
+        TASK_BLOCKS = 2,
+        TASK_BRIDGES = 3,
+        TASK_STRONG = 4
+    };
+
+    TTask   task;       // The task executed by the worker threads
+
+public:
+
+    /// \brief  Constructor for the parallel component methods
+    ///
+    /// \param GC  The graph to be searched
+    parallelComponents(abstractMixedGraph& GC) throw();
+    ~parallelComponents() throw();
+
+    unsigned long   Size() const throw();
+    unsigned long   Allocated() const throw();
+
+    /// \brief  Compute the connected components
+    ///
+    /// \return  The number of connected components
+    ///
+    /// This assigns the node colours and the predecessor labels as
+    /// abstractMixedGraph::Connected() does, but the predecessor labels
+    /// encode an arbitrary spanning forest
+    TNode           Connected() throw();
+
+    /// \brief  Compute the blocks and the cut nodes
+    ///
+    /// \return  The number of blocks
+    ///
+    /// This assigns the node and edge colours and the predecessor labels as
+    /// abstractMixedGraph::CutNodes() does: Blocks are numbered from 1, cut
+    /// nodes are coloured 0, isolated nodes remain uncoloured, and loops at
+    /// isolated nodes are coloured 0. The predecessor labels encode an
+    /// arbitrary spanning forest, and edges with zero capacity remain uncoloured
+    TNode           CutNodes() throw();
+
+    /// \brief  Compute the 2-edge connected components
+    ///
+    /// \return  The number of 2-edge connected components
+    ///
+    /// This must be called after CutNodes() and overwrites the node colours
+    /// by the 2-edge connected components, numbered from 1 by increasing
+    /// minimum nodes. Isolated nodes remain uncoloured but are counted as
+    /// components. As in abstractMixedGraph::Biconnected(), a single edge
+    /// forming a connected component is considered 2-edge connected
+    TNode           TwoEdgeConnected() throw();
+
+    /// \brief  Compute the strong components
+    ///
+    /// \return  The number of strong components
+    ///
+    /// This assigns the node colours such that the strong components are numbered
+    /// by increasing minimum nodes. The predecessor labels encode a spanning tree
+    /// for every strong component, but tree arcs may be backward arcs
+    TNode           StronglyConnected() throw();
+
+    /// \brief  Query the number of connected components
+    ///
+    /// \return  The number of connected components found by the most recent method call
+    TNode           NComponents() const throw() {return nComponents;};
+
+    /// \brief  Query the number of cut nodes
+    ///
+    /// \return  The number of cut nodes found by CutNodes()
+    TNode           NCutNodes() const throw() {return nCutNodes;};
+
+    /// \brief  Thread entry point
+    ///
+    /// \param arg  A pointer to a #TWorkerArg structure
+    static void*    WorkerEntry(void* arg) throw();
+
+private:
+
+    struct TWorkerArg
+    {
+        parallelComponents*  P;
+        unsigned             id;
+    };
+
+    void            Run(TTask thisTask) throw();
+    void            Worker(unsigned id) throw();
+    void            Barrier() throw();
+
+    TNode           Find(TNode v) throw();
+    void            Unite(TNode u,TNode w,TArc a) throw();
+    TNode           PrefixSums() throw();
+    void            ColourByRoots(unsigned id) throw();
+
+    void            ConnectedWorker(unsigned id) throw();
+    void            OrientForest() throw();
+    void            LowHighWorker(unsigned id) throw();
+    void            BlocksWorker(unsigned id) throw();
+    void            BridgesWorker(unsigned id) throw();
+    void            StrongWorker(unsigned id) throw();
+
+    TNode           NodeBlock(TNode v) const throw();
+    void            Trim(unsigned id) throw();
+    void            SearchLayers(unsigned id,bool forward,char mark) throw();
+    void            CompactActive(unsigned id) throw();
+
+};
+
+
+#endif
@@ -0,0 +1,128 @@
+
+//  This file forms part of the GOBLIN C++ Class Library.
+//
+//  Initially written by the GOBLIN developers, October 2026
+//
+//  Copying, compiling, distribution and modification
+//  of this source code is permitted only in accordance
+//  with the GOBLIN general licence information.
+
+/// \file   parallelPushRelabel.h
+/// \brief  #parallelPushRelabel class interface
+
+#ifndef _PARALLEL_PUSH_RELABEL_H_
+#define _PARALLEL_PUSH_RELABEL_H_
+
+#include "abstractDigraph.h"
+
+#include <pthread.h>
+
+
+/// \brief  Encapsulates the data structures and the worker threads of the parallel push / relabel method
+///
+/// The method works in synchronous rounds. In every round, all active nodes
+/// are discharged concurrently with respect to the distance labels at the
+/// beginning of the round. Since an arc and its reverse arc cannot be both
+/// admissible, every residual capacity is manipulated by a single thread.
+/// Only the excesses of the receiving nodes are updated by atomic operations.
+/// After that, all active nodes which could not be discharged are relabelled
+/// concurrently. Since distance labels only increase, this maintains a valid
+/// labelling.
+///
+/// Active nodes are collected in lock-free work lists. Exact distance labels
+/// are computed at the start and periodically, by a breadth first search
+/// which processes every BFS layer concurrently.
+///
+/// The initial flow may leave node imbalances, as in the auxiliary networks
+/// of AdmissibleBFlow(). Nodes with negative excess are treated as further
+/// sinks: They are roots of the breadth first search, and they absorb all
+/// flow pushed to them until the deficit is filled.
+///
+/// The residual network is copied in advance, and the flow is written back
+/// to the graph object when the method has finished. So the graph object is
+/// accessed by the master thread only.
+
+class parallelPushRelabel : public managedObject
+{
+private:
+
+    abstractDiGraph &G; // Related graph object
+
+    TNode   n;          // Number of graph nodes
+    TArc    m;          // Number of graph arcs
+    TNode   s;          // Source node
+    TNode   t;          // Target node
+
+    TArc*   first;      // Slot ranges [first[v],first[v+1]) for every node v
+    TArc*   slotArc;    // Arc indices
+    TNode*  slotHead;   // End node indices
+
+    TFloat* resCap;     // Residual capacities, indexed by the arcs
+    TFloat* excess;     // Node excesses
+    TFloat* incoming;   // Excesses received during the current round
+    TNode*  dist;       // Distance labels
+    TNode*  newDist;    // Distance labels computed in the current round
+    char*   listed;     // Marks the nodes in the next work list
+
+    TNode*  active;     // The current work list
+    TNode   nActive;    // The current work list length
+    TNode*  next;       // The next work list
+    TNode   nNext;      // The next work list length
+
+    unsigned  nThreads; // Number of worker threads
+    pthread_barrier_t  barrier;
+
+    TNode   bfsLevel;   // The current layer in global relabel operations
+    bool    finished;   // Tells the worker threads to exit
+    bool    relabelNow; // Tells the worker threads to compute exact labels
+
+    unsigned long nPush;        // Number of push operations
+    unsigned long nRelabel;     // Number of relabel operations
+    unsigned long nGlobalRelabel; // Number of global relabel operations
+
+    TFloat* initialResCap;  // Residual capacities before the method has started
+
+public:
+
+    /// \brief  Constructor for the parallel push / relabel method
+    ///
+    /// \param GC  The graph to be solved
+    /// \param ss  The source node
+    /// \param tt  The target node
+    parallelPushRelabel(abstractDiGraph& GC,TNode ss,TNode tt) throw(ERRange);
+    ~parallelPushRelabel() throw();
+
+    unsigned long   Size() const throw();
+    unsigned long   Allocated() const throw();
+
+    /// \brief  Run the method and write the maximum flow back to the graph
+    ///
+    /// \return  The maximum flow value
+    TFloat          Solve() throw(ERRange);
+
+    /// \brief  Thread entry point
+    ///
+    /// \param arg  A pointer to a #TWorkerArg structure
+    static void*    WorkerEntry(void* arg) throw();
+
+private:
+
+    struct TWorkerArg
+    {
+        parallelPushRelabel*    P;
+        unsigned                id;
+    };
+
+    void            Worker(unsigned id) throw();
+    void            Barrier() throw();
+
+    void            Discharge(TNode u) throw();
+    void            Relabel(TNode u) throw();
+    void            Enlist(TNode v) throw();
+    void            GlobalRelabel(unsigned id) throw();
+    void            SearchLayers(unsigned id) throw();
+
+};
+
+
+#endif
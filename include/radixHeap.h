@@ -0,0 +1,91 @@
+
+//  This file forms part of the GOBLIN C++ Class Library.
+//
+//  Initially written by the GOBLIN developers, October 2026
+//
+//  Copying, compiling, distribution and modification
+//  of this source code is permitted only in accordance
+//  with the GOBLIN general licence information.
+
+/// \file   radixHeap.h
+/// \brief  #radixHeap class interface
+
+#ifndef _RADIX_HEAP_H_
+#define _RADIX_HEAP_H_
+
+#include "goblinQueue.h"
+
+
+/// \addtogroup priorityQueues
+/// @{
+
+/// \brief  Upper bound on the keys which can be managed by radix heaps
+///
+/// Keys are converted to unsigned long values, and must be exactly representable
+const TFloat MaxRadixHeapKey =
+    (sizeof(unsigned long)>4) ? 4503599627370496.0 : 4294967295.0;
+
+/// \brief Monotone priority queue for non-negative integral keys
+///
+/// The elements are distributed among 1+B buckets where B is the number of
+/// bits of an unsigned long. Bucket 0 holds the elements with the same key
+/// as the most recently deleted element. Any other element is placed into
+/// the bucket 1+k where k is the most significant bit in which its key
+/// differs from the most recently deleted key. When bucket 0 runs empty, the
+/// minimum key in the first non-empty bucket is determined, and the elements
+/// of this bucket are redistributed to lower buckets.
+///
+/// The keys must be integral, non-negative, bounded by #MaxRadixHeapKey and
+/// must not be smaller than the key of the most recently deleted element.
+/// This is satisfied by the distance labels in Dijkstra's method with
+/// integral length labels.
+
+template <class TItem,class TKey>
+class radixHeap : public goblinQueue<TItem,TKey>
+{
+private:
+
+    enum {nBuckets = 8*sizeof(unsigned long)+1};
+
+    TItem*          next;
+    TItem*          prev;
+    unsigned char*  bucket;
+    TKey*           key;
+
+    TItem           first[nBuckets];
+    unsigned long   last;
+
+    TItem           maxIndex;
+    TItem           n;
+    unsigned char   NO_BUCKET() const throw() {return (unsigned char)(-1);};
+    TItem           UITEM_MAX() const throw() {return TItem(-1);};
+
+    unsigned char   BucketIndex(unsigned long k) const throw();
+    void            Link(TItem w,unsigned char i) throw();
+    void            Unlink(TItem w) throw();
+    TItem           MinElement(unsigned char i) const throw();
+
+public:
+
+    radixHeap(TItem nn,goblinController &thisContext) throw();
+    ~radixHeap() throw();
+
+    void            Init() throw();
+    unsigned long   Size() const throw();
+    unsigned long   Allocated() const throw();
+    char*           Display() const throw();
+
+    void            Insert(TItem w,TKey alpha) throw(ERRange,ERRejected);
+    TItem           Delete() throw(ERRejected);
+    void            Delete(TItem w) throw(ERRange);
+    TKey            Key(TItem w) const throw(ERRange);
+    void            ChangeKey(TItem w,TKey alpha) throw(ERRange,ERRejected);
+    TItem           Peek() const throw(ERRejected);
+    bool            Empty() const throw() {return (maxIndex==0);};
+    TItem           Cardinality() const throw() {return maxIndex;};
+
+};
+
+/// @}
+
+#endif
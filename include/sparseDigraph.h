@@ -17,6 +17,9 @@
 #include "sparseRepresentation.h"
 
 
+class abstractGraph;
+
+
 /// \brief A class for directed graphs represented with incidence lists
 
 class diGraph : public abstractDiGraph
@@ -148,6 +151,69 @@ public:
 
     void MapEdgeCut() throw();
 
+    /// \brief  Check if every arc cut can be replaced by a node cut
+    ///
+    /// \retval true  If no mapped arc has a smaller capacity than one of its end nodes
+    ///
+    /// If this holds, every minimum st-cut of the split graph with non-adjacent
+    /// nodes s,t can be replaced by a cut of internal arcs with the same capacity.
+    /// This is the precondition of the Esfahanian-Hakimi node pair selection.
+    bool NodeCutsOnly() const throw();
+
+};
+
+
+/// \brief Gomory-Hu cut tree of a given undirected graph
+///
+/// This digraph has the same nodes as the original graph. For every node pair
+/// u,v, the minimum uv-cut capacity in the original graph is the minimum arc
+/// capacity on the tree path connecting u and v. The arcs point from the child
+/// to the parent nodes, and node 0 is the root. Both the upper capacity bounds
+/// and the length labels of the tree arcs take the cut capacities.
+///
+/// The tree is constructed by Gusfield's method which solves n-1 max-flow
+/// problems on copies of the original graph, without contracting nodes.
+
+class gomoryHuTree : public diGraph
+{
+private:
+
+    TNode   nLevels;    ///< Number of levels in the ancestor tables
+    TNode*  depth;      ///< Node depths in the tree
+    TNode*  ancestor;   ///< For all levels k, the ancestors at distance 2^k
+    TCap*   pathCap;    ///< For all levels k, the minimum capacity on the path to the ancestor
+
+    /// \brief  Set up the ancestor tables for the cut value queries
+    ///
+    /// \param parent  The parent nodes, with parent[0]==NoNode
+    /// \param value   The capacities of the cuts separating the nodes from their parents
+    void  InitQueries(const TNode* parent,const TCap* value) throw();
+
+public:
+
+    /// \param G       The original undirected graph
+    /// \param method  A #TMethMXF value specifying the applied max-flow method
+    ///
+    /// Up to #goblinController::maxThreads max-flow problems are solved
+    /// concurrently. The flows are committed in the order of Gusfield's method,
+    /// and a flow is recomputed if the previous commits have changed its target
+    /// node. So the tree does not depend on the number of threads.
+    gomoryHuTree(abstractGraph& G,TMethMXF method = MXF_DEFAULT) throw();
+    ~gomoryHuTree() throw();
+
+    unsigned long   Size() const throw();
+    unsigned long   Allocated() const throw();
+
+    /// \brief  Query a minimum cut capacity in the original graph
+    ///
+    /// \param u  A node index
+    /// \param v  Another node index
+    /// \return   The minimum uv-cut capacity, or InfCap if u==v
+    ///
+    /// This takes O(log n) time by lifting u and v to their lowest common
+    /// ancestor in steps of powers of two.
+    TCap  MinCutValue(TNode u,TNode v) const throw(ERRange);
+
 };
 
 
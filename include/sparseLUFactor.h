@@ -0,0 +1,170 @@
+
+//  This file forms part of the GOBLIN C++ Class Library.
+//
+//  Initially written by the GOBLIN developers, October 2026
+//
+//  Copying, compiling, distribution and modification
+//  of this source code is permitted only in accordance
+//  with the GOBLIN general licence information.
+
+/// \file   sparseLUFactor.h
+/// \brief  #sparseLUFactor class interface
+
+#ifndef _SPARSE_LU_FACTOR_H_
+#define _SPARSE_LU_FACTOR_H_
+
+#include "managedObject.h"
+
+
+/// \brief  Sparse LU factorization of a square matrix with product form updates
+///
+/// The matrix M is supplied column by column and then factorized by Gaussian
+/// elimination. Pivot elements are chosen by the Markowitz criterion, that is,
+/// by minimizing (r-1)*(c-1) where r and c are the numbers of non-zeros in
+/// the pivot row and the pivot column of the active submatrix. For the sake of
+/// numerical stability, only candidates which exceed a fixed fraction of the
+/// largest absolute value in their column are accepted.
+///
+/// If a column of M is replaced later, the factorization is not recomputed,
+/// but an eta vector is appended to an update file. Callers are expected to
+/// refactorize when #RefactorizationRequired() returns true.
+///
+/// Row and column indices of M run from 0 to #N()-1. In #FTran(), the
+/// right-hand side is indexed like the rows of M and the solution like the
+/// columns of M. In #BTran(), it is the other way round.
+
+class sparseLUFactor : public managedObject
+{
+private:
+
+    TIndex      n;          // Matrix dimension
+
+    // Active submatrix, only used during the factorization
+
+    TIndex*     colLen;     // Number of entries in every column
+    TIndex*     colCap;     // Capacities of the column arrays
+    TIndex**    colRow;     // Row indices of the column entries
+    TFloat**    colVal;     // Values of the column entries
+    TIndex*     rowLen;     // Number of entries in every row
+    TIndex*     rowCap;     // Capacities of the row arrays
+    TIndex**    rowCol;     // Column indices of the row entries
+
+    TIndex*     rowFirst;   // Rows with a given number of entries
+    TIndex*     rowNext;    // Doubly linked lists of rows with equal length
+    TIndex*     rowPrev;
+    TIndex*     colFirst;   // Columns with a given number of entries
+    TIndex*     colNext;    // Doubly linked lists of columns with equal length
+    TIndex*     colPrev;
+
+    // Factors
+
+    TIndex*     pivRow;     // Pivot rows in elimination order
+    TIndex*     pivCol;     // Pivot columns in elimination order
+    TFloat*     pivVal;     // Pivot elements in elimination order
+
+    TIndex*     lFirst;     // Multipliers of pivot k: [lFirst[k],lFirst[k+1])
+    TIndex*     lIndex;     // Row indices of the multipliers
+    TFloat*     lVal;       // Multipliers
+    TIndex      lCap;       // Capacity of lIndex[] and lVal[]
+
+    TIndex*     uFirst;     // Pivot row k without the pivot: [uFirst[k],uFirst[k+1])
+    TIndex*     uIndex;     // Column indices of the pivot row entries
+    TFloat*     uVal;       // Pivot row entries
+    TIndex      uCap;       // Capacity of uIndex[] and uVal[]
+
+    // Update file
+
+    TIndex      nEta;       // Number of eta vectors
+    TIndex      etaMax;     // Capacity of etaPos[], etaPivot[] and etaFirst[]
+    TIndex*     etaPos;     // Replaced column positions
+    TFloat*     etaPivot;   // Pivot elements of the eta vectors
+    TIndex*     etaFirst;   // Eta vector t: [etaFirst[t],etaFirst[t+1])
+    TIndex*     etaIndex;   // Indices of the eta vector entries
+    TFloat*     etaVal;     // Values of the eta vector entries
+    TIndex      etaCap;     // Capacity of etaIndex[] and etaVal[]
+
+    TIndex*     mark;       // Scatter positions during the elimination
+    TFloat*     work;       // Dense work vector for FTRAN and BTRAN
+
+public:
+
+    /// \brief  Constructor for sparse LU factorizations
+    ///
+    /// \param nn           The matrix dimension
+    /// \param thisContext  The context to which this object is attached
+    sparseLUFactor(TIndex nn,goblinController& thisContext = goblinDefaultContext) throw();
+    ~sparseLUFactor() throw();
+
+    unsigned long   Size() const throw();
+    unsigned long   Allocated() const throw();
+
+    /// \brief  Retrieve the matrix dimension
+    ///
+    /// \return  The number of rows and columns of the factorized matrix
+    TIndex          N() const throw() {return n;};
+
+    /// \brief  Clear all matrix columns before a new factorization
+    void            Init() throw();
+
+    /// \brief  Specify a column of the matrix to be factorized
+    ///
+    /// \param j      A column index ranged [0,1,..,N()-1]
+    /// \param len    The number of non-zero entries in this column
+    /// \param index  The row indices of the non-zero entries
+    /// \param val    The values of the non-zero entries
+    void            SetColumn(TIndex j,TIndex len,const TIndex* index,
+                        const TFloat* val) throw(ERRange);
+
+    /// \brief  Factorize the matrix given by the recent #SetColumn() calls
+    ///
+    /// The update file is cleared.
+    void            Factorize() throw(ERRejected);
+
+    /// \brief  Set the factorization to the identity matrix
+    void            Identity() throw();
+
+    /// \brief  Replace a matrix column and append an eta vector to the update file
+    ///
+    /// \param p      The column position to be replaced
+    /// \param alpha  The new column, transformed by #FTran()
+    void            Update(TIndex p,const TFloat* alpha) throw(ERRange,ERRejected);
+
+    /// \brief  Solve M*z = x
+    ///
+    /// \param x  A dense vector which is overwritten by the solution z
+    void            FTran(TFloat* x) const throw();
+
+    /// \brief  Solve M^T*z = x
+    ///
+    /// \param x  A dense vector which is overwritten by the solution z
+    void            BTran(TFloat* x) const throw();
+
+    /// \brief  Retrieve the number of column replacements since the last factorization
+    ///
+    /// \return  The number of eta vectors
+    TIndex          NumUpdates() const throw() {return nEta;};
+
+    /// \brief  Check if the update file has become too long
+    ///
+    /// \retval true  The matrix should be refactorized
+    bool            RefactorizationRequired() const throw();
+
+private:
+
+    void            AppendToColumn(TIndex j,TIndex i,TFloat val) throw();
+    void            AppendToRow(TIndex i,TIndex j) throw();
+    void            RemoveFromRow(TIndex i,TIndex j) throw();
+    TFloat          RemoveFromColumn(TIndex j,TIndex i) throw();
+
+    void            RowListInsert(TIndex i) throw();
+    void            RowListDelete(TIndex i) throw();
+    void            ColListInsert(TIndex j) throw();
+    void            ColListDelete(TIndex j) throw();
+
+    bool            SearchPivot(TIndex& r,TIndex& c) const throw();
+    void            Eliminate(TIndex k,TIndex r,TIndex c) throw();
+
+};
+
+
+#endif
@@ -24,6 +24,8 @@
 
 class sparseRepresentation : public graphRepresentation
 {
+    friend class sparseScanner;
+
 protected:
 
     TNode*          SN;     ///< Start node indices
@@ -45,6 +47,20 @@ public:
     /// The operation may happen only in an initial state with mMax = nMax = 0
     void ReadIncidences(goblinImport& F) throw(ERParse);
 
+    /// \brief Restore the incidence structure from a binary file
+    ///
+    /// \param F  A mapped binary file
+    ///
+    /// This copies the start node indices, the incidence lists and, if present,
+    /// the subgraph multiplicities from the mapped file. The node and arc
+    /// capacities must have been set by graphRepresentation::Reserve() before
+    void ReadBinary(const goblinBinaryImport& F) throw(ERParse);
+
+    /// \brief Write the incidence structure to a binary file
+    ///
+    /// \param F  An export object in binary mode
+    void WriteBinary(goblinExport& F) const throw();
+
     /// \brief Set the attribute capacities to the expected object dimensions
     ///
     /// \param _n  The expected number of graph nodes
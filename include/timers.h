@@ -42,6 +42,24 @@ private:
     TFloat      lowerBound;
     TFloat      upperBound;
 
+public:
+
+    /// \brief  Operation counters which are maintained by some solver methods
+    enum TOperationCounter {
+        COUNT_PUSH = 0,             ///< Push operations of push / relabel methods
+        COUNT_RELABEL = 1,          ///< Relabel operations of push / relabel methods
+        COUNT_GLOBAL_RELABEL = 2,   ///< Exact distance label updates
+        COUNT_GAP = 3,              ///< Applications of the gap heuristics
+        NoCounter = 4
+    };
+
+    /// \brief  Counter names, used by the timer report
+    static const char* counterName[NoCounter];
+
+private:
+
+    unsigned long   opCounter[NoCounter];
+
 public:
 
     enum TProgressOptions {
@@ -88,6 +106,14 @@ public:
     void        SetProgressMax(double) throw();
     double      ProgressCounter() const throw() {return progressCounter;};
     double      ProgressMax() const throw() {return maxCounter;};
+
+    /// \brief  Add to an operation counter
+    ///
+    /// The counters are reset whenever the timer is started, so that the
+    /// final values refer to the latest round
+    void        IncreaseCounter(TOperationCounter i,unsigned long delta = 1) throw()
+                    {opCounter[i] += delta;};
+    unsigned long  Counter(TOperationCounter i) const throw() {return opCounter[i];};
     TProgressOptions    ProgressMode() const throw() {return progressMode;};
 
 };
@@ -0,0 +1,122 @@
+
+//  This file forms part of the GOBLIN C++ Class Library.
+//
+//  Initially written by the GOBLIN developers, October 2026
+//
+//  Copying, compiling, distribution and modification
+//  of this source code is permitted only in accordance
+//  with the GOBLIN general licence information.
+
+/// \file   twoLevelTour.h
+/// \brief  #twoLevelTour class interface
+
+#ifndef _TWO_LEVEL_TOUR_H_
+#define _TWO_LEVEL_TOUR_H_
+
+#include "managedObject.h"
+
+
+/// \brief  Hamiltonian cycles represented by two-level doubly linked lists
+///
+/// The tour is split into O(sqrt(n)) segments of consecutive nodes. Every
+/// segment carries a reversal bit, so that a path can be reversed by splitting
+/// at most two segments and then reversing the order of the segments in
+/// between. This takes O(sqrt(n)) operations, other than the O(n) operations
+/// required for array representations. Segments are rebalanced when splitting
+/// has doubled their number.
+///
+/// The class is intended for local search procedures like 2-opt, Or-opt and
+/// Lin-Kernighan which query the tour neighbours of nodes and reverse paths
+/// again and again.
+
+class twoLevelTour : public managedObject
+{
+private:
+
+    TNode       n;          // Number of tour nodes
+    TNode       nSeg;       // Number of segments in use
+    TNode       segTarget;  // Segment length after a rebalancing step
+    bool        reversed;   // Global reversal bit
+
+    TNode*      seg;        // Segment of every node
+    TNode*      id;         // Increasing node indices in segment order
+    TNode*      next;       // Successors in segment order or NoNode
+    TNode*      prev;       // Predecessors in segment order or NoNode
+
+    TNode*      segFirst;   // First node of every segment in segment order
+    TNode*      segLast;    // Last node of every segment in segment order
+    TNode*      segSize;    // Number of nodes of every segment
+    char*       segRev;     // Reversal bits of the segments
+    TNode*      segNext;    // Cyclic order of the segments
+    TNode*      segPrev;
+    TNode*      segRank;    // Positions in the cyclic order of segments
+    TNode*      segFree;    // Stack of unused segment indices
+    TNode       nFree;
+
+    TNode*      buffer;     // Node sequence for rebalancing
+
+public:
+
+    /// \brief  Constructor for two-level tour representations
+    ///
+    /// \param nn           The number of tour nodes
+    /// \param thisContext  The context to which this object is attached
+    twoLevelTour(TNode nn,goblinController& thisContext = goblinDefaultContext) throw();
+    ~twoLevelTour() throw();
+
+    unsigned long   Size() const throw();
+    unsigned long   Allocated() const throw();
+
+    /// \brief  Initialize the tour
+    ///
+    /// \param order  An array which lists all nodes in tour order
+    void            Init(const TNode* order) throw(ERRejected);
+
+    /// \brief  Retrieve the successor of a node
+    ///
+    /// \param v  A node index ranged [0,1,..,n-1]
+    /// \return   The node following v on the tour
+    TNode           Next(TNode v) const throw();
+
+    /// \brief  Retrieve the predecessor of a node
+    ///
+    /// \param v  A node index ranged [0,1,..,n-1]
+    /// \return   The node preceding v on the tour
+    TNode           Prev(TNode v) const throw();
+
+    /// \brief  Check if a node lies on a given tour path
+    ///
+    /// \param a  The start node of the path
+    /// \param b  The node to be checked
+    /// \param c  The end node of the path
+    /// \retval true  If b is on the path from a to c, end nodes included
+    bool            Between(TNode a,TNode b,TNode c) const throw();
+
+    /// \brief  Reverse a tour path
+    ///
+    /// \param a  The start node of the path
+    /// \param b  The end node of the path
+    ///
+    /// If p and q denote the predecessor of a and the successor of b before
+    /// the operation, the tour runs from p to b, back to a and then to q
+    /// afterwards.
+    void            Reverse(TNode a,TNode b) throw();
+
+private:
+
+    TNode           SegSucc(TNode v) const throw();
+    TNode           SegPred(TNode v) const throw();
+    bool            SegPrecedes(TNode u,TNode v) const throw();
+    bool            SegBetween(TNode a,TNode b,TNode c) const throw();
+
+    void            SplitBefore(TNode v) throw();
+    void            Split(TNode s,TNode u) throw();
+    void            ReverseSegments(TNode s1,TNode s2) throw();
+    void            ReverseSegPath(TNode a,TNode b) throw();
+    void            UpdateRanks() throw();
+    void            Rebalance() throw();
+
+};
+
+
+#endif
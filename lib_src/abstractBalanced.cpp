@@ -315,7 +315,7 @@ void abstractBalancedFNW::BalAugment(TArc* pred,TNode u,TNode v,TFloat Lambda)
         LogEntry(LOG_METH2,CT.logBuffer);
         LogEntry(LOG_METH2,"Path in reverse order:");
         OpenFold();
-        sprintf(CT.logBuffer,"(%ld",w);
+        sprintf(CT.logBuffer,"(%ld",(unsigned long)w);
         LH = LogStart(LOG_METH2,CT.logBuffer);
     }
 
@@ -342,7 +342,7 @@ void abstractBalancedFNW::BalAugment(TArc* pred,TNode u,TNode v,TFloat Lambda)
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"[%ld]%ld",a,w);
+            sprintf(CT.logBuffer,"[%ld]%ld",(unsigned long)a,(unsigned long)w);
             LogAppend(LH,CT.logBuffer);
         }
 
@@ -403,7 +403,7 @@ TFloat abstractBalancedFNW::FindBalCap(TArc* pred,TNode u,TNode v) throw(ERRange
 
         if (Lambda==0)
         {
-            sprintf(CT.logBuffer,"Arc %ld has capacity %g",a,BalCap(a));
+            sprintf(CT.logBuffer,"Arc %ld has capacity %g",(unsigned long)a,BalCap(a));
             Error(ERR_CHECK,"FindBalCap",CT.logBuffer);
         }
 
@@ -430,8 +430,8 @@ void abstractBalancedFNW::CancelEven() throw()
 
             if (floor(thisCap+0.01)-floor(thisCap-0.01)<0.5)
             {
-                sprintf(CT.logBuffer,"Arc %ld is non-integral",a);
-                InternalError("CancelEven",CT.logBuffer);
+                sprintf(CT.logBuffer,"Arc %ld is non-integral",(unsigned long)a);
+                InternalError1("CancelEven");
             }
         }
     }
@@ -487,7 +487,7 @@ cout << "===========================\n";
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer," %ld (%ld)",v,a);
+                sprintf(CT.logBuffer," %ld (%ld)",(unsigned long)v,(unsigned long)a);
 
                 if (LH==NoHandle)
                 {
@@ -508,7 +508,7 @@ cout << "===========================\n";
 
                 if (CT.logMeth>1)
                 {
-                    sprintf(CT.logBuffer," %ld",u);
+                    sprintf(CT.logBuffer," %ld",(unsigned long)u);
                     LogEnd(LH,CT.logBuffer);
                     LogEntry(LOG_METH2,"...Fractional arcs cancelled");
                     LH = NoHandle;
@@ -553,7 +553,7 @@ cout << "===========================\n";
 
                 if (CT.logMeth>1)
                 {
-                    sprintf(CT.logBuffer," %ld",u);
+                    sprintf(CT.logBuffer," %ld",(unsigned long)u);
                     LogEnd(LH,CT.logBuffer);
                     LogEntry(LOG_METH2,"...New odd cycle found");
                     LH = NoHandle;
@@ -590,7 +590,7 @@ cout << "===========================\n";
 
                 if (CT.logMeth>1)
                 {
-                    sprintf(CT.logBuffer," %ld",u);
+                    sprintf(CT.logBuffer," %ld",(unsigned long)u);
                     LogEnd(LH,CT.logBuffer);
                     LogEntry(LOG_METH2,"...Odd cycle cancelled");
                     LH = LogStart(LOG_METH2,"");
@@ -618,7 +618,7 @@ cout << "===========================\n";
     if (CT.logMeth>1)
     {
         LogEnd(LH);
-        sprintf(CT.logBuffer,"...Keeping %ld odd cycles uncancelled",k);
+        sprintf(CT.logBuffer,"...Keeping %ld odd cycles uncancelled",(unsigned long)k);
         LogEntry(LOG_METH2,CT.logBuffer);
     }
 
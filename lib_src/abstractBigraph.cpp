@@ -65,7 +65,7 @@ void abstractBiGraph::RandomArcs(TArc _m) throw(ERRejected)
 
     if (CT.logMan && _m>0)
     {
-        sprintf(CT.logBuffer,"Generating %ld edges...",_m);
+        sprintf(CT.logBuffer,"Generating %ld edges...",(unsigned long)_m);
         LogEntry(LOG_MAN,CT.logBuffer);
     }
 
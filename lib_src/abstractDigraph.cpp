@@ -78,7 +78,7 @@ void abstractDiGraph::Augment(TArc* pred,TNode u,TNode v,TFloat Lambda)
         LogEntry(LOG_METH2,CT.logBuffer);
         LogEntry(LOG_METH2,"Path in reverse order:");
         OpenFold();
-        sprintf(CT.logBuffer,"(%ld",w);
+        sprintf(CT.logBuffer,"(%ld",(unsigned long)w);
         LH = LogStart(LOG_METH2,CT.logBuffer);
     }
 
@@ -110,7 +110,7 @@ void abstractDiGraph::Augment(TArc* pred,TNode u,TNode v,TFloat Lambda)
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"[%ld]%ld",a,w);
+            sprintf(CT.logBuffer,"[%ld]%ld",(unsigned long)a,(unsigned long)w);
             LogAppend(LH,CT.logBuffer);
         }
 
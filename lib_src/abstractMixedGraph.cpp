@@ -18,8 +18,12 @@
 #include "basicHeap.h"
 #include "fibonacciHeap.h"
 #include "binaryHeap.h"
+#include "dAryHeap.h"
+#include "radixHeap.h"
 #include "denseRepresentation.h"
 #include "sparseBigraph.h"
+#include "csrRepresentation.h"
+#include "adjacencyIndex.h"
 
 
 // ------------------------------------------------------
@@ -39,6 +43,7 @@ abstractMixedGraph::abstractMixedGraph(TNode nn,TArc mm) throw() :
     partition = NULL;
     nHeap = NULL;
     adj = NULL;
+    frozen = NULL;
 
     sDeg = NULL;
     sDegIn = NULL;
@@ -59,6 +64,7 @@ abstractMixedGraph::abstractMixedGraph(TNode nn,TArc mm) throw() :
 abstractMixedGraph::~abstractMixedGraph() throw()
 {
     ReleaseInvestigators();
+    Unfreeze();
     ReleasePredecessors();
     ReleaseLabels();
     ReleasePartition();
@@ -83,13 +89,13 @@ void abstractMixedGraph::CheckLimits() throw(ERRejected)
 
     if (n>=CT.MaxNode())
     {
-        sprintf(CT.logBuffer,"Number of nodes is out of range: %ld",n);
+        sprintf(CT.logBuffer,"Number of nodes is out of range: %ld",(unsigned long)n);
         Error(ERR_REJECTED,"CheckLimits",CT.logBuffer);
     }
 
     if (2*m>CT.MaxArc()-2)
     {
-        sprintf(CT.logBuffer,"Number of arcs is out of range: %ld",m);
+        sprintf(CT.logBuffer,"Number of arcs is out of range: %ld",(unsigned long)m);
         Error(ERR_REJECTED,"CheckLimits",CT.logBuffer);
     }
 
@@ -108,6 +114,7 @@ unsigned long abstractMixedGraph::Allocated() const throw()
     if (sDegIn!=NULL)           tmpSize += n*sizeof(TFloat);
     if (sDegOut!=NULL)          tmpSize += n*sizeof(TFloat);
     if (face!=NULL)             tmpSize += 2*m*sizeof(TNode);
+    if (frozen!=NULL)           tmpSize += frozen->Size();
 
     return tmpSize;
 }
@@ -129,6 +136,13 @@ goblinQueue<TNode,TFloat> * abstractMixedGraph::NewNodeHeap() throw(ERRejected)
         {
             return new fibonacciHeap<TNode,TFloat>(n,CT);
         }
+        case 3:
+        case 4:
+        {
+            // Radix heaps are restricted to monotone integral keys,
+            // see NewMonotoneNodeHeap()
+            return new dAryHeap<TNode,TFloat>(n,CT);
+        }
     }
 
     UnknownOption("NewNodeHeap",CT.methPQ);
@@ -137,6 +151,14 @@ goblinQueue<TNode,TFloat> * abstractMixedGraph::NewNodeHeap() throw(ERRejected)
 }
 
 
+goblinQueue<TNode,TFloat> * abstractMixedGraph::NewMonotoneNodeHeap() throw(ERRejected)
+{
+    if (CT.methPQ!=1 && CT.methPQ!=4) return NewNodeHeap();
+
+    return new radixHeap<TNode,TFloat>(n,CT);
+}
+
+
 goblinQueue<TArc,TFloat> * abstractMixedGraph::NewArcHeap() throw(ERRejected)
 {
     switch (CT.methPQ)
@@ -153,6 +175,11 @@ goblinQueue<TArc,TFloat> * abstractMixedGraph::NewArcHeap() throw(ERRejected)
         {
             return new fibonacciHeap<TArc,TFloat>(m,CT);
         }
+        case 3:
+        case 4:
+        {
+            return new dAryHeap<TArc,TFloat>(m,CT);
+        }
     }
 
     UnknownOption("NewArcHeap",CT.methPQ);
@@ -253,7 +280,7 @@ TArc abstractMixedGraph::InsertArc(TNode u,TNode v) throw(ERRange,ERRejected)
     {
         // This happens if the graph is bipartite,
         // and u and v are in the same partition
-        sprintf(CT.logBuffer,"Nodes %ld and %ld are non-adjacent",u,v);
+        sprintf(CT.logBuffer,"Nodes %ld and %ld are non-adjacent",(unsigned long)u,(unsigned long)v);
         Error(ERR_REJECTED,"InsertArc",CT.logBuffer);
     }
 
@@ -315,7 +342,7 @@ TArc abstractMixedGraph::InsertArc(TNode u,TNode v,TCap cc,TFloat ll,TCap bb)
     {
         // This happens if the graph is bipartite,
         // and u and v are in the same partition
-        sprintf(CT.logBuffer,"Nodes %ld and %ld are non-adjacent",u,v);
+        sprintf(CT.logBuffer,"Nodes %ld and %ld are non-adjacent",(unsigned long)u,(unsigned long)v);
         Error(ERR_REJECTED,"InsertArc",CT.logBuffer);
     }
 
@@ -344,7 +371,8 @@ TNode abstractMixedGraph::InsertNode() throw(ERRange,ERRejected)
     n++;
     TNode ret = static_cast<sparseRepresentation*>(X)->InsertNode();
 
-    ReleaseAdjacencies();
+    if (adj) adj -> AppendNode();
+
     ReleasePartition();
 
     if (sDegIn)
@@ -421,7 +449,7 @@ void abstractMixedGraph::RandomArcs(TArc _m) throw(ERRejected)
 
     if (m+_m>=CT.MaxArc())
     {
-        sprintf(CT.logBuffer,"Number of arcs is out of range: %ld",m);
+        sprintf(CT.logBuffer,"Number of arcs is out of range: %ld",(unsigned long)m);
         Error(ERR_REJECTED,"RandomArcs",CT.logBuffer);
     }
 
@@ -429,7 +457,7 @@ void abstractMixedGraph::RandomArcs(TArc _m) throw(ERRejected)
 
     if (CT.logMan && _m>0)
     {
-        sprintf(CT.logBuffer,"Generating %ld edges...",_m);
+        sprintf(CT.logBuffer,"Generating %ld edges...",(unsigned long)_m);
         LogEntry(LOG_MAN,CT.logBuffer);
     }
 
@@ -458,7 +486,7 @@ void abstractMixedGraph::RandEulerian(TArc _m) throw(ERRejected)
 
     if (m+_m>=CT.MaxArc() || _m<2)
     {
-        sprintf(CT.logBuffer,"Number of arcs is out of range: %ld",m);
+        sprintf(CT.logBuffer,"Number of arcs is out of range: %ld",(unsigned long)m);
         Error(ERR_REJECTED,"RandEulerian",CT.logBuffer);
     }
 
@@ -466,7 +494,7 @@ void abstractMixedGraph::RandEulerian(TArc _m) throw(ERRejected)
 
     if (CT.logMan)
     {
-        sprintf(CT.logBuffer,"Generating eulerian cycle of length %ld...",_m);
+        sprintf(CT.logBuffer,"Generating eulerian cycle of length %ld...",(unsigned long)_m);
         LogEntry(LOG_MAN,CT.logBuffer);
     }
 
@@ -503,7 +531,7 @@ void abstractMixedGraph::RandRegular(TArc k) throw(ERRejected)
 
     if (n&k&1)
     {
-        sprintf(CT.logBuffer,"Parity mismatch: n=%ld, k=%ld",n,k);
+        sprintf(CT.logBuffer,"Parity mismatch: n=%ld, k=%ld",(unsigned long)n,(unsigned long)k);
         Error(ERR_REJECTED,"RandRegular",CT.logBuffer);
     }
 
@@ -564,7 +592,7 @@ void abstractMixedGraph::RandRegular(TArc k) throw(ERRejected)
 
     if (CT.logMan)
     {
-        sprintf(CT.logBuffer,"...Random %ld-regular graph generated",k);
+        sprintf(CT.logBuffer,"...Random %ld-regular graph generated",(unsigned long)k);
         LogEntry(LOG_MAN,CT.logBuffer);
     }
 }
@@ -684,6 +712,57 @@ abstractMixedGraph::TMetricType abstractMixedGraph::MetricType() const throw()
 }
 
 
+TFloat abstractMixedGraph::MetricDistance(TMetricType metricType,TNode u,TNode v)
+    const throw(ERRange)
+{
+    #if defined(_FAILSAVE_)
+
+    if (u>=n) NoSuchNode("MetricDistance",u);
+
+    if (v>=n) NoSuchNode("MetricDistance",v);
+
+    #endif
+
+    TFloat x1 = C(u,0);
+    TFloat y1 = C(u,1);
+    TFloat x2 = C(v,0);
+    TFloat y2 = C(v,1);
+
+    if (metricType==METRIC_SPHERIC)
+    {
+        const double radius = 6378.388;
+
+        double deg = int(x1);
+        double min = x1-deg;
+        double latitude1 = PI*(deg+5.0*min/3.0)/180.0;
+        deg = int(y1);
+        min = y1-deg;
+        double longitude1 = PI*(deg+5.0*min/3.0)/180.0;
+
+        deg = int(x2);
+        min = x2-deg;
+        double latitude2 = PI*(deg+5.0*min/3.0)/180.0;
+        deg = int(y2);
+        min = y2-deg;
+        double longitude2 = PI*(deg+5.0*min/3.0)/180.0;
+
+        double q1 = cos(longitude1-longitude2);
+        double q2 = cos(latitude1-latitude2);
+        double q3 = cos(latitude1+latitude2);
+        return radius*acos(0.5*((1.0+q1)*q2-(1.0-q1)*q3));
+    }
+
+    TFloat dx = fabs(x1-x2);
+    TFloat dy = fabs(y1-y2);
+
+    if (metricType==METRIC_MANHATTAN) return dx+dy;
+    if (metricType==METRIC_EUCLIDIAN) return sqrt(dx*dx+dy*dy);
+
+    // metricType==METRIC_MAXIMUM
+    return ((dx>dy) ? dx : dy);
+}
+
+
 void abstractMixedGraph::SetSourceNode(TNode s) throw(ERRange)
 {
     #if defined(_FAILSAVE_)
@@ -898,6 +977,69 @@ bool abstractMixedGraph::CLength() const throw()
 }
 
 
+bool abstractMixedGraph::IntegralLengths() const throw()
+{
+    // Every path length must be a valid radix heap key
+    TFloat maxLength = MaxRadixHeapKey/(2*TFloat(n)+1);
+
+    if (frozen)
+    {
+        return frozen->IntegralLengths() && frozen->MaxLength()<=maxLength;
+    }
+
+    if (m==0) return true;
+
+    if (CLength() && MetricType()==METRIC_DISABLED)
+    {
+        TFloat thisLength = Length(0);
+
+        return (   thisLength>=0 && thisLength<=maxLength
+                && thisLength==floor(thisLength));
+    }
+
+    for (TArc a=0;a<m;a++)
+    {
+        TFloat thisLength = Length(2*a);
+
+        if (   thisLength<0 || thisLength>maxLength
+            || thisLength!=floor(thisLength)
+           )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+TFloat abstractMixedGraph::MetricLengthRatio() const throw()
+{
+    if (frozen) return frozen->MetricLengthRatio();
+
+    TMetricType metricType = MetricType();
+
+    if (metricType==METRIC_DISABLED) return 0;
+
+    TFloat ratio = 1;
+
+    for (TArc a=0;a<m;a++)
+    {
+        TNode u = StartNode(2*a);
+        TNode v = EndNode(2*a);
+
+        if (u==v) continue;
+
+        TFloat thisLength = Length(2*a);
+        TFloat thisDistance = MetricDistance(metricType,u,v);
+
+        if (thisLength<ratio*thisDistance) ratio = thisLength/thisDistance;
+    }
+
+    return ratio;
+}
+
+
 char abstractMixedGraph::Orientation(TArc a) const throw(ERRange)
 {
     const graphRepresentation* X = Representation();
@@ -1102,63 +1244,55 @@ TArc abstractMixedGraph::Adjacency(TNode u,TNode v,TMethAdjacency method) const
 
     TArc a = NoArc;
 
-    if (adj==NULL)
+    if (adj==NULL && method==ADJ_MATRIX && m>0)
     {
-        if (method==ADJ_MATRIX)
-        {
-            if (m>0)
-            {
-                adj = new goblinHashTable<TArc,TArc>(n*n,2*m,NoArc,CT);
-
-                for (TArc a1=0;a1<2*m;a1++)
-                {
-                    TNode u0 = StartNode(a1);
-                    TNode v0 = EndNode(a1);
-                    TArc a0 = u0*n+v0;
-                    TArc a2 = adj->Key(a0);
+        adj = new adjacencyIndex(*this);
+    }
 
-                    // Check if a1 is preferable before a2
+    if (adj!=NULL)
+    {
+        // The arcs connecting u and v are consecutive and ordered by
+        // increasing indices. Prefer the first non-blocking arc
 
-                    if (a2==NoArc || (Blocking(a2) && !Blocking(a1)))
-                    {
-                        adj -> ChangeKey(a0,a1);
-                        continue;
-                    }
+        TArc k = adj->First(u,v);
 
-                    if (Blocking(a1) && !Blocking(a2)) continue;
+        if (k!=NoArc)
+        {
+            a = adj->Arc(u,k);
 
-                    if (a1<a2) adj -> ChangeKey(a0,a1);
+            for (;k<adj->Degree(u) && adj->Neighbour(u,k)==v;k++)
+            {
+                if (!Blocking(adj->Arc(u,k)))
+                {
+                    a = adj->Arc(u,k);
+                    break;
                 }
-
-                a = adj->Key(u*n+v);
             }
         }
-        else // (method==ADJ_SEARCH)
-        {
-            TArc a0 = First(u);
-
-            if (a0!=NoArc && EndNode(a0)==v) a = a0;
-
-            while (a0!=NoArc && Right(a0,u)!=First(u))
-            {
-                a0 = Right(a0,u);
+    }
+    else if (method==ADJ_SEARCH)
+    {
+        TArc a0 = First(u);
 
-                if (EndNode(a0)!=v) continue;
+        if (a0!=NoArc && EndNode(a0)==v) a = a0;
 
-                if (a==NoArc || (Blocking(a) && !Blocking(a0)))
-                {
-                    a = a0;
-                    continue;
-                }
+        while (a0!=NoArc && Right(a0,u)!=First(u))
+        {
+            a0 = Right(a0,u);
 
-                if (Blocking(a0) && !Blocking(a)) continue;
+            if (EndNode(a0)!=v) continue;
 
-                if (a0<a) a = a0;
+            if (a==NoArc || (Blocking(a) && !Blocking(a0)))
+            {
+                a = a0;
+                continue;
             }
 
+            if (Blocking(a0) && !Blocking(a)) continue;
+
+            if (a0<a) a = a0;
         }
     }
-    else a = adj->Key(u*n+v);
 
     if (a==NoArc)
     {
@@ -1166,7 +1300,7 @@ TArc abstractMixedGraph::Adjacency(TNode u,TNode v,TMethAdjacency method) const
 
         if (CT.logWarn)
         {
-            sprintf(CT.logBuffer,"Nodes are non-adjacent: %ld, %ld",u,v);
+            sprintf(CT.logBuffer,"Nodes are non-adjacent: %ld, %ld",(unsigned long)u,(unsigned long)v);
             Error(MSG_WARN,"Adjacency",CT.logBuffer);
         }
 
@@ -1181,7 +1315,7 @@ TArc abstractMixedGraph::Adjacency(TNode u,TNode v,TMethAdjacency method) const
         if (CT.logRes>2)
         {
             sprintf(CT.logBuffer,
-                "The nodes %ld and %ld are adjacent by the arc %ld",u,v,a);
+                "The nodes %ld and %ld are adjacent by the arc %ld",(unsigned long)u,(unsigned long)v,(unsigned long)a);
             LogEntry(LOG_RES2,CT.logBuffer);
         }
 
@@ -1205,13 +1339,40 @@ void abstractMixedGraph::MarkAdjacency(TNode u,TNode v,TArc a)
 
     if (a>=2*m && a!=NoArc) NoSuchArc("MarkAdjacency",a);
 
-    if (a!=NoArc && (StartNode(a)!=u || EndNode(a)!=v || Blocking(a)))
+    if (a!=NoArc && (StartNode(a)!=u || EndNode(a)!=v))
         Error(ERR_REJECTED,"MarkAdjacency","Mismatching end nodes");
 
     #endif
 
-    TArc a0 = u*n+v;
-    adj -> ChangeKey(a0,a);
+    if (a==NoArc)
+    {
+        adj -> DeleteAll(u,v);
+        adj -> DeleteAll(v,u);
+        return;
+    }
+
+    adj -> Insert(u,v,a);
+    adj -> Insert(v,u,a^1);
+}
+
+
+void abstractMixedGraph::UnmarkAdjacency(TArc a) throw(ERRange)
+{
+    if (adj==NULL) return;
+
+    #if defined(_FAILSAVE_)
+
+    if (a>=2*m) NoSuchArc("UnmarkAdjacency",a);
+
+    #endif
+
+    TNode u = StartNode(a);
+    TNode v = EndNode(a);
+
+    if (u==NoNode || v==NoNode) return;
+
+    adj -> Delete(u,v,a);
+    adj -> Delete(v,u,a^1);
 }
 
 
@@ -1433,6 +1594,33 @@ void abstractMixedGraph::StripInvestigators() const throw()
 }
 
 
+void abstractMixedGraph::Freeze() const throw(ERRejected)
+{
+    if (frozen) return;
+
+    #if defined(_FAILSAVE_)
+
+    if (n==0) Error(ERR_REJECTED,"Freeze","Graph is empty");
+
+    #endif
+
+    LogEntry(LOG_MEM,"Freezing node incidences...");
+
+    frozen = new csrRepresentation(*this);
+}
+
+
+void abstractMixedGraph::Unfreeze() const throw()
+{
+    if (!frozen) return;
+
+    delete frozen;
+    frozen = NULL;
+
+    LogEntry(LOG_MEM,"...Frozen incidences released");
+}
+
+
 void abstractMixedGraph::Bud(TNode v) throw(ERRange)
 {
     #if defined(_FAILSAVE_)
@@ -1598,7 +1786,7 @@ TNode abstractMixedGraph::Face(TArc a) throw(ERRange)
 }
 
 
-TNode abstractMixedGraph::OriginalNode(TArc v) const throw(ERRange)
+TIndex abstractMixedGraph::OriginalNode(TNode v) const throw(ERRange)
 {
     #if defined(_FAILSAVE_)
 
@@ -1765,7 +1953,7 @@ void abstractMixedGraph::SetNodeColour(TNode v,TNode thisColour) throw(ERRange)
 
     if (thisColour>=n && thisColour!=NoNode)
     {
-        sprintf(CT.logBuffer,"Illegal assignment: %ld",thisColour);
+        sprintf(CT.logBuffer,"Illegal assignment: %ld",(unsigned long)thisColour);
         Error(MSG_WARN,"SetNodeColour",CT.logBuffer);
     }
 
@@ -1793,7 +1981,7 @@ void abstractMixedGraph::SetEdgeColour(TArc a,TArc thisColour) throw(ERRange)
 
     if (thisColour>=m && thisColour!=NoArc)
     {
-        sprintf(CT.logBuffer,"Illegal assignment: %ld",thisColour);
+        sprintf(CT.logBuffer,"Illegal assignment: %ld",(unsigned long)thisColour);
         Error(MSG_WARN,"SetEdgeColour",CT.logBuffer);
     }
 
@@ -2082,6 +2270,16 @@ void abstractMixedGraph::InitSubgraph() throw()
 {
     ReleaseDegrees();
 
+    graphRepresentation* X = Representation();
+
+    if (X)
+    {
+        // Without an allocated subgraph, the lower capacity bounds apply.
+        // This avoids m hash table operations for dense graphs
+        X -> ReleaseSubgraph();
+        return;
+    }
+
     for (TArc a=0;a<m;a++) SetSub(2*a,LCap(2*a));
 }
 
@@ -2250,6 +2448,20 @@ void abstractMixedGraph::ReleaseArcMapping() throw()
 }
 
 
+const char* abstractMixedGraph::FileClassLabel() const throw()
+{
+    if (IsBalanced()) return "balanced_fnw";
+
+    if (IsBipartite()) return (IsDense()) ? "dense_bigraph" : "bigraph";
+
+    if (IsDirected()) return (IsDense()) ? "dense_digraph" : "digraph";
+
+    if (IsUndirected()) return (IsDense()) ? "dense_graph" : "graph";
+
+    return "mixed";
+}
+
+
 void abstractMixedGraph::Write(const char* fileName) const throw(ERFile)
 {
     #if defined(_TIMERS_)
@@ -2258,45 +2470,7 @@ void abstractMixedGraph::Write(const char* fileName) const throw(ERFile)
 
     #endif
 
-    char* className = "mixed";
-
-    if (IsBalanced())
-    {
-        className = "balanced_fnw";
-    }
-    else if (IsBipartite())
-    {
-        if (IsDense())
-        {
-            className = "dense_bigraph";
-        }
-        else
-        {
-            className = "bigraph";
-        }
-    }
-    else if (IsDirected())
-    {
-        if (IsDense())
-        {
-            className = "dense_digraph";
-        }
-        else
-        {
-            className = "digraph";
-        }
-    }
-    else if (IsUndirected())
-    {
-        if (IsDense())
-        {
-            className = "dense_graph";
-        }
-        else
-        {
-            className = "graph";
-        }
-    }
+    const char* className = FileClassLabel();
 
     sprintf(CT.logBuffer,"Writing \"%s\" object to \"%s\"...",className,fileName);
     LogEntry(LOG_IO,CT.logBuffer);
@@ -2358,6 +2532,59 @@ void abstractMixedGraph::Write(const char* fileName) const throw(ERFile)
 }
 
 
+void abstractMixedGraph::WriteBinary(const char* fileName) const throw(ERFile,ERRejected)
+{
+    const graphRepresentation* X = Representation();
+
+    if (!X || IsDense())
+    {
+        Error(ERR_REJECTED,"WriteBinary","Binary format requires a sparse representation");
+    }
+
+    #if defined(_TIMERS_)
+
+    CT.globalTimer[TimerIO] -> Enable();
+
+    #endif
+
+    const char* className = FileClassLabel();
+
+    sprintf(CT.logBuffer,"Writing \"%s\" object to binary file \"%s\"...",className,fileName);
+    LogEntry(LOG_IO,CT.logBuffer);
+
+    TNode n1 = n;
+
+    if (IsBipartite())
+    {
+        const abstractBiGraph* G = static_cast<const abstractBiGraph*>(this);
+        n1 = G->N1();
+    }
+
+    goblinExport F(fileName,CT,goblinExport::EXP_BINARY);
+
+    F.WriteBinaryHeader(className,n,n1,ni,m,Source(),Target(),Root());
+
+    static_cast<const sparseRepresentation*>(X) -> WriteBinary(F);
+    RepresentationalData() -> WriteBinary(F,BIN_POOL_REPRESENTATION);
+    Geometry() -> WriteBinary(F,BIN_POOL_GEOMETRY);
+    LayoutData() -> WriteBinary(F,BIN_POOL_LAYOUT);
+    registers.WriteBinary(F,BIN_POOL_REGISTERS);
+
+    CT.sourceNode = Source();
+    CT.targetNode = Target();
+    CT.rootNode = Root();
+    F.WriteConfiguration(this);
+
+    F.WriteBinaryEnd();
+
+    #if defined(_TIMERS_)
+
+    CT.globalTimer[TimerIO] -> Disable();
+
+    #endif
+}
+
+
 void abstractMixedGraph::WriteSpecial(goblinExport& F,const attributePool& pool,TPoolEnum token) const throw()
 {
     if (&pool==&registers)
@@ -2411,8 +2638,13 @@ void abstractMixedGraph::WriteUCap(goblinExport* F) const throw()
         size_t lLength = CT.ExternalLength<TCap>(MaxUCap());
         F -> StartTuple("ucap",10);
 
-        for (TArc a=0;a<m;a++)
-            F -> MakeFloatItem((TFloat)UCap(2*a),lLength);
+        TFloat* value = new TFloat[m];
+
+        for (TArc a=0;a<m;a++) value[a] = (TFloat)UCap(2*a);
+
+        F -> MakeItems<TFloat>(value,m,InfFloat,lLength);
+
+        delete[] value;
     }
 
     F -> EndTuple();
@@ -2431,8 +2663,13 @@ void abstractMixedGraph::WriteLCap(goblinExport* F) const throw()
         size_t lLength = CT.ExternalLength<TCap>(MaxLCap());
         F -> StartTuple("lcap",10);
 
-        for (TArc a=0;a<m;a++)
-            F -> MakeFloatItem((TFloat)LCap(2*a),lLength);
+        TFloat* value = new TFloat[m];
+
+        for (TArc a=0;a<m;a++) value[a] = (TFloat)LCap(2*a);
+
+        F -> MakeItems<TFloat>(value,m,InfFloat,lLength);
+
+        delete[] value;
     }
 
     F -> EndTuple();
@@ -2451,8 +2688,13 @@ void abstractMixedGraph::WriteLength(goblinExport* F) const throw()
         size_t lLength = CT.ExternalLength<TCap>(MaxLength());
         F -> StartTuple("length",10);
 
-        for (TArc a=0;a<m;a++)
-            F -> MakeFloatItem((TFloat)Length(2*a),lLength);
+        TFloat* value = new TFloat[m];
+
+        for (TArc a=0;a<m;a++) value[a] = (TFloat)Length(2*a);
+
+        F -> MakeItems<TFloat>(value,m,InfFloat,lLength);
+
+        delete[] value;
     }
 
     F -> EndTuple();
@@ -2471,8 +2713,13 @@ void abstractMixedGraph::WriteDemand(goblinExport* F) const throw()
         size_t lLength = CT.ExternalLength<TCap>(MaxDemand());
         F -> StartTuple("demand",10);
 
-        for (TNode v=0;v<n;v++)
-            F -> MakeFloatItem(Demand(v),lLength);
+        TFloat* value = new TFloat[n];
+
+        for (TNode v=0;v<n;v++) value[v] = (TFloat)Demand(v);
+
+        F -> MakeItems<TFloat>(value,n,InfFloat,lLength);
+
+        delete[] value;
     }
 
     F -> EndTuple();
@@ -2536,7 +2783,13 @@ void abstractMixedGraph::WriteGeometry(goblinExport* F) const throw()
             sprintf(strToken,"axis%u",i);
             F -> StartTuple(strToken,10);
 
-            for (TNode v=0;v<n+ni;v++) F -> MakeFloatItem(C(v,i),xLength);
+            TFloat* value = new TFloat[n+ni];
+
+            for (TNode v=0;v<n+ni;v++) value[v] = C(v,i);
+
+            F -> MakeItems<TFloat>(value,n+ni,InfFloat,xLength);
+
+            delete[] value;
 
             F -> EndTuple();
         }
@@ -2593,7 +2846,13 @@ void abstractMixedGraph::WriteSubgraph(goblinExport& F) const throw()
             if (thisLength>length) length = thisLength;
         }
 
-        for (TArc a=0;a<m;a++) F.MakeFloatItem(Sub(2*a),length);
+        TFloat* value = new TFloat[m];
+
+        for (TArc a=0;a<m;a++) value[a] = Sub(2*a);
+
+        F.MakeItems<TFloat>(value,m,InfFloat,length);
+
+        delete[] value;
 
         F.EndTuple();
     }
@@ -2712,6 +2971,39 @@ void abstractMixedGraph::ReadAllData(goblinImport& F) throw(ERParse)
 }
 
 
+void abstractMixedGraph::ReadBinary(const goblinBinaryImport& F) throw(ERParse)
+{
+    graphRepresentation* X = Representation();
+
+    if (!X || IsDense())
+    {
+        Error(ERR_PARSE,"ReadBinary","Binary format requires a sparse representation");
+    }
+
+    const TBinaryFileHeader& header = F.Header();
+
+    n = TNode(header.n);
+    ni = TNode(header.ni);
+    m = TArc(header.m);
+
+    CheckLimits();
+
+    X -> Reserve(n,m,n+ni);
+    static_cast<sparseRepresentation*>(X) -> ReadBinary(F);
+
+    RepresentationalData() -> ReadBinary(*this,F,BIN_POOL_REPRESENTATION);
+    Geometry() -> ReadBinary(*this,F,BIN_POOL_GEOMETRY);
+    LayoutData() -> ReadBinary(*this,F,BIN_POOL_LAYOUT);
+    registers.ReadBinary(*this,F,BIN_POOL_REGISTERS);
+
+    F.ReadConfiguration();
+
+    CT.sourceNode = TNode(header.source);
+    CT.targetNode = TNode(header.target);
+    CT.rootNode = TNode(header.root);
+}
+
+
 void abstractMixedGraph::ReadNNodes(goblinImport& F) throw(ERParse)
 {
     TNode* nodes = F.GetTNodeTuple(3);
@@ -2773,7 +3065,7 @@ void abstractMixedGraph::ReadSubgraph(goblinImport& F) throw(ERParse)
 
         if (fabs(thisSub)<LCap(2*a) || fabs(thisSub)>UCap(2*a))
         {
-            sprintf(CT.logBuffer,"Arc multiplicity exeeds capacity bounds: %ld",a);
+            sprintf(CT.logBuffer,"Arc multiplicity exeeds capacity bounds: %ld",(unsigned long)a);
             Error(ERR_RANGE,"ReadSubgraph",CT.logBuffer);
         }
 
@@ -2841,7 +3133,7 @@ char* abstractMixedGraph::Display() const throw(ERRejected,ERFile)
 
 void abstractMixedGraph::TextDisplay(TNode i,TNode j) const throw()
 {
-    sprintf(CT.logBuffer,"Graph has %ld nodes and %ld arcs",n,m);
+    sprintf(CT.logBuffer,"Graph has %ld nodes and %ld arcs",(unsigned long)n,(unsigned long)m);
     LogEntry(MSG_TRACE,CT.logBuffer);
 
     if (m==0) return;
@@ -2924,7 +3216,7 @@ void abstractMixedGraph::TextDisplay(TNode i,TNode j) const throw()
         LogEnd(LH);
 
         LogEntry(MSG_TRACE2,"");
-        sprintf(CT.logBuffer,"Node %ld",v);
+        sprintf(CT.logBuffer,"Node %ld",(unsigned long)v);
         LH = LogStart(MSG_TRACE2,CT.logBuffer);
 
         if (CMax(0)!=0 || CMax(1)!=0)
@@ -2970,9 +3262,9 @@ void abstractMixedGraph::TextDisplay(TNode i,TNode j) const throw()
 
             if (StartNode(a)!=v)
             {
-                sprintf(CT.logBuffer,"Incidence mismatch: %ld",a);
+                sprintf(CT.logBuffer,"Incidence mismatch: %ld",(unsigned long)a);
                 Error(MSG_WARN,"TextDisplay",CT.logBuffer);
-                sprintf(CT.logBuffer,"Concerning nodes %ld and %ld",v,StartNode(a));
+                sprintf(CT.logBuffer,"Concerning nodes %ld and %ld",(unsigned long)v,(unsigned long)StartNode(a));
                 Error(MSG_WARN,"TextDisplay",CT.logBuffer);
             }
 
@@ -3075,7 +3367,7 @@ void abstractMixedGraph::DisplayPath(TNode u,TNode v) throw(ERRange,ERRejected)
     TNode w = v;
 
     LogEntry(LOG_RES,"Encoded path in reverse order:");
-    sprintf(CT.logBuffer," (%ld",w);
+    sprintf(CT.logBuffer," (%ld",(unsigned long)w);
     THandle LH = LogStart(LOG_RES,CT.logBuffer);
 
     while (w!=u || count==0)
@@ -3083,7 +3375,7 @@ void abstractMixedGraph::DisplayPath(TNode u,TNode v) throw(ERRange,ERRejected)
         TArc a = pred[w];
         l += Length(a);
         w = StartNode(a);
-        sprintf(CT.logBuffer,", %ld",w);
+        sprintf(CT.logBuffer,", %ld",(unsigned long)w);
         LogAppend(LH,CT.logBuffer);
         count++;
 
@@ -3097,7 +3389,7 @@ void abstractMixedGraph::DisplayPath(TNode u,TNode v) throw(ERRange,ERRejected)
     LogEnd(LH,")");
     sprintf(CT.logBuffer,"Total length: %g",l);
     LogEntry(LOG_RES,CT.logBuffer);
-    sprintf(CT.logBuffer,"Total number of arcs: %ld",count);
+    sprintf(CT.logBuffer,"Total number of arcs: %ld",(unsigned long)count);
     LogEntry(LOG_RES,CT.logBuffer);
 }
 
@@ -3129,7 +3421,7 @@ TFloat abstractMixedGraph::CutCapacity(TFloat separator) throw(ERCheck)
 
             if (UCap(a)>0 && CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"%ld[%g] ",a,UCap(a));
+                sprintf(CT.logBuffer,"%ld[%g] ",(unsigned long)a,UCap(a));
                 LogAppend(LH,CT.logBuffer);
             }
 
@@ -3256,7 +3548,7 @@ void abstractMixedGraph::ExportToAscii(const char* fileName,TOption format)
 
         for (size_t k=0;k<lrow;k++) expFile << "-";
 
-        sprintf(CT.logBuffer,"Node %ld",v);
+        sprintf(CT.logBuffer,"Node %ld",(unsigned long)v);
         expFile << endl << CT.logBuffer;
 
         if (CMax(0)!=0 || CMax(1)!=0)
@@ -3300,9 +3592,9 @@ void abstractMixedGraph::ExportToAscii(const char* fileName,TOption format)
 
             if (StartNode(a)!=v)
             {
-                sprintf(CT.logBuffer,"Incidence mismatch: %ld",a);
+                sprintf(CT.logBuffer,"Incidence mismatch: %ld",(unsigned long)a);
                 Error(MSG_WARN,"TextDisplay",CT.logBuffer);
-                sprintf(CT.logBuffer,"Concerning nodes %ld and %ld",v,StartNode(a));
+                sprintf(CT.logBuffer,"Concerning nodes %ld and %ld",(unsigned long)v,(unsigned long)StartNode(a));
                 Error(MSG_WARN,"TextDisplay",CT.logBuffer);
             }
 
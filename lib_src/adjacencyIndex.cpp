@@ -0,0 +1,230 @@
+
+//  This file forms part of the GOBLIN C++ Class Library.
+//
+//  Initially written by the GOBLIN developers, October 2026
+//
+//  Copying, compiling, distribution and modification
+//  of this source code is permitted only in accordance
+//  with the GOBLIN general licence information.
+
+/// \file   adjacencyIndex.cpp
+/// \brief  #adjacencyIndex class implementation
+
+#include "adjacencyIndex.h"
+
+
+adjacencyIndex::adjacencyIndex(const abstractMixedGraph& G) throw() :
+    managedObject(G.Context())
+{
+    n = G.N();
+    TArc m2 = 2*G.M();
+
+    degree    = new TArc[n];
+    capacity  = new TArc[n];
+    neighbour = new TNode*[n];
+    arc       = new TArc*[n];
+
+    // First pass: Bucket the arcs by their end nodes. Within every bucket,
+    // the arcs are ordered by increasing indices
+
+    TArc* bucket = new TArc[n+1];
+    TArc* byEndNode = new TArc[m2];
+
+    for (TNode v=0;v<=n;v++) bucket[v] = 0;
+
+    for (TNode u=0;u<n;u++) degree[u] = 0;
+
+    for (TArc a=0;a<m2;a++)
+    {
+        TNode u = G.StartNode(a);
+        TNode v = G.EndNode(a);
+
+        if (u==NoNode || v==NoNode) continue;
+
+        bucket[v+1]++;
+        degree[u]++;
+    }
+
+    for (TNode v=0;v<n;v++) bucket[v+1] += bucket[v];
+
+    for (TArc a=0;a<m2;a++)
+    {
+        TNode u = G.StartNode(a);
+        TNode v = G.EndNode(a);
+
+        if (u==NoNode || v==NoNode) continue;
+
+        byEndNode[bucket[v]++] = a;
+    }
+
+    TArc nIndexed = (n>0) ? bucket[n-1] : 0;
+
+    // Second pass: Distribute the arcs to the lists of their start nodes.
+    // This results in lists ordered by the end nodes and the arc indices
+
+    for (TNode u=0;u<n;u++)
+    {
+        capacity[u] = degree[u];
+        neighbour[u] = (degree[u]>0) ? new TNode[degree[u]] : NULL;
+        arc[u] = (degree[u]>0) ? new TArc[degree[u]] : NULL;
+        degree[u] = 0;
+    }
+
+    for (TArc i=0;i<nIndexed;i++)
+    {
+        TArc a = byEndNode[i];
+        TNode u = G.StartNode(a);
+
+        neighbour[u][degree[u]] = G.EndNode(a);
+        arc[u][degree[u]] = a;
+        degree[u]++;
+    }
+
+    delete[] bucket;
+    delete[] byEndNode;
+
+    LogEntry(LOG_MEM,"...Adjacency index allocated");
+}
+
+
+adjacencyIndex::~adjacencyIndex() throw()
+{
+    for (TNode u=0;u<n;u++)
+    {
+        delete[] neighbour[u];
+        delete[] arc[u];
+    }
+
+    delete[] degree;
+    delete[] capacity;
+    delete[] neighbour;
+    delete[] arc;
+
+    LogEntry(LOG_MEM,"...Adjacency index disallocated");
+}
+
+
+unsigned long adjacencyIndex::Size() const throw()
+{
+    return
+          sizeof(adjacencyIndex)
+        + managedObject::Allocated()
+        + adjacencyIndex::Allocated();
+}
+
+
+unsigned long adjacencyIndex::Allocated() const throw()
+{
+    unsigned long tmpSize = n*(2*sizeof(TArc)+sizeof(TNode*)+sizeof(TArc*));
+
+    for (TNode u=0;u<n;u++) tmpSize += capacity[u]*(sizeof(TNode)+sizeof(TArc));
+
+    return tmpSize;
+}
+
+
+void adjacencyIndex::AppendNode() throw()
+{
+    n++;
+
+    degree    = (TArc*)GoblinRealloc(degree,n*sizeof(TArc));
+    capacity  = (TArc*)GoblinRealloc(capacity,n*sizeof(TArc));
+    neighbour = (TNode**)GoblinRealloc(neighbour,n*sizeof(TNode*));
+    arc       = (TArc**)GoblinRealloc(arc,n*sizeof(TArc*));
+
+    degree[n-1] = capacity[n-1] = 0;
+    neighbour[n-1] = NULL;
+    arc[n-1] = NULL;
+}
+
+
+TArc adjacencyIndex::LowerBound(TNode u,TNode v,TArc a) const throw()
+{
+    const TNode* thisNeighbour = neighbour[u];
+    const TArc* thisArc = arc[u];
+    TArc lower = 0;
+    TArc upper = degree[u];
+
+    while (lower<upper)
+    {
+        TArc k = lower+(upper-lower)/2;
+
+        if (thisNeighbour[k]<v || (thisNeighbour[k]==v && thisArc[k]<a))
+        {
+            lower = k+1;
+        }
+        else upper = k;
+    }
+
+    return lower;
+}
+
+
+void adjacencyIndex::Insert(TNode u,TNode v,TArc a) throw()
+{
+    TArc k = LowerBound(u,v,a);
+
+    if (k<degree[u] && neighbour[u][k]==v && arc[u][k]==a) return;
+
+    if (degree[u]==capacity[u])
+    {
+        capacity[u] = (capacity[u]>0) ? 2*capacity[u] : 2;
+        neighbour[u] = (TNode*)GoblinRealloc(neighbour[u],capacity[u]*sizeof(TNode));
+        arc[u] = (TArc*)GoblinRealloc(arc[u],capacity[u]*sizeof(TArc));
+    }
+
+    for (TArc i=degree[u];i>k;i--)
+    {
+        neighbour[u][i] = neighbour[u][i-1];
+        arc[u][i] = arc[u][i-1];
+    }
+
+    neighbour[u][k] = v;
+    arc[u][k] = a;
+    degree[u]++;
+}
+
+
+void adjacencyIndex::Delete(TNode u,TNode v,TArc a) throw()
+{
+    TArc k = LowerBound(u,v,a);
+
+    if (k>=degree[u] || neighbour[u][k]!=v || arc[u][k]!=a) return;
+
+    degree[u]--;
+
+    for (TArc i=k;i<degree[u];i++)
+    {
+        neighbour[u][i] = neighbour[u][i+1];
+        arc[u][i] = arc[u][i+1];
+    }
+}
+
+
+void adjacencyIndex::DeleteAll(TNode u,TNode v) throw()
+{
+    TArc k = LowerBound(u,v,0);
+    TArc l = k;
+
+    while (l<degree[u] && neighbour[u][l]==v) l++;
+
+    if (l==k) return;
+
+    for (TArc i=l;i<degree[u];i++)
+    {
+        neighbour[u][i-(l-k)] = neighbour[u][i];
+        arc[u][i-(l-k)] = arc[u][i];
+    }
+
+    degree[u] -= l-k;
+}
+
+
+TArc adjacencyIndex::First(TNode u,TNode v) const throw()
+{
+    TArc k = LowerBound(u,v,0);
+
+    if (k<degree[u] && neighbour[u][k]==v) return k;
+
+    return NoArc;
+}
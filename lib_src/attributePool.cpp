@@ -323,6 +323,172 @@ void attributePool::WritePool(const goblinRootObject& X,goblinExport& F,const ch
 }
 
 
+// Attribute values are copied from and to binary files as raw arrays. The
+// boolean attributes are encapsulated by bit vectors and therefore converted.
+
+template <typename T>
+static void CopyBinaryValues(attribute<T>* A,const void* data,size_t length) throw()
+{
+    if (length>A->Size()) length = A->Size();
+
+    if (length>0) memcpy(A->GetArray(),data,length*sizeof(T));
+
+    A -> ReleaseBounds();
+}
+
+
+template <>
+void CopyBinaryValues(attribute<bool>* A,const void* data,size_t length) throw()
+{
+    if (length>A->Size()) length = A->Size();
+
+    vector<bool>& values = *(A->GetVector());
+    const char* items = static_cast<const char*>(data);
+
+    for (size_t i=0;i<length;i++) values[i] = (items[i]!=0);
+
+    A -> ReleaseBounds();
+}
+
+
+template <typename T>
+static void WriteBinaryValues(goblinExport& F,unsigned short pool,TPoolEnum token,
+    TBaseType baseType,attribute<T>* A) throw()
+{
+    T defaultValue = A->DefaultValue();
+    F.WriteBinaryBlock(pool,token,baseType,A->Size(),
+        (A->Size()>0) ? A->GetArray() : NULL,&defaultValue);
+}
+
+
+template <>
+void WriteBinaryValues(goblinExport& F,unsigned short pool,TPoolEnum token,
+    TBaseType baseType,attribute<bool>* A) throw()
+{
+    vector<bool>& values = *(A->GetVector());
+    char* items = new char[values.size()+1];
+
+    for (size_t i=0;i<values.size();i++) items[i] = values[i];
+
+    char defaultValue = A->DefaultValue();
+    F.WriteBinaryBlock(pool,token,baseType,values.size(),items,&defaultValue);
+
+    delete[] items;
+}
+
+
+void attributePool::ReadBinary(goblinRootObject& X,const goblinBinaryImport& F,
+    unsigned short pool) throw()
+{
+    for (unsigned long i=0;i<F.NumBlocks();i++)
+    {
+        const TBinaryBlockHeader& block = F.Block(i);
+
+        if (block.pool!=pool || block.token>=dim) continue;
+
+        TPoolEnum thisToken = TPoolEnum(table[block.token].primaryIndex);
+
+        // Blocks with special or inconsistent types are skipped
+        if (table[thisToken].arrayType!=TBaseType(block.baseType)) continue;
+
+        TAttributeType attributeType = (block.length>0) ? ATTR_REQ_SINGLETON : ATTR_ALLOW_NULL;
+        void* defaultValue = const_cast<char*>(block.defaultValue);
+        const void* data = F.Data(i);
+
+        switch (table[thisToken].arrayType)
+        {
+            case TYPE_NODE_INDEX:
+            {
+                CopyBinaryValues(MakeAttribute<TNode>(X,thisToken,attributeType,defaultValue),
+                    data,block.length);
+                break;
+            }
+            case TYPE_ARC_INDEX:
+            {
+                CopyBinaryValues(MakeAttribute<TArc>(X,thisToken,attributeType,defaultValue),
+                    data,block.length);
+                break;
+            }
+            case TYPE_FLOAT_VALUE:
+            {
+                CopyBinaryValues(MakeAttribute<TFloat>(X,thisToken,attributeType,defaultValue),
+                    data,block.length);
+                break;
+            }
+            case TYPE_CAP_VALUE:
+            {
+                CopyBinaryValues(MakeAttribute<TCap>(X,thisToken,attributeType,defaultValue),
+                    data,block.length);
+                break;
+            }
+            case TYPE_INDEX:
+            {
+                CopyBinaryValues(MakeAttribute<TIndex>(X,thisToken,attributeType,defaultValue),
+                    data,block.length);
+                break;
+            }
+            case TYPE_ORIENTATION:
+            {
+                CopyBinaryValues(MakeAttribute<char>(X,thisToken,attributeType,defaultValue),
+                    data,block.length);
+                break;
+            }
+            case TYPE_INT:
+            {
+                CopyBinaryValues(MakeAttribute<int>(X,thisToken,attributeType,defaultValue),
+                    data,block.length);
+                break;
+            }
+            case TYPE_BOOL:
+            {
+                bool boolDefault = (block.defaultValue[0]!=0);
+                CopyBinaryValues(MakeAttribute<bool>(X,thisToken,attributeType,&boolDefault),
+                    data,block.length);
+                break;
+            }
+            case TYPE_VAR_INDEX:
+            {
+                CopyBinaryValues(MakeAttribute<TVar>(X,thisToken,attributeType,defaultValue),
+                    data,block.length);
+                break;
+            }
+            case TYPE_RESTR_INDEX:
+            {
+                CopyBinaryValues(MakeAttribute<TRestr>(X,thisToken,attributeType,defaultValue),
+                    data,block.length);
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+    }
+}
+
+
+void attributePool::WriteBinary(goblinExport& F,unsigned short pool) const throw()
+{
+    list<attributeBase*>::const_iterator I = attributes.begin();
+    list<TPoolEnum>::const_iterator J = tokens.begin();
+
+    while (I != attributes.end())
+    {
+        if (   table[(*J)].arrayType!=TYPE_SPECIAL
+            && table[(*J)].arrayType!=TYPE_STRING
+           )
+        {
+            #define _STATEMENT WriteBinaryValues(F,pool,*J,table[(*J)].arrayType,A);
+            #include "switchBaseTypes.h"
+            #undef _STATEMENT
+        }
+
+        I++;
+        J++;
+    }
+}
+
+
 attributeBase* attributePool::FindAttribute(TPoolEnum token) const throw()
 {
     // Handle synonymous tokens
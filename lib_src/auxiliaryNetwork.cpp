@@ -303,7 +303,7 @@ TFloat layeredAuxNetwork::FindPath(TNode t) throw(ERRange,ERRejected)
 
     if (CT.logMeth>1)
     {
-        sprintf(CT.logBuffer,"Augmenting by path (%ld",v);
+        sprintf(CT.logBuffer,"Augmenting by path (%ld",(unsigned long)v);
         LH = LogStart(LOG_METH2,CT.logBuffer);
     }
 
@@ -330,7 +330,7 @@ TFloat layeredAuxNetwork::FindPath(TNode t) throw(ERRange,ERRejected)
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,",%ld",v);
+            sprintf(CT.logBuffer,",%ld",(unsigned long)v);
             LogAppend(LH,CT.logBuffer);
         }
 
@@ -368,7 +368,7 @@ void layeredAuxNetwork::TopErasure(TArc a) throw(ERRange,ERRejected)
 
     if (CT.logMeth>1)
     {
-        sprintf(CT.logBuffer,"Node %ld has indegree %ld",x,currentDegree[x]);
+        sprintf(CT.logBuffer,"Node %ld has indegree %ld",(unsigned long)x,(unsigned long)currentDegree[x]);
         LogEntry(LOG_METH2,CT.logBuffer);
     }
 
@@ -385,7 +385,7 @@ void layeredAuxNetwork::TopErasure(TArc a) throw(ERRange,ERRejected)
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"Deleting node %ld...",x);
+                sprintf(CT.logBuffer,"Deleting node %ld...",(unsigned long)x);
                 LogEntry(LOG_METH2,CT.logBuffer);
                 OpenFold();
             }
@@ -405,8 +405,8 @@ void layeredAuxNetwork::TopErasure(TArc a) throw(ERRange,ERRejected)
 
                     if (CT.logMeth>1)
                     {
-                        sprintf(CT.logBuffer,"Node %ld has indegree %ld",y,
-                            currentDegree[y]);
+                        sprintf(CT.logBuffer,"Node %ld has indegree %ld",(unsigned long)y,
+                            (unsigned long)currentDegree[y]);
                         LogEntry(LOG_METH2,CT.logBuffer);
                     }
 
@@ -41,9 +41,18 @@ balancedFNW::balancedFNW(const char* fileName,goblinController& _CT)
     if (!CT.logIO && CT.logMem)
         LogEntry(LOG_MEM,"Loading balanced flow network...");
 
-    goblinImport F(fileName,CT);
-    F.Scan("balanced_fnw");
-    ReadAllData(F);
+    if (goblinBinaryImport::IsBinaryFile(fileName))
+    {
+        goblinBinaryImport F(fileName,CT);
+        F.CheckObjectClass("balanced_fnw");
+        ReadBinary(F);
+    }
+    else
+    {
+        goblinImport F(fileName,CT);
+        F.Scan("balanced_fnw");
+        ReadAllData(F);
+    }
 
     n1 = n>>1;
 
@@ -66,7 +66,7 @@ balancedToBalanced::balancedToBalanced(abstractBalancedFNW& _G) throw() :
 
     if (CT.logRes)
     {
-        sprintf(CT.logBuffer,"%ld odd length cycles eliminated",k2);
+        sprintf(CT.logBuffer,"%ld odd length cycles eliminated",(unsigned long)k2);
         LogEntry(LOG_RES,CT.logBuffer);
     }
 
@@ -100,12 +100,12 @@ balancedToBalanced::balancedToBalanced(abstractBalancedFNW& _G) throw() :
         {
             if (i==0)
             {
-                sprintf(CT.logBuffer,"Canonical elements: %ld",repr[2*(k2-i-1)]);
+                sprintf(CT.logBuffer,"Canonical elements: %ld",(unsigned long)repr[2*(k2-i-1)]);
                 LH = LogStart(LOG_METH2,CT.logBuffer);
             }
             else
             {
-                sprintf(CT.logBuffer,",%ld",repr[2*(k2-i-1)]);
+                sprintf(CT.logBuffer,",%ld",(unsigned long)repr[2*(k2-i-1)]);
                 LogAppend(LH,CT.logBuffer);
             }
         }
@@ -90,7 +90,7 @@ char* basicHeap<TItem,TKey>::Display() const throw()
 
         for (TItem i=0;i<maxIndex;i++)
         {
-            sprintf(this->CT.logBuffer,"%ld[%g]",v[i],key[v[i]]);
+            sprintf(this->CT.logBuffer,"%ld[%g]",(unsigned long)v[i],key[v[i]]);
             this -> LogAppend(LH,this->CT.logBuffer);
 
             if (i<maxIndex-1)
@@ -196,7 +196,7 @@ void basicHeap<TItem,TKey>::Delete(TItem w) throw(ERRange,ERRejected)
 
     if (alpha==InfFloat)
     {
-        sprintf(this->CT.logBuffer,"Not a member: %ld",w);
+        sprintf(this->CT.logBuffer,"Not a member: %ld",(unsigned long)w);
         this->Error(ERR_REJECTED,"Delete",this->CT.logBuffer);
     }
 
@@ -259,7 +259,7 @@ void basicHeap<TItem,TKey>::ChangeKey(TItem w,TKey alpha) throw(ERRange,ERReject
 
     if (key[w]==InfFloat)
     {
-        sprintf(this->CT.logBuffer,"Not a member: %ld",w);
+        sprintf(this->CT.logBuffer,"Not a member: %ld",(unsigned long)w);
         this->Error(ERR_REJECTED,"ChangeKey",this->CT.logBuffer);
     }
 
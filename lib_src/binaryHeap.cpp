@@ -92,7 +92,7 @@ unsigned long binaryHeap<TItem,TKey>::Allocated() const throw()
 }
 
 
-static THandle LH = NoHandle;
+static __thread THandle LH;
 
 template <class TItem,class TKey>
 char* binaryHeap<TItem,TKey>::Display() const throw()
@@ -146,7 +146,7 @@ void binaryHeap<TItem,TKey>::Display(TItem i) const throw(ERRange)
 
     if (i!=index[v[i]])
     {
-        sprintf(this->CT.logBuffer,"Inconsistent index: %ld",i);
+        sprintf(this->CT.logBuffer,"Inconsistent index: %ld",(unsigned long)i);
         InternalError1("Display");
     }
 
@@ -155,7 +155,7 @@ void binaryHeap<TItem,TKey>::Display(TItem i) const throw(ERRange)
     TItem left = 2*i;
     TItem right = left+1;
 
-    sprintf(this->CT.logBuffer,"%ld[%g]",v[i],key[v[i]]);
+    sprintf(this->CT.logBuffer,"%ld[%g]",(unsigned long)v[i],key[v[i]]);
     this -> LogAppend(LH,this->CT.logBuffer);
 
     if (left<=maxIndex)
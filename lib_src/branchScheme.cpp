@@ -90,6 +90,12 @@ branchScheme<TIndex,TObj>::branchScheme(branchNode<TIndex,TObj>* root,
     nDFS = 0;
     depth = root->depth;
     firstActive = NULL;
+    progressEstimate = 0;
+    nThreads = 1;
+    nBusy = 0;
+    busy = NULL;
+    busyBound = NULL;
+    finished = false;
     savedObjective = aPrioriBound;
     bestBound = root->Objective();
 
@@ -168,7 +174,7 @@ branchScheme<TIndex,TObj>::branchScheme(branchNode<TIndex,TObj>* root,
 
     if (CT.logMeth==1 || CT.logGaps>0)
     {
-        sprintf(CT.logBuffer,"...Total number of branch nodes: %ld",nIterations);
+        sprintf(CT.logBuffer,"...Total number of branch nodes: %ld",(unsigned long)nIterations);
         LogEntry(LOG_METH,CT.logBuffer);
     }
 
@@ -228,9 +234,31 @@ unsigned long branchScheme<TIndex,TObj>::Allocated() const throw()
 }
 
 
+template <class TIndex,class TObj>
+bool branchScheme<TIndex,TObj>::Proceed(TObj thisBound) throw()
+{
+    return (   CT.SolverRunning() && nActive>0
+            && nActive<unsigned(CT.maxBBNodes)*100
+            && (level!=SEARCH_FEASIBLE || !feasible)
+            && (   sign*thisBound<=sign*savedObjective+CT.epsilon-1
+                || (sign*thisBound<=sign*savedObjective+CT.epsilon && !feasible) )
+            && (   CT.maxBBIterations<0
+                || nIterations<unsigned(CT.maxBBIterations)*1000 )
+           );
+}
+
+
 template <class TIndex,class TObj>
 void branchScheme<TIndex,TObj>::Optimize() throw()
 {
+    if (CT.methBranch==BRANCH_PARALLEL) nThreads = CT.NumThreads();
+
+    if (nThreads>1)
+    {
+        OptimizeParallel();
+        return;
+    }
+
     branchNode<TIndex,TObj> *activeNode = NULL;
     branchNode<TIndex,TObj> *leftChild = NULL;
     branchNode<TIndex,TObj> *rightChild = NULL;
@@ -239,18 +267,11 @@ void branchScheme<TIndex,TObj>::Optimize() throw()
 
     InitProgressCounter(1);
 
-    double combEstimate = 0;
-
     #endif
 
-    while (   CT.SolverRunning() && nActive>0
-           && nActive<unsigned(CT.maxBBNodes)*100
-           && (level!=SEARCH_FEASIBLE || !feasible)
-           && (   sign*bestBound<=sign*savedObjective+CT.epsilon-1
-               || (sign*bestBound<=sign*savedObjective+CT.epsilon && !feasible) )
-           && (   CT.maxBBIterations<0
-               || nIterations<unsigned(CT.maxBBIterations)*1000 )
-          )
+    progressEstimate = 0;
+
+    while (Proceed(bestBound))
     {
         activeNode = SelectActiveNode();
 
@@ -326,33 +347,272 @@ void branchScheme<TIndex,TObj>::Optimize() throw()
         if (deleteLeft) delete leftChild;
         if (deleteRight) delete rightChild;
 
-        #if defined(_PROGRESS_)
+        ReportProgress();
+    }
+
+    if (CT.logMeth>1 && CT.logGaps==0) LogEnd(LH,"  STOP");
+}
+
+
+template <class TIndex,class TObj>
+void branchScheme<TIndex,TObj>::ReportProgress() throw()
+{
+    #if defined(_PROGRESS_)
+
+    double thisEstimate =
+        sqrt((nIterations+1-2*nActive)/(nIterations+1.0));
 
-        double thisEstimate =
-            sqrt((nIterations+1-2*nActive)/(nIterations+1.0));
+    // Filter the progress counter used for display
+    progressEstimate = 0.85*progressEstimate + 0.15*thisEstimate;
+    double thisEstimate2 =
+            progressEstimate*progressEstimate*progressEstimate*progressEstimate;
 
-        // Filter the progress counter used for display
-        combEstimate = 0.85*combEstimate + 0.15*thisEstimate;
-        double thisEstimate2 =
-                combEstimate*combEstimate*combEstimate*combEstimate;
+    if (CT.maxBBIterations>0)
+    {
+        // At least, in the DFS case, a different estimation is required
+        double thisEstimate3 = nIterations/(CT.maxBBIterations*1000.0);
 
-        if (CT.maxBBIterations>0)
+        if (thisEstimate2<thisEstimate3)
         {
-            // At least, in the DFS case, a different estimation is required
-            double thisEstimate3 = nIterations/(CT.maxBBIterations*1000.0);
+            thisEstimate2 = thisEstimate3;
+        }
+    }
+
+    SetProgressCounter(thisEstimate2);
+
+    #endif
+}
+
+
+template <class TIndex,class TObj>
+void branchScheme<TIndex,TObj>::OptimizeParallel() throw()
+{
+    #if defined(_PROGRESS_)
+
+    InitProgressCounter(1);
+
+    #endif
+
+    progressEstimate = 0;
+
+    if (CT.logMeth==1 || CT.logGaps>0)
+    {
+        sprintf(CT.logBuffer,"Starting %u worker threads...",nThreads);
+        LogEntry(LOG_METH,CT.logBuffer);
+    }
+
+    pthread_mutex_init(&schemeLock,NULL);
+    pthread_cond_init(&poolChanged,NULL);
+
+    nBusy = 0;
+    finished = false;
+    busy = new char[nThreads];
+    busyBound = new TObj[nThreads];
+
+    for (unsigned i=0;i<nThreads;i++) busy[i] = 0;
+
+    pthread_t* threads = new pthread_t[nThreads];
+    TWorkerArg* args = new TWorkerArg[nThreads];
+
+    for (unsigned i=0;i<nThreads;i++)
+    {
+        args[i].S = this;
+        args[i].id = i;
+    }
+
+    for (unsigned i=1;i<nThreads;i++)
+    {
+        pthread_create(&threads[i],NULL,WorkerEntry,&args[i]);
+    }
+
+    Worker(0);
+
+    for (unsigned i=1;i<nThreads;i++) pthread_join(threads[i],NULL);
+
+    delete[] threads;
+    delete[] args;
+    delete[] busy;
+    delete[] busyBound;
+    busy = NULL;
+    busyBound = NULL;
+
+    pthread_cond_destroy(&poolChanged);
+    pthread_mutex_destroy(&schemeLock);
+
+    // All evaluated nodes have been either queued or discarded by now
+    bestBound = savedObjective;
+    branchNode<TIndex,TObj> *thisNode = firstActive;
+
+    while (thisNode)
+    {
+        if (sign*(thisNode->Objective())<sign*bestBound)
+            bestBound = thisNode->Objective();
+
+        thisNode = thisNode->succNode;
+    }
+
+    if (CT.logMeth>1 && CT.logGaps==0) LogEnd(LH,"  STOP");
+}
+
+
+template <class TIndex,class TObj>
+void* branchScheme<TIndex,TObj>::WorkerEntry(void* arg) throw()
+{
+    TWorkerArg* thisArg = static_cast<TWorkerArg*>(arg);
+    thisArg -> S -> Worker(thisArg->id);
+
+    return NULL;
+}
+
+
+template <class TIndex,class TObj>
+TObj branchScheme<TIndex,TObj>::GlobalBound() const throw()
+{
+    TObj ret = bestBound;
+
+    for (unsigned i=0;i<nThreads;i++)
+    {
+        if (busy[i] && sign*busyBound[i]<sign*ret) ret = busyBound[i];
+    }
+
+    return ret;
+}
+
+
+template <class TIndex,class TObj>
+void branchScheme<TIndex,TObj>::Worker(unsigned id) throw()
+{
+    // The list of active nodes is shared by all worker threads. Only the
+    // relaxations are solved concurrently. Everything else, including any
+    // access to the context, is done while holding the scheme lock
+
+    branchNode<TIndex,TObj> *activeNode = NULL;
+    branchNode<TIndex,TObj> *leftChild = NULL;
+    branchNode<TIndex,TObj> *rightChild = NULL;
 
-            if (thisEstimate2<thisEstimate3)
+    pthread_mutex_lock(&schemeLock);
+
+    while (!finished)
+    {
+        if (nActive==0 && nBusy>0)
+        {
+            // Wait for the child nodes of the other workers
+            pthread_cond_wait(&poolChanged,&schemeLock);
+            continue;
+        }
+
+        if (!Proceed(GlobalBound()))
+        {
+            finished = true;
+            pthread_cond_broadcast(&poolChanged);
+            break;
+        }
+
+        activeNode = SelectActiveNode();
+        TObj activeBound = activeNode->Objective();
+
+        #if defined(_TRACING_)
+
+        TNode activeIndex = activeNode->index;
+
+        #endif
+
+        TIndex i = activeNode->SelectVariable();
+
+        typedef typename branchNode<TIndex,TObj>::TBranchDir TBranchDir;
+        TBranchDir dir =
+            activeNode->DirectionConstructive(i);
+
+        if (feasible) dir = activeNode->DirectionExhaustive(i);
+
+        leftChild = activeNode;
+        rightChild = activeNode->Clone();
+
+        rightChild -> Raise(i);
+        leftChild -> Lower(i);
+
+        busy[id] = 1;
+        busyBound[id] = activeBound;
+        nBusy++;
+
+        pthread_mutex_unlock(&schemeLock);
+
+        // The relaxations read the scheme state by Snapshot() which
+        // acquires the scheme lock again
+        goblinController::SetWorkerThread(true);
+        leftChild -> Objective();
+        rightChild -> Objective();
+        goblinController::SetWorkerThread(false);
+
+        pthread_mutex_lock(&schemeLock);
+
+        busy[id] = 0;
+        nBusy--;
+
+        bool deleteLeft = false;
+        bool deleteRight = false;
+
+        if (dir==branchNode<TIndex,TObj>::RAISE_FIRST)
+        {
+            deleteLeft = Inspect(leftChild);
+            if (CT.logMeth>1 && CT.logGaps==0) LogEnd(LH);
+            deleteRight = Inspect(rightChild);
+        }
+        else
+        {
+            deleteRight = Inspect(rightChild);
+            if (CT.logMeth>1 && CT.logGaps==0) LogEnd(LH);
+            deleteLeft = Inspect(leftChild);
+        }
+
+        // Other workers may select nodes before this log line is complete
+        if (CT.logMeth>1 && CT.logGaps==0) LogEnd(LH);
+        LH = NoHandle;
+
+        TObj thisBound = GlobalBound();
+
+        if (leftChild->ObjectSense()==MAXIMIZE)
+        {
+            if (LowerBound(leftChild->TimerModule())<=thisBound)
+                SetUpperBound(leftChild->TimerModule(),thisBound);
+        }
+        else
+        {
+            if (UpperBound(leftChild->TimerModule())>=thisBound)
+                SetLowerBound(leftChild->TimerModule(),thisBound);
+        }
+
+        #if defined(_TRACING_)
+
+        if (CT.traceLevel>1)
+        {
+            Tree->SetNodeColour(activeIndex,TNode(PROCESSED));
+
+            TArc a = 2*(Tree->InsertArc(activeIndex,leftChild->index));
+            Tree -> SetPred(leftChild->index,a);
+            Tree->Representation() -> SetLength(a,i);
+
+            a = 2*(Tree->InsertArc(activeIndex,rightChild->index));
+            Tree -> SetPred(rightChild->index,a);
+            Tree->Representation() -> SetLength(a,i);
+
+            if (CT.traceLevel==3 && nIterations>1)
             {
-                thisEstimate2 = thisEstimate3;
+                Tree->Layout_PredecessorTree();
             }
         }
 
-        SetProgressCounter(thisEstimate2);
-
         #endif
+
+        if (deleteLeft) delete leftChild;
+        if (deleteRight) delete rightChild;
+
+        ReportProgress();
+
+        pthread_cond_broadcast(&poolChanged);
     }
 
-    if (CT.logMeth>1 && CT.logGaps==0) LogEnd(LH,"  STOP");
+    pthread_mutex_unlock(&schemeLock);
 }
 
 
@@ -372,7 +632,7 @@ bool branchScheme<TIndex,TObj>::Inspect(branchNode<TIndex,TObj> *thisNode)
 
     if (CT.logMeth>=2 && CT.logGaps==0)
     {
-        sprintf(CT.logBuffer,"%9.1ld  ",nIterations);
+        sprintf(CT.logBuffer,"%9.1ld  ",(unsigned long)nIterations);
         LH = LogStart(LOG_METH2,CT.logBuffer);
 
         if (thisObjective!=thisNode->Infeasibility())
@@ -382,7 +642,7 @@ bool branchScheme<TIndex,TObj>::Inspect(branchNode<TIndex,TObj> *thisNode)
         }
         else LogAppend(LH,"     INFEASIBLE");
 
-        sprintf(CT.logBuffer,"  %6.1ld  ",thisNode->Unfixed());
+        sprintf(CT.logBuffer,"  %6.1ld  ",(unsigned long)thisNode->Unfixed());
         LogAppend(LH,CT.logBuffer);
     }
 
@@ -468,10 +728,10 @@ bool branchScheme<TIndex,TObj>::Inspect(branchNode<TIndex,TObj> *thisNode)
         else sprintf(CT.logBuffer,"%15.10g",savedObjective);
 
         if (bestBound==thisNode->Infeasibility())
-            sprintf(CT.logBuffer,"%s       INFEASIBLE",CT.logBuffer);
-        else sprintf(CT.logBuffer,"%s  %15.10g",CT.logBuffer,bestBound);
+            sprintf(CT.logBuffer+strlen(CT.logBuffer),"       INFEASIBLE");
+        else sprintf(CT.logBuffer+strlen(CT.logBuffer),"  %15.10g",bestBound);
 
-        sprintf(CT.logBuffer,"%s  %6.1ld",CT.logBuffer,nActive);
+        sprintf(CT.logBuffer+strlen(CT.logBuffer),"  %6.1ld",(unsigned long)nActive);
         LogAppend(LH,CT.logBuffer);
     }
 
@@ -500,6 +760,23 @@ void branchScheme<TIndex,TObj>::QueueExploredNode(branchNode<TIndex,TObj> *thisN
 }
 
 
+template <class TIndex,class TObj>
+void branchScheme<TIndex,TObj>::Snapshot(TIndex& thisIterations,
+    TSearchState& thisState,TObj& thisObjective) throw()
+{
+    // The busy flags are only allocated while the worker threads are running
+    bool parallel = (busy!=NULL);
+
+    if (parallel) pthread_mutex_lock(&schemeLock);
+
+    thisIterations = nIterations;
+    thisState = SearchState();
+    thisObjective = savedObjective;
+
+    if (parallel) pthread_mutex_unlock(&schemeLock);
+}
+
+
 template <class TIndex,class TObj>
 typename branchScheme<TIndex,TObj>::TSearchState branchScheme<TIndex,TObj>::SearchState() throw()
 {
@@ -644,4 +921,11 @@ template class branchScheme<TArc,TFloat>;
 
 #endif // _BIG_ARCS_
 
+#ifdef _INDEX_32_
+
+template class branchNode<TVar,TFloat>;
+template class branchScheme<TVar,TFloat>;
+
+#endif // _INDEX_32_
+
 #endif // DO_NOT_DOCUMENT_THIS
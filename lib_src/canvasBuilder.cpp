@@ -525,7 +525,7 @@ char* canvasBuilder::ArcLabel(TArc a,int option) throw(ERRejected)
         }
         case 1:
         {
-            sprintf(label,"%ld",a);
+            sprintf(label,"%ld",(unsigned long)a);
             break;
         }
         case 2:
@@ -557,13 +557,13 @@ char* canvasBuilder::ArcLabel(TArc a,int option) throw(ERRejected)
         }
         case 7:
         {
-            sprintf(label,"%ld",a+1);
+            sprintf(label,"%ld",(unsigned long)(a+1));
             break;
         }
         case 8:
         {
             if (G.EdgeColour(2*a)==NoArc) sprintf(label,"*");
-            else sprintf(label,"%ld",G.EdgeColour(2*a));
+            else sprintf(label,"%ld",(unsigned long)G.EdgeColour(2*a));
             break;
         }
         default:
@@ -628,7 +628,7 @@ char* canvasBuilder::NodeLabel(TNode v,int option) throw(ERRejected)
         }
         case 1:
         {
-            sprintf(label,"%ld",v);
+            sprintf(label,"%ld",(unsigned long)v);
             break;
         }
         case 2:
@@ -646,7 +646,7 @@ char* canvasBuilder::NodeLabel(TNode v,int option) throw(ERRejected)
         case 4:
         {
             if (G.NodeColour(v)==NoNode) return "*";
-            sprintf(label,"%ld",G.NodeColour(v));
+            sprintf(label,"%ld",(unsigned long)G.NodeColour(v));
             break;
         }
         case 5:
@@ -656,7 +656,7 @@ char* canvasBuilder::NodeLabel(TNode v,int option) throw(ERRejected)
         }
         case 6:
         {
-            sprintf(label,"%ld",v+1);
+            sprintf(label,"%ld",(unsigned long)(v+1));
             break;
         }
         default:
@@ -0,0 +1,112 @@
+
+//  This file forms part of the GOBLIN C++ Class Library.
+//
+//  Initially written by the GOBLIN developers, October 2026
+//
+//  Copying, compiling, distribution and modification
+//  of this source code is permitted only in accordance
+//  with the GOBLIN general licence information.
+
+/// \file   csrRepresentation.cpp
+/// \brief  #csrRepresentation class implementation
+
+#include "csrRepresentation.h"
+
+
+csrRepresentation::csrRepresentation(const abstractMixedGraph& G) throw() :
+    managedObject(G.Context())
+{
+    n = G.N();
+    nSlots = 2*G.M();
+
+    offset = new TArc[n+1];
+    arc    = new TArc[nSlots];
+    head   = new TNode[nSlots];
+    length = new TFloat[nSlots];
+    status = new char[nSlots];
+
+    TArc k = 0;
+    integralLengths = true;
+    maxLength = 0;
+
+    abstractMixedGraph::TMetricType metricType = G.MetricType();
+    metricLengthRatio = (metricType==abstractMixedGraph::METRIC_DISABLED) ? 0 : 1;
+
+    for (TNode v=0;v<n;v++)
+    {
+        offset[v] = k;
+
+        TArc a = G.First(v);
+
+        if (a==NoArc) continue;
+
+        do
+        {
+            arc[k]    = a;
+            head[k]   = G.EndNode(a);
+            length[k] = G.Length(a);
+            status[k] = 0;
+
+            if (G.UCap(a)>0) status[k] |= SLOT_CAPACITY;
+            if (G.Blocking(a)) status[k] |= SLOT_BLOCKING;
+            if (G.Blocking(a^1)) status[k] |= SLOT_REVERSE_BLOCKING;
+
+            if (length[k]<0 || length[k]!=floor(length[k])) integralLengths = false;
+            if (length[k]>maxLength) maxLength = length[k];
+
+            if (metricLengthRatio>0 && head[k]!=v)
+            {
+                TFloat thisDistance = G.MetricDistance(metricType,v,head[k]);
+
+                if (length[k]<metricLengthRatio*thisDistance)
+                {
+                    metricLengthRatio = length[k]/thisDistance;
+                }
+            }
+
+            k++;
+
+            a = G.Right(a,v);
+        }
+        while (a!=G.First(v) && k<nSlots);
+    }
+
+    offset[n] = k;
+
+    // Cancelled arcs are not part of any incidence list
+    nSlots = k;
+
+    LogEntry(LOG_MEM,"...Compressed incidences allocated");
+}
+
+
+unsigned long csrRepresentation::Size() const throw()
+{
+    return
+          sizeof(csrRepresentation)
+        + managedObject::Allocated()
+        + csrRepresentation::Allocated();
+}
+
+
+unsigned long csrRepresentation::Allocated() const throw()
+{
+    return
+          (n+1)*sizeof(TArc)    // offset[]
+        + nSlots*sizeof(TArc)   // arc[]
+        + nSlots*sizeof(TNode)  // head[]
+        + nSlots*sizeof(TFloat) // length[]
+        + nSlots*sizeof(char);  // status[]
+}
+
+
+csrRepresentation::~csrRepresentation() throw()
+{
+    delete[] offset;
+    delete[] arc;
+    delete[] head;
+    delete[] length;
+    delete[] status;
+
+    LogEntry(LOG_MEM,"...Compressed incidences disallocated");
+}
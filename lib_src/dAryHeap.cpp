@@ -0,0 +1,404 @@
+
+//  This file forms part of the GOBLIN C++ Class Library.
+//
+//  Initially written by the GOBLIN developers, October 2026
+//
+//  Copying, compiling, distribution and modification
+//  of this source code is permitted only in accordance
+//  with the GOBLIN general licence information.
+
+/// \file   dAryHeap.cpp
+/// \brief  #dAryHeap class implementation
+
+#include "dAryHeap.h"
+
+
+template <class TItem,class TKey>
+dAryHeap<TItem,TKey>::dAryHeap(TItem _n,goblinController &thisContext,TItem _d)
+    throw() : managedObject(thisContext)
+{
+    #if defined(_TIMERS_)
+
+    this -> CT.globalTimer[TimerPrioQ] -> Enable();
+
+    #endif
+
+    n = _n;
+    d = (_d<2) ? 2 : _d;
+
+    v = new TItem[n];
+    index = new TItem[n];
+    key = new TKey[n];
+
+    maxIndex = 0;
+
+    for (TItem w=0;w<n;w++) index[w] = UITEM_MAX();
+
+    this -> LogEntry(LOG_MEM,"...D-ary heap instanciated");
+
+    #if defined(_TIMERS_)
+
+    this -> CT.globalTimer[TimerPrioQ] -> Disable();
+
+    #endif
+}
+
+
+template <class TItem,class TKey>
+void dAryHeap<TItem,TKey>::Init() throw()
+{
+    #if defined(_TIMERS_)
+
+    this -> CT.globalTimer[TimerPrioQ] -> Enable();
+
+    #endif
+
+    if (maxIndex*100<n)
+    {
+        for (TItem i=0;i<maxIndex;i++) index[v[i]] = UITEM_MAX();
+    }
+    else
+    {
+        for (TItem w=0;w<n;w++) index[w] = UITEM_MAX();
+    }
+
+    maxIndex = 0;
+
+    #if defined(_TIMERS_)
+
+    this -> CT.globalTimer[TimerPrioQ] -> Disable();
+
+    #endif
+}
+
+
+template <class TItem,class TKey>
+unsigned long dAryHeap<TItem,TKey>::Size() const throw()
+{
+    return
+          sizeof(dAryHeap<TItem,TKey>)
+        + managedObject::Allocated()
+        + dAryHeap::Allocated();
+}
+
+
+template <class TItem,class TKey>
+unsigned long dAryHeap<TItem,TKey>::Allocated() const throw()
+{
+    return
+          2*n*sizeof(TItem)
+        + n*sizeof(TKey);
+}
+
+
+template <class TItem,class TKey>
+char* dAryHeap<TItem,TKey>::Display() const throw()
+{
+    this -> LogEntry(MSG_TRACE,"D-ary heap");
+
+    if (Empty()) this->LogEntry(MSG_TRACE2,"    ---");
+    else
+    {
+        THandle LH = this->LogStart(MSG_TRACE2,"    ");
+
+        for (TItem i=0;i<maxIndex;i++)
+        {
+            sprintf(this->CT.logBuffer,"%ld[%g]",(unsigned long)v[i],key[v[i]]);
+            this -> LogAppend(LH,this->CT.logBuffer);
+
+            if (i<maxIndex-1)
+            {
+                this -> LogAppend(LH,", ");
+
+                if (i%10==9)
+                {
+                    this -> LogEnd(LH);
+                    LH = this->LogStart(MSG_TRACE2,"   ");
+                }
+            }
+        }
+
+        this -> LogEnd(LH);
+    }
+
+    return NULL;
+}
+
+
+template <class TItem,class TKey>
+dAryHeap<TItem,TKey>::~dAryHeap() throw()
+{
+    #if defined(_TIMERS_)
+
+    this -> CT.globalTimer[TimerPrioQ] -> Enable();
+
+    #endif
+
+    delete[] v;
+    delete[] index;
+    delete[] key;
+
+    this -> LogEntry(LOG_MEM,"...D-ary heap disallocated");
+
+    #if defined(_TIMERS_)
+
+    this -> CT.globalTimer[TimerPrioQ] -> Disable();
+
+    #endif
+}
+
+
+template <class TItem,class TKey>
+void dAryHeap<TItem,TKey>::UpHeap(TItem i) throw()
+{
+    TItem w = v[i];
+    TKey alpha = key[w];
+
+    while (i>0)
+    {
+        TItem parent = (i-1)/d;
+
+        if (key[v[parent]]<=alpha) break;
+
+        v[i] = v[parent];
+        index[v[i]] = i;
+        i = parent;
+    }
+
+    v[i] = w;
+    index[w] = i;
+}
+
+
+template <class TItem,class TKey>
+void dAryHeap<TItem,TKey>::DownHeap(TItem i) throw()
+{
+    TItem w = v[i];
+    TKey alpha = key[w];
+
+    while (true)
+    {
+        TItem first = d*i+1;
+
+        if (first>=maxIndex) break;
+
+        TItem last = (first+d<maxIndex) ? first+d : maxIndex;
+        TItem minChild = first;
+        TKey minKey = key[v[first]];
+
+        for (TItem j=first+1;j<last;j++)
+        {
+            if (key[v[j]]<minKey)
+            {
+                minChild = j;
+                minKey = key[v[j]];
+            }
+        }
+
+        if (minKey>=alpha) break;
+
+        v[i] = v[minChild];
+        index[v[i]] = i;
+        i = minChild;
+    }
+
+    v[i] = w;
+    index[w] = i;
+}
+
+
+template <class TItem,class TKey>
+void dAryHeap<TItem,TKey>::Insert(TItem w,TKey alpha) throw(ERRange,ERRejected)
+{
+    #if defined(_FAILSAVE_)
+
+    if (w>=n) this->NoSuchIndex("Insert",w);
+
+    if (index[w]!=UITEM_MAX())
+        this -> Error(ERR_REJECTED,"Insert","Element is already on the heap");
+
+    #endif
+
+    #if defined(_TIMERS_)
+
+    this -> CT.globalTimer[TimerPrioQ] -> Enable();
+
+    #endif
+
+    key[w] = alpha;
+    v[maxIndex] = w;
+    index[w] = maxIndex++;
+
+    UpHeap(maxIndex-1);
+
+    #if defined(_TIMERS_)
+
+    this -> CT.globalTimer[TimerPrioQ] -> Disable();
+
+    #endif
+
+    #if defined(_TRACING_)
+
+    if (this->CT.traceData) Display();
+
+    #endif
+}
+
+
+template <class TItem,class TKey>
+void dAryHeap<TItem,TKey>::Delete(TItem w) throw(ERRange)
+{
+    #if defined(_FAILSAVE_)
+
+    if (w>=n || index[w]==UITEM_MAX()) this->NoSuchItem("Delete",w);
+
+    #endif
+
+    #if defined(_TIMERS_)
+
+    this -> CT.globalTimer[TimerPrioQ] -> Enable();
+
+    #endif
+
+    TItem i = index[w];
+    index[w] = UITEM_MAX();
+    maxIndex--;
+
+    if (i<maxIndex)
+    {
+        v[i] = v[maxIndex];
+        index[v[i]] = i;
+
+        if (i>0 && key[v[i]]<key[v[(i-1)/d]]) UpHeap(i);
+        else DownHeap(i);
+    }
+
+    #if defined(_TIMERS_)
+
+    this -> CT.globalTimer[TimerPrioQ] -> Disable();
+
+    #endif
+
+    #if defined(_TRACING_)
+
+    if (this->CT.traceData) Display();
+
+    #endif
+}
+
+
+template <class TItem,class TKey>
+TItem dAryHeap<TItem,TKey>::Delete() throw(ERRejected)
+{
+    #if defined(_FAILSAVE_)
+
+    if (maxIndex==0) this -> Error(ERR_REJECTED,"Delete","Heap is empty");
+
+    #endif
+
+    #if defined(_TIMERS_)
+
+    this -> CT.globalTimer[TimerPrioQ] -> Enable();
+
+    #endif
+
+    TItem w = v[0];
+    index[w] = UITEM_MAX();
+    maxIndex--;
+
+    if (maxIndex>0)
+    {
+        v[0] = v[maxIndex];
+        index[v[0]] = 0;
+        DownHeap(0);
+    }
+
+    #if defined(_TIMERS_)
+
+    this -> CT.globalTimer[TimerPrioQ] -> Disable();
+
+    #endif
+
+    #if defined(_TRACING_)
+
+    if (this->CT.traceData) Display();
+
+    #endif
+
+    return w;
+}
+
+
+template <class TItem,class TKey>
+TKey dAryHeap<TItem,TKey>::Key(TItem w) const throw(ERRange)
+{
+    #if defined(_FAILSAVE_)
+
+    if (w>=n || index[w]==UITEM_MAX()) this->NoSuchItem("Key",w);
+
+    #endif
+
+    return key[w];
+}
+
+
+template <class TItem,class TKey>
+void dAryHeap<TItem,TKey>::ChangeKey(TItem w,TKey alpha) throw(ERRange)
+{
+    #if defined(_FAILSAVE_)
+
+    if (w>=n || index[w]==UITEM_MAX()) this->NoSuchItem("ChangeKey",w);
+
+    #endif
+
+    #if defined(_TIMERS_)
+
+    this -> CT.globalTimer[TimerPrioQ] -> Enable();
+
+    #endif
+
+    if (alpha>key[w])
+    {
+        key[w] = alpha;
+        DownHeap(index[w]);
+    }
+    else
+    {
+        key[w] = alpha;
+        UpHeap(index[w]);
+    }
+
+    #if defined(_TIMERS_)
+
+    this -> CT.globalTimer[TimerPrioQ] -> Disable();
+
+    #endif
+
+    #if defined(_TRACING_)
+
+    if (this->CT.traceData) Display();
+
+    #endif
+}
+
+
+template <class TItem,class TKey>
+TItem dAryHeap<TItem,TKey>::Peek() const throw(ERRejected)
+{
+    #if defined(_FAILSAVE_)
+
+    if (maxIndex==0) this -> Error(ERR_REJECTED,"Peek","Heap is empty");
+
+    #endif
+
+    return v[0];
+}
+
+
+template class dAryHeap<TNode,TFloat>;
+
+#if defined(_BIG_ARCS_)
+
+template class dAryHeap<TArc,TFloat>;
+
+#endif
@@ -149,7 +149,7 @@ TArc denseGraph::Adjacency(TNode u,TNode v,TMethAdjacency) const throw(ERRange)
     if (CT.logRes>2)
     {
         sprintf(CT.logBuffer,
-            "The nodes %ld and %ld are adjacent by the arc %ld",u,v,a);
+            "The nodes %ld and %ld are adjacent by the arc %ld",(unsigned long)u,(unsigned long)v,(unsigned long)a);
         LogEntry(LOG_RES2,CT.logBuffer);
     }
 
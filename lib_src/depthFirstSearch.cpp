@@ -0,0 +1,142 @@
+
+//  This file forms part of the GOBLIN C++ Class Library.
+//
+//  Initially written by the GOBLIN developers, October 2026
+//
+//  Copying, compiling, distribution and modification
+//  of this source code is permitted only in accordance
+//  with the GOBLIN general licence information.
+
+/// \file   depthFirstSearch.cpp
+/// \brief  #depthFirstSearch class implementation
+
+#include "depthFirstSearch.h"
+
+
+depthFirstSearch::depthFirstSearch(const abstractMixedGraph& GC)
+    throw() : managedObject(GC.Context()), G(GC), S(GC.N(),GC.Context())
+{
+    n = G.N();
+
+    H = G.Investigate();
+    I = &G.Investigator(H);
+
+    treeArc   = new TArc[n];
+    preOrder  = new TNode[n];
+    postOrder = new TNode[n];
+
+    Reset();
+
+    LogEntry(LOG_MEM,"...Depth first search engine instanciated");
+}
+
+
+depthFirstSearch::~depthFirstSearch() throw()
+{
+    G.Close(H);
+
+    delete[] treeArc;
+    delete[] preOrder;
+    delete[] postOrder;
+
+    LogEntry(LOG_MEM,"...Depth first search engine disallocated");
+}
+
+
+unsigned long depthFirstSearch::Size() const throw()
+{
+    return
+          sizeof(depthFirstSearch)
+        + managedObject::Allocated()
+        + depthFirstSearch::Allocated();
+}
+
+
+unsigned long depthFirstSearch::Allocated() const throw()
+{
+    return n*(sizeof(TArc)+2*sizeof(TNode));
+}
+
+
+void depthFirstSearch::Reset() throw()
+{
+    while (!S.Empty()) S.Delete();
+
+    I -> Reset();
+
+    for (TNode v=0;v<n;v++)
+    {
+        treeArc[v] = NoArc;
+        preOrder[v] = postOrder[v] = NoNode;
+    }
+
+    nPre = nPost = 0;
+}
+
+
+TNode depthFirstSearch::Search(TNode r) throw(ERRange)
+{
+    #if defined(_FAILSAVE_)
+
+    if (r>=n) NoSuchNode("Search",r);
+
+    #endif
+
+    if (preOrder[r]!=NoNode) return 0;
+
+    TNode nPreBefore = nPre;
+
+    preOrder[r] = nPre++;
+    S.Insert(r);
+    PreVisit(r,NoArc);
+
+    while (!S.Empty())
+    {
+        TNode u = S.Peek();
+
+        if (I->Active(u))
+        {
+            TArc a = I->Read(u);
+
+            if (!Eligible(a)) continue;
+
+            TNode v = G.EndNode(a);
+
+            if (preOrder[v]==NoNode)
+            {
+                // Tree arc
+                treeArc[v] = a;
+                preOrder[v] = nPre++;
+                S.Insert(v);
+                PreVisit(v,a);
+            }
+            else NonTreeArc(a);
+        }
+        else
+        {
+            // Backtracking
+            S.Delete();
+            postOrder[u] = nPost++;
+            PostVisit(u,treeArc[u]);
+        }
+    }
+
+    return nPre-nPreBefore;
+}
+
+
+TNode depthFirstSearch::SearchAll() throw()
+{
+    TNode nTrees = 0;
+
+    for (TNode r=0;r<n;r++)
+    {
+        if (preOrder[r]==NoNode)
+        {
+            Search(r);
+            nTrees++;
+        }
+    }
+
+    return nTrees;
+}
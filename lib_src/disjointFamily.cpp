@@ -123,7 +123,7 @@ char* disjointFamily<TItem>::Display() const throw()
                     this -> LogEnd(LH);
                     LH = this->LogStart(MSG_TRACE2,"  ");
                 }
-                sprintf(this->CT.logBuffer," %ld->%ld",v,B[v]);
+                sprintf(this->CT.logBuffer," %ld->%ld",(unsigned long)v,(unsigned long)B[v]);
                 this -> LogAppend(LH,this->CT.logBuffer);
                 counter++;
             }
@@ -63,7 +63,7 @@ char* dynamicStack<TItem,TKey>::Display() const throw()
                 LH = this->LogStart(MSG_TRACE2,"   ");
             }
 
-            sprintf(this->CT.logBuffer,"%ld, ",temp->index);
+            sprintf(this->CT.logBuffer,"%ld, ",(unsigned long)temp->index);
             this -> LogAppend(LH,this->CT.logBuffer);
 
             counter++;
@@ -75,7 +75,7 @@ char* dynamicStack<TItem,TKey>::Display() const throw()
             LH = this->LogStart(MSG_TRACE2,"   ");
         }
 
-        sprintf(this->CT.logBuffer,"%ld (bottom)",temp->index);
+        sprintf(this->CT.logBuffer,"%ld (bottom)",(unsigned long)temp->index);
         this -> LogEnd(LH,this->CT.logBuffer);
     }
 
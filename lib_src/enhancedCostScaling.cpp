@@ -0,0 +1,979 @@
+
+//  This file forms part of the GOBLIN C++ Class Library.
+//
+//  Initially written by the GOBLIN developers, October 2026
+//
+//  Copying, compiling, distribution and modification
+//  of this source code is permitted only in accordance
+//  with the GOBLIN general licence information.
+
+/// \file enhancedCostScaling.cpp
+/// \brief Cost scaling method with look-ahead, price refinement, global price updates and arc fixing
+
+#include "abstractDigraph.h"
+
+
+// Maximum number of shortest path rounds in a single price refinement step
+static const int PR_MAX_ROUNDS = 8;
+
+
+/// \brief  Residual network representation for the enhanced cost scaling method
+///
+/// All arc data is stored in plain arrays which are sorted by the start nodes
+/// of the residual arcs. Every node v owns the positions first[v],..,
+/// first[v+1]-1. The range last[v],..,first[v+1]-1 is reserved for fixed arcs
+/// which are not considered by the push / relabel and price update steps.
+///
+/// Lengths and node potentials are multiplied by n+1, so that a 1-optimal
+/// flow is optimal for integral lengths. All potential changes are integral
+/// multiples of epsilon, hence all computations are done on integers.
+
+class costScalingNetwork : public managedObject
+{
+private:
+
+    abstractDiGraph&    G;
+
+    TNode       n;
+    TArc        m;
+
+    TArc*       first;      // First position of every node
+    TArc*       last;       // End of the positions of non-fixed arcs
+    TArc*       current;    // Current arc positions for push operations
+
+    TNode*      target;     // End nodes of the residual arcs
+    TFloat*     cost;       // Scaled lengths of the residual arcs
+    TFloat*     resCap;     // Residual capacities
+    TArc*       reverse;    // Positions of the reverse residual arcs
+    TArc*       arcIndex;   // Original arc indices
+
+    TFloat*     pi;         // Scaled node potentials
+    TFloat*     excess;     // Node excesses, negative for deficit nodes
+
+    TNode*      queue;      // Cyclic FIFO queue of the active nodes
+    TNode       qFirst;
+    TNode       qSize;
+    char*       queued;
+
+    TNode       maxRank;    // Number of buckets for global updates and price refinement
+    TNode*      rank;
+    TNode*      bucket;
+    TNode*      bucketNext; // Doubly linked bucket lists, n is the list end
+    TNode*      bucketPrev;
+
+    TNode*      stack;      // Node stack for topological sorting
+    char*       state;      // DFS states for topological sorting
+
+    TFloat      epsilon;    // Current scaling parameter
+    TFloat      alpha;      // Scaling factor
+
+    unsigned long   nPush;
+    unsigned long   nRelabel;
+    unsigned long   nUpdate;
+    unsigned long   nRefine;
+    TArc            nFixed;
+
+public:
+
+    costScalingNetwork(abstractDiGraph& GC,TFloat _alpha) throw();
+    ~costScalingNetwork() throw();
+
+    unsigned long   Size() const throw() {return 0;};
+
+    TFloat  MaxViolation() const throw();
+    void    Solve(TFloat epsilon0) throw(ERRejected);
+    void    ExportFlow() throw();
+    void    ExportPotentials() throw(ERRejected);
+
+private:
+
+    TFloat  RedCost(TNode v,TArc i) const throw()
+                {return cost[i]+pi[v]-pi[target[i]];};
+
+    void    Push(TNode v,TArc i,TFloat lambda) throw();
+    void    Enqueue(TNode v) throw();
+    TNode   Dequeue() throw();
+
+    bool    Relabel(TNode v) throw();
+    bool    HasAdmissibleArc(TNode v) throw();
+    bool    Discharge(TNode v) throw();
+
+    void    BucketInsert(TNode v,TNode r) throw();
+    void    BucketRemove(TNode v,TNode r) throw();
+
+    void    GlobalUpdate() throw();
+    bool    TopologicalSort(TNode& nSorted) throw();
+    bool    PriceRefinement() throw();
+
+    void    SwapPositions(TArc i,TArc j) throw();
+    TArc    FixPosition(TArc i) throw();
+    void    FixArcs() throw();
+
+    void    Refine() throw(ERRejected);
+
+};
+
+
+costScalingNetwork::costScalingNetwork(abstractDiGraph& GC,TFloat _alpha)
+    throw() : managedObject(GC.Context()), G(GC), n(GC.N()), m(GC.M())
+{
+    alpha = _alpha;
+    epsilon = 0;
+    nPush = nRelabel = nUpdate = nRefine = 0;
+    nFixed = 0;
+
+    first    = new TArc[n+1];
+    last     = new TArc[n];
+    current  = new TArc[n];
+
+    target   = new TNode[2*m];
+    cost     = new TFloat[2*m];
+    resCap   = new TFloat[2*m];
+    reverse  = new TArc[2*m];
+    arcIndex = new TArc[2*m];
+
+    // Sort the residual arcs by their start nodes
+
+    for (TNode v=0;v<=n;v++) first[v] = 0;
+
+    for (TArc a=0;a<2*m;a++) first[G.StartNode(a)+1]++;
+
+    for (TNode v=0;v<n;v++) first[v+1] += first[v];
+
+    for (TNode v=0;v<n;v++) current[v] = first[v];
+
+    TFloat scale = TFloat(n+1);
+    TArc* position = new TArc[2*m];
+
+    for (TArc a=0;a<2*m;a++)
+    {
+        TNode u = G.StartNode(a);
+        TArc i = current[u]++;
+
+        position[a] = i;
+        target[i]   = G.EndNode(a);
+        cost[i]     = G.Length(a)*scale;
+        resCap[i]   = G.ResCap(a);
+        arcIndex[i] = a;
+
+        if (a&1) cost[i] = -cost[i];
+    }
+
+    for (TArc a=0;a<2*m;a++) reverse[position[a]] = position[a^1];
+
+    delete[] position;
+
+    for (TNode v=0;v<n;v++)
+    {
+        last[v] = first[v+1];
+        current[v] = first[v];
+    }
+
+    // Start with the rounded node potentials of the graph object
+
+    pi = new TFloat[n];
+    excess = new TFloat[n];
+
+    TFloat* potential = G.GetPotentials();
+
+    for (TNode v=0;v<n;v++)
+    {
+        excess[v] = 0;
+        pi[v] = 0;
+
+        if (potential && fabs(potential[v])<InfFloat)
+            pi[v] = floor(potential[v])*scale;
+    }
+
+    queue  = new TNode[n];
+    queued = new char[n];
+    qFirst = qSize = 0;
+
+    for (TNode v=0;v<n;v++) queued[v] = 0;
+
+    maxRank = TNode(alpha)*n+1;
+
+    rank       = new TNode[n];
+    bucket     = new TNode[maxRank+1];
+    bucketNext = new TNode[n+1];
+    bucketPrev = new TNode[n+1];
+
+    stack = new TNode[n];
+    state = new char[n];
+
+    LogEntry(LOG_MEM,"...Residual network allocated");
+}
+
+
+costScalingNetwork::~costScalingNetwork() throw()
+{
+    delete[] first;
+    delete[] last;
+    delete[] current;
+
+    delete[] target;
+    delete[] cost;
+    delete[] resCap;
+    delete[] reverse;
+    delete[] arcIndex;
+
+    delete[] pi;
+    delete[] excess;
+
+    delete[] queue;
+    delete[] queued;
+
+    delete[] rank;
+    delete[] bucket;
+    delete[] bucketNext;
+    delete[] bucketPrev;
+
+    delete[] stack;
+    delete[] state;
+
+    LogEntry(LOG_MEM,"...Residual network disallocated");
+}
+
+
+TFloat costScalingNetwork::MaxViolation() const throw()
+{
+    TFloat violation = 0;
+
+    for (TNode v=0;v<n;v++)
+    {
+        for (TArc i=first[v];i<last[v];i++)
+        {
+            if (resCap[i]>0 && -RedCost(v,i)>violation)
+                violation = -RedCost(v,i);
+        }
+    }
+
+    return violation;
+}
+
+
+void costScalingNetwork::Push(TNode v,TArc i,TFloat lambda) throw()
+{
+    TNode w = target[i];
+
+    resCap[i] -= lambda;
+    resCap[reverse[i]] += lambda;
+    excess[v] -= lambda;
+    excess[w] += lambda;
+
+    nPush++;
+}
+
+
+void costScalingNetwork::Enqueue(TNode v) throw()
+{
+    if (queued[v]) return;
+
+    queue[(qFirst+qSize)%n] = v;
+    qSize++;
+    queued[v] = 1;
+}
+
+
+TNode costScalingNetwork::Dequeue() throw()
+{
+    TNode v = queue[qFirst];
+
+    qFirst = (qFirst+1)%n;
+    qSize--;
+    queued[v] = 0;
+
+    return v;
+}
+
+
+bool costScalingNetwork::Relabel(TNode v) throw()
+{
+    // Decrease the potential of v as far as possible without violating
+    // epsilon-optimality. Returns false if v has no residual arcs at all
+
+    TFloat minCost = InfFloat;
+
+    for (TArc i=first[v];i<last[v];i++)
+    {
+        if (resCap[i]>0 && RedCost(v,i)<minCost) minCost = RedCost(v,i);
+    }
+
+    if (minCost==InfFloat) return false;
+
+    pi[v] -= minCost+epsilon;
+    current[v] = first[v];
+    nRelabel++;
+
+    return true;
+}
+
+
+bool costScalingNetwork::HasAdmissibleArc(TNode v) throw()
+{
+    for (TArc i=current[v];i<last[v];i++)
+    {
+        if (resCap[i]>0 && RedCost(v,i)<0)
+        {
+            current[v] = i;
+            return true;
+        }
+    }
+
+    current[v] = last[v];
+
+    return false;
+}
+
+
+bool costScalingNetwork::Discharge(TNode v) throw()
+{
+    while (excess[v]>0)
+    {
+        TArc i = current[v];
+
+        if (i==last[v])
+        {
+            if (!Relabel(v)) return false;
+
+            continue;
+        }
+
+        if (resCap[i]<=0 || RedCost(v,i)>=0)
+        {
+            current[v]++;
+            continue;
+        }
+
+        TNode w = target[i];
+
+        // Push look-ahead: Rather than pushing flow to a node which could not
+        // forward it, relabel this node first. This often makes the arc i
+        // inadmissible and saves a push back operation
+
+        if (excess[w]>=0 && !HasAdmissibleArc(w))
+        {
+            Relabel(w);
+
+            if (RedCost(v,i)>=0)
+            {
+                current[v]++;
+                continue;
+            }
+        }
+
+        TFloat lambda = (resCap[i]<excess[v]) ? resCap[i] : excess[v];
+        bool wasActive = (excess[w]>0);
+
+        Push(v,i,lambda);
+
+        if (!wasActive && excess[w]>0) Enqueue(w);
+
+        if (resCap[i]<=0) current[v]++;
+    }
+
+    return true;
+}
+
+
+void costScalingNetwork::BucketInsert(TNode v,TNode r) throw()
+{
+    TNode w = bucket[r];
+
+    bucketNext[v] = w;
+    bucketPrev[w] = v;
+    bucket[r] = v;
+}
+
+
+void costScalingNetwork::BucketRemove(TNode v,TNode r) throw()
+{
+    if (bucket[r]==v)
+    {
+        bucket[r] = bucketNext[v];
+    }
+    else
+    {
+        TNode u = bucketPrev[v];
+        TNode w = bucketNext[v];
+        bucketNext[u] = w;
+        bucketPrev[w] = u;
+    }
+}
+
+
+void costScalingNetwork::GlobalUpdate() throw()
+{
+    // Dial's implementation of Dijkstra's method on the reverse residual
+    // network. The deficit nodes are the roots, and an arc of reduced length
+    // c contributes floor(c/epsilon)+1 to the distance labels. The search
+    // stops when all active nodes have been reached
+
+    for (TNode r=0;r<=maxRank;r++) bucket[r] = n;
+
+    TFloat totalExcess = 0;
+
+    for (TNode v=0;v<n;v++)
+    {
+        if (excess[v]<0)
+        {
+            rank[v] = 0;
+            BucketInsert(v,0);
+        }
+        else
+        {
+            totalExcess += excess[v];
+            rank[v] = maxRank;
+        }
+    }
+
+    if (totalExcess<=0) return;
+
+    nUpdate++;
+
+    TNode r = 0;
+
+    for (;r<maxRank && totalExcess>0;r++)
+    {
+        while (bucket[r]!=n && totalExcess>0)
+        {
+            TNode u = bucket[r];
+            bucket[r] = bucketNext[u];
+
+            for (TArc i=first[u];i<last[u];i++)
+            {
+                TArc j = reverse[i];
+
+                if (resCap[j]<=0) continue;
+
+                TNode v = target[i];
+
+                if (rank[v]<=r) continue;
+
+                TFloat steps = floor(RedCost(v,j)/epsilon);
+
+                if (steps<0) steps = 0;
+
+                if (steps>=TFloat(maxRank-r-1)) continue;
+
+                TNode newRank = r+1+TNode(steps);
+
+                if (newRank<rank[v])
+                {
+                    if (rank[v]<maxRank) BucketRemove(v,rank[v]);
+
+                    rank[v] = newRank;
+                    BucketInsert(v,newRank);
+                }
+            }
+
+            if (excess[u]>0) totalExcess -= excess[u];
+        }
+
+        if (totalExcess<=0) break;
+    }
+
+    for (TNode v=0;v<n;v++)
+    {
+        TNode k = (rank[v]<r) ? rank[v] : r;
+
+        if (k>0)
+        {
+            pi[v] -= epsilon*k;
+            current[v] = first[v];
+        }
+    }
+}
+
+
+bool costScalingNetwork::TopologicalSort(TNode& nSorted) throw()
+{
+    // Sort the subgraph of admissible arcs topologically by a depth first
+    // search. The nodes are stored on the stack in reverse topological order.
+    // Returns false if the admissible subgraph contains a cycle
+
+    for (TNode v=0;v<n;v++)
+    {
+        state[v] = 0;
+        current[v] = first[v];
+    }
+
+    TNode* path = rank;
+    nSorted = 0;
+
+    for (TNode s=0;s<n;s++)
+    {
+        if (state[s]!=0) continue;
+
+        TNode depth = 0;
+        path[depth++] = s;
+        state[s] = 1;
+
+        while (depth>0)
+        {
+            TNode u = path[depth-1];
+            TArc i = current[u];
+
+            if (i==last[u])
+            {
+                state[u] = 2;
+                stack[nSorted++] = u;
+                depth--;
+                continue;
+            }
+
+            current[u]++;
+
+            if (resCap[i]<=0 || RedCost(u,i)>=0) continue;
+
+            TNode v = target[i];
+
+            if (state[v]==1)
+            {
+                for (TNode w=0;w<n;w++) current[w] = first[w];
+
+                return false;
+            }
+
+            if (state[v]==0)
+            {
+                state[v] = 1;
+                path[depth++] = v;
+            }
+        }
+    }
+
+    for (TNode v=0;v<n;v++) current[v] = first[v];
+
+    return true;
+}
+
+
+bool costScalingNetwork::PriceRefinement() throw()
+{
+    // Try to make the current flow epsilon-optimal by a potential update
+    // only. This succeeds if the admissible subgraph is acyclic and a
+    // shortest path computation in units of epsilon yields appropriate
+    // potentials
+
+    for (int round=0;round<PR_MAX_ROUNDS;round++)
+    {
+        TNode nSorted = 0;
+
+        if (!TopologicalSort(nSorted)) return false;
+
+        // Compute node ranks in topological order
+
+        for (TNode v=0;v<n;v++) rank[v] = 0;
+
+        for (TNode r=0;r<=maxRank;r++) bucket[r] = n;
+
+        TNode topRank = 0;
+
+        for (TNode k=nSorted;k>0;)
+        {
+            TNode u = stack[--k];
+
+            for (TArc i=first[u];i<last[u];i++)
+            {
+                if (resCap[i]<=0) continue;
+
+                TFloat rc = RedCost(u,i);
+
+                if (rc>=0) continue;
+
+                TFloat steps = floor((-rc-0.5)/epsilon);
+
+                if (steps>=TFloat(maxRank-rank[u])) return false;
+
+                TNode v = target[i];
+                TNode newRank = rank[u]+TNode(steps);
+
+                if (newRank>rank[v]) rank[v] = newRank;
+            }
+
+            if (rank[u]>0)
+            {
+                if (rank[u]>topRank) topRank = rank[u];
+
+                BucketInsert(u,rank[u]);
+            }
+        }
+
+        if (topRank==0) return true;
+
+        nRefine++;
+
+        // Process the buckets in decreasing order
+
+        for (TNode r=topRank;r>0;r--)
+        {
+            while (bucket[r]!=n)
+            {
+                TNode u = bucket[r];
+                bucket[r] = bucketNext[u];
+
+                for (TArc i=first[u];i<last[u];i++)
+                {
+                    if (resCap[i]<=0) continue;
+
+                    TNode v = target[i];
+                    TNode oldRank = rank[v];
+
+                    if (oldRank>=r) continue;
+
+                    TFloat rc = RedCost(u,i);
+                    TNode newRank = 0;
+
+                    if (rc<0)
+                    {
+                        newRank = r;
+                    }
+                    else
+                    {
+                        TFloat steps = floor(rc/epsilon);
+
+                        if (steps<TFloat(r-1)) newRank = r-1-TNode(steps);
+                    }
+
+                    if (newRank>oldRank)
+                    {
+                        if (oldRank>0) BucketRemove(v,oldRank);
+
+                        rank[v] = newRank;
+                        BucketInsert(v,newRank);
+                    }
+                }
+
+                pi[u] -= epsilon*r;
+            }
+        }
+    }
+
+    return false;
+}
+
+
+void costScalingNetwork::SwapPositions(TArc i,TArc j) throw()
+{
+    TNode swapNode = target[i];
+    target[i] = target[j];
+    target[j] = swapNode;
+
+    TFloat swapFloat = cost[i];
+    cost[i] = cost[j];
+    cost[j] = swapFloat;
+
+    swapFloat = resCap[i];
+    resCap[i] = resCap[j];
+    resCap[j] = swapFloat;
+
+    TArc swapArc = arcIndex[i];
+    arcIndex[i] = arcIndex[j];
+    arcIndex[j] = swapArc;
+
+    swapArc = reverse[i];
+    reverse[i] = reverse[j];
+    reverse[j] = swapArc;
+
+    reverse[reverse[i]] = i;
+    reverse[reverse[j]] = j;
+}
+
+
+TArc costScalingNetwork::FixPosition(TArc i) throw()
+{
+    TNode v = target[reverse[i]];
+    TArc j = --last[v];
+
+    if (i!=j) SwapPositions(i,j);
+
+    return j;
+}
+
+
+void costScalingNetwork::FixArcs() throw()
+{
+    // If the current flow is epsilon-optimal and an arc has reduced length
+    // at least 2n*epsilon, the flow on this arc is the same for all optimal
+    // solutions [Goldberg/Tarjan]. Such arcs are excluded from the further
+    // computation. Loops are never fixed
+
+    TFloat threshold = 2*n*epsilon;
+
+    for (TNode v=0;v<n;v++)
+    {
+        for (TArc i=first[v];i<last[v];)
+        {
+            if (target[i]==v || RedCost(v,i)<threshold)
+            {
+                i++;
+                continue;
+            }
+
+            TArc j = FixPosition(i);
+            FixPosition(reverse[j]);
+            nFixed++;
+        }
+    }
+}
+
+
+void costScalingNetwork::Refine() throw(ERRejected)
+{
+    // Saturate all arcs with negative reduced length. This yields a
+    // 0-optimal pseudo-flow which is then balanced by push and relabel
+    // operations on the active nodes in FIFO order
+
+    for (TNode v=0;v<n;v++)
+    {
+        current[v] = first[v];
+
+        for (TArc i=first[v];i<last[v];i++)
+        {
+            if (resCap[i]>0 && RedCost(v,i)<0) Push(v,i,resCap[i]);
+        }
+    }
+
+    for (TNode v=0;v<n;v++)
+    {
+        if (excess[v]>0) Enqueue(v);
+    }
+
+    GlobalUpdate();
+
+    unsigned long relabelLimit = nRelabel+n;
+
+    while (qSize>0 && CT.SolverRunning())
+    {
+        TNode v = Dequeue();
+
+        if (!Discharge(v))
+            Error(ERR_REJECTED,"Refine","Node excess cannot be routed");
+
+        if (nRelabel>=relabelLimit)
+        {
+            GlobalUpdate();
+            relabelLimit = nRelabel+n;
+        }
+    }
+}
+
+
+void costScalingNetwork::Solve(TFloat epsilon0) throw(ERRejected)
+{
+    #if defined(_PROGRESS_)
+
+    TFloat nPhases = log(epsilon0)/log(alpha)+1;
+    TFloat thisPhase = 0;
+
+    #endif
+
+    epsilon = epsilon0;
+    bool firstPhase = true;
+
+    while (epsilon>1 && CT.SolverRunning())
+    {
+        epsilon = floor(epsilon/alpha);
+
+        if (epsilon<1) epsilon = 1;
+
+        #if defined(_LOGGING_)
+
+        if (CT.logMeth)
+        {
+            sprintf(CT.logBuffer,
+                "Starting scaling phase with epsilon = %g...",epsilon);
+            LogEntry(LOG_METH,CT.logBuffer);
+        }
+
+        #endif
+
+        // The price refinement heuristic is skipped in the first phase
+        // where it rarely succeeds
+
+        if (firstPhase || !PriceRefinement())
+        {
+            Refine();
+        }
+        else
+        {
+            #if defined(_LOGGING_)
+
+            LogEntry(LOG_METH2,"...Price refinement succeeded");
+
+            #endif
+        }
+
+        FixArcs();
+        firstPhase = false;
+
+        #if defined(_PROGRESS_)
+
+        SetProgressCounter((++thisPhase)/nPhases);
+
+        #endif
+
+        Trace();
+    }
+
+    #if defined(_LOGGING_)
+
+    if (CT.logRes)
+    {
+        sprintf(CT.logBuffer,
+            "...%lu pushes, %lu relabels, %lu global updates, %lu price refinements",
+            nPush,nRelabel,nUpdate,nRefine);
+        LogEntry(LOG_RES,CT.logBuffer);
+        sprintf(CT.logBuffer,"...%lu arcs have been fixed",(unsigned long)nFixed);
+        LogEntry(LOG_RES,CT.logBuffer);
+    }
+
+    #endif
+}
+
+
+void costScalingNetwork::ExportFlow() throw()
+{
+    for (TNode v=0;v<n;v++)
+    {
+        for (TArc i=first[v];i<first[v+1];i++)
+        {
+            TArc a = arcIndex[i];
+            TFloat lambda = resCap[reverse[i]]-G.ResCap(a^1);
+
+            // Every arc is updated from the position of its forward arc only
+            if ((a&1) || lambda==0) continue;
+
+            if (lambda>0)
+            {
+                G.Push(a,lambda);
+            }
+            else G.Push(a^1,-lambda);
+        }
+    }
+}
+
+
+void costScalingNetwork::ExportPotentials() throw(ERRejected)
+{
+    // The flow is optimal, but the potentials are optimal only for the
+    // residual network without the fixed arcs, and only up to a rounding
+    // error. Exact potentials are obtained by a FIFO label correcting method
+    // which starts with the rounded-down potentials
+
+    TFloat scale = TFloat(n+1);
+    TFloat* potential = G.RawPotentials();
+    TFloat* dist = excess;
+    TNode* count = rank;
+
+    for (TNode v=0;v<n;v++)
+    {
+        potential[v] = floor(pi[v]/scale);
+        dist[v] = 0;
+        count[v] = 0;
+        Enqueue(v);
+    }
+
+    while (qSize>0)
+    {
+        TNode u = Dequeue();
+
+        if (++count[u]>n)
+            Error(ERR_REJECTED,"ExportPotentials","Negative cycle detected");
+
+        for (TArc i=first[u];i<first[u+1];i++)
+        {
+            if (resCap[i]<=0) continue;
+
+            TNode v = target[i];
+            TFloat l = cost[i]/scale+potential[u]-potential[v];
+
+            if (dist[u]+l<dist[v])
+            {
+                dist[v] = dist[u]+l;
+                Enqueue(v);
+            }
+        }
+    }
+
+    for (TNode v=0;v<n;v++) potential[v] += dist[v];
+}
+
+
+TFloat abstractDiGraph::MCF_EnhancedCostScaling() throw()
+{
+    // The method depends on integral arc lengths. Scaled lengths and
+    // potentials must be represented exactly by floating point numbers
+
+    TFloat maxLength = 0;
+    bool integral = true;
+
+    for (TArc a=0;a<m && integral;a++)
+    {
+        TFloat l = fabs(Length(2*a));
+
+        if (l!=floor(l) || l==InfFloat) integral = false;
+
+        if (l>maxLength) maxLength = l;
+    }
+
+    if (!integral || maxLength*(n+1)*(n+1)*(CT.costScalingFactor+1)>1e15)
+    {
+        LogEntry(LOG_METH,"...Arc lengths are not small integers");
+        return MCF_CostScaling(MCF_BF_COST);
+    }
+
+    OpenFold(ModEnhancedCostScaling,SHOW_TITLE);
+
+    #if defined(_PROGRESS_)
+
+    InitProgressCounter(1);
+    SetProgressNext(0);
+
+    #endif
+
+    TFloat alpha = (CT.costScalingFactor>=2) ? CT.costScalingFactor : 2;
+
+    costScalingNetwork N(*this,alpha);
+
+    TFloat epsilon0 = N.MaxViolation();
+
+    #if defined(_LOGGING_)
+
+    if (CT.logMeth)
+    {
+        sprintf(CT.logBuffer,"Initial epsilon = %g (scaled by %lu)",
+            epsilon0,static_cast<unsigned long>(n+1));
+        LogEntry(LOG_METH,CT.logBuffer);
+    }
+
+    #endif
+
+    try
+    {
+        N.Solve(epsilon0);
+
+        if (CT.SolverRunning())
+        {
+            N.ExportFlow();
+            N.ExportPotentials();
+        }
+    }
+    catch (ERRejected)
+    {
+        // The graph object holds a feasible flow in any case
+
+        CloseFold(ModEnhancedCostScaling);
+        LogEntry(LOG_METH,"...Applying the basic cost scaling method");
+
+        return MCF_CostScaling(MCF_BF_COST);
+    }
+
+    TFloat w = Weight();
+    SetBounds(TimerMinCFlow,MCF_DualObjective(),w);
+
+    CloseFold(ModEnhancedCostScaling);
+
+    return w;
+}
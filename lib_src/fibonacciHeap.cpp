@@ -108,7 +108,7 @@ unsigned long fibonacciHeap<TItem,TKey>::Allocated() const throw()
 }
 
 
-static THandle LH = NoHandle;
+static __thread THandle LH;
 
 template <class TItem,class TKey>
 char* fibonacciHeap<TItem,TKey>::Display() const throw()
@@ -136,7 +136,7 @@ char* fibonacciHeap<TItem,TKey>::Display() const throw()
 
                     if (status[x]!=UNMARKED_CHILD && status[x]!=MARKED_CHILD)
                     {
-                        sprintf(this->CT.logBuffer,"Inconsistent item: %ld",x);
+                        sprintf(this->CT.logBuffer,"Inconsistent item: %ld",(unsigned long)x);
                         InternalError1("Display");
                     }
 
@@ -167,7 +167,7 @@ char* fibonacciHeap<TItem,TKey>::Display() const throw()
 
                     if (status[bucket[i]]!=ROOT_NODE)
                     {
-                        sprintf(this->CT.logBuffer,"Inconsistent bucket: %ld",i);
+                        sprintf(this->CT.logBuffer,"Inconsistent bucket: %ld",(unsigned long)i);
                         InternalError1("Display");
                     }
 
@@ -196,7 +196,7 @@ void fibonacciHeap<TItem,TKey>::Display(TItem v) const throw(ERRange)
 
     #endif
 
-    sprintf(this->CT.logBuffer,"%ld[%g]",v,key[v]);
+    sprintf(this->CT.logBuffer,"%ld[%g]",(unsigned long)v,key[v]);
     this -> LogAppend(LH,this->CT.logBuffer);
 
     TItem x = first[v];
@@ -211,7 +211,7 @@ void fibonacciHeap<TItem,TKey>::Display(TItem v) const throw(ERRange)
 
             if (status[x]!=UNMARKED_CHILD && status[x]!=MARKED_CHILD)
             {
-                sprintf(this->CT.logBuffer,"Inconsistent item: %ld",x);
+                sprintf(this->CT.logBuffer,"Inconsistent item: %ld",(unsigned long)x);
                 InternalError1("Display");
             }
 
@@ -281,7 +281,7 @@ void fibonacciHeap<TItem,TKey>::Insert(TItem w,TKey alpha)
 
     if (status[w]!=NOT_QUEUED)
     {
-        sprintf(this->CT.logBuffer,"Already on queue: %ld",w);
+        sprintf(this->CT.logBuffer,"Already on queue: %ld",(unsigned long)w);
         this->Error(ERR_REJECTED,"Insert",this->CT.logBuffer);
     }
 
@@ -326,7 +326,7 @@ void fibonacciHeap<TItem,TKey>::Push(TItem w) throw(ERRejected)
 
     if (w>=n || status[w]!=ROOT_NODE)
     {
-        sprintf(this->CT.logBuffer,"Not a root: %ld",w);
+        sprintf(this->CT.logBuffer,"Not a root: %ld",(unsigned long)w);
         this->Error(ERR_REJECTED,"Push",this->CT.logBuffer);
     }
 
@@ -392,7 +392,7 @@ void fibonacciHeap<TItem,TKey>::Link(TItem v,TItem w) throw(ERRange,ERRejected)
 
     if (status[v]!=ROOT_NODE)
     {
-        sprintf(this->CT.logBuffer,"Not a root: %ld",v);
+        sprintf(this->CT.logBuffer,"Not a root: %ld",(unsigned long)v);
         this->Error(ERR_REJECTED,"Link",this->CT.logBuffer);
     }
 
@@ -400,7 +400,7 @@ void fibonacciHeap<TItem,TKey>::Link(TItem v,TItem w) throw(ERRange,ERRejected)
 
     if (status[w]!=ROOT_NODE)
     {
-        sprintf(this->CT.logBuffer,"Not a root: %ld",w);
+        sprintf(this->CT.logBuffer,"Not a root: %ld",(unsigned long)w);
         this->Error(ERR_REJECTED,"Link",this->CT.logBuffer);
     }
 
@@ -455,7 +455,7 @@ void fibonacciHeap<TItem,TKey>::Cut(TItem v) throw(ERRange,ERRejected)
 
     if (status[v]!=UNMARKED_CHILD && status[v]!=MARKED_CHILD)
     {
-        sprintf(this->CT.logBuffer,"Cut node is a root: %ld",v);
+        sprintf(this->CT.logBuffer,"Cut node is a root: %ld",(unsigned long)v);
         this->Error(ERR_REJECTED,"Cut",this->CT.logBuffer);
     }
 
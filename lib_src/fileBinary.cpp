@@ -0,0 +1,242 @@
+
+//  This file forms part of the GOBLIN C++ Class Library.
+//
+//  Initially written by the GOBLIN developers, October 2026
+//
+//  Copying, compiling, distribution and modification
+//  of this source code is permitted only in accordance
+//  with the GOBLIN general licence information.
+
+/// \file   fileBinary.cpp
+/// \brief  #goblinBinaryImport class implementation
+
+#include "fileBinary.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+
+
+const char BinaryFormatMagic[8] = {'G','O','B','L','I','N','B',0};
+
+
+goblinBinaryImport::goblinBinaryImport(const char* impFileName,goblinController& thisContext)
+    throw(ERFile,ERParse) :
+    CT(thisContext), fileDescriptor(-1), fileSize(0), image(NULL), block(NULL), nBlocks(0)
+{
+    fileDescriptor = open(impFileName,O_RDONLY);
+
+    struct stat fileStatus;
+
+    if (fileDescriptor<0 || fstat(fileDescriptor,&fileStatus)!=0)
+    {
+        Release();
+        sprintf(CT.logBuffer,"Could not open import file %s",impFileName);
+        CT.Error(ERR_FILE,NoHandle,"goblinBinaryImport",CT.logBuffer);
+    }
+
+    fileSize = size_t(fileStatus.st_size);
+
+    if (fileSize<sizeof(TBinaryFileHeader)) Reject("Truncated file header");
+
+    void* mapped = mmap(NULL,fileSize,PROT_READ,MAP_PRIVATE,fileDescriptor,0);
+
+    if (mapped==MAP_FAILED)
+    {
+        Release();
+        sprintf(CT.logBuffer,"Could not map import file %s",impFileName);
+        CT.Error(ERR_FILE,NoHandle,"goblinBinaryImport",CT.logBuffer);
+    }
+
+    image = static_cast<const char*>(mapped);
+
+    const TBinaryFileHeader& header = Header();
+
+    if (memcmp(header.magic,BinaryFormatMagic,8)!=0) Reject("Not a binary GOBLIN file");
+
+    if (header.version==0 || header.version>BinaryFormatVersion)
+        Reject("Unsupported format version");
+
+    if (header.byteOrder!=0x0102) Reject("Incompatible byte order");
+
+    if (   header.typeSize[0]!=sizeof(TNode)
+        || header.typeSize[1]!=sizeof(TArc)
+        || header.typeSize[2]!=sizeof(TFloat)
+        || header.typeSize[3]!=sizeof(TCap)
+        || header.typeSize[4]!=sizeof(TIndex)
+        || header.typeSize[5]!=sizeof(TVar)
+        || header.typeSize[6]!=sizeof(TRestr)
+        || header.typeSize[7]!=sizeof(unsigned long)
+       )
+    {
+        Reject("File has been written with different index types");
+    }
+
+    // Two passes over the block headers: Check the block boundaries and
+    // count the blocks, then set up the block index
+
+    for (int pass=0;pass<2;pass++)
+    {
+        size_t offset = sizeof(TBinaryFileHeader);
+        unsigned long i = 0;
+
+        while (true)
+        {
+            if (offset+sizeof(TBinaryBlockHeader)>fileSize) Reject("Truncated block header");
+
+            const TBinaryBlockHeader* thisBlock =
+                reinterpret_cast<const TBinaryBlockHeader*>(image+offset);
+
+            if (thisBlock->pool==BIN_POOL_END) break;
+
+            if (pass==0)
+            {
+                if (   thisBlock->baseType>=TYPE_SPECIAL
+                    || thisBlock->itemSize==0
+                    || thisBlock->itemSize!=ItemSize(TBaseType(thisBlock->baseType))
+                   )
+                {
+                    Reject("Invalid block type");
+                }
+
+                size_t available = fileSize-offset-sizeof(TBinaryBlockHeader);
+
+                if (thisBlock->length>available/thisBlock->itemSize)
+                {
+                    Reject("Truncated data block");
+                }
+            }
+            else block[i] = thisBlock;
+
+            size_t bytes = size_t(thisBlock->length)*thisBlock->itemSize;
+            offset += sizeof(TBinaryBlockHeader)+((bytes+7) & ~size_t(7));
+            i++;
+        }
+
+        if (pass==0)
+        {
+            nBlocks = i;
+            block = new const TBinaryBlockHeader*[nBlocks+1];
+        }
+    }
+
+    sprintf(CT.logBuffer,"...%lu data blocks mapped",nBlocks);
+    CT.LogEntry(LOG_IO,NoHandle,CT.logBuffer);
+}
+
+
+goblinBinaryImport::~goblinBinaryImport() throw()
+{
+    Release();
+}
+
+
+void goblinBinaryImport::Release() throw()
+{
+    if (image) munmap(const_cast<char*>(image),fileSize);
+
+    if (fileDescriptor>=0) close(fileDescriptor);
+
+    delete[] block;
+
+    image = NULL;
+    fileDescriptor = -1;
+    block = NULL;
+    nBlocks = 0;
+}
+
+
+void goblinBinaryImport::Reject(const char* reason) throw(ERParse)
+{
+    Release();
+    CT.Error(ERR_PARSE,NoHandle,"goblinBinaryImport",const_cast<char*>(reason));
+}
+
+
+bool goblinBinaryImport::IsBinaryFile(const char* fileName) throw()
+{
+    FILE* file = fopen(fileName,"rb");
+
+    if (!file) return false;
+
+    char magic[8];
+    bool isBinary = (fread(magic,1,8,file)==8 && memcmp(magic,BinaryFormatMagic,8)==0);
+
+    fclose(file);
+
+    return isBinary;
+}
+
+
+size_t goblinBinaryImport::ItemSize(TBaseType baseType) throw()
+{
+    switch (baseType)
+    {
+        case TYPE_NODE_INDEX:   return sizeof(TNode);
+        case TYPE_ARC_INDEX:    return sizeof(TArc);
+        case TYPE_FLOAT_VALUE:  return sizeof(TFloat);
+        case TYPE_CAP_VALUE:    return sizeof(TCap);
+        case TYPE_INDEX:        return sizeof(TIndex);
+        case TYPE_ORIENTATION:  return sizeof(char);
+        case TYPE_INT:          return sizeof(int);
+        case TYPE_BOOL:         return sizeof(char);
+        case TYPE_VAR_INDEX:    return sizeof(TVar);
+        case TYPE_RESTR_INDEX:  return sizeof(TRestr);
+        case TYPE_STRING:       return sizeof(char);
+        default:                return 0;
+    }
+}
+
+
+void goblinBinaryImport::CheckObjectClass(const char* objectClass) throw(ERParse)
+{
+    const TBinaryFileHeader& header = Header();
+
+    if (strncmp(header.objectClass,objectClass,sizeof(header.objectClass))!=0)
+    {
+        sprintf(CT.logBuffer,"Expected object class \"%s\", found \"%.16s\"",
+            objectClass,header.objectClass);
+        Release();
+        CT.Error(ERR_PARSE,NoHandle,"CheckObjectClass",CT.logBuffer);
+    }
+}
+
+
+unsigned long goblinBinaryImport::FindBlock(unsigned short pool,unsigned short token) const throw()
+{
+    for (unsigned long i=0;i<nBlocks;i++)
+    {
+        if (block[i]->pool==pool && block[i]->token==token) return i;
+    }
+
+    return nBlocks;
+}
+
+
+void goblinBinaryImport::ReadConfiguration() const throw()
+{
+    unsigned long i = FindBlock(BIN_POOL_CONFIGURATION,0);
+
+    if (i==nBlocks || block[i]->baseType!=TYPE_STRING) return;
+
+    const char* tokens = static_cast<const char*>(Data(i));
+    unsigned long length = block[i]->length;
+
+    // The block may end without a terminating zero if the file is damaged
+
+    std::string config(tokens,length);
+    if (length>0 && tokens[length-1]!=0) config += '\0';
+
+    vector<const char*> ParamStr(1,static_cast<const char*>(NULL));
+
+    for (size_t offset=0;offset<config.size();offset+=strlen(config.c_str()+offset)+1)
+        ParamStr.push_back(config.c_str()+offset);
+
+    // As in goblinImport::ReadConfiguration(), the parameter list only
+    // holds differences with the default parameters of the layout model
+
+    CT.SetDisplayParameters(TLayoutModel(CT.layoutModel));
+    CT.Configure(int(ParamStr.size()),&ParamStr[0]);
+}
@@ -11,10 +11,16 @@
 /// \brief  #goblinExport class implementation
 
 #include "fileExport.h"
+#include "fileBinary.h"
+#include <string>
+#include <sstream>
 
 
-goblinExport::goblinExport(const char* expFileName,goblinController &thisContext)
-    throw(ERFile) : expFile(expFileName, ios::out), CT(thisContext)
+goblinExport::goblinExport(const char* expFileName,goblinController &thisContext,
+    TExportMode mode) throw(ERFile) :
+    binaryMode(mode==EXP_BINARY),
+    expFile(expFileName, (mode==EXP_BINARY) ? ios::out | ios::binary : ios::out),
+    CT(thisContext)
 {
     if (!expFile)
     {
@@ -92,7 +98,7 @@ void goblinExport::EndTuple() throw(ERRejected)
 }
 
 
-static char itemBuffer[25];
+static __thread char itemBuffer[25];
 
 void goblinExport::MakeIntItem(long int item, char length) throw()
 {
@@ -203,6 +209,185 @@ void goblinExport::MakeNoItem(char length) throw()
 }
 
 
+/// Arrays with at least this number of items are formatted concurrently
+/// by goblinExport::MakeItems()
+static const size_t LongTupleLength = 4096;
+
+
+/// \brief  Formatting of a single item as in goblinExport::MakeIntItem()
+template <typename T> struct TItemFormat
+{
+    static bool Undefined(T) throw() {return false;};
+
+    static void Print(char* buffer,T item,int width,int indent,int) throw()
+    {
+        sprintf(buffer,"%*ld",width+indent,(long int)(item));
+    };
+};
+
+
+/// \brief  Formatting of a single item as in goblinExport::MakeFloatItem()
+template <> struct TItemFormat<double>
+{
+    static bool Undefined(double item) throw() {return fabs(item)==InfFloat;};
+
+    static void Print(char* buffer,double item,int width,int indent,int precision) throw()
+    {
+        sprintf(buffer,"%*s%*.*f",indent,"",width,precision,item);
+    };
+};
+
+
+template <> struct TItemFormat<float>
+{
+    static bool Undefined(float item) throw() {return fabs(TFloat(item))==InfFloat;};
+
+    static void Print(char* buffer,float item,int width,int indent,int precision) throw()
+    {
+        sprintf(buffer,"%*s%*.*f",indent,"",width,precision,double(item));
+    };
+};
+
+
+template <typename T> struct TItemChunk
+{
+    const T*    array;
+    T           undefined;
+    size_t      lo;         // First array index of the chunk
+    size_t      hi;         // Behind the last array index of the chunk
+    int         firstPos;   // The line position before item lo is written
+    int         lastPos;    // The line position after the chunk is written
+    int         itemsPerLine;
+    int         level;
+    int         length;
+    int         precision;
+    string      text;
+};
+
+
+template <typename T> static void* FormatItems(void* arg) throw()
+{
+    TItemChunk<T>* chunk = static_cast<TItemChunk<T>*>(arg);
+    char buffer[512];
+    int pos = chunk->firstPos;
+
+    chunk->text.reserve((chunk->hi-chunk->lo)*(chunk->length+2));
+
+    for (size_t i=chunk->lo;i<chunk->hi;i++)
+    {
+        // Line breaks and indentation as in MakeIntItem() and MakeFloatItem()
+        bool newLine = (pos==chunk->itemsPerLine);
+        int indent = (newLine) ? chunk->level+1 : 0;
+
+        if (newLine) pos = 1;
+        else pos++;
+
+        chunk->text += (newLine) ? '\n' : ' ';
+
+        T item = chunk->array[i];
+
+        if (item==chunk->undefined || TItemFormat<T>::Undefined(item))
+        {
+            sprintf(buffer,"%*s",chunk->length+indent,"*");
+        }
+        else
+        {
+            TItemFormat<T>::Print(buffer,item,chunk->length,indent,chunk->precision);
+        }
+
+        chunk->text += buffer;
+    }
+
+    chunk->lastPos = pos;
+
+    return NULL;
+}
+
+
+template <typename T>
+void goblinExport::MakeItems(const T* array,size_t size,T undefined,char length) throw()
+{
+    unsigned nThreads = CT.NumThreads();
+
+    if (nThreads>size/LongTupleLength) nThreads = unsigned(size/LongTupleLength);
+
+    if (   nThreads<=1 || binaryMode
+        || currentType<=1 || currentPos<1 || currentPos>currentType
+       )
+    {
+        for (size_t i=0;i<size;i++)
+        {
+            if (array[i]!=undefined)
+            {
+                MakeItem<T>(array[i],length);
+            }
+            else
+            {
+                MakeNoItem(length);
+            }
+        }
+
+        return;
+    }
+
+    TItemChunk<T>* chunk = new TItemChunk<T>[nThreads];
+    pthread_t* threads = new pthread_t[nThreads];
+
+    for (unsigned k=0;k<nThreads;k++)
+    {
+        chunk[k].array = array;
+        chunk[k].undefined = undefined;
+        chunk[k].lo = size_t((size*(unsigned long long)(k))/nThreads);
+        chunk[k].hi = size_t((size*(unsigned long long)(k+1))/nThreads);
+        chunk[k].firstPos = int((currentPos-1+chunk[k].lo)%currentType)+1;
+        chunk[k].itemsPerLine = currentType;
+        chunk[k].level = currentLevel;
+        chunk[k].length = length;
+        chunk[k].precision = CT.externalPrecision;
+    }
+
+    for (unsigned k=1;k<nThreads;k++)
+    {
+        pthread_create(&threads[k],NULL,FormatItems<T>,&chunk[k]);
+    }
+
+    FormatItems<T>(&chunk[0]);
+
+    for (unsigned k=0;k<nThreads;k++)
+    {
+        if (k>0) pthread_join(threads[k],NULL);
+
+        expFile.write(chunk[k].text.data(),chunk[k].text.size());
+    }
+
+    currentPos = char(chunk[nThreads-1].lastPos);
+
+    delete[] threads;
+    delete[] chunk;
+}
+
+
+template <> void goblinExport::MakeItems(char* const* array,size_t size,char* undefined,char length) throw()
+{
+    for (size_t i=0;i<size;i++)
+    {
+        if (array[i]!=undefined)
+        {
+            MakeStringItem(array[i],length);
+        }
+        else
+        {
+            MakeNoItem(length);
+        }
+    }
+}
+
+
+template void goblinExport::MakeItems(const double* array,size_t size,double undefined,char length) throw();
+
+template void goblinExport::MakeItems(const float* array,size_t size,float undefined,char length) throw();
+
+
 template <typename T>
 void goblinExport::WriteAttribute(T* array,const char* attributeLabel,size_t size,T undefined) throw()
 {
@@ -232,17 +417,7 @@ void goblinExport::WriteAttribute(T* array,const char* attributeLabel,size_t siz
             if (array[i]!=undefined && thisLength>length) length = thisLength;
         }
 
-        for (size_t i=0;i<size;i++)
-        {
-            if (array[i]!=undefined)
-            {
-                MakeItem<T>(array[i],length);
-            }
-            else
-            {
-                MakeNoItem(length);
-            }
-        }
+        MakeItems<T>(array,size,undefined,length);
     }
 
     EndTuple();
@@ -255,6 +430,13 @@ template void goblinExport::WriteAttribute(float* array,const char* attributeLab
 template
 void goblinExport::WriteAttribute(unsigned long* array,const char* attributeLabel,size_t size,unsigned long undefined) throw();
 
+#if defined(_INDEX_32_)
+
+template
+void goblinExport::WriteAttribute(unsigned int* array,const char* attributeLabel,size_t size,unsigned int undefined) throw();
+
+#endif
+
 template void goblinExport::WriteAttribute(int* array,const char* attributeLabel,size_t size,int undefined) throw();
 
 template void goblinExport::WriteAttribute(bool* array,const char* attributeLabel,size_t size,bool undefined) throw();
@@ -277,273 +459,402 @@ void goblinExport::WriteConfiguration(const goblinController &CT1,TConfig tp) th
     goblinController CT2(goblinDefaultContext);
     CT2.SetDisplayParameters(TLayoutModel(CT1.layoutModel));
 
-    StartTuple("configure",2);
+    // Binary files take the same parameter list as the text format,
+    // but as a data block of zero terminated strings
+
+    ostringstream configText;
+    ostream& out = (binaryMode) ? static_cast<ostream&>(configText) : expFile;
+
+    if (!binaryMode) StartTuple("configure",2);
 
     if (CT1.sourceNode!=CT2.sourceNode || tp==CONF_DIFF)
-        expFile << endl << "   -source             " << CT1.sourceNode;
+        out << endl << "   -source             " << CT1.sourceNode;
 
     if (CT1.targetNode!=CT2.targetNode || tp==CONF_DIFF)
-        expFile << endl << "   -target             " << CT1.targetNode;
+        out << endl << "   -target             " << CT1.targetNode;
 
     if (CT1.rootNode!=CT2.rootNode || tp==CONF_DIFF)
-        expFile << endl << "   -root               " << CT1.rootNode;
+        out << endl << "   -root               " << CT1.rootNode;
 
     if (CT1.xShift!=CT2.xShift || tp==CONF_DIFF)
-        expFile << endl << "   -xShift             " << CT1.xShift;
+        out << endl << "   -xShift             " << CT1.xShift;
 
     if (CT1.yShift!=CT2.yShift || tp==CONF_DIFF)
-        expFile << endl << "   -yShift             " << CT1.yShift;
+        out << endl << "   -yShift             " << CT1.yShift;
 
     if (CT1.xZoom!=CT2.xZoom || tp==CONF_DIFF)
-        expFile << endl << "   -xZoom              " << CT1.xZoom;
+        out << endl << "   -xZoom              " << CT1.xZoom;
 
     if (CT1.yZoom!=CT2.yZoom || tp==CONF_DIFF)
-        expFile << endl << "   -yZoom              " << CT1.yZoom;
+        out << endl << "   -yZoom              " << CT1.yZoom;
 
     if (CT1.nodeSize!=CT2.nodeSize || tp==CONF_FULL)
-        expFile << endl << "   -nodeSize           " << CT1.nodeSize;
+        out << endl << "   -nodeSize           " << CT1.nodeSize;
 
     if (CT1.nodeScalable!=CT2.nodeScalable || tp==CONF_FULL)
-        expFile << endl << "   -nodeScalable       " << CT1.nodeScalable;
+        out << endl << "   -nodeScalable       " << CT1.nodeScalable;
 
     if (CT1.nodeSep!=CT2.nodeSep || tp==CONF_FULL)
-        expFile << endl << "   -nodeSep            " << CT1.nodeSep;
+        out << endl << "   -nodeSep            " << CT1.nodeSep;
 
     if (CT1.bendSep!=CT2.bendSep || tp==CONF_FULL)
-        expFile << endl << "   -bendSep            " << CT1.bendSep;
+        out << endl << "   -bendSep            " << CT1.bendSep;
 
     if (CT1.fineSep!=CT2.fineSep || tp==CONF_FULL)
-        expFile << endl << "   -fineSep            " << CT1.fineSep;
+        out << endl << "   -fineSep            " << CT1.fineSep;
 
     if (CT1.arrowSize!=CT2.arrowSize || tp==CONF_FULL)
-        expFile << endl << "   -arrowSize          " << CT1.arrowSize;
+        out << endl << "   -arrowSize          " << CT1.arrowSize;
 
     if (CT1.legenda!=CT2.legenda || tp==CONF_DIFF)
-        expFile << endl << "   -legenda            " << CT1.legenda;
+        out << endl << "   -legenda            " << CT1.legenda;
 
 
     if (CT1.arcLabels!=CT2.arcLabels || tp==CONF_FULL)
-        expFile << endl << "   -arcLabels          " << CT1.arcLabels;
+        out << endl << "   -arcLabels          " << CT1.arcLabels;
 
     if (CT1.arcLabels2!=CT2.arcLabels2 || tp==CONF_FULL)
-        expFile << endl << "   -arcLabels2         " << CT1.arcLabels2;
+        out << endl << "   -arcLabels2         " << CT1.arcLabels2;
 
     if (CT1.arcLabels3!=CT2.arcLabels3 || tp==CONF_FULL)
-        expFile << endl << "   -arcLabels3         " << CT1.arcLabels3;
+        out << endl << "   -arcLabels3         " << CT1.arcLabels3;
 
     if (CT1.nodeLabels!=CT2.nodeLabels || tp==CONF_FULL)
-        expFile << endl << "   -nodeLabels         " << CT1.nodeLabels;
+        out << endl << "   -nodeLabels         " << CT1.nodeLabels;
 
     if (CT1.nodeColours!=CT2.nodeColours || tp==CONF_FULL)
-        expFile << endl << "   -nodeColours        " << CT1.nodeColours;
+        out << endl << "   -nodeColours        " << CT1.nodeColours;
 
     if (CT1.subgraph!=CT2.subgraph || tp==CONF_FULL)
-        expFile << endl << "   -subgraph           " << CT1.subgraph;
+        out << endl << "   -subgraph           " << CT1.subgraph;
 
     if (CT1.predecessors!=CT2.predecessors || tp==CONF_FULL)
-        expFile << endl << "   -predecessors       " << CT1.predecessors;
+        out << endl << "   -predecessors       " << CT1.predecessors;
 
     if (CT1.arcStyle!=CT2.arcStyle || tp==CONF_FULL)
-        expFile << endl << "   -arcStyle           " << CT1.arcStyle;
+        out << endl << "   -arcStyle           " << CT1.arcStyle;
 
     if (CT1.nodeStyle!=CT2.nodeStyle || tp==CONF_FULL)
-        expFile << endl << "   -nodeStyle          " << CT1.nodeStyle;
+        out << endl << "   -nodeStyle          " << CT1.nodeStyle;
 
     if (CT1.arrows!=CT2.arrows || tp==CONF_FULL)
-        expFile << endl << "   -arrows             " << CT1.arrows;
+        out << endl << "   -arrows             " << CT1.arrows;
 
     if (CT1.arcColours!=CT2.arcColours || tp==CONF_FULL)
-        expFile << endl << "   -arcColours         " << CT1.arcColours;
+        out << endl << "   -arcColours         " << CT1.arcColours;
 
     if (strcmp(CT1.nodeFormatting,CT2.nodeFormatting)!=0 || tp==CONF_FULL)
     {
-        expFile << endl << "   -nodeFormatting     "
+        out << endl << "   -nodeFormatting     "
             << "\"" << CT1.nodeFormatting << "\"";
     }
 
     if (strcmp(CT1.arcFormatting,CT2.arcFormatting)!=0 || tp==CONF_FULL)
     {
-        expFile << endl << "   -arcFormatting      "
+        out << endl << "   -arcFormatting      "
             << "\"" << CT1.arcFormatting << "\"";
     }
 
     if (strcmp(CT1.wallpaper,CT2.wallpaper)!=0 || tp==CONF_FULL)
     {
-        expFile << endl << "   -wallpaper          "
+        out << endl << "   -wallpaper          "
             << "\"" << CT1.wallpaper << "\"";
     }
 
 
     if (CT1.displayMode!=CT2.displayMode || tp==CONF_FULL)
-        expFile << endl << "   -displayMode        " << CT1.displayMode;
+        out << endl << "   -displayMode        " << CT1.displayMode;
 
     if (CT1.traceLevel!=CT2.traceLevel || tp==CONF_FULL)
-        expFile << endl << "   -traceLevel         " << CT1.traceLevel;
+        out << endl << "   -traceLevel         " << CT1.traceLevel;
 
     if (CT1.traceData!=CT2.traceData || tp==CONF_FULL)
-        expFile << endl << "   -traceData          " << CT1.traceData;
+        out << endl << "   -traceData          " << CT1.traceData;
 
     if (CT1.traceStep!=CT2.traceStep || tp==CONF_FULL)
-        expFile << endl << "   -traceStep          " << CT1.traceStep;
+        out << endl << "   -traceStep          " << CT1.traceStep;
 
     if (CT1.threshold!=CT2.threshold || tp==CONF_FULL)
-        expFile << endl << "   -threshold          " << CT1.threshold;
+        out << endl << "   -threshold          " << CT1.threshold;
 
 
     if (CT1.logMeth!=CT2.logMeth || tp==CONF_FULL)
-        expFile << endl << "   -logMeth            " << CT1.logMeth;
+        out << endl << "   -logMeth            " << CT1.logMeth;
 
     if (CT1.logMem!=CT2.logMem || tp==CONF_FULL)
-        expFile << endl << "   -logMem             " << CT1.logMem;
+        out << endl << "   -logMem             " << CT1.logMem;
 
     if (CT1.logMan!=CT2.logMan || tp==CONF_FULL)
-        expFile << endl << "   -logMan             " << CT1.logMan;
+        out << endl << "   -logMan             " << CT1.logMan;
 
     if (CT1.logIO!=CT2.logIO || tp==CONF_FULL)
-        expFile << endl << "   -logIO              " << CT1.logIO;
+        out << endl << "   -logIO              " << CT1.logIO;
 
     if (CT1.logRes!=CT2.logRes || tp==CONF_FULL)
-        expFile << endl << "   -logRes             " << CT1.logRes;
+        out << endl << "   -logRes             " << CT1.logRes;
 
     if (CT1.logWarn!=CT2.logWarn || tp==CONF_FULL)
-        expFile << endl << "   -logWarn            " << CT1.logWarn;
+        out << endl << "   -logWarn            " << CT1.logWarn;
 
     if (CT1.logTimers!=CT2.logTimers || tp==CONF_FULL)
-        expFile << endl << "   -logTimers          " << CT1.logTimers;
+        out << endl << "   -logTimers          " << CT1.logTimers;
 
     if (CT1.logGaps!=CT2.logGaps || tp==CONF_FULL)
-        expFile << endl << "   -logGaps            " << CT1.logGaps;
+        out << endl << "   -logGaps            " << CT1.logGaps;
 
 
     if (CT1.methFailSave!=CT2.methFailSave || tp==CONF_FULL)
-        expFile << endl << "   -methFailSave       " << CT1.methFailSave;
+        out << endl << "   -methFailSave       " << CT1.methFailSave;
 
     if (CT1.methDSU!=CT2.methDSU || tp==CONF_FULL)
-        expFile << endl << "   -methDSU            " << CT1.methDSU;
+        out << endl << "   -methDSU            " << CT1.methDSU;
 
     if (CT1.methPQ!=CT2.methPQ || tp==CONF_FULL)
-        expFile << endl << "   -methPQ             " << CT1.methPQ;
+        out << endl << "   -methPQ             " << CT1.methPQ;
 
     if (CT1.methModLength!=CT2.methModLength || tp==CONF_FULL)
-        expFile << endl << "   -methModLength      " << CT1.methModLength;
+        out << endl << "   -methModLength      " << CT1.methModLength;
 
 
     if (CT1.methSPX!=CT2.methSPX || tp==CONF_FULL)
-        expFile << endl << "   -methSPX            " << CT1.methSPX;
+        out << endl << "   -methSPX            " << CT1.methSPX;
 
     if (CT1.methMST!=CT2.methMST || tp==CONF_FULL)
-        expFile << endl << "   -methMST            " << CT1.methMST;
+        out << endl << "   -methMST            " << CT1.methMST;
 
     if (CT1.methMXF!=CT2.methMXF || tp==CONF_FULL)
-        expFile << endl << "   -methMXF            " << CT1.methMXF;
+        out << endl << "   -methMXF            " << CT1.methMXF;
+
+    if (CT1.methMXFHeur!=CT2.methMXFHeur || tp==CONF_FULL)
+        out << endl << "   -methMXFHeur        " << CT1.methMXFHeur;
 
     if (CT1.methMCFST!=CT2.methMCFST || tp==CONF_FULL)
-        expFile << endl << "   -methMCFST          " << CT1.methMCFST;
+        out << endl << "   -methMCFST          " << CT1.methMCFST;
 
     if (CT1.methMCF!=CT2.methMCF || tp==CONF_FULL)
-        expFile << endl << "   -methMCF            " << CT1.methMCF;
+        out << endl << "   -methMCF            " << CT1.methMCF;
 
     if (CT1.methNWPricing!=CT2.methNWPricing || tp==CONF_FULL)
-        expFile << endl << "   -methNWPricing      " << CT1.methNWPricing;
+        out << endl << "   -methNWPricing      " << CT1.methNWPricing;
+
+    if (CT1.costScalingFactor!=CT2.costScalingFactor || tp==CONF_FULL)
+        out << endl << "   -costScalingFactor  " << CT1.costScalingFactor;
 
     if (CT1.methMCC!=CT2.methMCC || tp==CONF_FULL)
-        expFile << endl << "   -methMCC            " << CT1.methMCC;
+        out << endl << "   -methMCC            " << CT1.methMCC;
 
     if (CT1.methMaxBalFlow!=CT2.methMaxBalFlow || tp==CONF_FULL)
-        expFile << endl << "   -methMaxBalFlow     " << CT1.methMaxBalFlow;
+        out << endl << "   -methMaxBalFlow     " << CT1.methMaxBalFlow;
 
     if (CT1.methBNS!=CT2.methBNS || tp==CONF_FULL)
-        expFile << endl << "   -methBNS            " << CT1.methBNS;
+        out << endl << "   -methBNS            " << CT1.methBNS;
 
     if (CT1.methMinCBalFlow!=CT2.methMinCBalFlow || tp==CONF_FULL)
-        expFile << endl << "   -methMinCBalFlow    " << CT1.methMinCBalFlow;
+        out << endl << "   -methMinCBalFlow    " << CT1.methMinCBalFlow;
 
     if (CT1.methPrimalDual!=CT2.methPrimalDual || tp==CONF_FULL)
-        expFile << endl << "   -methPrimalDual     " << CT1.methPrimalDual;
+        out << endl << "   -methPrimalDual     " << CT1.methPrimalDual;
 
     if (CT1.methCandidates!=CT2.methCandidates || tp==CONF_FULL)
-        expFile << endl << "   -methCandidates     " << CT1.methCandidates;
+        out << endl << "   -methCandidates     " << CT1.methCandidates;
+
+    if (CT1.methAssignment!=CT2.methAssignment || tp==CONF_FULL)
+        out << endl << "   -methAssignment     " << CT1.methAssignment;
 
     if (CT1.methColour!=CT2.methColour || tp==CONF_FULL)
-        expFile << endl << "   -methColour         " << CT1.methColour;
+        out << endl << "   -methColour         " << CT1.methColour;
 
     if (CT1.methHeurTSP!=CT2.methHeurTSP || tp==CONF_FULL)
-        expFile << endl << "   -methHeurTSP        " << CT1.methHeurTSP;
+        out << endl << "   -methHeurTSP        " << CT1.methHeurTSP;
 
     if (CT1.methRelaxTSP1!=CT2.methRelaxTSP1 || tp==CONF_FULL)
-        expFile << endl << "   -methRelaxTSP1      " << CT1.methRelaxTSP1;
+        out << endl << "   -methRelaxTSP1      " << CT1.methRelaxTSP1;
 
     if (CT1.methRelaxTSP2!=CT2.methRelaxTSP2 || tp==CONF_FULL)
-        expFile << endl << "   -methRelaxTSP2      " << CT1.methRelaxTSP2;
+        out << endl << "   -methRelaxTSP2      " << CT1.methRelaxTSP2;
 
     if (CT1.methMaxCut!=CT2.methMaxCut || tp==CONF_FULL)
-        expFile << endl << "   -methMaxCut         " << CT1.methMaxCut;
+        out << endl << "   -methMaxCut         " << CT1.methMaxCut;
 
 
     if (CT1.methLP!=CT2.methLP || tp==CONF_FULL)
-        expFile << endl << "   -methLP             " << CT1.methLP;
+        out << endl << "   -methLP             " << CT1.methLP;
 
     if (CT1.methLPPricing!=CT2.methLPPricing || tp==CONF_FULL)
-        expFile << endl << "   -methLPPricing      " << CT1.methLPPricing;
+        out << endl << "   -methLPPricing      " << CT1.methLPPricing;
 
     if (CT1.methLPQTest!=CT2.methLPQTest || tp==CONF_FULL)
-        expFile << endl << "   -methLPQTest        " << CT1.methLPQTest;
+        out << endl << "   -methLPQTest        " << CT1.methLPQTest;
 
     if (CT1.methLPStart!=CT2.methLPStart || tp==CONF_FULL)
-        expFile << endl << "   -methLPStart        " << CT1.methLPStart;
+        out << endl << "   -methLPStart        " << CT1.methLPStart;
 
 
     if (CT1.methSolve!=CT2.methSolve || tp==CONF_FULL)
-        expFile << endl << "   -methSolve          " << CT1.methSolve;
+        out << endl << "   -methSolve          " << CT1.methSolve;
 
     if (CT1.methLocal!=CT2.methLocal || tp==CONF_FULL)
-        expFile << endl << "   -methLocal          " << CT1.methLocal;
+        out << endl << "   -methLocal          " << CT1.methLocal;
 
     if (CT1.maxBBIterations!=CT2.maxBBIterations || tp==CONF_FULL)
-        expFile << endl << "   -maxBBIterations    " << CT1.maxBBIterations;
+        out << endl << "   -maxBBIterations    " << CT1.maxBBIterations;
 
     if (CT1.maxBBNodes!=CT2.maxBBNodes || tp==CONF_FULL)
-        expFile << endl << "   -maxBBNodes         " << CT1.maxBBNodes;
+        out << endl << "   -maxBBNodes         " << CT1.maxBBNodes;
+
+    if (CT1.methBranch!=CT2.methBranch || tp==CONF_FULL)
+        out << endl << "   -methBranch         " << CT1.methBranch;
+
+    if (CT1.methComponents!=CT2.methComponents || tp==CONF_FULL)
+        out << endl << "   -methComponents     " << CT1.methComponents;
+
+    if (CT1.maxThreads!=CT2.maxThreads || tp==CONF_FULL)
+        out << endl << "   -maxThreads         " << CT1.maxThreads;
 
 
     if (CT1.methFDP!=CT2.methFDP || tp==CONF_FULL)
-        expFile << endl << "   -methFDP            " << CT1.methFDP;
+        out << endl << "   -methFDP            " << CT1.methFDP;
 
     if (CT1.methPlanarity!=CT2.methPlanarity || tp==CONF_FULL)
-        expFile << endl << "   -methPlanarity     " << CT1.methPlanarity;
+        out << endl << "   -methPlanarity     " << CT1.methPlanarity;
 
     if (CT1.methOrthogonal!=CT2.methOrthogonal || tp==CONF_FULL)
-        expFile << endl << "   -methOrthogonal     " << CT1.methOrthogonal;
+        out << endl << "   -methOrthogonal     " << CT1.methOrthogonal;
 
 
     if (CT1.randMin!=CT2.randMin || tp==CONF_FULL)
-        expFile << endl << "   -randMin            " << CT1.randMin;
+        out << endl << "   -randMin            " << CT1.randMin;
 
     if (CT1.randMax!=CT2.randMax || tp==CONF_FULL)
-        expFile << endl << "   -randMax            " << CT1.randMax;
+        out << endl << "   -randMax            " << CT1.randMax;
 
     if (CT1.randUCap!=CT2.randUCap || tp==CONF_FULL)
-        expFile << endl << "   -randUCap           " << CT1.randUCap;
+        out << endl << "   -randUCap           " << CT1.randUCap;
 
     if (CT1.randLCap!=CT2.randLCap || tp==CONF_FULL)
-        expFile << endl << "   -randLCap           " << CT1.randLCap;
+        out << endl << "   -randLCap           " << CT1.randLCap;
 
     if (CT1.randLength!=CT2.randLength || tp==CONF_FULL)
-        expFile << endl << "   -randLength         " << CT1.randLength;
+        out << endl << "   -randLength         " << CT1.randLength;
 
     if (CT1.randParallels!=CT2.randParallels || tp==CONF_FULL)
-        expFile << endl << "   -randParallels      " << CT1.randParallels;
+        out << endl << "   -randParallels      " << CT1.randParallels;
 
     if (CT1.randGeometry!=CT2.randGeometry || tp==CONF_FULL)
-        expFile << endl << "   -randGeometry       " << CT1.randGeometry;
+        out << endl << "   -randGeometry       " << CT1.randGeometry;
 
-    EndTuple();
+    if (!binaryMode)
+    {
+        EndTuple();
+        return;
+    }
+
+    // Split the parameter list into tokens. Quoted values may contain
+    // white space, and the quotes are dropped as by goblinImport::Scan()
+
+    std::string config = configText.str();
+    std::string tokens;
+    size_t i = 0;
+
+    while (true)
+    {
+        while (i<config.size() && isspace(config[i])) i++;
+
+        if (i>=config.size()) break;
+
+        if (config[i]=='\"')
+        {
+            size_t j = config.find('\"',i+1);
+            if (j==std::string::npos) j = config.size();
+            tokens.append(config,i+1,j-i-1);
+            i = j+1;
+        }
+        else
+        {
+            size_t j = i;
+            while (j<config.size() && !isspace(config[j])) j++;
+            tokens.append(config,i,j-i);
+            i = j;
+        }
+
+        tokens += '\0';
+    }
+
+    char noChar = 0;
+    WriteBinaryBlock(BIN_POOL_CONFIGURATION,0,TYPE_STRING,tokens.size(),tokens.data(),&noChar);
+}
+
+
+void goblinExport::WriteBinaryHeader(const char* objectClass,TNode n,TNode n1,TNode ni,
+    TArc m,TNode source,TNode target,TNode root) throw()
+{
+    TBinaryFileHeader header;
+    memset(&header,0,sizeof(TBinaryFileHeader));
+
+    memcpy(header.magic,BinaryFormatMagic,8);
+    header.version = BinaryFormatVersion;
+    header.byteOrder = 0x0102;
+    header.typeSize[0] = sizeof(TNode);
+    header.typeSize[1] = sizeof(TArc);
+    header.typeSize[2] = sizeof(TFloat);
+    header.typeSize[3] = sizeof(TCap);
+    header.typeSize[4] = sizeof(TIndex);
+    header.typeSize[5] = sizeof(TVar);
+    header.typeSize[6] = sizeof(TRestr);
+    header.typeSize[7] = sizeof(unsigned long);
+    strncpy(header.objectClass,objectClass,sizeof(header.objectClass));
+    header.n = n;
+    header.n1 = n1;
+    header.ni = ni;
+    header.m = m;
+    header.source = source;
+    header.target = target;
+    header.root = root;
+
+    expFile.write(reinterpret_cast<const char*>(&header),sizeof(TBinaryFileHeader));
+}
+
+
+void goblinExport::WriteBinaryBlock(unsigned short pool,unsigned short token,
+    TBaseType baseType,unsigned long length,const void* data,const void* defaultValue) throw()
+{
+    TBinaryBlockHeader header;
+    memset(&header,0,sizeof(TBinaryBlockHeader));
+
+    size_t itemSize = goblinBinaryImport::ItemSize(baseType);
+
+    header.pool = pool;
+    header.token = token;
+    header.baseType = (unsigned char)baseType;
+    header.itemSize = (unsigned char)itemSize;
+    header.length = length;
+    memcpy(header.defaultValue,defaultValue,itemSize);
+
+    expFile.write(reinterpret_cast<const char*>(&header),sizeof(TBinaryBlockHeader));
+
+    size_t bytes = length*itemSize;
+
+    if (bytes>0) expFile.write(static_cast<const char*>(data),bytes);
+
+    // Align the next block header to 8 bytes
+    static const char padding[8] = {0,0,0,0,0,0,0,0};
+    expFile.write(padding,((bytes+7) & ~size_t(7))-bytes);
+}
+
+
+void goblinExport::WriteBinaryEnd() throw()
+{
+    TBinaryBlockHeader header;
+    memset(&header,0,sizeof(TBinaryBlockHeader));
+    header.pool = BIN_POOL_END;
+
+    expFile.write(reinterpret_cast<const char*>(&header),sizeof(TBinaryBlockHeader));
 }
 
 
 goblinExport::~goblinExport() throw()
 {
-    expFile << endl;
+    if (!binaryMode) expFile << endl;
     expFile.close();
 
     if (currentLevel > 0)
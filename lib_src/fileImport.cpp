@@ -12,6 +12,8 @@
 /// \brief  #goblinImport class implementation
 
 #include "fileImport.h"
+#include <pthread.h>
+#include <string>
 
 
 goblinImport::goblinImport(const char* impFileName,goblinController& thisContext)
@@ -199,7 +201,7 @@ TNode* goblinImport::GetTNodeTuple(unsigned long k)
                 CT.Error(ERR_PARSE,NoHandle,"GetTNodeTuple","Length mismatch");
             }
 
-            #if defined(_BIG_NODES_)
+            #if defined(_BIG_NODES_) || defined(_INDEX_32_)
 
             if (strcmp(label,"*")) tuple[length++] = atol(label);
 
@@ -569,6 +571,280 @@ size_t goblinImport::AllocateTuple(TBaseType arrayType,TArrayDim dim)
 }
 
 
+/// Tuples with at least this number of required values are read by
+/// goblinImport::ReadLongTuple()
+static const size_t LongTupleLength = 4096;
+
+/// Minimum number of characters per thread in goblinImport::ReadLongTuple()
+static const size_t LongTupleChunk = 65536;
+
+
+struct TTupleChunk
+{
+    TBaseType       arrayType;
+    size_t          reqLength;
+    void*           array;
+    const char*     lo;         // First character of the chunk
+    const char*     hi;         // Behind the last character of the chunk
+    size_t          offset;     // Array index of the first value in the chunk
+    size_t          count;      // Number of values in the chunk
+};
+
+
+static inline bool IsBlank(char c) throw()
+{
+    return (c==' ' || c=='\n' || c=='\t' || c=='\r' || c=='\v' || c=='\f');
+}
+
+
+/// \brief  Convert a decimal number
+///
+/// Numbers with at most 15 significant digits, at most 22 fractional digits
+/// and without an exponent are converted by a single floating point division
+/// of two exactly represented values. This is correctly rounded and hence
+/// gives the same result as strtod(), which is used for all other numbers.
+static double ParseFloat(const char* label) throw()
+{
+    static const double powerOfTen[23] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+    const char* p = label;
+    bool negative = false;
+
+    if (*p=='-' || *p=='+')
+    {
+        negative = (*p=='-');
+        p++;
+    }
+
+    unsigned long long mantissa = 0;
+    int nDigits = 0;
+    int nSignificant = 0;
+    int nFraction = 0;
+    bool point = false;
+
+    for (;;p++)
+    {
+        if (*p>='0' && *p<='9')
+        {
+            if (mantissa>0 || *p!='0') nSignificant++;
+
+            if (nSignificant>15) break;
+
+            mantissa = 10*mantissa+(*p-'0');
+            nDigits++;
+
+            if (point) nFraction++;
+        }
+        else if (*p=='.' && !point) point = true;
+        else break;
+    }
+
+    if ((IsBlank(*p) || *p==0) && nDigits>0 && nFraction<=22)
+    {
+        double value = double(mantissa)/powerOfTen[nFraction];
+        return (negative) ? -value : value;
+    }
+
+    return strtod(label,NULL);
+}
+
+
+static void* CountTupleValues(void* arg) throw()
+{
+    TTupleChunk* chunk = static_cast<TTupleChunk*>(arg);
+    const char* p = chunk->lo;
+
+    chunk->count = 0;
+
+    while (true)
+    {
+        while (p<chunk->hi && IsBlank(*p)) p++;
+
+        if (p==chunk->hi) break;
+
+        chunk->count++;
+
+        while (p<chunk->hi && !IsBlank(*p)) p++;
+    }
+
+    return NULL;
+}
+
+
+static void* ConvertTupleValues(void* arg) throw()
+{
+    TTupleChunk* chunk = static_cast<TTupleChunk*>(arg);
+    const char* p = chunk->lo;
+    void* _array = chunk->array;
+
+    // Values beyond the required length are counted, but not stored
+    for (size_t i=chunk->offset;i<chunk->reqLength;i++)
+    {
+        while (p<chunk->hi && IsBlank(*p)) p++;
+
+        if (p==chunk->hi) break;
+
+        // The chunk ends with a blank or with the terminating zero. So the
+        // conversion functions do not read beyond the current token
+        const char* label = p;
+
+        while (p<chunk->hi && !IsBlank(*p)) p++;
+
+        bool undefined = (p==label+1 && *label=='*');
+
+        switch (chunk->arrayType)
+        {
+            case TYPE_NODE_INDEX:
+            {
+                static_cast<TNode*>(_array)[i] =
+                    (undefined) ? NoNode : TNode(strtol(label,NULL,10));
+                break;
+            }
+            case TYPE_ARC_INDEX:
+            {
+                static_cast<TArc*>(_array)[i] =
+                    (undefined) ? NoArc : TArc(strtol(label,NULL,10));
+                break;
+            }
+            case TYPE_FLOAT_VALUE:
+            {
+                static_cast<TFloat*>(_array)[i] =
+                    (undefined) ? InfFloat : TFloat(ParseFloat(label));
+                break;
+            }
+            case TYPE_CAP_VALUE:
+            {
+                static_cast<TCap*>(_array)[i] =
+                    (undefined) ? InfCap : TCap(ParseFloat(label));
+                break;
+            }
+            case TYPE_INDEX:
+            {
+                static_cast<TIndex*>(_array)[i] = TIndex(strtol(label,NULL,10));
+                break;
+            }
+            case TYPE_ORIENTATION:
+            {
+                static_cast<char*>(_array)[i] = char(strtol(label,NULL,10));
+                break;
+            }
+            case TYPE_INT:
+            {
+                static_cast<int*>(_array)[i] = int(strtol(label,NULL,10));
+                break;
+            }
+            case TYPE_BOOL:
+            {
+                static_cast<bool*>(_array)[i] = bool(strtol(label,NULL,10));
+                break;
+            }
+            case TYPE_VAR_INDEX:
+            {
+                static_cast<TVar*>(_array)[i] = TVar(strtol(label,NULL,10));
+                break;
+            }
+            case TYPE_RESTR_INDEX:
+            {
+                static_cast<TRestr*>(_array)[i] = TRestr(strtol(label,NULL,10));
+                break;
+            }
+            case TYPE_STRING:
+            case TYPE_SPECIAL:
+            {
+                break;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+
+static void RunTupleThreads(void* (*task)(void*),TTupleChunk* chunk,unsigned nThreads) throw()
+{
+    pthread_t* threads = new pthread_t[nThreads];
+
+    for (unsigned k=1;k<nThreads;k++)
+    {
+        pthread_create(&threads[k],NULL,task,&chunk[k]);
+    }
+
+    task(&chunk[0]);
+
+    for (unsigned k=1;k<nThreads;k++) pthread_join(threads[k],NULL);
+
+    delete[] threads;
+}
+
+
+void goblinImport::ReadLongTuple(TBaseType arrayType,size_t reqLength,void* _array)
+    throw(ERParse)
+{
+    string text;
+    getline(impFile,text,')');
+
+    if (impFile.eof() || impFile.fail())
+    {
+        CT.Error(ERR_PARSE,NoHandle,"ReadLongTuple","Parenthesis mismatch");
+    }
+
+    // The tuple head has been read before and is not on the top level
+    tail = true;
+    currentLevel--;
+
+    size_t nChars = text.size();
+    const char* first = text.c_str();
+    const char* last = first+nChars;
+
+    unsigned nThreads = CT.NumThreads();
+
+    if (nThreads>nChars/LongTupleChunk) nThreads = unsigned(nChars/LongTupleChunk);
+
+    if (nThreads==0) nThreads = 1;
+
+    TTupleChunk* chunk = new TTupleChunk[nThreads];
+
+    for (unsigned k=0;k<nThreads;k++)
+    {
+        chunk[k].arrayType = arrayType;
+        chunk[k].reqLength = reqLength;
+        chunk[k].array = _array;
+        chunk[k].lo = (k==0) ? first : chunk[k-1].hi;
+
+        if (k==nThreads-1)
+        {
+            chunk[k].hi = last;
+            continue;
+        }
+
+        // Move the chunk boundaries to the next blank
+        const char* p = first+(nChars*(unsigned long long)(k+1))/nThreads;
+
+        if (p<chunk[k].lo) p = chunk[k].lo;
+
+        while (p<last && !IsBlank(*p)) p++;
+
+        chunk[k].hi = p;
+    }
+
+    RunTupleThreads(CountTupleValues,chunk,nThreads);
+
+    length = 0;
+
+    for (unsigned k=0;k<nThreads;k++)
+    {
+        chunk[k].offset = length;
+        length += chunk[k].count;
+    }
+
+    RunTupleThreads(ConvertTupleValues,chunk,nThreads);
+
+    delete[] chunk;
+}
+
+
 void goblinImport::ReadTupleValues(TBaseType arrayType,size_t reqLength,void* _array)
     throw(ERParse)
 {
@@ -577,6 +853,14 @@ void goblinImport::ReadTupleValues(TBaseType arrayType,size_t reqLength,void* _a
     length = 0;
     char* label = NULL;
 
+    if (   !tail && reqLength>=LongTupleLength
+        && arrayType!=TYPE_STRING && arrayType!=TYPE_SPECIAL
+       )
+    {
+        // This also consumes the closing parenthesis, and the loop is skipped
+        ReadLongTuple(arrayType,reqLength,_array);
+    }
+
     while (!tail)
     {
         label = Scan();
@@ -593,7 +877,7 @@ void goblinImport::ReadTupleValues(TBaseType arrayType,size_t reqLength,void* _a
             {
                 case TYPE_NODE_INDEX:
                 {
-                    #if defined(_BIG_NODES_)
+                    #if defined(_BIG_NODES_) || defined(_INDEX_32_)
 
                     if (strcmp(label,"*"))
                         static_cast<TNode*>(_array)[length++] = TNode(atol(label));
@@ -16,7 +16,7 @@
 #include "globals.h"
 
 
-#if defined(_BIG_NODES_)
+#if defined(_BIG_NODES_) || defined(_INDEX_32_)
 
 const TNode     NoNode   = 200000;
 
@@ -80,6 +80,49 @@ long unsigned goblinNAllocs   = 0;
 long unsigned goblinNObjects  = 0;
 
 
+// The memory counters are shared by all contexts and by all threads.
+// They are therefore updated by atomic operations only
+
+static void GoblinUpdateMaxSize(long unsigned newSize) throw()
+{
+    long unsigned oldMax = goblinMaxSize;
+
+    while (newSize>oldMax)
+    {
+        long unsigned prevMax =
+            __sync_val_compare_and_swap(&goblinMaxSize,oldMax,newSize);
+
+        if (prevMax==oldMax) break;
+
+        oldMax = prevMax;
+    }
+}
+
+
+void GoblinHeapAcquire(size_t size) throw()
+{
+    GoblinUpdateMaxSize(__sync_add_and_fetch(&goblinHeapSize,size));
+    __sync_add_and_fetch(&goblinNFragments,1);
+    __sync_add_and_fetch(&goblinNAllocs,1);
+}
+
+
+void GoblinHeapRelease(size_t size) throw()
+{
+    __sync_sub_and_fetch(&goblinHeapSize,size);
+    __sync_sub_and_fetch(&goblinNFragments,1);
+}
+
+
+void GoblinHeapResize(size_t oldSize,size_t newSize) throw()
+{
+    // Unsigned wrap-around yields the correct result when shrinking
+    GoblinUpdateMaxSize(__sync_add_and_fetch(&goblinHeapSize,
+        (long unsigned)(newSize)-(long unsigned)(oldSize)));
+    __sync_add_and_fetch(&goblinNAllocs,1);
+}
+
+
 #if defined(_HEAP_MON_GLOBAL_)
 
 void* operator new(size_t size) throw (std::bad_alloc)
@@ -88,12 +131,7 @@ void* operator new(size_t size) throw (std::bad_alloc)
 
     if (void* p = malloc(size+sizeof(size_t)))
     {
-        goblinHeapSize += size;
-
-        if (goblinHeapSize>goblinMaxSize) goblinMaxSize = goblinHeapSize;
-
-        goblinNFragments++;
-        goblinNAllocs++;
+        GoblinHeapAcquire(size);
 
         *((size_t*)(p)) = size;
         return (size_t*)(p)+1;
@@ -109,12 +147,7 @@ void* operator new[](size_t size) throw (std::bad_alloc)
 
     if (void* p = malloc(size+sizeof(size_t)))
     {
-        goblinHeapSize += size;
-
-        if (goblinHeapSize>goblinMaxSize) goblinMaxSize = goblinHeapSize;
-
-        goblinNFragments++;
-        goblinNAllocs++;
+        GoblinHeapAcquire(size);
 
         *((size_t*)(p)) = size;
         return (size_t*)(p)+1;
@@ -130,12 +163,7 @@ void* operator new(size_t size,const std::nothrow_t& type) throw ()
 
     if (void* p = malloc(size+sizeof(size_t)))
     {
-        goblinHeapSize += size;
-
-        if (goblinHeapSize>goblinMaxSize) goblinMaxSize = goblinHeapSize;
-
-        goblinNFragments++;
-        goblinNAllocs++;
+        GoblinHeapAcquire(size);
 
         *((size_t*)(p)) = size;
 
@@ -152,12 +180,7 @@ void* operator new[](size_t size,const std::nothrow_t& type) throw ()
 
     if (void* p = malloc(size+sizeof(size_t)))
     {
-        goblinHeapSize += size;
-
-        if (goblinHeapSize>goblinMaxSize) goblinMaxSize = goblinHeapSize;
-
-        goblinNFragments++;
-        goblinNAllocs++;
+        GoblinHeapAcquire(size);
         *((size_t*)(p)) = size;
 
         return (size_t*)(p)+1;
@@ -175,12 +198,7 @@ void* GoblinRealloc(void* p,size_t size) throw (std::bad_alloc)
 
         if (void* p = malloc(size+sizeof(size_t)))
         {
-            goblinHeapSize += size;
-
-            if (goblinHeapSize>goblinMaxSize) goblinMaxSize = goblinHeapSize;
-
-            goblinNFragments++;
-            goblinNAllocs++;
+            GoblinHeapAcquire(size);
 
             *((size_t*)(p)) = size;
             return (size_t*)(p)+1;
@@ -194,20 +212,16 @@ void* GoblinRealloc(void* p,size_t size) throw (std::bad_alloc)
 
         if (size==old_size) return p;
 
-        goblinHeapSize += size-old_size;
-
         if (size==0)
         {
-            goblinNFragments--;
+            GoblinHeapRelease(old_size);
             free((size_t*)(p)-1);
             return NULL;
         }
 
         if (size_t* q = (size_t*)malloc(size+sizeof(size_t)))
         {
-            if (goblinHeapSize>goblinMaxSize) goblinMaxSize = goblinHeapSize;
-
-            goblinNAllocs++;
+            GoblinHeapResize(old_size,size);
 
             *q = size;
 
@@ -232,8 +246,7 @@ void operator delete(void* p) throw ()
     if (!p) return;
 
     size_t size = *((size_t*)(p)-1);
-    goblinHeapSize -= size;
-    goblinNFragments--;
+    GoblinHeapRelease(size);
 
     free((size_t*)(p)-1);
 }
@@ -245,8 +258,7 @@ void operator delete[](void* p) throw ()
 
     size_t size = *((size_t*)(p)-1);
 
-    goblinHeapSize -= size;
-    goblinNFragments--;
+    GoblinHeapRelease(size);
 
     free((size_t*)(p)-1);
 }
@@ -259,8 +271,7 @@ void operator delete(void* p,size_t) throw ()
     if (!p) return;
 
     size_t size = *((size_t*)(p)-1);
-    goblinHeapSize -= size;
-    goblinNFragments--;
+    GoblinHeapRelease(size);
 
     free((size_t*)(p)-1);
 }
@@ -272,8 +283,7 @@ void operator delete[](void* p,size_t) throw ()
 
     size_t size = *((size_t*)(p)-1);
 
-    goblinHeapSize -= size;
-    goblinNFragments--;
+    GoblinHeapRelease(size);
 
     free((size_t*)(p)-1);
 }
@@ -285,8 +295,7 @@ void operator delete(void *p,const std::nothrow_t&) throw ()
 
     size_t size = *((size_t*)(p)-1);
 
-    goblinHeapSize -= size;
-    goblinNFragments--;
+    GoblinHeapRelease(size);
 
     free((size_t*)(p)-1);
 }
@@ -298,8 +307,7 @@ void operator delete[](void *p,const std::nothrow_t&) throw ()
 
     size_t size = *((size_t*)(p)-1);
 
-    goblinHeapSize -= size;
-    goblinNFragments--;
+    GoblinHeapRelease(size);
 
     free((size_t*)(p)-1);
 }
@@ -320,7 +328,19 @@ THandle NewObjectHandle()
     // Handles are globally unique, not context dependent
     static THandle nextObjectHandle = 1;
 
-    if (nextObjectHandle+1==NoHandle) nextObjectHandle = 0;
+    THandle thisHandle = nextObjectHandle;
+
+    while (true)
+    {
+        THandle followingHandle = thisHandle+1;
+
+        if (followingHandle==NoHandle) followingHandle = 0;
+
+        THandle prevHandle =
+            __sync_val_compare_and_swap(&nextObjectHandle,thisHandle,followingHandle);
 
-    return nextObjectHandle++;
+        if (prevHandle==thisHandle) return thisHandle;
+
+        thisHandle = prevHandle;
+    }
 }
@@ -15,7 +15,9 @@
 #include "fileImport.h"
 #include "fileExport.h"
 #include "lpSolver.h"
-#include "abstractMixedGraph.h"  // For several enum values
+#include "abstractBigraph.h"     // For several enum values
+
+#include <unistd.h>
 
 
 #if defined(_HEAP_MON_LOCAL_)
@@ -27,12 +29,7 @@ void* goblinRootObject::operator new(size_t size) throw (std::bad_alloc)
 
     if (void* p = malloc(size+sizeof(size_t)))
     {
-        goblinHeapSize += size;
-
-        if (goblinHeapSize>goblinMaxSize) goblinMaxSize = goblinHeapSize;
-
-        goblinNFragments++;
-        goblinNAllocs++;
+        GoblinHeapAcquire(size);
 
         *((size_t*)(p)) = size;
 
@@ -49,12 +46,7 @@ void* goblinRootObject::operator new[](size_t size) throw (std::bad_alloc)
 
     if (void* p = malloc(size+sizeof(size_t)))
     {
-        goblinHeapSize += size;
-
-        if (goblinHeapSize>goblinMaxSize) goblinMaxSize = goblinHeapSize;
-
-        goblinNFragments++;
-        goblinNAllocs++;
+        GoblinHeapAcquire(size);
         *((size_t*)(p)) = size;
 
         return (size_t*)(p)+1;
@@ -71,12 +63,7 @@ void* goblinRootObject::operator new(size_t size,const std::nothrow_t& type)
 
     if (void* p = malloc(size+sizeof(size_t)))
     {
-        goblinHeapSize += size;
-
-        if (goblinHeapSize>goblinMaxSize) goblinMaxSize = goblinHeapSize;
-
-        goblinNFragments++;
-        goblinNAllocs++;
+        GoblinHeapAcquire(size);
 
         *((size_t*)(p)) = size;
 
@@ -96,12 +83,7 @@ void* goblinRootObject::operator new[](size_t size,const std::nothrow_t& type)
 
     if (void* p = malloc(size+sizeof(size_t)))
     {
-        goblinHeapSize += size;
-
-        if (goblinHeapSize>goblinMaxSize) goblinMaxSize = goblinHeapSize;
-
-        goblinNFragments++;
-        goblinNAllocs++;
+        GoblinHeapAcquire(size);
         *((size_t*)(p)) = size;
 
         return (size_t*)(p)+1;
@@ -122,12 +104,7 @@ void* goblinRootObject::GoblinRealloc(void* p,size_t size) const throw (std::bad
         p = malloc(size+sizeof(size_t));
         if (p)
         {
-            goblinHeapSize += size;
-
-            if (goblinHeapSize>goblinMaxSize) goblinMaxSize = goblinHeapSize;
-
-            goblinNFragments++;
-            goblinNAllocs++;
+            GoblinHeapAcquire(size);
 
             *((size_t*)(p)) = size;
 
@@ -142,11 +119,9 @@ void* goblinRootObject::GoblinRealloc(void* p,size_t size) const throw (std::bad
 
         if (size==old_size) return p;
 
-        goblinHeapSize += size-old_size;
-
         if (size==0)
         {
-            goblinNFragments--;
+            GoblinHeapRelease(old_size);
             free((size_t*)(p)-1);
 
             return NULL;
@@ -155,9 +130,7 @@ void* goblinRootObject::GoblinRealloc(void* p,size_t size) const throw (std::bad
         size_t* q = (size_t*)malloc(size+sizeof(size_t));
         if (q)
         {
-            if (goblinHeapSize>goblinMaxSize) goblinMaxSize = goblinHeapSize;
-
-            goblinNFragments++;
+            GoblinHeapResize(old_size,size);
 
             *q = size;
 
@@ -183,8 +156,7 @@ void goblinRootObject::operator delete(void *p) throw ()
 
     size_t size = *((size_t*)(p)-1);
 
-    goblinHeapSize -= size;
-    goblinNFragments--;
+    GoblinHeapRelease(size);
 
     free((size_t*)(p)-1);
 }
@@ -196,8 +168,7 @@ void  goblinRootObject::operator delete[](void *p) throw ()
 
     size_t size = *((size_t*)(p)-1);
 
-    goblinHeapSize -= size;
-    goblinNFragments--;
+    GoblinHeapRelease(size);
 
     free((size_t*)(p)-1);
 }
@@ -210,8 +181,7 @@ void goblinRootObject::operator delete(void *p,const std::nothrow_t&)
 
     size_t size = *((size_t*)(p)-1);
 
-    goblinHeapSize -= size;
-    goblinNFragments--;
+    GoblinHeapRelease(size);
 
     free((size_t*)(p)-1);
 }
@@ -224,8 +194,7 @@ void  goblinRootObject::operator delete[](void *p,const std::nothrow_t&)
 
     size_t size = *((size_t*)(p)-1);
 
-    goblinHeapSize -= size;
-    goblinNFragments--;
+    GoblinHeapRelease(size);
 
     free((size_t*)(p)-1);
 }
@@ -241,6 +210,10 @@ const char   goblinController::patchLevel[] = _GOBLIN_REVISION_;
 char const*         goblinController::pLPModule = NULL;
 char*               goblinController::controllerTable = NULL;
 goblinRootObject*   goblinController::firstController = NULL;
+__thread char       goblinController::logBuffer[LOGBUFFERSIZE];
+
+// Protects the list of controllers and the controllerTable
+static pthread_mutex_t controllerLock = PTHREAD_MUTEX_INITIALIZER;
 
 
 goblinController::goblinController() throw()
@@ -252,6 +225,7 @@ goblinController::goblinController() throw()
     objectExtension = "gob";
 
     newObjectHandler = &NewObjectHandle;
+    pthread_mutex_init(&objectLock,NULL);
 
     sourceNode = NoNode;
     targetNode = NoNode;
@@ -354,10 +328,12 @@ goblinController::goblinController() throw()
     methSPX         = abstractMixedGraph::SPX_FIFO;
     methMST         = abstractMixedGraph::MST_PRIM2;
     methMXF         = abstractMixedGraph::MXF_DINIC;
+    methMXFHeur     = abstractMixedGraph::MXF_HEUR_NONE;
     methMCC         = abstractMixedGraph::MCC_PREFLOW_HIGH;
     methMCFST       = abstractMixedGraph::MCF_ST_DIJKSTRA;
     methMCF         = abstractMixedGraph::MCF_BF_SIMPLEX;
     methNWPricing   = 0;
+    costScalingFactor = 16;
     methMaxBalFlow  = 2;
     methBNS         = 0;
     methDSU         = 1;
@@ -368,6 +344,7 @@ goblinController::goblinController() throw()
     methPrimalDual  = 2;
     methModLength   = 0;
     methCandidates  = 5;
+    methAssignment  = abstractBiGraph::MCA_FLOW;
     methColour      = 0;
     methHeurTSP     = abstractMixedGraph::TSP_HEUR_CHRISTOFIDES;
     methRelaxTSP1   = abstractMixedGraph::TSP_RELAX_FAST;
@@ -381,6 +358,9 @@ goblinController::goblinController() throw()
 
     maxBBIterations = -1;
     maxBBNodes      = 20;
+    methBranch      = 0;
+    methComponents  = abstractMixedGraph::COMP_DFS;
+    maxThreads      = 0;
 
     methFDP         = abstractMixedGraph::FDP_GEM;
     methPlanarity   = abstractMixedGraph::PLANAR_DMP;
@@ -395,6 +375,7 @@ goblinController::goblinController() throw()
     tolerance = 0.001;
 
     SetRandomBounds(0,99);
+    randSeed = 1;
     randUCap      = 0;
     randLCap      = 0;
     randLength    = 1;
@@ -414,6 +395,8 @@ goblinController::goblinController() throw()
     // Let objectTable contain itself ;)
     RegisterObject(useTable,useTable->Handle());
 
+    pthread_mutex_lock(&controllerLock);
+
     if (!controllerTable)
     {
         goblinHashTable<THandle,long unsigned>* useTable2 =
@@ -429,6 +412,8 @@ goblinController::goblinController() throw()
         RegisterController();
     }
 
+    pthread_mutex_unlock(&controllerLock);
+
 
     // Module entry points
     if (!pLPModule)
@@ -451,6 +436,7 @@ goblinController::goblinController(const goblinController &masterContext,
     objectExtension = "gob";
 
     newObjectHandler = masterContext.newObjectHandler;
+    pthread_mutex_init(&objectLock,NULL);
 
     sourceNode = masterContext.sourceNode;
     targetNode = masterContext.targetNode;
@@ -557,10 +543,12 @@ goblinController::goblinController(const goblinController &masterContext,
     methSPX         = masterContext.methSPX;
     methMST         = masterContext.methMST;
     methMXF         = masterContext.methMXF;
+    methMXFHeur     = masterContext.methMXFHeur;
     methMCC         = masterContext.methMCC;
     methMCFST       = masterContext.methMCFST;
     methMCF         = masterContext.methMCF;
     methNWPricing   = masterContext.methNWPricing;
+    costScalingFactor = masterContext.costScalingFactor;
     methMaxBalFlow  = masterContext.methMaxBalFlow;
     methBNS         = masterContext.methBNS;
     methDSU         = masterContext.methDSU;
@@ -572,6 +560,7 @@ goblinController::goblinController(const goblinController &masterContext,
     methPrimalDual  = masterContext.methPrimalDual;
     methModLength   = masterContext.methModLength;
     methCandidates  = masterContext.methCandidates;
+    methAssignment  = masterContext.methAssignment;
     methColour      = masterContext.methColour;
     methRelaxTSP1   = masterContext.methRelaxTSP1;
     methRelaxTSP2   = masterContext.methRelaxTSP2;
@@ -584,6 +573,9 @@ goblinController::goblinController(const goblinController &masterContext,
 
     maxBBIterations = masterContext.maxBBIterations;
     maxBBNodes      = masterContext.maxBBNodes;
+    methBranch      = masterContext.methBranch;
+    methComponents  = masterContext.methComponents;
+    maxThreads      = masterContext.maxThreads;
 
     methFDP         = masterContext.methFDP;
     methPlanarity   = masterContext.methPlanarity;
@@ -605,6 +597,7 @@ goblinController::goblinController(const goblinController &masterContext,
     tolerance = masterContext.tolerance;
 
     SetRandomBounds(masterContext.randMin,masterContext.randMax);
+    randSeed = masterContext.randSeed;
     randUCap      = masterContext.randUCap;
     randLCap      = masterContext.randLCap;
     randLength    = masterContext.randLength;
@@ -624,8 +617,10 @@ goblinController::goblinController(const goblinController &masterContext,
     // Let objectTable contain itself ;)
     RegisterObject(useTable,useTable->Handle());
 
-    // Let controllerTable contain this controller (goblinDefaultContext)
+    // Let controllerTable contain this controller
+    pthread_mutex_lock(&controllerLock);
     RegisterController();
+    pthread_mutex_unlock(&controllerLock);
 
     LogEntry(LOG_MEM,NoHandle,"...Context allocated.");
 }
@@ -873,6 +868,9 @@ void goblinController::Configure(int ParamCount,const char* ParamStr[])
     pc = FindParam(ParamCount,ParamStr,"-methMXF");
     if (pc>0 && pc<ParamCount-1) methMXF = atoi(ParamStr[pc+1]);
 
+    pc = FindParam(ParamCount,ParamStr,"-methMXFHeur");
+    if (pc>0 && pc<ParamCount-1) methMXFHeur = atoi(ParamStr[pc+1]);
+
     pc = FindParam(ParamCount,ParamStr,"-methMCC");
     if (pc>0 && pc<ParamCount-1) methMCC = atoi(ParamStr[pc+1]);
 
@@ -885,6 +883,9 @@ void goblinController::Configure(int ParamCount,const char* ParamStr[])
     pc = FindParam(ParamCount,ParamStr,"-methNWPricing");
     if (pc>0 && pc<ParamCount-1) methNWPricing = atoi(ParamStr[pc+1]);
 
+    pc = FindParam(ParamCount,ParamStr,"-costScalingFactor");
+    if (pc>0 && pc<ParamCount-1) costScalingFactor = atoi(ParamStr[pc+1]);
+
     pc = FindParam(ParamCount,ParamStr,"-methMaxBalFlow");
     if (pc>0 && pc<ParamCount-1) methMaxBalFlow = atoi(ParamStr[pc+1]);
 
@@ -915,6 +916,9 @@ void goblinController::Configure(int ParamCount,const char* ParamStr[])
     pc = FindParam(ParamCount,ParamStr,"-methCandidates");
     if (pc>0 && pc<ParamCount-1) methCandidates = atoi(ParamStr[pc+1]);
 
+    pc = FindParam(ParamCount,ParamStr,"-methAssignment");
+    if (pc>0 && pc<ParamCount-1) methAssignment = atoi(ParamStr[pc+1]);
+
     pc = FindParam(ParamCount,ParamStr,"-methHeurTSP");
     if (pc>0 && pc<ParamCount-1) methHeurTSP = atoi(ParamStr[pc+1]);
 
@@ -945,6 +949,15 @@ void goblinController::Configure(int ParamCount,const char* ParamStr[])
     pc = FindParam(ParamCount,ParamStr,"-maxBBNodes");
     if (pc>0 && pc<ParamCount-1) maxBBNodes = atoi(ParamStr[pc+1]);
 
+    pc = FindParam(ParamCount,ParamStr,"-methBranch");
+    if (pc>0 && pc<ParamCount-1) methBranch = atoi(ParamStr[pc+1]);
+
+    pc = FindParam(ParamCount,ParamStr,"-methComponents");
+    if (pc>0 && pc<ParamCount-1) methComponents = atoi(ParamStr[pc+1]);
+
+    pc = FindParam(ParamCount,ParamStr,"-maxThreads");
+    if (pc>0 && pc<ParamCount-1) maxThreads = atoi(ParamStr[pc+1]);
+
     pc = FindParam(ParamCount,ParamStr,"-methFDP");
     if (pc>0 && pc<ParamCount-1) methFDP = atoi(ParamStr[pc+1]);
 
@@ -973,7 +986,7 @@ void goblinController::Configure(int ParamCount,const char* ParamStr[])
     if (pc>0 && pc<ParamCount-1) randLCap = atoi(ParamStr[pc+1]);
 
     pc = FindParam(ParamCount,ParamStr,"-seed");
-    if (pc>0 && pc<ParamCount-1) srand(atoi(ParamStr[pc+1]));
+    if (pc>0 && pc<ParamCount-1) randSeed = atoi(ParamStr[pc+1]);
 
     pc = FindParam(ParamCount,ParamStr,"-epsilon");
     if (pc>0 && pc<ParamCount-1) epsilon = atol(ParamStr[pc+1]);
@@ -1053,6 +1066,8 @@ void goblinController::ReleaseLPModule() throw()
 
 goblinController::~goblinController() throw()
 {
+    pthread_mutex_lock(&controllerLock);
+
     // When no other controller remains, the LP module must be released
     if (!(firstController->nextObject) && pLPModule) ReleaseLPModule();
 
@@ -1071,6 +1086,8 @@ goblinController::~goblinController() throw()
         useTable -> ChangeKey(OH,(long unsigned)NULL);
     }
 
+    pthread_mutex_unlock(&controllerLock);
+
     #if defined(_FAILSAVE_)
 
     if (firstObject->nextObject)
@@ -1101,6 +1118,8 @@ goblinController::~goblinController() throw()
     #endif
 
     // Unlink from controller list
+    pthread_mutex_lock(&controllerLock);
+
     if (static_cast<goblinRootObject*>(this)==firstController)
     {
         firstController = nextObject;
@@ -1112,6 +1131,10 @@ goblinController::~goblinController() throw()
         if (nextObject) nextObject->prevObject = prevObject;
     }
 
+    pthread_mutex_unlock(&controllerLock);
+
+    pthread_mutex_destroy(&objectLock);
+
     if (!isDefault && logMem)
         LogEntry(LOG_MEM,NoHandle,"...Context disallocated.");
 }
@@ -1121,7 +1144,6 @@ unsigned long goblinController::Size() const throw()
 {
     unsigned long tmpSize
         = sizeof(goblinController)
-        + sizeof(char[LOGBUFFERSIZE])
         + strlen(nodeFormatting)+1
         + strlen(arcFormatting)+1
         + strlen(wallpaper)+1;
@@ -1152,6 +1174,8 @@ THandle goblinController::LinkController()
     }
 
     // Update linked list of member objects
+    pthread_mutex_lock(&controllerLock);
+
     nextObject = firstController;
     prevObject = NULL;
 
@@ -1161,6 +1185,8 @@ THandle goblinController::LinkController()
 
     if (controllerTable) RegisterController();
 
+    pthread_mutex_unlock(&controllerLock);
+
     return thisHandle;
 }
 
@@ -1181,6 +1207,8 @@ void goblinController::RegisterController()
 THandle goblinController::InsertObject(goblinRootObject* thisObject)
     throw(ERRejected)
 {
+    pthread_mutex_lock(&objectLock);
+
     // Receive a new handle
     THandle thisHandle = newObjectHandler();
 
@@ -1201,6 +1229,8 @@ THandle goblinController::InsertObject(goblinRootObject* thisObject)
 
     if (objectTable) RegisterObject(thisObject,thisHandle);
 
+    pthread_mutex_unlock(&objectLock);
+
     return thisHandle;
 }
 
@@ -1224,10 +1254,15 @@ void goblinController::DeleteObject(const goblinRootObject* thisObject)
     goblinHashTable<THandle,long unsigned>* useTable =
         reinterpret_cast<goblinHashTable<THandle,long unsigned>*>(objectTable);
 
+    pthread_mutex_lock(&objectLock);
+
     #if defined(_FAILSAVE_)
 
     if (objectTable && useTable->Key(thisHandle)==(long unsigned)NULL)
+    {
+        pthread_mutex_unlock(&objectLock);
         Error(ERR_REJECTED,NoHandle,"DeleteObject","Context mismatch");
+    }
 
     #endif
 
@@ -1251,6 +1286,8 @@ void goblinController::DeleteObject(const goblinRootObject* thisObject)
     // Reset master object if necessary
     if (masterObject==thisObject) masterObject = NULL;
 
+    pthread_mutex_unlock(&objectLock);
+
     if (logMem)
     {
         sprintf(logBuffer,"...Object with handle <%ld> deleted",thisHandle);
@@ -1341,6 +1378,31 @@ bool goblinController::SolverRunning() const throw()
 }
 
 
+unsigned goblinController::NumThreads() const throw()
+{
+    if (maxThreads>0) return unsigned(maxThreads);
+
+    long nProcessors = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return (nProcessors>1) ? unsigned(nProcessors) : 1;
+}
+
+
+static __thread bool isWorkerThread = false;
+
+
+void goblinController::SetWorkerThread(bool isWorker) throw()
+{
+    isWorkerThread = isWorker;
+}
+
+
+bool goblinController::WorkerThread() throw()
+{
+    return isWorkerThread;
+}
+
+
 unsigned long goblinController::Rand(unsigned long x) throw(ERRange)
 {
     #if defined(_FAILSAVE_)
@@ -1354,7 +1416,7 @@ unsigned long goblinController::Rand(unsigned long x) throw(ERRange)
 
     unsigned long ret = goblinRandMax;
     while (ret>=thisRandMax)
-        ret = (unsigned long)((rand()*(RAND_MAX+1)+rand())%x);
+        ret = (unsigned long)((rand_r(&randSeed)*(RAND_MAX+1)+rand_r(&randSeed))%x);
     return ret;
 }
 
@@ -1434,7 +1496,7 @@ void goblinController::SetBounds(TNode cMaxNode,TArc cMaxArc,
 }
 
 
-static char lengthCheckBuffer[25];
+static __thread char lengthCheckBuffer[25];
 
 char goblinController::ExternalIntLength(long int val) const throw()
 {
@@ -1460,6 +1522,8 @@ char goblinController::ExternalFloatLength(TFloat val) const throw()
 
 void goblinController::IncreaseLogLevel() throw(ERRejected)
 {
+    if (WorkerThread()) return;
+
     #if defined(_FAILSAVE_)
 
     if (logLevel==INT_MAX)
@@ -1473,6 +1537,8 @@ void goblinController::IncreaseLogLevel() throw(ERRejected)
 
 void goblinController::DecreaseLogLevel() throw(ERRejected)
 {
+    if (WorkerThread()) return;
+
     #if defined(_FAILSAVE_)
 
     if (logLevel==0)
@@ -1488,6 +1554,8 @@ void goblinController::DecreaseLogLevel() throw(ERRejected)
 
 void goblinController::OpenFold(TModule mod,TOption opt) throw(ERRejected)
 {
+    if (WorkerThread()) return;
+
     if ( !(opt & managedObject::NO_INDENT) ) IncreaseLogLevel();
 
     if (moduleNestingLevel<MAX_MODULE_NESTING)
@@ -1508,6 +1576,8 @@ void goblinController::OpenFold(TModule mod,TOption opt) throw(ERRejected)
 
 void goblinController::CloseFold(TModule mod,TOption opt) throw(ERRejected)
 {
+    if (WorkerThread()) return;
+
     if ( !(opt & managedObject::NO_INDENT) ) DecreaseLogLevel();
 
     moduleNestingLevel--;
@@ -1540,6 +1610,8 @@ void goblinController::CloseFold(TModule mod,TOption opt) throw(ERRejected)
 void goblinController::InitProgressCounter(double l,TProgressOptions mode)
     throw()
 {
+    if (WorkerThread()) return;
+
     TTimer thisTimer =
         listOfModules[nestedModule[moduleNestingLevel-1]].moduleTimer;
 
@@ -1637,7 +1709,7 @@ void goblinController::ProgressStep(double step) throw()
         }
     }
 */
-    if (moduleNestingLevel==0 || step==0) return;
+    if (moduleNestingLevel==0 || step==0 || WorkerThread()) return;
 
     TTimer thisTimer =
         listOfModules[nestedModule[moduleNestingLevel-1]].moduleTimer;
@@ -1678,7 +1750,7 @@ void goblinController::SetProgressCounter(double l) throw()
         }
     }
 */
-    if (moduleNestingLevel==0) return;
+    if (moduleNestingLevel==0 || WorkerThread()) return;
 
     TTimer thisTimer =
         listOfModules[nestedModule[moduleNestingLevel-1]].moduleTimer;
@@ -1704,7 +1776,7 @@ void goblinController::SetProgressCounter(double l) throw()
 
 void goblinController::SetProgressMax(double l) throw()
 {
-    if (moduleNestingLevel==0) return;
+    if (moduleNestingLevel==0 || WorkerThread()) return;
 
     TTimer thisTimer =
         listOfModules[nestedModule[moduleNestingLevel-1]].moduleTimer;
@@ -1716,7 +1788,7 @@ void goblinController::SetProgressMax(double l) throw()
 
 void goblinController::SetProgressNext(double step) throw()
 {
-    if (progressHigh<0) return;
+    if (progressHigh<0 || WorkerThread()) return;
 
     TTimer thisTimer =
         listOfModules[nestedModule[moduleNestingLevel-1]].moduleTimer;
@@ -1735,6 +1807,8 @@ void goblinController::SetProgressNext(double step) throw()
 
 void goblinController::SuppressLogging() throw()
 {
+    if (WorkerThread()) return;
+
     if (suppressCount==0)
     {
         savedLogEventHandler = logEventHandler;
@@ -1748,6 +1822,8 @@ void goblinController::SuppressLogging() throw()
 
 void goblinController::RestoreLogging() throw()
 {
+    if (WorkerThread()) return;
+
     suppressCount--;
 
     if (suppressCount==0)
@@ -1813,6 +1889,9 @@ void goblinController::DefaultLogEventHandler(
 
 THandle goblinController::LogFilter(msgType msg,THandle OH,char* logEntry) const throw()
 {
+    // Worker threads of parallel solver methods do not write any log entries
+    if (WorkerThread()) return NoHandle;
+
     void (*usedLogEventHandler)(msgType,TModule,THandle,char*)
         = logEventHandler;
 
@@ -1914,45 +1993,54 @@ void goblinController::LogEnd(THandle LH,char* logEntry) const throw()
 void goblinController::Error(msgType msg,THandle OH,char* methodName,
     char* description) throw(ERRange,ERRejected,ERCheck,ERFile,ERParse)
 {
-    // Maintain information for GOSH shell
+    // Worker threads of parallel solver methods only raise the exception
+    bool logError = !WorkerThread();
 
-    strcpy(savedErrorMethodName,methodName);
-    strcpy(savedErrorDescription,description);
-    savedErrorOriginator = OH;
-    savedErrorMsgType = msg;
+    if (logError)
+    {
+        // Maintain information for GOSH shell
+
+        strcpy(savedErrorMethodName,methodName);
+        strcpy(savedErrorDescription,description);
+        savedErrorOriginator = OH;
+        savedErrorMsgType = msg;
+    }
 
     if (!logWarn && msg==MSG_WARN) return;
 
-    compoundLogEntry = false;
+    if (logError) compoundLogEntry = false;
 
     if (!logWarn && msg==ERR_CHECK) throw ERCheck();
 
-    LogEntry(msg,OH,"::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::");
-
-    if (methodName)
+    if (logError)
     {
-        THandle LH = LogStart(msg,OH,methodName);
-        LogAppend(LH," - ");
-        LogEnd(LH,description);
-    }
-    else LogEntry(msg,OH,description);
+        LogEntry(msg,OH,"::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::");
 
-    if (OH!=NoHandle)
-    {
-        const char* thisLabel = ObjectPointer(OH)->Label();
+        if (methodName)
+        {
+            THandle LH = LogStart(msg,OH,methodName);
+            LogAppend(LH," - ");
+            LogEnd(LH,description);
+        }
+        else LogEntry(msg,OH,description);
 
-        if (thisLabel)
+        if (OH!=NoHandle)
         {
-            sprintf(logBuffer,"Object \"%s\"",thisLabel);
+            const char* thisLabel = ObjectPointer(OH)->Label();
+
+            if (thisLabel)
+            {
+                sprintf(logBuffer,"Object \"%s\"",thisLabel);
+            }
+            else sprintf(logBuffer,"Object #%ld",(unsigned long)OH);
         }
-        else sprintf(logBuffer,"Object #%ld",(unsigned long)OH);
-    }
-    else sprintf(logBuffer,"Controller object");
+        else sprintf(logBuffer,"Controller object");
 
-    LogEntry(msg,OH,logBuffer);
-    sprintf(logBuffer,", before trace point #%d",breakPoint);
-    LogEntry(MSG_APPEND,OH,logBuffer);
-    LogEntry(msg,OH,"::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::");
+        LogEntry(msg,OH,logBuffer);
+        sprintf(logBuffer,", before trace point #%d",breakPoint);
+        LogEntry(MSG_APPEND,OH,logBuffer);
+        LogEntry(msg,OH,"::::::::::::::::::::::::::::::::::::::::::::::::::::::::::::");
+    }
 
     switch (msg)
     {
@@ -1969,6 +2057,8 @@ void goblinController::Error(msgType msg,THandle OH,char* methodName,
 
 void goblinController::Trace(THandle HH,unsigned long step) throw()
 {
+    if (WorkerThread()) return;
+
     #if defined(_PROGRESS_)
 
     ProgressStep(step);
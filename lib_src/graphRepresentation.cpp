@@ -74,19 +74,19 @@ void graphRepresentation::Reserve(TNode _n,TArc _m,TNode _l)
 
     if (_n>=CT.MaxNode())
     {
-        sprintf(CT.logBuffer,"Number of graph nodes is out of range: %ld",_n);
+        sprintf(CT.logBuffer,"Number of graph nodes is out of range: %ld",(unsigned long)_n);
         Error(ERR_REJECTED,"Reserve",CT.logBuffer);
     }
 
     if (2*_m>CT.MaxArc()-2)
     {
-        sprintf(CT.logBuffer,"Number of arcs is out of range: %ld",_m);
+        sprintf(CT.logBuffer,"Number of arcs is out of range: %ld",(unsigned long)_m);
         Error(ERR_REJECTED,"Reserve",CT.logBuffer);
     }
 
     if (_l>=CT.MaxNode())
     {
-        sprintf(CT.logBuffer,"Number of layout nodes is out of range: %ld",_l);
+        sprintf(CT.logBuffer,"Number of layout nodes is out of range: %ld",(unsigned long)_l);
         Error(ERR_REJECTED,"Reserve",CT.logBuffer);
     }
 
@@ -163,6 +163,8 @@ graphRepresentation::~graphRepresentation()
 void graphRepresentation::SetUCap(TArc a,TCap _ucap)
     throw(ERRange)
 {
+    G.Unfreeze();
+
     #if defined(_FAILSAVE_)
 
     if (a>=2*mAct) NoSuchArc("SetUCap",a);
@@ -200,6 +202,8 @@ void graphRepresentation::SetUCap(TArc a,TCap _ucap)
 void graphRepresentation::SetCUCap(TCap _ucap)
     throw(ERRange)
 {
+    G.Unfreeze();
+
     #if defined(_FAILSAVE_)
 
     if (_ucap<0)
@@ -343,6 +347,8 @@ void graphRepresentation::SetCDemand(TCap _demand)
 
 void graphRepresentation::SetMetricType(abstractMixedGraph::TMetricType metricType) throw()
 {
+    G.Unfreeze();
+
     attribute<int>* attrMetric = geometry.GetAttribute<int>(TokGeoMetric);
 
     if (metricType==abstractMixedGraph::METRIC_DISABLED)
@@ -385,43 +391,11 @@ TFloat graphRepresentation::Length(TArc a)
 
     if (v1==v2) return InfFloat;
 
-    TFloat x1 = G.C(v1,0);
-    TFloat y1 = G.C(v1,1);
-    TFloat x2 = G.C(v2,0);
-    TFloat y2 = G.C(v2,1);
-
-    if (metricType==abstractMixedGraph::METRIC_SPHERIC)
-    {
-        const double radius = 6378.388;
-
-        double deg = int(x1);
-        double min = x1-deg;
-        double latitude1 = PI*(deg+5.0*min/3.0)/180.0;
-        deg = int(y1);
-        min = y1-deg;
-        double longitude1 = PI*(deg+5.0*min/3.0)/180.0;
-
-        deg = int(x2);
-        min = x2-deg;
-        double latitude2 = PI*(deg+5.0*min/3.0)/180.0;
-        deg = int(y2);
-        min = y2-deg;
-        double longitude2 = PI*(deg+5.0*min/3.0)/180.0;
-
-        double q1 = cos(longitude1-longitude2);
-        double q2 = cos(latitude1-latitude2);
-        double q3 = cos(latitude1+latitude2);
-        return int(radius*acos(0.5*((1.0+q1)*q2-(1.0-q1)*q3))+1.0);
-    }
-
-    TFloat dx = fabs(x1-x2);
-    TFloat dy = fabs(y1-y2);
+    TFloat thisDistance = G.MetricDistance(metricType,v1,v2);
 
-    if (metricType==abstractMixedGraph::METRIC_MANHATTAN) return floor(dx+dy+0.5);
-    if (metricType==abstractMixedGraph::METRIC_EUCLIDIAN) return floor(sqrt(dx*dx+dy*dy)+0.5);
+    if (metricType==abstractMixedGraph::METRIC_SPHERIC) return int(thisDistance+1.0);
 
-    // metricType==METRIC_MAXIMUM
-    return ((dx>dy) ? floor(dx+0.5) : floor(dy+0.5));
+    return floor(thisDistance+0.5);
 }
 
 
@@ -449,6 +423,8 @@ TFloat graphRepresentation::MaxLength()
 void graphRepresentation::SetLength(TArc a,TFloat _length)
     throw(ERRange)
 {
+    G.Unfreeze();
+
     #if defined(_FAILSAVE_)
 
     if (a>=2*mAct) NoSuchArc("SetLength",a);
@@ -478,6 +454,8 @@ void graphRepresentation::SetLength(TArc a,TFloat _length)
 void graphRepresentation::SetCLength(TFloat _length)
     throw()
 {
+    G.Unfreeze();
+
     if (_length!=defaultLength)
     {
         representation.MakeAttribute<TFloat>(G,TokReprLength,attributePool::ATTR_ALLOW_NULL,&_length);
@@ -492,6 +470,8 @@ void graphRepresentation::SetCLength(TFloat _length)
 void graphRepresentation::SetOrientation(TArc a,char _orientation)
     throw(ERRange)
 {
+    G.Unfreeze();
+
     #if defined(_FAILSAVE_)
 
     if (a>=2*mAct) NoSuchArc("SetOrientation",a);
@@ -524,6 +504,8 @@ void graphRepresentation::SetOrientation(TArc a,char _orientation)
 void graphRepresentation::SetCOrientation(char _orientation)
     throw()
 {
+    G.Unfreeze();
+
     #if defined(_FAILSAVE_)
 
     if (_orientation>=4)
@@ -577,6 +559,10 @@ void graphRepresentation::SetC(TNode v,TDim i,TFloat pos)
 
     #endif
 
+    // Geometric length labels depend on the first two coordinates
+    if (i<2 && G.IsFrozen() && G.MetricType()!=abstractMixedGraph::METRIC_DISABLED)
+        G.Unfreeze();
+
     attribute<TFloat>* axis = geometry.GetAttribute<TFloat>(TokGeoAxis0+i);
 
     if (!axis && pos!=defaultC)
@@ -591,6 +577,8 @@ void graphRepresentation::SetC(TNode v,TDim i,TFloat pos)
 void graphRepresentation::ReleaseCoordinate(TDim i)
     throw(ERRange)
 {
+    G.Unfreeze();
+
     #if defined(_FAILSAVE_)
 
     if (i>2)
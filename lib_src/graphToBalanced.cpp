@@ -881,9 +881,9 @@ TFloat graphToBalanced::CancelOdd() throw()
 
     if (CT.logRes)
     {
-        sprintf(CT.logBuffer,"%ld odd length cycles eliminated",k1+k2);
+        sprintf(CT.logBuffer,"%ld odd length cycles eliminated",(unsigned long)(k1+k2));
         LogEntry(LOG_RES,CT.logBuffer);
-        sprintf(CT.logBuffer,"Flow value decreases by %ld units",k2);
+        sprintf(CT.logBuffer,"Flow value decreases by %ld units",(unsigned long)k2);
         LogEntry(LOG_RES,CT.logBuffer);
     }
 
@@ -94,7 +94,7 @@ template <class TItem,class TKey>
 char* goblinHashTable<TItem,TKey>::Display() const throw()
 {
     LogEntry(MSG_TRACE,"Hash table");
-    sprintf(CT.logBuffer,"Maximum size: %ld",nMax);
+    sprintf(CT.logBuffer,"Maximum size: %ld",(unsigned long)nMax);
     LogEntry(MSG_TRACE2,CT.logBuffer);
     sprintf(CT.logBuffer,"Default key: %g",double(defaultKey));
     LogEntry(MSG_TRACE2,CT.logBuffer);
@@ -105,12 +105,12 @@ char* goblinHashTable<TItem,TKey>::Display() const throw()
 
         if (x!=UNDEFINED)
         {
-            sprintf(CT.logBuffer,"Q[%ld]:",w0);
+            sprintf(CT.logBuffer,"Q[%ld]:",(unsigned long)w0);
             THandle LH = LogStart(MSG_TRACE2,CT.logBuffer);
 
             while (x!=UNDEFINED)
             {
-                sprintf(CT.logBuffer," (%ld,%g)",index[x],double(key[x]));
+                sprintf(CT.logBuffer," (%ld,%g)",(unsigned long)index[x],double(key[x]));
                 LogAppend(LH,CT.logBuffer);
                 x = next[x];
             }
@@ -292,7 +292,7 @@ template class goblinHashTable<TArc,TArc>;
 
 template class goblinHashTable<TArc,TFloat>;
 
-#if defined(_SMALL_ARCS_)
+#if defined(_SMALL_ARCS_) || defined(_INDEX_32_)
 
 template class goblinHashTable<TIndex,TFloat>;
 
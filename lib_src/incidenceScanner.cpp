@@ -0,0 +1,36 @@
+
+//  This file forms part of the GOBLIN C++ Class Library.
+//
+//  Initially written by the GOBLIN developers, October 2026
+//
+//  Copying, compiling, distribution and modification
+//  of this source code is permitted only in accordance
+//  with the GOBLIN general licence information.
+
+/// \file   incidenceScanner.cpp
+/// \brief  #sparseScanner class implementation
+
+#include "incidenceScanner.h"
+
+
+sparseScanner::sparseScanner(const abstractMixedGraph& _G) throw() : G(_G)
+{
+    const sparseRepresentation* X =
+        static_cast<const sparseRepresentation*>(G.Representation());
+
+    SN    = X->SN;
+    right = X->right;
+    first = X->first;
+
+    const attributePool& pool = X->RepresentationalData();
+
+    pLength      = pool.GetAttribute<TFloat>(TokReprLength);
+    pUCap        = pool.GetAttribute<TCap>(TokReprUCap);
+    pOrientation = pool.GetAttribute<char>(TokReprOrientation);
+
+    // Geometric length labels are computed from the node coordinates, and
+    // balanced flow networks overload the length labels. In both cases, the
+    // length labels are obtained by the virtual method
+    explicitLength =
+        (G.MetricType()==abstractMixedGraph::METRIC_DISABLED && !G.IsBalanced());
+}
@@ -173,7 +173,7 @@ TArc iSurfaceGraph::ReadBlossom(TNode v,TArc thisProp) throw(ERRange)
 
     #if defined(_FAILSAVE_)
 
-    sprintf(CT.logBuffer,"No such blossom: %ld",v);
+    sprintf(CT.logBuffer,"No such blossom: %ld",(unsigned long)v);
     Error(ERR_RANGE,"ReadBlossom",CT.logBuffer);
 
     #endif
@@ -0,0 +1,726 @@
+
+//  This file forms part of the GOBLIN C++ Class Library.
+//
+//  Initially written by the GOBLIN developers, October 2026
+//
+//  Copying, compiling, distribution and modification
+//  of this source code is permitted only in accordance
+//  with the GOBLIN general licence information.
+
+/// \file   jonkerVolgenant.cpp
+/// \brief  Jonker / Volgenant method for the linear assignment problem
+
+#include "abstractBigraph.h"
+#include "csrRepresentation.h"
+#include "binaryHeap.h"
+
+
+/// \brief  Data structures of the Jonker / Volgenant method
+///
+/// The left-hand nodes are the rows and the right-hand nodes are the columns
+/// of the assignment problem. Only column potentials v[] are stored. The
+/// potential of an assigned row i is implicitly rowCost[i]-v[rowCol[i]], and
+/// all reduced lengths c(i,j)-u[i]-v[j] are kept non-negative.
+
+class jonkerVolgenant : public managedObject
+{
+private:
+
+    abstractBiGraph &G; // Related graph object
+
+    TNode   n1;         // Number of rows and of columns
+
+    const csrRepresentation* X; // Node incidences
+    csrRepresentation* localX;  // Node incidences if the graph is not frozen
+
+    bool    dense;      // Apply the shortest path search without a priority queue
+
+    TFloat* v;          // Column potentials
+    TNode*  rowCol;     // The column assigned to every row, or NoNode
+    TFloat* rowCost;    // The length of the assigning arc of every row
+    TArc*   rowArc;     // The assigning arc of every row
+    TNode*  colRow;     // The row assigned to every column, or NoNode
+
+    TNode*  freeRow;    // The unassigned rows
+    TNode   nFree;      // The number of unassigned rows
+
+    TFloat* d;          // Distance labels of the columns
+    TNode*  predRow;    // The row preceding a column on a shortest path
+    TFloat* predCost;   // The length of the arc which reaches a column
+    TArc*   predArc;    // The arc which reaches a column
+
+    TNode*  col;        // Dense search: Columns partitioned into ready, scan and todo
+    TNode*  pos;        // Dense search: Position of every column in col[]
+
+    binaryHeap<TNode,TFloat>* Q;    // Sparse search: Labelled columns
+    char*   state;      // Sparse search: 0 = unlabelled, 1 = labelled, 2 = scanned
+    TNode*  reached;    // Sparse search: The labelled and the scanned columns
+
+    unsigned long nTransfer;    // Number of reduction transfers
+    unsigned long nRowReduce;   // Number of augmenting row reduction steps
+    unsigned long nAugment;     // Number of shortest path augmentations
+
+public:
+
+    jonkerVolgenant(abstractBiGraph& GC) throw();
+    ~jonkerVolgenant() throw();
+
+    unsigned long   Size() const throw();
+    unsigned long   Allocated() const throw();
+
+    bool            Solve() throw();
+    TFloat          ExportAssignment() throw();
+
+private:
+
+    void            Assign(TNode i,TNode j,TFloat c,TArc a) throw();
+
+    bool            ColumnReduction() throw();
+    bool            AugmentingRowReduction() throw();
+    TNode           SearchDense(TNode f) throw();
+    TNode           SearchSparse(TNode f) throw();
+    void            Augment(TNode f,TNode j) throw();
+
+};
+
+
+jonkerVolgenant::jonkerVolgenant(abstractBiGraph& GC) throw() :
+    managedObject(GC.Context()), G(GC)
+{
+    n1 = G.N1();
+
+    X = G.FrozenIncidences();
+    localX = NULL;
+
+    if (!X)
+    {
+        localX = new csrRepresentation(G);
+        X = localX;
+    }
+
+    // Scanning all columns per search step pays off if a substantial
+    // part of all node pairs is adjacent
+    dense = G.IsDense() || TFloat(X->NSlots())*2>=TFloat(n1)*n1;
+
+    v        = new TFloat[n1];
+    rowCol   = new TNode[n1];
+    rowCost  = new TFloat[n1];
+    rowArc   = new TArc[n1];
+    colRow   = new TNode[n1];
+    freeRow  = new TNode[n1];
+    d        = new TFloat[n1];
+    predRow  = new TNode[n1];
+    predCost = new TFloat[n1];
+    predArc  = new TArc[n1];
+
+    col = pos = NULL;
+    Q = NULL;
+    state = NULL;
+    reached = NULL;
+
+    if (dense)
+    {
+        col = new TNode[n1];
+        pos = new TNode[n1];
+    }
+    else
+    {
+        Q = new binaryHeap<TNode,TFloat>(n1,CT);
+        state = new char[n1];
+        reached = new TNode[n1];
+    }
+
+    for (TNode j=0;j<n1;j++)
+    {
+        v[j] = 0;
+        rowCol[j] = colRow[j] = NoNode;
+        rowArc[j] = NoArc;
+
+        if (state) state[j] = 0;
+    }
+
+    nFree = 0;
+    nTransfer = nRowReduce = nAugment = 0;
+
+    LogEntry(LOG_MEM,"...Jonker/Volgenant data structures allocated");
+}
+
+
+jonkerVolgenant::~jonkerVolgenant() throw()
+{
+    delete[] v;
+    delete[] rowCol;
+    delete[] rowCost;
+    delete[] rowArc;
+    delete[] colRow;
+    delete[] freeRow;
+    delete[] d;
+    delete[] predRow;
+    delete[] predCost;
+    delete[] predArc;
+
+    if (col) delete[] col;
+    if (pos) delete[] pos;
+    if (Q) delete Q;
+    if (state) delete[] state;
+    if (reached) delete[] reached;
+
+    if (localX) delete localX;
+
+    LogEntry(LOG_MEM,"...Jonker/Volgenant data structures disallocated");
+}
+
+
+unsigned long jonkerVolgenant::Size() const throw()
+{
+    return
+          sizeof(jonkerVolgenant)
+        + managedObject::Allocated()
+        + jonkerVolgenant::Allocated();
+}
+
+
+unsigned long jonkerVolgenant::Allocated() const throw()
+{
+    unsigned long tmpSize =
+        n1*(4*sizeof(TFloat)+5*sizeof(TNode)+2*sizeof(TArc));
+
+    if (dense) tmpSize += 2*n1*sizeof(TNode);
+    else tmpSize += n1*(sizeof(char)+sizeof(TNode))+Q->Size();
+
+    if (localX) tmpSize += localX->Size();
+
+    return tmpSize;
+}
+
+
+void jonkerVolgenant::Assign(TNode i,TNode j,TFloat c,TArc a) throw()
+{
+    rowCol[i] = j;
+    rowCost[i] = c;
+    rowArc[i] = a;
+    colRow[j] = i;
+}
+
+
+bool jonkerVolgenant::ColumnReduction() throw()
+{
+    // Every column potential is set to the minimum length of the column.
+    // A column is assigned to the minimizing row unless that row has been
+    // assigned before. Columns are processed in reverse order, as proposed
+    // in the original paper
+
+    TNode* nMatch = new TNode[n1];
+
+    for (TNode i=0;i<n1;i++) nMatch[i] = 0;
+
+    bool feasible = true;
+
+    for (TNode j=n1;j>0 && feasible;)
+    {
+        j--;
+
+        TFloat cMin = InfFloat;
+        TArc kMin = NoArc;
+
+        for (TArc k=X->First(n1+j);k<X->Stop(n1+j);k++)
+        {
+            if (X->Capacitated(k) && X->Length(k)<cMin)
+            {
+                cMin = X->Length(k);
+                kMin = k;
+            }
+        }
+
+        if (kMin==NoArc)
+        {
+            feasible = false;
+            break;
+        }
+
+        v[j] = cMin;
+
+        TNode i = X->EndNode(kMin);
+
+        if (nMatch[i]++==0) Assign(i,j,cMin,X->Arc(kMin));
+    }
+
+
+    // Reduction transfer: For a row which is the minimum of a single column,
+    // the column potential is decreased so that the row reduced lengths
+    // become non-negative with the row potential as large as possible
+
+    for (TNode i=0;i<n1 && feasible;i++)
+    {
+        if (nMatch[i]==0)
+        {
+            freeRow[nFree++] = i;
+            continue;
+        }
+
+        if (nMatch[i]>1) continue;
+
+        TNode j1 = rowCol[i];
+        TFloat hMin = InfFloat;
+
+        for (TArc k=X->First(i);k<X->Stop(i);k++)
+        {
+            TNode j = X->EndNode(k)-n1;
+
+            if (j==j1 || !X->Capacitated(k)) continue;
+
+            TFloat h = X->Length(k)-v[j];
+
+            if (h<hMin) hMin = h;
+        }
+
+        if (hMin<InfFloat)
+        {
+            v[j1] -= hMin;
+            nTransfer++;
+        }
+    }
+
+    delete[] nMatch;
+
+    return feasible;
+}
+
+
+bool jonkerVolgenant::AugmentingRowReduction() throw()
+{
+    // Every free row is assigned to its column of minimum reduced length. If
+    // the second smallest reduced length is strictly larger, the column
+    // potential is decreased by the difference, and the displaced row is
+    // processed immediately. Otherwise, the row takes the second column if
+    // this one is free, and displaced rows are processed in the next pass
+
+    for (int pass=0;pass<2 && nFree>0;pass++)
+    {
+        TNode nPrevFree = nFree;
+        TNode k = 0;
+        unsigned long nSteps = 0;
+
+        nFree = 0;
+
+        while (k<nPrevFree)
+        {
+            TNode i = freeRow[k++];
+
+            TFloat u1 = InfFloat;
+            TFloat u2 = InfFloat;
+            TNode j1 = NoNode;
+            TNode j2 = NoNode;
+            TArc k1 = NoArc;
+            TArc k2 = NoArc;
+
+            for (TArc l=X->First(i);l<X->Stop(i);l++)
+            {
+                if (!X->Capacitated(l)) continue;
+
+                TNode j = X->EndNode(l)-n1;
+                TFloat h = X->Length(l)-v[j];
+
+                if (j==j1)
+                {
+                    // A parallel arc
+                    if (h<u1)
+                    {
+                        u1 = h;
+                        k1 = l;
+                    }
+                }
+                else if (h<u1)
+                {
+                    u2 = u1;
+                    j2 = j1;
+                    k2 = k1;
+                    u1 = h;
+                    j1 = j;
+                    k1 = l;
+                }
+                else if (h<u2)
+                {
+                    u2 = h;
+                    j2 = j;
+                    k2 = l;
+                }
+            }
+
+            if (j1==NoNode) return false;
+
+            TNode i0 = colRow[j1];
+
+            // Bound the number of immediate re-assignments for real-valued
+            // lengths, where the potential decreases can be tiny
+            bool strict = (u2<InfFloat && u1<u2-CT.epsilon && nSteps<4*(unsigned long)(n1));
+
+            if (strict)
+            {
+                v[j1] -= u2-u1;
+                nSteps++;
+            }
+            else if (i0!=NoNode && j2!=NoNode)
+            {
+                j1 = j2;
+                k1 = k2;
+                i0 = colRow[j2];
+            }
+
+            if (i0!=NoNode) rowCol[i0] = NoNode;
+
+            Assign(i,j1,X->Length(k1),X->Arc(k1));
+            nRowReduce++;
+
+            if (i0!=NoNode)
+            {
+                if (strict) freeRow[--k] = i0;
+                else freeRow[nFree++] = i0;
+            }
+        }
+    }
+
+    return true;
+}
+
+
+TNode jonkerVolgenant::SearchDense(TNode f) throw()
+{
+    // Columns col[0..low-1] are ready, col[low..up-1] are to be scanned and
+    // have the current minimum distance, and col[up..n1-1] are to be done
+
+    for (TNode j=0;j<n1;j++)
+    {
+        d[j] = InfFloat;
+        col[j] = pos[j] = j;
+    }
+
+    for (TArc k=X->First(f);k<X->Stop(f);k++)
+    {
+        if (!X->Capacitated(k)) continue;
+
+        TNode j = X->EndNode(k)-n1;
+        TFloat h = X->Length(k)-v[j];
+
+        if (h<d[j])
+        {
+            d[j] = h;
+            predRow[j] = f;
+            predCost[j] = X->Length(k);
+            predArc[j] = X->Arc(k);
+        }
+    }
+
+    TNode low = 0;
+    TNode up = 0;
+    TNode last = 0;
+    TNode endOfPath = NoNode;
+    TFloat dMin = InfFloat;
+
+    while (endOfPath==NoNode)
+    {
+        if (up==low)
+        {
+            // Collect the todo columns with minimum distance
+
+            last = low;
+            dMin = d[col[up++]];
+
+            for (TNode p=up;p<n1;p++)
+            {
+                TNode j = col[p];
+                TFloat h = d[j];
+
+                if (h<=dMin)
+                {
+                    if (h<dMin)
+                    {
+                        up = low;
+                        dMin = h;
+                    }
+
+                    col[p] = col[up];
+                    pos[col[p]] = p;
+                    col[up] = j;
+                    pos[j] = up;
+                    up++;
+                }
+            }
+
+            if (dMin==InfFloat) return NoNode;
+
+            for (TNode p=low;p<up;p++)
+            {
+                if (colRow[col[p]]==NoNode)
+                {
+                    endOfPath = col[p];
+                    break;
+                }
+            }
+
+            if (endOfPath!=NoNode) break;
+        }
+
+
+        // Scan the row assigned to a column with minimum distance
+
+        TNode j1 = col[low++];
+        TNode i = colRow[j1];
+        TFloat u1 = rowCost[i]-v[j1]-dMin;
+
+        for (TArc k=X->First(i);k<X->Stop(i);k++)
+        {
+            TNode j = X->EndNode(k)-n1;
+
+            if (pos[j]<up || !X->Capacitated(k)) continue;
+
+            TFloat h = X->Length(k)-v[j]-u1;
+
+            if (h<d[j])
+            {
+                d[j] = h;
+                predRow[j] = i;
+                predCost[j] = X->Length(k);
+                predArc[j] = X->Arc(k);
+
+                if (h==dMin)
+                {
+                    if (colRow[j]==NoNode)
+                    {
+                        endOfPath = j;
+                        break;
+                    }
+
+                    TNode p = pos[j];
+                    col[p] = col[up];
+                    pos[col[p]] = p;
+                    col[up] = j;
+                    pos[j] = up;
+                    up++;
+                }
+            }
+        }
+    }
+
+
+    // Update the potentials of the ready columns
+
+    for (TNode p=0;p<last;p++)
+    {
+        TNode j = col[p];
+        v[j] += d[j]-dMin;
+    }
+
+    return endOfPath;
+}
+
+
+TNode jonkerVolgenant::SearchSparse(TNode f) throw()
+{
+    TNode nReached = 0;
+
+    for (TArc k=X->First(f);k<X->Stop(f);k++)
+    {
+        if (!X->Capacitated(k)) continue;
+
+        TNode j = X->EndNode(k)-n1;
+        TFloat h = X->Length(k)-v[j];
+
+        if (state[j]==0)
+        {
+            state[j] = 1;
+            reached[nReached++] = j;
+            Q -> Insert(j,h);
+        }
+        else if (h<d[j]) Q -> ChangeKey(j,h);
+        else continue;
+
+        d[j] = h;
+        predRow[j] = f;
+        predCost[j] = X->Length(k);
+        predArc[j] = X->Arc(k);
+    }
+
+    TNode endOfPath = NoNode;
+    TFloat dMin = InfFloat;
+
+    while (!Q->Empty())
+    {
+        TNode j1 = Q->Delete();
+        state[j1] = 2;
+        dMin = d[j1];
+
+        if (colRow[j1]==NoNode)
+        {
+            endOfPath = j1;
+            break;
+        }
+
+        TNode i = colRow[j1];
+        TFloat u1 = rowCost[i]-v[j1]-dMin;
+
+        for (TArc k=X->First(i);k<X->Stop(i);k++)
+        {
+            TNode j = X->EndNode(k)-n1;
+
+            if (state[j]==2 || !X->Capacitated(k)) continue;
+
+            TFloat h = X->Length(k)-v[j]-u1;
+
+            if (state[j]==0)
+            {
+                state[j] = 1;
+                reached[nReached++] = j;
+                Q -> Insert(j,h);
+            }
+            else if (h<d[j]) Q -> ChangeKey(j,h);
+            else continue;
+
+            d[j] = h;
+            predRow[j] = i;
+            predCost[j] = X->Length(k);
+            predArc[j] = X->Arc(k);
+        }
+    }
+
+    // Update the potentials of the scanned columns and reset the labels
+
+    while (!Q->Empty()) Q->Delete();
+
+    for (TNode p=0;p<nReached;p++)
+    {
+        TNode j = reached[p];
+
+        if (state[j]==2 && endOfPath!=NoNode) v[j] += d[j]-dMin;
+
+        state[j] = 0;
+    }
+
+    return endOfPath;
+}
+
+
+void jonkerVolgenant::Augment(TNode f,TNode j) throw()
+{
+    TNode i = NoNode;
+
+    do
+    {
+        i = predRow[j];
+        TNode jPrev = rowCol[i];
+        Assign(i,j,predCost[j],predArc[j]);
+        j = jPrev;
+    }
+    while (i!=f);
+
+    nAugment++;
+}
+
+
+bool jonkerVolgenant::Solve() throw()
+{
+    #if defined(_PROGRESS_)
+
+    InitProgressCounter(n1);
+
+    #endif
+
+    if (!ColumnReduction())
+    {
+        LogEntry(LOG_RES,"...Graph has isolated nodes");
+        return false;
+    }
+
+    if (!AugmentingRowReduction())
+    {
+        LogEntry(LOG_RES,"...Graph has isolated nodes");
+        return false;
+    }
+
+    if (CT.logMeth>1)
+    {
+        sprintf(CT.logBuffer,
+            "...%lu reduction transfers, %lu row reduction steps, %lu rows remain unassigned",
+            nTransfer,nRowReduce,static_cast<unsigned long>(nFree));
+        LogEntry(LOG_METH2,CT.logBuffer);
+    }
+
+    if (CT.logMeth && !dense)
+    {
+        LogEntry(LOG_METH,"Sparse shortest path search...");
+    }
+
+    #if defined(_PROGRESS_)
+
+    SetProgressCounter(n1-nFree);
+
+    #endif
+
+    for (TNode p=0;p<nFree;p++)
+    {
+        TNode j = dense ? SearchDense(freeRow[p]) : SearchSparse(freeRow[p]);
+
+        if (j==NoNode)
+        {
+            LogEntry(LOG_RES,"...Graph does not have a perfect assignment");
+            return false;
+        }
+
+        Augment(freeRow[p],j);
+
+        if (!CT.SolverRunning()) return false;
+
+        #if defined(_PROGRESS_)
+
+        ProgressStep(1);
+
+        #endif
+    }
+
+    if (CT.logRes>1)
+    {
+        sprintf(CT.logBuffer,"...%lu shortest path augmentations",nAugment);
+        LogEntry(LOG_RES2,CT.logBuffer);
+    }
+
+    return true;
+}
+
+
+TFloat jonkerVolgenant::ExportAssignment() throw()
+{
+    G.InitSubgraph();
+    TFloat weight = 0;
+
+    for (TNode i=0;i<n1;i++)
+    {
+        G.SetSub(rowArc[i]&~TArc(1),1);
+        weight += rowCost[i];
+    }
+
+    return weight;
+}
+
+
+bool abstractBiGraph::MCA_JonkerVolgenant() throw()
+{
+    OpenFold(ModJonkerVolgenant,SHOW_TITLE);
+
+    jonkerVolgenant J(*this);
+    bool ret = J.Solve();
+
+    if (ret)
+    {
+        TFloat weight = J.ExportAssignment();
+
+        if (CT.logRes)
+        {
+            sprintf(CT.logBuffer,"...Perfect assignment of weight %g found",weight);
+            LogEntry(LOG_RES,CT.logBuffer);
+        }
+    }
+
+    CloseFold(ModJonkerVolgenant);
+
+    return ret;
+}
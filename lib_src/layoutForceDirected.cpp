@@ -52,6 +52,14 @@ void abstractMixedGraph::Layout_ForceDirected(TOptFDP method,int spacing)
             Layout_ConvertModel(LAYOUT_FREESTYLE_CURVES);
             break;
         }
+        case FDP_BARNES_HUT:
+        case FDP_MULTILEVEL:
+        {
+            Layout_ConvertModel(LAYOUT_STRAIGHT_2DIM);
+            Layout_MultilevelFDP(method,spacing);
+            Layout_ConvertModel(LAYOUT_FREESTYLE_CURVES);
+            break;
+        }
         case FDP_LAYERED:
         case FDP_LAYERED_RESTR:
         {
@@ -788,7 +796,7 @@ void abstractMixedGraph::Layout_GEMDrawing(TOptFDP options,int spacing)
 
     if (CT.logRes)
     {
-        sprintf(CT.logBuffer,"...%ld iterations in total",stepCount-1);
+        sprintf(CT.logBuffer,"...%ld iterations in total",(unsigned long)(stepCount-1));
         LogEntry(LOG_RES,CT.logBuffer);
         sprintf(CT.logBuffer,"...final temperature is %g",tGlobal/n);
         LogEntry(LOG_RES,CT.logBuffer);
@@ -974,7 +982,7 @@ void abstractMixedGraph::Layout_LayeredFDP(TOptFDP method,int spacing)
 
     if (CT.logRes)
     {
-        sprintf(CT.logBuffer,"...%ld iterations in total",stepCount-1);
+        sprintf(CT.logBuffer,"...%ld iterations in total",(unsigned long)(stepCount-1));
         LogEntry(LOG_RES,CT.logBuffer);
         sprintf(CT.logBuffer,"...final temperature is %g",tGlobal/n);
         LogEntry(LOG_RES,CT.logBuffer);
@@ -178,7 +178,7 @@ void abstractMixedGraph::Layout_Kandinsky(
 
 
     // Postoptimization of the node placement and arc orientations
-    if (CT.methLocal==LOCAL_OPTIMIZE) Layout_KandinskyCompaction(orientation);
+    if (CT.methLocal>=LOCAL_OPTIMIZE) Layout_KandinskyCompaction(orientation);
 
 
     // Determine the effective node size CT.nodeSep and assign final node positions
@@ -512,7 +512,7 @@ bool abstractMixedGraph::Layout_KandinskyCompaction(char* orientation)
                             LH = LogStart(LOG_METH2,"Nodes in line: ");
                         }
 
-                        sprintf(CT.logBuffer,"%ld ",v);
+                        sprintf(CT.logBuffer,"%ld ",(unsigned long)v);
                         LogAppend(LH,CT.logBuffer);
                     }
 
@@ -663,7 +663,7 @@ bool abstractMixedGraph::Layout_KandinskyCompaction(char* orientation)
 
     if (CT.logRes)
     {
-        sprintf(CT.logBuffer,"...Final coarse grid size is (%lu,%lu)",maxGridLine[0],maxGridLine[1]);
+        sprintf(CT.logBuffer,"...Final coarse grid size is (%lu,%lu)",(unsigned long)maxGridLine[0],(unsigned long)maxGridLine[1]);
         LogEntry(LOG_RES,CT.logBuffer);
     }
 
@@ -1280,7 +1280,7 @@ TArc abstractMixedGraph::Layout_KandinskyScaleNodes(const char* orientation)
     if (CT.logRes)
     {
         sprintf(CT.logBuffer,"...At most %ld ports are attached to each side",
-            nodeSize);
+            (unsigned long)nodeSize);
         LogEntry(LOG_RES,CT.logBuffer);
     }
 
@@ -1800,7 +1800,7 @@ void abstractMixedGraph::Layout_StaircaseDrawing(TArc aBasis,int spacing)
     delete[] representant;
 
     // Try to merge some lines
-    if (CT.methLocal==LOCAL_OPTIMIZE) Layout_KandinskyCompaction(orientation);
+    if (CT.methLocal>=LOCAL_OPTIMIZE) Layout_KandinskyCompaction(orientation);
 
     // Determine the effective node size and assign final node positions
     Layout_KandinskyScaleNodes(orientation);
@@ -1864,7 +1864,7 @@ void abstractMixedGraph::Layout_StaircaseTriconnected(TArc aBasis,int spacing)
     }
 
     // Step 2: Try to merge some lines
-    if (CT.methLocal==LOCAL_OPTIMIZE) Layout_KandinskyCompaction(orientation);
+    if (CT.methLocal>=LOCAL_OPTIMIZE) Layout_KandinskyCompaction(orientation);
 
     // Step 3: Determine the effective node size and assign final node positions
     Layout_KandinskyScaleNodes(orientation);
@@ -2134,7 +2134,7 @@ void abstractMixedGraph::Layout_KandinskyTree(TNode root,int spacing)
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"%ld ",u);
+            sprintf(CT.logBuffer,"%ld ",(unsigned long)u);
             LogAppend(LH,CT.logBuffer);
         }
 
@@ -2321,7 +2321,7 @@ void abstractMixedGraph::Layout_KandinskyTree(TNode root,int spacing)
         delete[] height;
 
         // Step 2: Try to merge some lines
-        if (CT.methLocal==LOCAL_OPTIMIZE) Layout_KandinskyCompaction(orientation);
+        if (CT.methLocal>=LOCAL_OPTIMIZE) Layout_KandinskyCompaction(orientation);
 
         // Step 3: Determine the effective node size and assign final node positions
         Layout_KandinskyScaleNodes(orientation);
@@ -66,7 +66,7 @@ TCap abstractMixedGraph::FeedbackArcSet() throw()
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"Target node %ld",vDelete);
+                sprintf(CT.logBuffer,"Target node %ld",(unsigned long)vDelete);
                 LogEntry(LOG_METH2,CT.logBuffer);
             }
 
@@ -80,7 +80,7 @@ TCap abstractMixedGraph::FeedbackArcSet() throw()
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"Source node %ld",vDelete);
+                sprintf(CT.logBuffer,"Source node %ld",(unsigned long)vDelete);
                 LogEntry(LOG_METH2,CT.logBuffer);
             }
 
@@ -107,7 +107,7 @@ TCap abstractMixedGraph::FeedbackArcSet() throw()
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"Indefinite node %ld",vDelete);
+                sprintf(CT.logBuffer,"Indefinite node %ld",(unsigned long)vDelete);
                 LogEntry(LOG_METH2,CT.logBuffer);
             }
 
@@ -209,7 +209,7 @@ void abstractMixedGraph::ImplicitOrientationFromDrawing() throw()
 
     if (CT.logRes)
     {
-        sprintf(CT.logBuffer,"...%lu arcs eliminated", cancelledArcs);
+        sprintf(CT.logBuffer,"...%lu arcs eliminated", (unsigned long)cancelledArcs);
         LogEntry(LOG_RES,CT.logBuffer);
     }
 
@@ -221,7 +221,7 @@ bool abstractMixedGraph::ImplicitSTOrientation(TNode s,TNode t) throw()
 {
     if (s<n && t<n)
     {
-        sprintf(CT.logBuffer,"Computing (%lu,%lu)-orientation...",s,t);
+        sprintf(CT.logBuffer,"Computing (%lu,%lu)-orientation...",(unsigned long)s,(unsigned long)t);
         LogEntry(LOG_METH,CT.logBuffer);
     }
     else
@@ -261,7 +261,7 @@ bool abstractMixedGraph::ImplicitSTOrientation(TNode s,TNode t) throw()
 
     if (CT.logRes)
     {
-        sprintf(CT.logBuffer,"...%lu arcs eliminated", cancelledArcs);
+        sprintf(CT.logBuffer,"...%lu arcs eliminated", (unsigned long)cancelledArcs);
         LogEntry(LOG_RES,CT.logBuffer);
     }
 
@@ -1053,7 +1053,7 @@ bool abstractMixedGraph::Layout_CrossingLocalSearch(
 
                 if (CT.logMeth>1)
                 {
-                    sprintf(CT.logBuffer,"Flipping to ... %lu %lu ...",v,u);
+                    sprintf(CT.logBuffer,"Flipping to ... %lu %lu ...",(unsigned long)v,(unsigned long)u);
                     LogEntry(LOG_METH2,CT.logBuffer);
                 }
 
@@ -1087,7 +1087,7 @@ bool abstractMixedGraph::Layout_CrossingLocalSearch(
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"%ld ",nodeInFloatingLayer[i]);
+            sprintf(CT.logBuffer,"%ld ",(unsigned long)nodeInFloatingLayer[i]);
             LogAppend(LH,CT.logBuffer);
         }
 
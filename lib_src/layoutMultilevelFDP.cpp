@@ -0,0 +1,817 @@
+
+//  This file forms part of the GOBLIN C++ Class Library.
+//
+//  Initially written by the GOBLIN developers, October 2026
+//
+//  Copying, compiling, distribution and modification
+//  of this source code is permitted only in accordance
+//  with the GOBLIN general licence information.
+
+/// \file layoutMultilevelFDP.cpp
+/// \brief Barnes-Hut approximation and multilevel scheme for the GEM method
+
+#include "mixedGraph.h"
+
+
+// Maximum number of nodes in a leaf of the Barnes-Hut quadtree
+static const TNode BH_LEAF_SIZE = 4;
+
+// Maximum depth of the quadtree. Limits the recursion for coincident nodes
+static const int BH_MAX_DEPTH = 32;
+
+// Cells are approximated if (cell width) < BH_THETA * (distance)
+static const TFloat BH_THETA = 0.9;
+
+// Stop coarsening when a level has at most this number of nodes
+static const TNode ML_MIN_NODES = 32;
+
+// Stop coarsening when a level does not shrink by this factor
+static const TFloat ML_MIN_REDUCTION = 0.8;
+
+// Maximum number of GEM rounds for the coarsest level and for refinements
+static const unsigned long ML_MAX_ROUNDS = 300;
+static const unsigned long ML_REFINE_ROUNDS = 30;
+
+
+// Uniformly distributed random numbers from [0,1)
+static TFloat UnitRand(goblinController& CT) throw()
+{
+    return TFloat(CT.Rand(1000000))/1000000;
+}
+
+
+/// \brief  Quadtree for the Barnes-Hut approximation of repelling forces
+
+class barnesHutTree
+{
+private:
+
+    struct TCell
+    {
+        TFloat  x0,y0,size;     // Lower left corner and width of the cell
+        TFloat  cx,cy,mass;     // Center of gravity and total mass
+        TNode   lo,hi;          // Range of the cell nodes in idx[]
+        TNode   child[4];       // Subcells or NoNode
+        bool    leaf;
+    };
+
+    TNode       n;
+    TNode*      idx;            // Node indices sorted by cells
+    TNode*      buffer;
+    TFloat*     sx;             // Node positions when the tree has been built
+    TFloat*     sy;
+    const TFloat* mass;
+
+    TCell*      cell;
+    TNode       nCells;
+    TNode       maxCells;
+
+    TNode*      stack;
+
+public:
+
+    barnesHutTree(TNode nn) throw();
+    ~barnesHutTree() throw();
+
+    void    Build(const TFloat* x,const TFloat* y,const TFloat* _mass) throw();
+    void    Repulsion(TNode v,const TFloat* x,const TFloat* y,TFloat delta2,
+                TFloat epsilon,TFloat& fx,TFloat& fy) const throw();
+
+private:
+
+    TNode   NewCell(TFloat x0,TFloat y0,TFloat size) throw();
+    void    BuildCell(TNode c,int depth) throw();
+
+};
+
+
+barnesHutTree::barnesHutTree(TNode nn) throw()
+{
+    n = nn;
+    idx = new TNode[n];
+    buffer = new TNode[n];
+    sx = new TFloat[n];
+    sy = new TFloat[n];
+    mass = NULL;
+
+    maxCells = 2*n/BH_LEAF_SIZE+16;
+    cell = new TCell[maxCells];
+    nCells = 0;
+
+    stack = new TNode[3*BH_MAX_DEPTH+4];
+}
+
+
+barnesHutTree::~barnesHutTree() throw()
+{
+    delete[] idx;
+    delete[] buffer;
+    delete[] sx;
+    delete[] sy;
+    delete[] cell;
+    delete[] stack;
+}
+
+
+TNode barnesHutTree::NewCell(TFloat x0,TFloat y0,TFloat size) throw()
+{
+    if (nCells==maxCells)
+    {
+        TCell* newCell = new TCell[2*maxCells];
+        for (TNode c=0;c<nCells;c++) newCell[c] = cell[c];
+        delete[] cell;
+        cell = newCell;
+        maxCells *= 2;
+    }
+
+    TCell& C = cell[nCells];
+    C.x0 = x0;
+    C.y0 = y0;
+    C.size = size;
+
+    return nCells++;
+}
+
+
+void barnesHutTree::Build(const TFloat* x,const TFloat* y,const TFloat* _mass)
+    throw()
+{
+    mass = _mass;
+
+    TFloat xMin = InfFloat;
+    TFloat yMin = InfFloat;
+    TFloat xMax = -InfFloat;
+    TFloat yMax = -InfFloat;
+
+    for (TNode v=0;v<n;v++)
+    {
+        idx[v] = v;
+        sx[v] = x[v];
+        sy[v] = y[v];
+
+        if (x[v]<xMin) xMin = x[v];
+        if (x[v]>xMax) xMax = x[v];
+        if (y[v]<yMin) yMin = y[v];
+        if (y[v]>yMax) yMax = y[v];
+    }
+
+    TFloat size = (xMax-xMin>yMax-yMin) ? xMax-xMin : yMax-yMin;
+
+    nCells = 0;
+    TNode root = NewCell(xMin,yMin,size*(1+1e-9)+1e-9);
+    cell[root].lo = 0;
+    cell[root].hi = n;
+
+    BuildCell(root,0);
+}
+
+
+void barnesHutTree::BuildCell(TNode c,int depth) throw()
+{
+    TNode lo = cell[c].lo;
+    TNode hi = cell[c].hi;
+    TFloat cMass = 0;
+    TFloat cx = 0;
+    TFloat cy = 0;
+
+    for (TNode k=lo;k<hi;k++)
+    {
+        TNode v = idx[k];
+        cMass += mass[v];
+        cx += mass[v]*sx[v];
+        cy += mass[v]*sy[v];
+    }
+
+    cell[c].mass = cMass;
+    cell[c].cx = cx/cMass;
+    cell[c].cy = cy/cMass;
+    cell[c].leaf = (hi-lo<=BH_LEAF_SIZE || depth>=BH_MAX_DEPTH);
+
+    for (int q=0;q<4;q++) cell[c].child[q] = NoNode;
+
+    if (cell[c].leaf) return;
+
+    // Partition the cell nodes into the four quadrants
+    TFloat half = cell[c].size/2;
+    TFloat xMid = cell[c].x0+half;
+    TFloat yMid = cell[c].y0+half;
+    TNode count[4] = {0,0,0,0};
+
+    for (TNode k=lo;k<hi;k++)
+    {
+        TNode v = idx[k];
+        count[int(sx[v]>=xMid)+2*int(sy[v]>=yMid)]++;
+    }
+
+    TNode start[4];
+    start[0] = lo;
+
+    for (int q=1;q<4;q++) start[q] = start[q-1]+count[q-1];
+
+    TNode pos[4] = {start[0],start[1],start[2],start[3]};
+
+    for (TNode k=lo;k<hi;k++)
+    {
+        TNode v = idx[k];
+        buffer[pos[int(sx[v]>=xMid)+2*int(sy[v]>=yMid)]++] = v;
+    }
+
+    for (TNode k=lo;k<hi;k++) idx[k] = buffer[k];
+
+    for (int q=0;q<4;q++)
+    {
+        if (count[q]==0) continue;
+
+        TNode d = NewCell(cell[c].x0+(q&1)*half,cell[c].y0+(q>>1)*half,half);
+        cell[d].lo = start[q];
+        cell[d].hi = start[q]+count[q];
+        cell[c].child[q] = d;
+
+        BuildCell(d,depth+1);
+    }
+}
+
+
+void barnesHutTree::Repulsion(TNode v,const TFloat* x,const TFloat* y,
+    TFloat delta2,TFloat epsilon,TFloat& fx,TFloat& fy) const throw()
+{
+    // Add the forces repelling v from all other nodes to (fx,fy). Cells which
+    // have contained v when the tree was built are never approximated
+
+    TNode depth = 0;
+    stack[depth++] = 0;
+
+    while (depth>0)
+    {
+        const TCell& C = cell[stack[--depth]];
+
+        if (C.leaf)
+        {
+            for (TNode k=C.lo;k<C.hi;k++)
+            {
+                TNode w = idx[k];
+
+                if (w==v) continue;
+
+                TFloat dx = x[v]-x[w];
+                TFloat dy = y[v]-y[w];
+                TFloat nsq = dx*dx+dy*dy;
+
+                if (nsq>epsilon)
+                {
+                    fx += mass[w]*dx*delta2/nsq;
+                    fy += mass[w]*dy*delta2/nsq;
+                }
+            }
+
+            continue;
+        }
+
+        TFloat dx = x[v]-C.cx;
+        TFloat dy = y[v]-C.cy;
+        TFloat nsq = dx*dx+dy*dy;
+
+        bool containsV =
+               sx[v]>=C.x0 && sx[v]<C.x0+C.size
+            && sy[v]>=C.y0 && sy[v]<C.y0+C.size;
+
+        if (!containsV && C.size*C.size<BH_THETA*BH_THETA*nsq)
+        {
+            fx += C.mass*dx*delta2/nsq;
+            fy += C.mass*dy*delta2/nsq;
+            continue;
+        }
+
+        for (int q=0;q<4;q++)
+        {
+            if (C.child[q]!=NoNode) stack[depth++] = C.child[q];
+        }
+    }
+}
+
+
+/// \brief  A level of the multilevel scheme
+///
+/// Graphs are given by adjacency lists in compressed form. The nodes of a
+/// coarse graph represent groups of adjacent nodes of the finer graph.
+
+class fdpLevel
+{
+public:
+
+    TNode       n;
+    TArc*       first;      // Adjacency list of v is adj[first[v]..first[v+1]-1]
+    TNode*      adj;
+    TFloat*     mass;       // Number of original nodes represented
+    TFloat*     x;
+    TFloat*     y;
+    TNode*      coarse;     // Node on the next coarser level or NULL
+    fdpLevel*   next;       // The next coarser level or NULL
+
+    fdpLevel(TNode nn,TArc mm) throw();
+    ~fdpLevel() throw();
+
+    fdpLevel*   Coarsen(goblinController& CT) throw();
+    void        Prolongate(TFloat radius,goblinController& CT) throw();
+
+};
+
+
+fdpLevel::fdpLevel(TNode nn,TArc mm) throw()
+{
+    n = nn;
+    first = new TArc[n+1];
+    adj = new TNode[mm];
+    mass = new TFloat[n];
+    x = new TFloat[n];
+    y = new TFloat[n];
+    coarse = NULL;
+    next = NULL;
+}
+
+
+fdpLevel::~fdpLevel() throw()
+{
+    delete[] first;
+    delete[] adj;
+    delete[] mass;
+    delete[] x;
+    delete[] y;
+
+    if (coarse) delete[] coarse;
+    if (next) delete next;
+}
+
+
+fdpLevel* fdpLevel::Coarsen(goblinController& CT) throw()
+{
+    // Contract a maximal matching, visiting the nodes in random order and
+    // preferring light neighbours. Unmatched nodes are merged into the
+    // lightest group of a neighbour, isolated nodes are kept
+
+    coarse = new TNode[n];
+    TNode* order = new TNode[n];
+    TFloat* cMass = new TFloat[n];
+
+    for (TNode v=0;v<n;v++)
+    {
+        coarse[v] = NoNode;
+        order[v] = v;
+    }
+
+    for (TNode i=n;i>1;i--)
+    {
+        TNode j = TNode(CT.Rand(i));
+        TNode swap = order[i-1];
+        order[i-1] = order[j];
+        order[j] = swap;
+    }
+
+    TNode nc = 0;
+
+    for (TNode i=0;i<n;i++)
+    {
+        TNode u = order[i];
+
+        if (coarse[u]!=NoNode) continue;
+
+        TNode best = NoNode;
+
+        for (TArc k=first[u];k<first[u+1];k++)
+        {
+            TNode w = adj[k];
+
+            if (coarse[w]==NoNode && w!=u && (best==NoNode || mass[w]<mass[best]))
+                best = w;
+        }
+
+        if (best==NoNode) continue;
+
+        coarse[u] = coarse[best] = nc;
+        cMass[nc++] = mass[u]+mass[best];
+    }
+
+    for (TNode i=0;i<n;i++)
+    {
+        TNode u = order[i];
+
+        if (coarse[u]!=NoNode) continue;
+
+        TNode best = NoNode;
+
+        for (TArc k=first[u];k<first[u+1];k++)
+        {
+            TNode c = coarse[adj[k]];
+
+            if (c!=NoNode && (best==NoNode || cMass[c]<cMass[best])) best = c;
+        }
+
+        if (best==NoNode)
+        {
+            best = nc;
+            cMass[nc++] = 0;
+        }
+
+        coarse[u] = best;
+        cMass[best] += mass[u];
+    }
+
+    if (nc>ML_MIN_REDUCTION*n)
+    {
+        delete[] coarse;
+        delete[] order;
+        delete[] cMass;
+        coarse = NULL;
+        return NULL;
+    }
+
+    // Sort the nodes by groups
+    TNode* groupFirst = new TNode[nc+1];
+
+    for (TNode c=0;c<=nc;c++) groupFirst[c] = 0;
+
+    for (TNode v=0;v<n;v++) groupFirst[coarse[v]+1]++;
+
+    for (TNode c=0;c<nc;c++) groupFirst[c+1] += groupFirst[c];
+
+    for (TNode v=0;v<n;v++) order[groupFirst[coarse[v]]++] = v;
+
+    for (TNode c=nc;c>0;c--) groupFirst[c] = groupFirst[c-1];
+
+    groupFirst[0] = 0;
+
+    // Merge the adjacency lists of every group. The fine adjacency lists
+    // bound the size of the coarse adjacency lists
+    fdpLevel* L = new fdpLevel(nc,first[n]);
+    TNode* mark = new TNode[nc];
+    TArc mc = 0;
+
+    for (TNode c=0;c<nc;c++) mark[c] = NoNode;
+
+    for (TNode c=0;c<nc;c++)
+    {
+        L->first[c] = mc;
+        L->mass[c] = cMass[c];
+        mark[c] = c;
+
+        for (TNode k=groupFirst[c];k<groupFirst[c+1];k++)
+        {
+            TNode u = order[k];
+
+            for (TArc l=first[u];l<first[u+1];l++)
+            {
+                TNode d = coarse[adj[l]];
+
+                if (mark[d]==c) continue;
+
+                mark[d] = c;
+                L->adj[mc++] = d;
+            }
+        }
+    }
+
+    L->first[nc] = mc;
+
+    delete[] mark;
+    delete[] groupFirst;
+    delete[] order;
+    delete[] cMass;
+
+    next = L;
+
+    return L;
+}
+
+
+void fdpLevel::Prolongate(TFloat radius,goblinController& CT) throw()
+{
+    // Place every node close to the node representing it on the next level
+
+    for (TNode v=0;v<n;v++)
+    {
+        x[v] = next->x[coarse[v]]+(2*UnitRand(CT)-1)*radius;
+        y[v] = next->y[coarse[v]]+(2*UnitRand(CT)-1)*radius;
+    }
+}
+
+
+/// \brief  Apply the GEM node movements to a level
+///
+/// The force model is the same as in Layout_GEMDrawing(), but repelling forces
+/// are weighted by the node masses and approximated by a quadtree which is
+/// rebuilt in every round. If G is specified, the level represents the graph
+/// itself, and the drawing is updated for tracing
+
+static unsigned long GEMRounds(fdpLevel& L,TFloat delta,TFloat tInit,
+    unsigned long maxRounds,goblinController& CT,abstractMixedGraph* G) throw()
+{
+    TNode n = L.n;
+
+    TFloat theta = 10.0/16.0;    // Gravity constant
+    TFloat epsilon = 0.001;      // Numeric separation constant;
+    TFloat delta2 = delta*delta;
+
+    TFloat tMin = delta/250;
+    TFloat tMax = delta/4;
+    TFloat tGlobal = tInit*n;
+    TFloat* tCurrent = new TFloat[n];
+    TFloat* skewGauge = new TFloat[n];
+    TFloat* px = new TFloat[n];
+    TFloat* py = new TFloat[n];
+
+    TFloat sx = 0;
+    TFloat sy = 0;
+
+    for (TNode v=0;v<n;v++)
+    {
+        tCurrent[v] = tInit;
+        skewGauge[v] = 0;
+        px[v] = py[v] = 0;
+        sx += L.x[v];
+        sy += L.y[v];
+    }
+
+    barnesHutTree T(n);
+    unsigned long round = 0;
+
+    while (CT.SolverRunning() && tGlobal>tMin*n && round<maxRounds)
+    {
+        T.Build(L.x,L.y,L.mass);
+
+        for (TNode v=0;v<n;v++)
+        {
+            // Compute impulse
+            TFloat pcx = theta*(sx/n-L.x[v]);
+            TFloat pcy = theta*(sy/n-L.y[v]);
+
+            // Forces repelling from other nodes
+            T.Repulsion(v,L.x,L.y,delta2,epsilon,pcx,pcy);
+
+            // Attracting forces
+            for (TArc k=L.first[v];k<L.first[v+1];k++)
+            {
+                TNode w = L.adj[k];
+
+                TFloat dx = L.x[v]-L.x[w];
+                TFloat dy = L.y[v]-L.y[w];
+                TFloat dist = sqrt(dx*dx+dy*dy);
+
+                if (dist>delta)
+                {
+                    pcx -= dx*(dist-delta)/delta*(dist-delta)/delta;
+                    pcy -= dy*(dist-delta)/delta*(dist-delta)/delta;
+                }
+            }
+
+            // Update position and temperature
+            TFloat npc = sqrt(pcx*pcx+pcy*pcy);
+
+            if (npc>epsilon)
+            {
+                pcx = pcx/npc;
+                pcy = pcy/npc;
+
+                L.x[v] += tCurrent[v]*pcx;
+                L.y[v] += tCurrent[v]*pcy;
+                sx += tCurrent[v]*pcx;
+                sy += tCurrent[v]*pcy;
+
+                npc = sqrt(px[v]*px[v]+py[v]*py[v]);
+
+                if (npc>0.001)
+                {
+                    tGlobal -= tCurrent[v];
+
+                    TFloat pox = px[v]/npc;
+                    TFloat poy = py[v]/npc;
+
+                    TFloat cosBeta = pcx*pox+pcy*poy;
+                    TFloat sinBeta = pcx*poy-pcy*pox;
+
+                    if (fabs(cosBeta)>0.8)
+                    {
+                        // Handle oscillations
+                        if (cosBeta>0)
+                        {
+                            tCurrent[v] *= 1.1;
+                        }
+                        else tCurrent[v] *= 0.8;
+                    }
+                    else if (fabs(skewGauge[v]-sinBeta)<0.1)
+                    {
+                        // Handle rotations
+                        tCurrent[v] *= 0.9;
+                    }
+                    else if (fabs(skewGauge[v]-sinBeta)>1.0)
+                    {
+                        tCurrent[v] *= 1.1;
+                    }
+
+                    if (tCurrent[v]>tMax) tCurrent[v] = tMax;
+
+                    skewGauge[v] = 0.7*skewGauge[v]+0.3*sinBeta;
+
+                    tGlobal += tCurrent[v];
+                }
+            }
+
+            px[v] = pcx;
+            py[v] = pcy;
+        }
+
+        round++;
+
+        if (G)
+        {
+            sprintf(CT.logBuffer,"Temperature now at %g",tGlobal/n);
+            G -> LogEntry(LOG_METH2,CT.logBuffer);
+
+            if (CT.traceLevel>2)
+            {
+                for (TNode v=0;v<n;v++)
+                {
+                    G -> SetC(v,0,L.x[v]);
+                    G -> SetC(v,1,L.y[v]);
+                }
+            }
+
+            G -> Trace();
+        }
+    }
+
+    delete[] tCurrent;
+    delete[] skewGauge;
+    delete[] px;
+    delete[] py;
+
+    return round;
+}
+
+
+void abstractMixedGraph::Layout_MultilevelFDP(TOptFDP method,int spacing)
+    throw(ERRejected)
+{
+    #if defined(_FAILSAVE_)
+
+    if (MetricType()!=METRIC_DISABLED && IsDense())
+        Error(ERR_REJECTED,"Layout_MultilevelFDP","Coordinates are fixed");
+
+    if (method!=FDP_BARNES_HUT && method!=FDP_MULTILEVEL)
+        UnknownOption("Layout_MultilevelFDP",method);
+
+    #endif
+
+    if (spacing>0) CT.nodeSep = spacing;
+
+    TFloat delta = CT.nodeSep;
+
+    // Set up the finest level from the original graph, omitting loops
+    fdpLevel* L0 = new fdpLevel(n,2*m);
+    TArc* pos = new TArc[n+1];
+
+    for (TNode v=0;v<=n;v++) pos[v] = 0;
+
+    for (TArc a=0;a<m;a++)
+    {
+        TNode u = StartNode(2*a);
+        TNode w = EndNode(2*a);
+
+        if (u==w) continue;
+
+        pos[u+1]++;
+        pos[w+1]++;
+    }
+
+    for (TNode v=0;v<n;v++) pos[v+1] += pos[v];
+
+    for (TNode v=0;v<=n;v++) L0->first[v] = pos[v];
+
+    for (TArc a=0;a<m;a++)
+    {
+        TNode u = StartNode(2*a);
+        TNode w = EndNode(2*a);
+
+        if (u==w) continue;
+
+        L0->adj[pos[u]++] = w;
+        L0->adj[pos[w]++] = u;
+    }
+
+    delete[] pos;
+
+    for (TNode v=0;v<n;v++)
+    {
+        L0->mass[v] = 1;
+        L0->x[v] = C(v,0);
+        L0->y[v] = C(v,1);
+    }
+
+    if (method==FDP_BARNES_HUT)
+    {
+        OpenFold(ModBarnesHut,SHOW_TITLE);
+
+        unsigned long rounds =
+            GEMRounds(*L0,delta,delta/8,ML_MAX_ROUNDS,CT,this);
+
+        CloseFold(ModBarnesHut);
+
+        if (CT.logRes)
+        {
+            sprintf(CT.logBuffer,"...%lu rounds in total",rounds);
+            LogEntry(LOG_RES,CT.logBuffer);
+        }
+    }
+    else
+    {
+        OpenFold(ModMultilevelFDP,SHOW_TITLE);
+
+        // Coarsen the graph recursively
+        unsigned nLevels = 1;
+        fdpLevel* L = L0;
+
+        while (L->n>ML_MIN_NODES && CT.SolverRunning())
+        {
+            fdpLevel* coarser = L->Coarsen(CT);
+
+            if (!coarser) break;
+
+            L = coarser;
+            nLevels++;
+        }
+
+        sprintf(CT.logBuffer,"...%u levels, %lu nodes on the coarsest level",
+            nLevels,static_cast<unsigned long>(L->n));
+        LogEntry(LOG_METH,CT.logBuffer);
+
+        #if defined(_PROGRESS_)
+
+        InitProgressCounter(nLevels);
+
+        #endif
+
+        // The optimal edge lengths decrease by a constant factor per level
+        fdpLevel** level = new fdpLevel*[nLevels];
+        L = L0;
+
+        for (unsigned l=0;l<nLevels;l++)
+        {
+            level[l] = L;
+            L = L->next;
+        }
+
+        TFloat* levelDelta = new TFloat[nLevels];
+        levelDelta[0] = delta;
+
+        for (unsigned l=1;l<nLevels;l++) levelDelta[l] = levelDelta[l-1]*sqrt(7.0/4.0);
+
+        // Draw the coarsest graph from scratch
+        L = level[nLevels-1];
+        TFloat range = levelDelta[nLevels-1]*sqrt(double(L->n));
+
+        for (TNode v=0;v<L->n;v++)
+        {
+            L->x[v] = UnitRand(CT)*range;
+            L->y[v] = UnitRand(CT)*range;
+        }
+
+        unsigned long rounds = 0;
+
+        for (unsigned l=nLevels;l-->0;)
+        {
+            L = level[l];
+
+            if (l<nLevels-1) L->Prolongate(levelDelta[l]/4,CT);
+
+            TFloat tInit = (l==nLevels-1) ? levelDelta[l]/8 : levelDelta[l]/16;
+            unsigned long maxRounds = (l==nLevels-1) ? ML_MAX_ROUNDS : ML_REFINE_ROUNDS;
+
+            rounds += GEMRounds(*L,levelDelta[l],tInit,maxRounds,CT,
+                                (l==0) ? this : NULL);
+
+            #if defined(_PROGRESS_)
+
+            ProgressStep(1);
+
+            #endif
+        }
+
+        delete[] levelDelta;
+        delete[] level;
+
+        CloseFold(ModMultilevelFDP);
+
+        if (CT.logRes)
+        {
+            sprintf(CT.logBuffer,"...%lu rounds in total",rounds);
+            LogEntry(LOG_RES,CT.logBuffer);
+        }
+    }
+
+    for (TNode v=0;v<n;v++)
+    {
+        SetC(v,0,L0->x[v]);
+        SetC(v,1,L0->y[v]);
+    }
+
+    delete L0;
+}
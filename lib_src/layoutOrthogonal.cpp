@@ -37,7 +37,7 @@ void abstractMixedGraph::Layout_OrthogonalDeg4(TMethOrthogonal method,
 
         if (deg>4)
         {
-            sprintf(CT.logBuffer,"Node %ld has degree %ld",u,deg);
+            sprintf(CT.logBuffer,"Node %ld has degree %ld",(unsigned long)u,(unsigned long)deg);
             Error(ERR_REJECTED,"Layout_OrthogonalDeg4",CT.logBuffer);
         }
     }
@@ -245,7 +245,7 @@ void abstractMixedGraph::Layout_OrthogonalDeg4(TMethOrthogonal method,
 
     if (CT.logMeth>1)
     {
-        sprintf(CT.logBuffer,"Embedded nodes: %ld %ld",v,w);
+        sprintf(CT.logBuffer,"Embedded nodes: %ld %ld",(unsigned long)v,(unsigned long)w);
         LH = LogStart(LOG_METH2,CT.logBuffer);
     }
 
@@ -550,7 +550,7 @@ void abstractMixedGraph::Layout_OrthogonalDeg4(TMethOrthogonal method,
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer," %ld",u);
+            sprintf(CT.logBuffer," %ld",(unsigned long)u);
             LogAppend(LH,CT.logBuffer);
         }
 
@@ -578,7 +578,7 @@ void abstractMixedGraph::Layout_OrthogonalDeg4(TMethOrthogonal method,
         X -> SetC(i,1,Geo.RowNumber(i)*CT.nodeSep);
     }
 
-    if (   CT.methLocal==LOCAL_OPTIMIZE
+    if (   CT.methLocal>=LOCAL_OPTIMIZE
         && method==ORTHO_4PLANAR)
     {
         Layout_OrthoSmallLineSweep();
@@ -687,7 +687,7 @@ bool abstractMixedGraph::Layout_OrthoSmallNodeCompaction()
 
                 #if defined(_LOGGING_)
 
-                sprintf(CT.logBuffer,"...Stranded node %lu found",v);
+                sprintf(CT.logBuffer,"...Stranded node %lu found",(unsigned long)v);
                 LogEntry(LOG_METH2,CT.logBuffer);
 
                 #endif
@@ -717,7 +717,7 @@ bool abstractMixedGraph::Layout_OrthoSmallNodeCompaction()
 
                 #if defined(_LOGGING_)
 
-                sprintf(CT.logBuffer,"...Node %lu moved to an adjacent bend node",v);
+                sprintf(CT.logBuffer,"...Node %lu moved to an adjacent bend node",(unsigned long)v);
                 LogEntry(LOG_METH2,CT.logBuffer);
 
                 #endif
@@ -811,7 +811,7 @@ bool abstractMixedGraph::Layout_OrthoSmallNodeCompaction()
 
                         #if defined(_LOGGING_)
 
-                        sprintf(CT.logBuffer,"...Node %lu shifted by %lu units",v,(unsigned long)(stepLength));
+                        sprintf(CT.logBuffer,"...Node %lu shifted by %lu units",(unsigned long)v,(unsigned long)stepLength);
                         LogEntry(LOG_METH2,CT.logBuffer);
 
                         #endif
@@ -915,7 +915,7 @@ bool abstractMixedGraph::Layout_OrthoSmallNodeCompaction()
 
                         #if defined(_LOGGING_)
 
-                        sprintf(CT.logBuffer,"...Node %lu shifted by %lu units",v,(unsigned long)(stepLength));
+                        sprintf(CT.logBuffer,"...Node %lu shifted by %lu units",(unsigned long)v,(unsigned long)stepLength);
                         LogEntry(LOG_METH2,CT.logBuffer);
 
                         #endif
@@ -1051,7 +1051,7 @@ bool abstractMixedGraph::Layout_OrthoSmallNodeCompaction()
 
                     #if defined(_LOGGING_)
 
-                    sprintf(CT.logBuffer,"...Node %lu shifted by %lu units",v,(unsigned long)(stepLength));
+                    sprintf(CT.logBuffer,"...Node %lu shifted by %lu units",(unsigned long)v,(unsigned long)stepLength);
                     LogEntry(LOG_METH2,CT.logBuffer);
 
                     #endif
@@ -1257,7 +1257,7 @@ bool abstractMixedGraph::Layout_OrthoSmallLineSweep()
                             LH = LogStart(LOG_METH2,"Nodes in line: ");
                         }
 
-                        sprintf(CT.logBuffer,"%ld ",v);
+                        sprintf(CT.logBuffer,"%ld ",(unsigned long)v);
                         LogAppend(LH,CT.logBuffer);
                     }
 
@@ -1392,7 +1392,7 @@ bool abstractMixedGraph::Layout_OrthoSmallLineSweep()
 
     if (CT.logRes)
     {
-        sprintf(CT.logBuffer,"...Final grid size is (%lu,%lu)",maxGridLine[0],maxGridLine[1]);
+        sprintf(CT.logBuffer,"...Final grid size is (%lu,%lu)",(unsigned long)maxGridLine[0],(unsigned long)maxGridLine[1]);
         LogEntry(LOG_RES,CT.logBuffer);
     }
 
@@ -2078,7 +2078,7 @@ void abstractMixedGraph::Layout_VisibilityRepresentation(TMethOrthogonal option,
     {
         Layout_ConvertModel(LAYOUT_ORTHO_SMALL);
 
-        if (CT.methLocal==LOCAL_OPTIMIZE) Layout_OrthoSmallLineSweep();
+        if (CT.methLocal>=LOCAL_OPTIMIZE) Layout_OrthoSmallLineSweep();
     }
 }
 
@@ -2126,9 +2126,9 @@ void abstractMixedGraph::Layout_Visibility2Connected(int bendSep,bool alignPorts
 
     if (CT.logMeth>1)
     {
-        sprintf(CT.logBuffer,"Source node %ld on the bottom line",s);
+        sprintf(CT.logBuffer,"Source node %ld on the bottom line",(unsigned long)s);
         LogEntry(LOG_METH2,CT.logBuffer);
-        sprintf(CT.logBuffer,"Target node %ld on the top line",t);
+        sprintf(CT.logBuffer,"Target node %ld on the top line",(unsigned long)t);
         LogEntry(LOG_METH2,CT.logBuffer);
     }
 
@@ -2197,7 +2197,7 @@ void abstractMixedGraph::Layout_Visibility2Connected(int bendSep,bool alignPorts
         if (CT.logMeth>1)
         {
             sprintf(CT.logBuffer,"Node %ld from face %ld to %ld (width %ld)",
-                v,leftMost,rightMost,TNode(GY.Dist(rightMost)-1-GY.Dist(leftMost)));
+                (unsigned long)v,(unsigned long)leftMost,(unsigned long)rightMost,(unsigned long)TNode(GY.Dist(rightMost)-1-GY.Dist(leftMost)));
             LogEntry(LOG_METH2,CT.logBuffer);
         }
     }
@@ -2241,7 +2241,7 @@ void abstractMixedGraph::Layout_Visibility2Connected(int bendSep,bool alignPorts
     if (CT.logRes)
     {
         sprintf(CT.logBuffer,"...Layout size is %ld x %ld",
-            TNode(GY.Dist(Face(ExteriorArc()))-1),TNode(GX.Dist(t)));
+            (unsigned long)TNode(GY.Dist(Face(ExteriorArc()))-1),(unsigned long)TNode(GX.Dist(t)));
         LogEntry(LOG_RES,CT.logBuffer);
     }
 
@@ -2385,7 +2385,7 @@ bool abstractMixedGraph::Layout_HorizontalVerticalTree(TNode root,int spacing)
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"%ld ",u);
+            sprintf(CT.logBuffer,"%ld ",(unsigned long)u);
             LogAppend(LH,CT.logBuffer);
         }
 
@@ -2553,7 +2553,7 @@ bool abstractMixedGraph::Layout_HorizontalVerticalTree(TNode root,int spacing)
         if (CT.logRes)
         {
             sprintf(CT.logBuffer,"...Layout size is %ld x %ld",
-                width[root],height[root]);
+                (unsigned long)width[root],(unsigned long)height[root]);
             LogEntry(LOG_RES,CT.logBuffer);
         }
 
@@ -2565,7 +2565,7 @@ bool abstractMixedGraph::Layout_HorizontalVerticalTree(TNode root,int spacing)
             LogEntry(LOG_RES,"...Graph is not a binary tree");
         }
 
-        if (CT.methLocal==LOCAL_OPTIMIZE) Layout_OrthoSmallLineSweep();
+        if (CT.methLocal>=LOCAL_OPTIMIZE) Layout_OrthoSmallLineSweep();
     }
     else
     {
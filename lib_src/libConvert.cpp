@@ -101,7 +101,7 @@ TNode abstractMixedGraph::ExtractTrees() throw()
 
     if (CT.logRes>1)
     {
-        sprintf(CT.logBuffer,"...Forest has %ld components",count);
+        sprintf(CT.logBuffer,"...Forest has %ld components",(unsigned long)count);
         LogEntry(LOG_RES2,CT.logBuffer);
     }
 
@@ -238,7 +238,7 @@ TNode abstractMixedGraph::ExtractPath(TNode u,TNode v) throw()
 
     if (CT.logMeth>1)
     {
-        sprintf(CT.logBuffer,"Extracting (%ld,%ld)-path from subgraph...",u,v);
+        sprintf(CT.logBuffer,"Extracting (%ld,%ld)-path from subgraph...",(unsigned long)u,(unsigned long)v);
         LogEntry(LOG_METH2,CT.logBuffer);
     }
 
@@ -301,7 +301,7 @@ TNode abstractMixedGraph::ExtractPath(TNode u,TNode v) throw()
 
     if (CT.logRes>1)
     {
-        sprintf(CT.logBuffer,"...Path of length %ld found",count);
+        sprintf(CT.logBuffer,"...Path of length %ld found",(unsigned long)count);
         LogEntry(LOG_RES2,CT.logBuffer);
     }
 
@@ -352,7 +352,7 @@ TNode abstractMixedGraph::Extract1Matching() throw()
 
     if (CT.logRes>1)
     {
-        sprintf(CT.logBuffer,"...1-matching of cardinality %ld found",cardinality);
+        sprintf(CT.logBuffer,"...1-matching of cardinality %ld found",(unsigned long)cardinality);
         LogEntry(LOG_RES2,CT.logBuffer);
     }
 
@@ -403,7 +403,7 @@ TNode abstractMixedGraph::ExtractEdgeCover() throw()
 
     if (CT.logRes>1)
     {
-        sprintf(CT.logBuffer,"...Edge cover of cardinality %ld found",cardinality);
+        sprintf(CT.logBuffer,"...Edge cover of cardinality %ld found",(unsigned long)cardinality);
         LogEntry(LOG_RES2,CT.logBuffer);
     }
 
@@ -449,7 +449,7 @@ TNode abstractMixedGraph::ExtractCycles() throw()
 
     if (CT.logRes>1)
     {
-        sprintf(CT.logBuffer,"...Subgraph splits into %ld cycles",count);
+        sprintf(CT.logBuffer,"...Subgraph splits into %ld cycles",(unsigned long)count);
         LogEntry(LOG_RES2,CT.logBuffer);
     }
 
@@ -541,7 +541,7 @@ void abstractMixedGraph::ExtractColours() throw(ERRejected)
 
     if (CT.logRes>1)
     {
-        sprintf(CT.logBuffer,"...%ld colour classes found",i);
+        sprintf(CT.logBuffer,"...%ld colour classes found",(unsigned long)i);
         LogEntry(LOG_RES2,CT.logBuffer);
     }
 
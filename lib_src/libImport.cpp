@@ -13,6 +13,13 @@
 #include <stdio.h>
 #include "sparseDigraph.h"
 #include "sparseGraph.h"
+#include "sparseBigraph.h"
+#include "mixedGraph.h"
+#include "balancedDigraph.h"
+#include "denseGraph.h"
+#include "denseDigraph.h"
+#include "denseBigraph.h"
+#include "fileBinary.h"
 
 goblinRootObject* goblinController::ImportFromFile(const char* filename, TFileFormat format)
     throw(ERParse)
@@ -27,6 +34,11 @@ goblinRootObject* goblinController::ImportFromFile(const char* filename, TFileFo
         {
             return Import_DimacsEdge(filename);
         }
+        case FMT_GOBLIN:
+        case FMT_GOBLIN_BINARY:
+        {
+            return Import_Goblin(filename,format);
+        }
         default:
         {
         }
@@ -189,3 +201,43 @@ goblinRootObject* goblinController::Import_DimacsEdge(const char* filename)
 
     return G;
 }
+
+goblinRootObject* goblinController::Import_Goblin(const char* filename,TFileFormat format)
+    throw(ERParse)
+{
+    // The class label is determined in advance, so that the matching file
+    // constructor can be called. Binary files are recognized by their header
+    char objectClass[17];
+
+    if (goblinBinaryImport::IsBinaryFile(filename))
+    {
+        goblinBinaryImport F(filename,*this);
+        strncpy(objectClass,F.Header().objectClass,16);
+    }
+    else if (format==FMT_GOBLIN_BINARY)
+    {
+        Error(ERR_PARSE,NoHandle,"Import_Goblin","Not a binary GOBLIN file");
+    }
+    else
+    {
+        goblinImport F(filename,*this);
+        strncpy(objectClass,F.Scan(),16);
+        F.DontComplain();
+    }
+
+    objectClass[16] = 0;
+
+    if (strcmp(objectClass,"mixed")==0)         return new mixedGraph(filename,*this);
+    if (strcmp(objectClass,"graph")==0)         return new graph(filename,*this);
+    if (strcmp(objectClass,"digraph")==0)       return new diGraph(filename,*this);
+    if (strcmp(objectClass,"bigraph")==0)       return new biGraph(filename,*this);
+    if (strcmp(objectClass,"balanced_fnw")==0)  return new balancedFNW(filename,*this);
+    if (strcmp(objectClass,"dense_graph")==0)   return new denseGraph(filename,*this);
+    if (strcmp(objectClass,"dense_digraph")==0) return new denseDiGraph(filename,*this);
+    if (strcmp(objectClass,"dense_bigraph")==0) return new denseBiGraph(filename,*this);
+
+    sprintf(logBuffer,"Not a graph object: %s",filename);
+    Error(ERR_PARSE,NoHandle,"Import_Goblin",logBuffer);
+
+    return NULL;
+}
@@ -446,19 +446,49 @@ void sparseRepresentation::Layout_ArcAlignment(TFloat spacing,bool drawLoops) th
 
     for (TArc a=0;a<mAct;a++) ReleaseBendNodes(2*a);
 
+    // The arcs incident with u are grouped by their end nodes in a single
+    // incidence scan. Only groups of parallel arcs and loops are aligned
+    TArc* groupFirst = new TArc[nAct];
+    TArc* groupLast = new TArc[nAct];
+    TArc* groupNext = new TArc[2*mAct];
+    TNode* groupEnd = new TNode[nAct];
+
+    for (TNode v=0;v<nAct;v++) groupFirst[v] = NoArc;
+
     for (TNode u=0;u<nAct;u++)
     {
-        for (TNode v=u;v<nAct;v++)
+        TNode nGroups = 0;
+
+        while (I.Active(u))
         {
-            S.Init();
+            TArc a = I.Read(u);
+            TNode v = EndNode(a);
 
-            while (I.Active(u))
+            if (v<u || (v==u && !(a%2))) continue;
+
+            groupNext[a] = NoArc;
+
+            if (groupFirst[v]==NoArc)
             {
-                TArc a = I.Read(u);
-                if (EndNode(a)==v && (u!=v || (a%2))) S.Insert(a);
+                groupFirst[v] = a;
+                groupEnd[nGroups++] = v;
             }
+            else groupNext[groupLast[v]] = a;
+
+            groupLast[v] = a;
+        }
 
-            I.Reset(u);
+        I.Reset(u);
+
+        for (TNode k=0;k<nGroups;k++)
+        {
+            TNode v = groupEnd[k];
+
+            S.Init();
+
+            for (TArc a=groupFirst[v];a!=NoArc;a=groupNext[a]) S.Insert(a);
+
+            groupFirst[v] = NoArc;
 
             if (v!=u)
             {
@@ -509,6 +539,11 @@ void sparseRepresentation::Layout_ArcAlignment(TFloat spacing,bool drawLoops) th
         }
     }
 
+    delete[] groupFirst;
+    delete[] groupLast;
+    delete[] groupNext;
+    delete[] groupEnd;
+
     G.Close(H);
 }
 
@@ -822,7 +857,7 @@ bool abstractMixedGraph::Layout_Outerplanar(int spacing) throw(ERRejected)
             k++;
         }
 
-        if (CT.methLocal==LOCAL_OPTIMIZE) Layout_ForceDirected(FDP_RESTRICTED);
+        if (CT.methLocal>=LOCAL_OPTIMIZE) Layout_ForceDirected(FDP_RESTRICTED);
 
         Layout_ConvertModel(LAYOUT_FREESTYLE_CURVES);
     }
@@ -236,7 +236,7 @@ TNode abstractMixedGraph::ExtractEmbedding(TOptExtractEmbedding opt,void* arg)
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"Component %ld:",l);
+                sprintf(CT.logBuffer,"Component %ld:",(unsigned long)l);
                 LogEntry(LOG_METH2,CT.logBuffer);
             }
 
@@ -287,7 +287,7 @@ TNode abstractMixedGraph::ExtractEmbedding(TOptExtractEmbedding opt,void* arg)
                 if (CT.logMeth>1)
                 {
                     sprintf(CT.logBuffer,"Face %ld = (%ld [%ld] %ld",
-                        k,w,a2,v);
+                        (unsigned long)k,(unsigned long)w,(unsigned long)a2,(unsigned long)v);
                     LH = LogStart(LOG_METH2,CT.logBuffer);
                 }
 
@@ -313,7 +313,7 @@ TNode abstractMixedGraph::ExtractEmbedding(TOptExtractEmbedding opt,void* arg)
 
                     if (CT.logMeth>1)
                     {
-                        sprintf(CT.logBuffer," [%ld] %ld",a2,v);
+                        sprintf(CT.logBuffer," [%ld] %ld",(unsigned long)a2,(unsigned long)v);
                         LogAppend(LH,CT.logBuffer);
                     }
 
@@ -360,7 +360,7 @@ TNode abstractMixedGraph::ExtractEmbedding(TOptExtractEmbedding opt,void* arg)
                         {
                             sprintf(CT.logBuffer,
                                 "...Exterior face %ld has %ld nodes",
-                                face[maxRegion],maxLength);
+                                (unsigned long)face[maxRegion],(unsigned long)maxLength);
                             LogEntry(LOG_RES,CT.logBuffer);
                         }
 
@@ -407,7 +407,7 @@ TNode abstractMixedGraph::ExtractEmbedding(TOptExtractEmbedding opt,void* arg)
 
         sprintf(CT.logBuffer,
             "...Graph has %ld faces and %ld connected components",
-            k-l+1,l);
+            (unsigned long)(k-l+1),(unsigned long)l);
         LogEntry(LOG_RES,CT.logBuffer);
     }
     else
@@ -426,10 +426,10 @@ TNode abstractMixedGraph::ExtractEmbedding(TOptExtractEmbedding opt,void* arg)
         }
         while (a!=exteriorArc);
 
-        sprintf(CT.logBuffer,"...Graph has %ld faces",ND());
+        sprintf(CT.logBuffer,"...Graph has %ld faces",(unsigned long)ND());
         LogEntry(LOG_RES,CT.logBuffer);
         sprintf(CT.logBuffer,"...Exterior face %ld has %ld nodes",
-            face[exteriorArc],l);
+            (unsigned long)face[exteriorArc],(unsigned long)l);
         LogEntry(LOG_RES,CT.logBuffer);
     }
 
@@ -602,7 +602,7 @@ TNode abstractMixedGraph::GrowExteriorFace(TArc exteriorArc) throw(ERRejected)
 
     if (CT.logMeth>1)
     {
-        sprintf(CT.logBuffer,"(%ld",EndNode(a));
+        sprintf(CT.logBuffer,"(%ld",(unsigned long)EndNode(a));
         LH = LogStart(LOG_METH2,CT.logBuffer);
     }
 
@@ -620,7 +620,7 @@ TNode abstractMixedGraph::GrowExteriorFace(TArc exteriorArc) throw(ERRejected)
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer," [%ld] %ld",aNext,y);
+            sprintf(CT.logBuffer," [%ld] %ld",(unsigned long)aNext,(unsigned long)y);
             LogAppend(LH,CT.logBuffer);
         }
 
@@ -642,7 +642,7 @@ TNode abstractMixedGraph::GrowExteriorFace(TArc exteriorArc) throw(ERRejected)
 
                 if (CT.logMeth>1)
                 {
-                    sprintf(CT.logBuffer,"...%ld",x);
+                    sprintf(CT.logBuffer,"...%ld",(unsigned long)x);
                     LH = LogStart(LOG_METH2,CT.logBuffer);
                 }
 
@@ -738,7 +738,7 @@ TNode abstractMixedGraph::GrowExteriorFace(TArc exteriorArc) throw(ERRejected)
 
                 if (CT.logMeth>1 && CT.logRes)
                 {
-                    sprintf(CT.logBuffer,"...%ld",y);
+                    sprintf(CT.logBuffer,"...%ld",(unsigned long)y);
                     LH = LogStart(LOG_METH2,CT.logBuffer);
                 }
 
@@ -865,7 +865,7 @@ TNode abstractMixedGraph::GrowExteriorFace(TArc exteriorArc) throw(ERRejected)
 
                     if (CT.logMeth>1 && CT.logRes)
                     {
-                        sprintf(CT.logBuffer,"...%ld",y);
+                        sprintf(CT.logBuffer,"...%ld",(unsigned long)y);
                         LH = LogStart(LOG_METH2,CT.logBuffer);
                     }
 
@@ -994,7 +994,7 @@ TNode abstractMixedGraph::GrowExteriorFace(TArc exteriorArc) throw(ERRejected)
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"...%ld",x);
+            sprintf(CT.logBuffer,"...%ld",(unsigned long)x);
             LH = LogStart(LOG_METH2,CT.logBuffer);
         }
 
@@ -1015,7 +1015,7 @@ TNode abstractMixedGraph::GrowExteriorFace(TArc exteriorArc) throw(ERRejected)
 
     if (!outerplanar)
     {
-        sprintf(CT.logBuffer,"...Exterior region has %ld nodes",Q.Cardinality());
+        sprintf(CT.logBuffer,"...Exterior region has %ld nodes",(unsigned long)Q.Cardinality());
         LogEntry(LOG_RES,CT.logBuffer);
     }
     else
@@ -1061,7 +1061,7 @@ bool abstractMixedGraph::MoveInteriorBlocks(TNode x,bool* _visited)
 
     if (!ExteriorNode(x))
     {
-        sprintf(CT.logBuffer,"Not an exterior node: %ld",x);
+        sprintf(CT.logBuffer,"Not an exterior node: %ld",(unsigned long)x);
         Error(ERR_REJECTED,"MoveInteriorBlocks",CT.logBuffer);
     }
 
@@ -1129,7 +1129,7 @@ bool abstractMixedGraph::MoveInteriorBlocks(TNode x,bool* _visited)
 
     if (CT.logMeth>1 && moved>0 && !_visited)
     {
-        sprintf(CT.logBuffer,"...%ld blocks have been moved",moved);
+        sprintf(CT.logBuffer,"...%ld blocks have been moved",(unsigned long)moved);
         LogEntry(LOG_RES,CT.logBuffer);
     }
 
@@ -1183,7 +1183,7 @@ void abstractMixedGraph::PlanarBiconnectivityAugmentation() throw (ERRejected)
         if (CT.logMeth>1)
         {
             CloseFold();
-            sprintf(CT.logBuffer,"Tracing face of arc %ld...",a);
+            sprintf(CT.logBuffer,"Tracing face of arc %ld...",(unsigned long)a);
             LogEntry(LOG_METH2,CT.logBuffer);
             OpenFold();
         }
@@ -1230,7 +1230,7 @@ void abstractMixedGraph::PlanarBiconnectivityAugmentation() throw (ERRejected)
                     if (CT.logMeth>1)
                     {
                         sprintf(CT.logBuffer,"Adding arc (%ld,%ld)",
-                            threadNode,v);
+                            (unsigned long)threadNode,(unsigned long)v);
                         LogEntry(LOG_METH2,CT.logBuffer);
                     }
 
@@ -1248,7 +1248,7 @@ void abstractMixedGraph::PlanarBiconnectivityAugmentation() throw (ERRejected)
                 if (CT.logMeth>1)
                 {
                     sprintf(CT.logBuffer,"Adding arc (%ld,%ld)",
-                        threadNode,v);
+                        (unsigned long)threadNode,(unsigned long)v);
                     LogEntry(LOG_METH2,CT.logBuffer);
                 }
 
@@ -1284,7 +1284,7 @@ void abstractMixedGraph::PlanarBiconnectivityAugmentation() throw (ERRejected)
             if (CT.logMeth>1)
             {
                 sprintf(CT.logBuffer,"Adding arc (%ld,%ld)",
-                    threadNode,v);
+                    (unsigned long)threadNode,(unsigned long)v);
                 LogEntry(LOG_METH2,CT.logBuffer);
             }
 
@@ -1338,7 +1338,7 @@ void abstractMixedGraph::Triangulation() throw (ERRejected)
         if (CT.logMeth>1)
         {
             CloseFold();
-            sprintf(CT.logBuffer,"Tracing face of arc %ld...",a);
+            sprintf(CT.logBuffer,"Tracing face of arc %ld...",(unsigned long)a);
             LogEntry(LOG_METH2,CT.logBuffer);
             OpenFold();
         }
@@ -1390,7 +1390,7 @@ void abstractMixedGraph::Triangulation() throw (ERRejected)
 
                 if (CT.logMeth>1)
                 {
-                    sprintf(CT.logBuffer,"Adding arc (%ld,%ld)",u,v);
+                    sprintf(CT.logBuffer,"Adding arc (%ld,%ld)",(unsigned long)u,(unsigned long)v);
                     LogEntry(LOG_METH2,CT.logBuffer);
                 }
 
@@ -1417,7 +1417,7 @@ void abstractMixedGraph::Triangulation() throw (ERRejected)
 
                 if (CT.logMeth>1)
                 {
-                    sprintf(CT.logBuffer,"Adding arc (%ld,%ld)",u,v);
+                    sprintf(CT.logBuffer,"Adding arc (%ld,%ld)",(unsigned long)u,(unsigned long)v);
                     LogEntry(LOG_METH2,CT.logBuffer);
                 }
 
@@ -1633,7 +1633,7 @@ TNode abstractMixedGraph::LMCOrderedPartition(
         if (CT.logMeth>1)
         {
             sprintf(CT.logBuffer,"vOut[%ld] = %ld, aOut[%ld] = %ld",
-                f,vOut[f],f,aOut[f]);
+                (unsigned long)f,(unsigned long)vOut[f],(unsigned long)f,(unsigned long)aOut[f]);
             LogEntry(LOG_METH2,CT.logBuffer);
         }
 
@@ -1702,7 +1702,7 @@ TNode abstractMixedGraph::LMCOrderedPartition(
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"Component %ld (Node): %ld",k,vDel);
+                sprintf(CT.logBuffer,"Component %ld (Node): %ld",(unsigned long)k,(unsigned long)vDel);
                 LogEntry(LOG_METH2,CT.logBuffer);
             }
 
@@ -1803,7 +1803,7 @@ TNode abstractMixedGraph::LMCOrderedPartition(
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"Component %ld (Path): %ld",k,vDel);
+                sprintf(CT.logBuffer,"Component %ld (Path): %ld",(unsigned long)k,(unsigned long)vDel);
                 LH = LogStart(LOG_METH2,CT.logBuffer);
             }
 
@@ -1834,7 +1834,7 @@ TNode abstractMixedGraph::LMCOrderedPartition(
 
                     if (CT.logMeth>1)
                     {
-                        sprintf(CT.logBuffer,",%ld",vDel);
+                        sprintf(CT.logBuffer,",%ld",(unsigned long)vDel);
                         LogAppend(LH,CT.logBuffer);
                     }
 
@@ -1939,7 +1939,7 @@ TNode abstractMixedGraph::LMCOrderedPartition(
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"Not a separator face: %ld",f);
+                sprintf(CT.logBuffer,"Not a separator face: %ld",(unsigned long)f);
                 LogEntry(LOG_METH2,CT.logBuffer);
             }
 
@@ -1979,7 +1979,7 @@ TNode abstractMixedGraph::LMCOrderedPartition(
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"New exterior path: (%ld",cl);
+            sprintf(CT.logBuffer,"New exterior path: (%ld",(unsigned long)cl);
             LH = LogStart(LOG_METH2,CT.logBuffer);
         }
 
@@ -1991,7 +1991,7 @@ TNode abstractMixedGraph::LMCOrderedPartition(
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer," [%ld] %ld",a,v);
+                sprintf(CT.logBuffer," [%ld] %ld",(unsigned long)a,(unsigned long)v);
                 LogAppend(LH,CT.logBuffer);
             }
 
@@ -2067,7 +2067,7 @@ TNode abstractMixedGraph::LMCOrderedPartition(
 
                 if (CT.logMeth>1)
                 {
-                    sprintf(CT.logBuffer,"New separator face: %ld",f);
+                    sprintf(CT.logBuffer,"New separator face: %ld",(unsigned long)f);
                     LogEntry(LOG_METH2,CT.logBuffer);
                 }
 
@@ -2101,7 +2101,7 @@ TNode abstractMixedGraph::LMCOrderedPartition(
             if (CT.logMeth>1)
             {
                 sprintf(CT.logBuffer,"vOut[%ld] = %ld, aOut[%ld] = %ld",
-                    f,vOut[f],f,aOut[f]);
+                    (unsigned long)f,(unsigned long)vOut[f],(unsigned long)f,(unsigned long)aOut[f]);
                 LogEntry(LOG_METH2,CT.logBuffer);
             }
         }
@@ -2113,7 +2113,7 @@ TNode abstractMixedGraph::LMCOrderedPartition(
             if (CT.logMeth>1)
             {
                 sprintf(CT.logBuffer,"fSep[%ld] = %ld",
-                    v,fSep[v]);
+                    (unsigned long)v,(unsigned long)fSep[v]);
                 LogEntry(LOG_METH2,CT.logBuffer);
             }
         }
@@ -2135,7 +2135,7 @@ TNode abstractMixedGraph::LMCOrderedPartition(
 
     if (connected && CT.logMeth>1)
     {
-        sprintf(CT.logBuffer,"Component %ld (Basis): %ld,%ld",k,v1,v2);
+        sprintf(CT.logBuffer,"Component %ld (Basis): %ld,%ld",(unsigned long)k,(unsigned long)v1,(unsigned long)v2);
         LogEntry(LOG_METH2,CT.logBuffer);
     }
 
@@ -2187,7 +2187,7 @@ TNode abstractMixedGraph::LMCOrderedPartition(
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"Component: %ld",k-1);
+            sprintf(CT.logBuffer,"Component: %ld",(unsigned long)(k-1));
             LH = LogStart(LOG_METH2,CT.logBuffer);
         }
 
@@ -2240,7 +2240,7 @@ TNode abstractMixedGraph::LMCOrderedPartition(
 
                 if (CT.logMeth>1)
                 {
-                    sprintf(CT.logBuffer,",%ld",l);
+                    sprintf(CT.logBuffer,",%ld",(unsigned long)l);
                     LogAppend(LH,CT.logBuffer);
                 }
 
@@ -2427,7 +2427,7 @@ void abstractMixedGraph::Layout_StraightLineDrawing(TArc aBasis,int spacing)
     }
 
 
-    if (CT.methLocal==LOCAL_OPTIMIZE) Layout_ForceDirected(FDP_RESTRICTED);
+    if (CT.methLocal>=LOCAL_OPTIMIZE) Layout_ForceDirected(FDP_RESTRICTED);
 
     CloseFold();
     LogEntry(LOG_RES, "...Straight line drawing found");
@@ -2703,7 +2703,7 @@ void abstractMixedGraph::Layout_ConvexDrawing(TArc aBasis,int spacing)
                     if (CT.logMeth>1)
                     {
                         sprintf(CT.logBuffer,"x[%ld] += %g",
-                            v,thisShift*sep);
+                            (unsigned long)v,thisShift*sep);
                         LogEntry(LOG_METH2,CT.logBuffer);
                     }
 
@@ -2747,7 +2747,7 @@ void abstractMixedGraph::Layout_ConvexDrawing(TArc aBasis,int spacing)
                     if (CT.logMeth>1)
                     {
                         sprintf(CT.logBuffer,"x[%ld] += %g + %g",
-                            v,sumShift,2*q*sep);
+                            (unsigned long)v,sumShift,2*q*sep);
                         LogEntry(LOG_METH2,CT.logBuffer);
                     }
 
@@ -2764,7 +2764,7 @@ void abstractMixedGraph::Layout_ConvexDrawing(TArc aBasis,int spacing)
 
                     if (CT.logMeth>1 && sumShift>0)
                     {
-                        sprintf(CT.logBuffer,"x[%ld] += %g",v,sumShift);
+                        sprintf(CT.logBuffer,"x[%ld] += %g",(unsigned long)v,sumShift);
                         LogEntry(LOG_METH2,CT.logBuffer);
                     }
 
@@ -2798,7 +2798,7 @@ void abstractMixedGraph::Layout_ConvexDrawing(TArc aBasis,int spacing)
             if (CT.logMeth>1)
             {
                 sprintf(CT.logBuffer,"Insert node %ld at (%g,%g)",
-                    vNext,xNew,yNew);
+                    (unsigned long)vNext,xNew,yNew);
                 LogEntry(LOG_METH2,CT.logBuffer);
             }
 
@@ -2866,7 +2866,7 @@ void abstractMixedGraph::Layout_ConvexDrawing(TArc aBasis,int spacing)
                 if (CT.logMeth>1)
                 {
                     sprintf(CT.logBuffer,"x[%ld] = %g + %g + %g",
-                        vNext,xInsert[vNext],shift[vNext],rShift[vNext]);
+                        (unsigned long)vNext,xInsert[vNext],shift[vNext],rShift[vNext]);
                     LogEntry(LOG_METH2,CT.logBuffer);
                 }
 
@@ -2912,7 +2912,7 @@ void abstractMixedGraph::Layout_ConvexDrawing(TArc aBasis,int spacing)
                         if (CT.logMeth>1)
                         {
                             sprintf(CT.logBuffer,"shift[%ld] = %g + %g + %g",
-                                v,shift[EndNode(cLeft[l])],sumRShift,q*sep);
+                                (unsigned long)v,shift[EndNode(cLeft[l])],sumRShift,q*sep);
                             LogEntry(LOG_METH2,CT.logBuffer);
                         }
 
@@ -2944,7 +2944,7 @@ void abstractMixedGraph::Layout_ConvexDrawing(TArc aBasis,int spacing)
                     if (CT.logMeth>1)
                     {
                         sprintf(CT.logBuffer,"shift[%ld] = %g + %g + %g",
-                            v,shift[EndNode(cLeft[l])],sumRShift,q*sep);
+                            (unsigned long)v,shift[EndNode(cLeft[l])],sumRShift,q*sep);
                         LogEntry(LOG_METH2,CT.logBuffer);
                     }
 
@@ -2959,7 +2959,7 @@ void abstractMixedGraph::Layout_ConvexDrawing(TArc aBasis,int spacing)
                     if (CT.logMeth>1)
                     {
                         sprintf(CT.logBuffer,"shift[%ld] = %g",
-                            v,shift[StartNode(cLeft[l])]);
+                            (unsigned long)v,shift[StartNode(cLeft[l])]);
                         LogEntry(LOG_METH2,CT.logBuffer);
                     }
 
@@ -2975,7 +2975,7 @@ void abstractMixedGraph::Layout_ConvexDrawing(TArc aBasis,int spacing)
             if (CT.logMeth>1)
             {
                 sprintf(CT.logBuffer,"rShift[%ld] += %g + %g",
-                    v,sumRShift,2*q*sep);
+                    (unsigned long)v,sumRShift,2*q*sep);
                 LogEntry(LOG_METH2,CT.logBuffer);
             }
 
@@ -2997,7 +2997,7 @@ void abstractMixedGraph::Layout_ConvexDrawing(TArc aBasis,int spacing)
                     if (CT.logMeth>1)
                     {
                         sprintf(CT.logBuffer,"shift[%ld] = %g + %g",
-                            v,shift[vr],rShift[vr]);
+                            (unsigned long)v,shift[vr],rShift[vr]);
                         LogEntry(LOG_METH2,CT.logBuffer);
                     }
 
@@ -3017,7 +3017,7 @@ void abstractMixedGraph::Layout_ConvexDrawing(TArc aBasis,int spacing)
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"x[%ld] = %g",v2,rShift[v2]);
+            sprintf(CT.logBuffer,"x[%ld] = %g",(unsigned long)v2,rShift[v2]);
             LogEntry(LOG_METH2,CT.logBuffer);
         }
 
@@ -3032,7 +3032,7 @@ void abstractMixedGraph::Layout_ConvexDrawing(TArc aBasis,int spacing)
     CloseFold();
 
     sprintf(CT.logBuffer,"...Grid size: %ldx%ld",
-        TNode(C(v2,0)),TNode(C(EndNode(cLeft[k-1]),1)));
+        (unsigned long)TNode(C(v2,0)),(unsigned long)TNode(C(EndNode(cLeft[k-1]),1)));
     LogEntry(LOG_RES,CT.logBuffer);
 
     delete[] cLeft;
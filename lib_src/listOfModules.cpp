@@ -1402,5 +1402,196 @@ const TModuleStruct listOfModules[NoModule] =
         NoReference,        // Original publication
         NoReference,        // Authors reference
         NoReference         // Text book reference
+    },
+
+
+    // ModBidirectional
+
+    {
+        "Bidirectional Dijkstra Method",
+                            // Module name
+        TimerSPTree,        // Timer index
+        NoAuthor,           // First implementor
+        NoAuthor,           // Second implementor
+        "October 2026",     // Date of encoding
+        "",                 // Latest revision
+        RefPoh71,           // Original publication
+        NoReference,        // Authors reference
+        RefAMO93            // Text book reference
+    },
+
+
+    // ModAStar
+
+    {
+        "A* Shortest Path Method",
+                            // Module name
+        TimerSPTree,        // Timer index
+        NoAuthor,           // First implementor
+        NoAuthor,           // Second implementor
+        "October 2026",     // Date of encoding
+        "",                 // Latest revision
+        RefHNR68,           // Original publication
+        NoReference,        // Authors reference
+        NoReference         // Text book reference
+    },
+
+
+    // ModPushRelabelParallel
+
+    {
+        "Parallel Push/Relabel Method",
+                            // Module name
+        TimerMaxFlow,       // Timer index
+        NoAuthor,           // First implementor
+        NoAuthor,           // Second implementor
+        "October 2026",     // Date of encoding
+        "",                 // Latest revision
+        RefAnSe95,          // Original publication
+        NoReference,        // Authors reference
+        RefGoTa88           // Text book reference
+    },
+
+
+    // ModLUFactor
+
+    {
+        "Sparse LU Factorization",
+                            // Module name
+        TimerPivoting,      // Timer index
+        NoAuthor,           // First implementor
+        NoAuthor,           // Second implementor
+        "October 2026",     // Date of encoding
+        "",                 // Latest revision
+        RefMar57,           // Original publication
+        NoReference,        // Authors reference
+        NoReference         // Text book reference
+    },
+
+
+    // ModLinKernighan
+
+    {
+        "Lin-Kernighan Local Search",
+                            // Module name
+        TimerLocalSearch,   // Timer index
+        NoAuthor,           // First implementor
+        NoAuthor,           // Second implementor
+        "October 2026",     // Date of encoding
+        "",                 // Latest revision
+        RefLiKe73,          // Original publication
+        RefFJMO95,          // Authors reference
+        NoReference         // Text book reference
+    },
+
+
+    // ModBarnesHut
+
+    {
+        "Barnes-Hut GEM Drawing",
+                            // Module name
+        TimerDrawing,       // Timer index
+        NoAuthor,           // First implementor
+        NoAuthor,           // Second implementor
+        "October 2026",     // Date of encoding
+        "",                 // Latest revision
+        RefBaHu86,          // Original publication
+        RefFLM94,           // Authors reference
+        NoReference         // Text book reference
+    },
+
+
+    // ModMultilevelFDP
+
+    {
+        "Multilevel Force Directed Drawing",
+                            // Module name
+        TimerDrawing,       // Timer index
+        NoAuthor,           // First implementor
+        NoAuthor,           // Second implementor
+        "October 2026",     // Date of encoding
+        "",                 // Latest revision
+        RefWal03,           // Original publication
+        RefHaJu05,          // Authors reference
+        NoReference         // Text book reference
+    },
+
+
+    // ModEnhancedCostScaling
+
+    {
+        "Enhanced Cost Scaling Method",
+                            // Module name
+        TimerMinCFlow,      // Timer index
+        NoAuthor,           // First implementor
+        NoAuthor,           // Second implementor
+        "October 2026",     // Date of encoding
+        "",                 // Latest revision
+        RefGoTa90,          // Original publication
+        RefGol97,           // Authors reference
+        RefAMO93            // Text book reference
+    },
+
+
+    // ModParallelComponents
+
+    {
+        "Parallel Connected Components",
+                            // Module name
+        TimerComponents,    // Timer index
+        NoAuthor,           // First implementor
+        NoAuthor,           // Second implementor
+        "October 2026",     // Date of encoding
+        "",                 // Latest revision
+        RefShVi82,          // Original publication
+        RefTaVi85,          // Authors reference
+        NoReference         // Text book reference
+    },
+
+
+    // ModParallelStrongComp
+
+    {
+        "Parallel Strong Components",
+                            // Module name
+        TimerComponents,    // Timer index
+        NoAuthor,           // First implementor
+        NoAuthor,           // Second implementor
+        "October 2026",     // Date of encoding
+        "",                 // Latest revision
+        RefFHP00,           // Original publication
+        NoReference,        // Authors reference
+        NoReference         // Text book reference
+    },
+
+
+    // ModAuction
+
+    {
+        "Auction Method",   // Module name
+        TimerMatching,      // Timer index
+        NoAuthor,           // First implementor
+        NoAuthor,           // Second implementor
+        "October 2026",     // Date of encoding
+        "",                 // Latest revision
+        RefBer88,           // Original publication
+        NoReference,        // Authors reference
+        NoReference         // Text book reference
+    },
+
+
+    // ModJonkerVolgenant
+
+    {
+        "Jonker/Volgenant Method",
+                            // Module name
+        TimerMatching,      // Timer index
+        NoAuthor,           // First implementor
+        NoAuthor,           // Second implementor
+        "October 2026",     // Date of encoding
+        "",                 // Latest revision
+        RefJoVo87,          // Original publication
+        NoReference,        // Authors reference
+        NoReference         // Text book reference
     }
 };
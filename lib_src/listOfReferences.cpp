@@ -1101,5 +1101,272 @@ const TReferenceStruct listOfReferences[NoReference] =
         "",                             // pages
         "",                             // publisher
         2006                            // year
+    },
+
+
+    // RefPoh71
+
+    {
+        "Poh71",                        // refKey
+        "I.Pohl",
+                                        // authors
+        "Bi-directional search",        // title
+        "article",                      // type
+        "Machine Intelligence",         // in
+        "",                             // editors
+        6,                              // volume
+        "127-140",                      // pages
+        "Edinburgh University Press",   // publisher
+        1971                            // year
+    },
+
+
+    // RefHNR68
+
+    {
+        "HNR68",                        // refKey
+        "P.E.Hart, N.J.Nilsson, B.Raphael",
+                                        // authors
+        "A formal basis for the heuristic determination of minimum cost paths",
+                                        // title
+        "article",                      // type
+        "IEEE Trans. Systems Science and Cybernetics",
+                                        // in
+        "",                             // editors
+        4,                              // volume
+        "100-107",                      // pages
+        "",                             // publisher
+        1968                            // year
+    },
+
+
+    // RefAnSe95
+
+    {
+        "AnSe95",                       // refKey
+        "R.J.Anderson, J.C.Setubal",    // authors
+        "A parallel implementation of the push-relabel algorithm for the maximum flow problem",
+                                        // title
+        "article",                      // type
+        "Journal of Parallel and Distributed Computing",
+                                        // in
+        "",                             // editors
+        29,                             // volume
+        "17-26",                        // pages
+        "",                             // publisher
+        1995                            // year
+    },
+
+
+    // RefMar57
+
+    {
+        "Mar57",                        // refKey
+        "H.M.Markowitz",                // authors
+        "The elimination form of the inverse and its application to linear programming",
+                                        // title
+        "article",                      // type
+        "Management Science",           // in
+        "",                             // editors
+        3,                              // volume
+        "255-269",                      // pages
+        "",                             // publisher
+        1957                            // year
+    },
+
+
+    // RefLiKe73
+
+    {
+        "LiKe73",                       // refKey
+        "S.Lin, B.W.Kernighan",         // authors
+        "An effective heuristic algorithm for the traveling-salesman problem",
+                                        // title
+        "article",                      // type
+        "Operations Research",          // in
+        "",                             // editors
+        21,                             // volume
+        "498-516",                      // pages
+        "",                             // publisher
+        1973                            // year
+    },
+
+
+    // RefFJMO95
+
+    {
+        "FJMO95",                       // refKey
+        "M.L.Fredman, D.S.Johnson, L.A.McGeoch, G.Ostheimer",
+                                        // authors
+        "Data structures for traveling salesmen",
+                                        // title
+        "article",                      // type
+        "Journal of Algorithms",        // in
+        "",                             // editors
+        18,                             // volume
+        "432-479",                      // pages
+        "",                             // publisher
+        1995                            // year
+    },
+
+
+    // RefBaHu86
+
+    {
+        "BaHu86",                       // refKey
+        "J.Barnes, P.Hut",              // authors
+        "A hierarchical O(N log N) force-calculation algorithm",
+                                        // title
+        "article",                      // type
+        "Nature",                       // in
+        "",                             // editors
+        324,                            // volume
+        "446-449",                      // pages
+        "",                             // publisher
+        1986                            // year
+    },
+
+
+    // RefWal03
+
+    {
+        "Wal03",                        // refKey
+        "C.Walshaw",                    // authors
+        "A multilevel algorithm for force-directed graph drawing",
+                                        // title
+        "article",                      // type
+        "Journal of Graph Algorithms and Applications",
+                                        // in
+        "",                             // editors
+        7,                              // volume
+        "253-285",                      // pages
+        "",                             // publisher
+        2003                            // year
+    },
+
+
+    // RefHaJu05
+
+    {
+        "HaJu05",                       // refKey
+        "S.Hachul, M.Juenger",          // authors
+        "Drawing large graphs with a potential-field-based multilevel algorithm",
+                                        // title
+        "article",                      // type
+        "LNCS Proc. Graph Drawing 2004",
+                                        // in
+        "",                             // editors
+        3383,                           // volume
+        "285-295",                      // pages
+        "",                             // publisher
+        2005                            // year
+    },
+
+
+    // RefGol97
+
+    {
+        "Gol97",                        // refKey
+        "A.V.Goldberg",                 // authors
+        "An efficient implementation of a scaling minimum-cost flow algorithm",
+                                        // title
+        "article",                      // type
+        "Journal of Algorithms",
+                                        // in
+        "",                             // editors
+        22,                             // volume
+        "1-29",                         // pages
+        "",                             // publisher
+        1997                            // year
+    },
+
+
+    // RefShVi82
+
+    {
+        "ShVi82",                       // refKey
+        "Y.Shiloach, U.Vishkin",        // authors
+        "An O(log n) parallel connectivity algorithm",
+                                        // title
+        "article",                      // type
+        "Journal of Algorithms",
+                                        // in
+        "",                             // editors
+        3,                              // volume
+        "57-67",                        // pages
+        "",                             // publisher
+        1982                            // year
+    },
+
+
+    // RefTaVi85
+
+    {
+        "TaVi85",                       // refKey
+        "R.E.Tarjan, U.Vishkin",        // authors
+        "An efficient parallel biconnectivity algorithm",
+                                        // title
+        "article",                      // type
+        "SIAM Journal on Computing",
+                                        // in
+        "",                             // editors
+        14,                             // volume
+        "862-874",                      // pages
+        "",                             // publisher
+        1985                            // year
+    },
+
+
+    // RefFHP00
+
+    {
+        "FHP00",                        // refKey
+        "L.K.Fleischer, B.Hendrickson, A.Pinar",
+                                        // authors
+        "On identifying strongly connected components in parallel",
+                                        // title
+        "article",                      // type
+        "LNCS Proc. IPDPS 2000 Workshops",
+                                        // in
+        "",                             // editors
+        1800,                           // volume
+        "505-511",                      // pages
+        "Springer",                     // publisher
+        2000                            // year
+    },
+
+
+    // RefBer88
+
+    {
+        "Ber88",                        // refKey
+        "D.P.Bertsekas",                // authors
+        "The auction algorithm: A distributed relaxation method for the assignment problem",
+                                        // title
+        "article",                      // type
+        "Annals of Operations Research",
+                                        // in
+        "",                             // editors
+        14,                             // volume
+        "105-123",                      // pages
+        "",                             // publisher
+        1988                            // year
+    },
+
+
+    // RefJoVo87
+
+    {
+        "JoVo87",                       // refKey
+        "R.Jonker, A.Volgenant",        // authors
+        "A shortest augmenting path algorithm for dense and sparse linear assignment problems",
+                                        // title
+        "article",                      // type
+        "Computing",                    // in
+        "",                             // editors
+        38,                             // volume
+        "325-340",                      // pages
+        "",                             // publisher
+        1987                            // year
     }
 };
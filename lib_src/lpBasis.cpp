@@ -155,6 +155,44 @@ void goblinLPSolver::InitBasis()
 }
 
 
+void goblinLPSolver::AllocateBasisData()
+    const throw()
+{
+    if (baseFactor!=NULL && baseFactor->N()==lAct) return;
+
+    ReleaseBasisData();
+
+    baseFactor = new sparseLUFactor(lAct,CT);
+    tabRow  = new TFloat[lAct];
+    workVec = new TFloat[lAct];
+    pivotAlpha = new TFloat[lAct];
+    x = new TFloat[lAct];
+    y = new TFloat[kAct+lAct];
+}
+
+
+void goblinLPSolver::ReleaseBasisData()
+    const throw()
+{
+    delete baseFactor;
+    baseFactor  = NULL;
+    delete[] tabRow;
+    tabRow      = NULL;
+    delete[] workVec;
+    workVec     = NULL;
+    delete[] pivotAlpha;
+    pivotAlpha  = NULL;
+    delete[] x;
+    x           = NULL;
+    delete[] y;
+    y           = NULL;
+
+    tabRowIndex = NoVar;
+    baseValid = false;
+    dataValid = false;
+}
+
+
 void goblinLPSolver::DefaultBasisInverse()
     const throw(ERRejected)
 {
@@ -165,22 +203,14 @@ void goblinLPSolver::DefaultBasisInverse()
 
     #endif
 
-    if (baseInv==NULL)
-    {
-        baseInv = new denseMatrix<TIndex,TFloat>(lAct,lAct,CT);
-        keptInv = new denseMatrix<TIndex,TFloat>(lAct,lAct,CT);
-        x = new TFloat[lAct];
-        y = new TFloat[kAct+lAct];
-    }
+    AllocateBasisData();
 
-    // Compute basis inverse matrix
+    // The basis matrix is the identity matrix
 
     if (!baseValid)
     {
-        for (TVar i=0;i<lAct;i++)
-            for (TVar j=0;j<lAct;j++)
-                if (i==j) baseInv->SetCoeff(i,j,1);
-                else baseInv->SetCoeff(i,j,0);
+        baseFactor -> Identity();
+        tabRowIndex = NoVar;
     }
 
     // Compute basic solution
@@ -207,62 +237,59 @@ void goblinLPSolver::DefaultBasisInverse()
 }
 
 
-void goblinLPSolver::EvaluateBasis()
+void goblinLPSolver::FactorizeBasis()
     const throw(ERRejected)
 {
-    if (dataValid) return;
+    if (rowFirst==NULL) CompressRows();
 
-    if (baseInitial)
-    {
-        DefaultBasisInverse();
-        return;
-    }
+    // Column k of the factorized matrix is the k-th row of the basis matrix
 
-    OpenFold(ModLpPivoting,NO_INDENT);
+    baseFactor -> Init();
 
-    if (baseInv==NULL)
+    for (TVar k=0;k<lAct;k++)
     {
-        baseInv = new denseMatrix<TIndex,TFloat>(lAct,lAct,CT);
-        keptInv = new denseMatrix<TIndex,TFloat>(lAct,lAct,CT);
-        x = new TFloat[lAct];
-        y = new TFloat[kAct+lAct];
-        baseValid = false;
-    }
+        TRestr i = Index(k);
 
-    if (!baseValid)
-    {
-        // Compute basis inverse matrix
+        if (i==NoRestr)
+            Error(ERR_REJECTED,"FactorizeBasis","Incomplete basis information");
 
-        for (TIndex i=0;i<lAct;i++)
+        if (i<kAct)
         {
-            // Find next restriction in basis
+            baseFactor -> SetColumn(k,rowFirst[i+1]-rowFirst[i],
+                                    rowVar+rowFirst[i],rowCoeff+rowFirst[i]);
+        }
+        else
+        {
+            TIndex j = i-kAct;
+            TFloat unitCoeff = 1;
+            baseFactor -> SetColumn(k,1,&j,&unitCoeff);
+        }
+    }
 
-            TIndex iNext = Index(i);
+    tabRowIndex = NoVar;
 
-            if (iNext==NoRestr)
-                Error(ERR_REJECTED,"EvaluateBasis","Incomplete basis information");
+    baseFactor -> Factorize();
+}
 
-            // Copy matrix coefficients
 
-            for (TIndex j=0;j<lAct;j++) 
-            {
-                TFloat thisCoeff = 0;
+void goblinLPSolver::EvaluateBasis()
+    const throw(ERRejected)
+{
+    if (dataValid) return;
 
-                if (iNext<kAct) thisCoeff = Coeff(iNext,j);
-                else
-                {
-                    if (j==iNext-kAct) thisCoeff = 1;
-                    else thisCoeff = 0;
-                }
+    if (baseInitial)
+    {
+        DefaultBasisInverse();
+        return;
+    }
 
-                keptInv -> SetCoeff(i,j,thisCoeff);
+    OpenFold(ModLpPivoting,NO_INDENT);
 
-                if (i==j) baseInv->SetCoeff(i,j,1);
-                else baseInv->SetCoeff(i,j,0);
-            }
-        }
+    AllocateBasisData();
 
-        keptInv -> GaussElim(*baseInv);
+    if (!baseValid)
+    {
+        FactorizeBasis();
 
         baseValid = true;
 
@@ -298,13 +325,40 @@ void goblinLPSolver::Pivot(TIndex j,TIndex i,TLowerUpper rt)
     pivotRow = i;
     pivotColumn = RevIndex(j); 
 
+    // The factorization can only be updated if it matches the old basis
+    bool factorValid = (baseFactor!=NULL && baseValid);
+
     SetIndex(i,RevIndex(j),rt);
 
-    if (!baseInv) EvaluateBasis();
+    if (!factorValid) EvaluateBasis();
     else BasisUpdate(pivotRow,pivotColumn);
 }
 
 
+void goblinLPSolver::RestrFTran(TRestr i,TFloat* alpha)
+    const throw(ERRange)
+{
+    #if defined(_FAILSAVE_)
+
+    if (i>=kAct+lAct)  NoSuchRestr("RestrFTran",i);
+
+    #endif
+
+    for (TVar k=0;k<lAct;k++) alpha[k] = 0;
+
+    if (i<kAct)
+    {
+        if (rowFirst==NULL) CompressRows();
+
+        for (TIndex q=rowFirst[i];q<rowFirst[i+1];q++)
+            alpha[rowVar[q]] = rowCoeff[q];
+    }
+    else alpha[i-kAct] = 1;
+
+    baseFactor -> FTran(alpha);
+}
+
+
 void goblinLPSolver::BasisUpdate(TRestr i,TVar j)
     const throw(ERRange,ERRejected)
 {
@@ -314,44 +368,38 @@ void goblinLPSolver::BasisUpdate(TRestr i,TVar j)
 
     if (i>=kAct+lAct)  NoSuchRestr("BasisUpdate",i);
     if (j>=lAct)  NoSuchVar("BasisUpdate",j);
-    if (!baseInv)
-        Error(ERR_REJECTED,"BasisUpdate","No initial basis inverse");
+    if (!baseFactor)
+        Error(ERR_REJECTED,"BasisUpdate","No initial basis factorization");
 
     #endif
 
     OpenFold(ModLpPivoting,NO_INDENT);
 
-    // SetIndex() has cleared this flag but we want access to the old tableau
-
-    baseValid = true;
+    // The factorization still represents the old basis. Compute the
+    // tableau column of the entering row with respect to the old basis
 
-    // Update basis inverse
+    RestrFTran(i,workVec);
 
-    TFloat pivotElt = Tableau(Index(j),i);
+    TFloat pivotElt = workVec[j];
 
     if (fabs(pivotElt)<EPSILON)
         Error(ERR_REJECTED,"BasisUpdate","Pivot element too small");
 
-    TFloat* pivotCand = new TFloat[lAct];
-    for (TVar r=0;r<lAct;r++)
-        pivotCand[r] = Tableau(Index(r),i);
-
-    for (TVar r=0;r<j;r++)
-        for(TVar s=0;s<lAct;s++)
-            baseInv->SetCoeff(s,r,
-                baseInv->Coeff(s,r)-pivotCand[r]*baseInv->Coeff(s,j)/pivotElt);
-
-    for (TVar r=j+1;r<lAct;r++)
-        for(TVar s=0;s<lAct;s++)
-            baseInv->SetCoeff(s,r,
-                baseInv->Coeff(s,r)-pivotCand[r]*baseInv->Coeff(s,j)/pivotElt);
+    if (baseFactor->RefactorizationRequired())
+    {
+        FactorizeBasis();
 
-    for (TVar s=0;s<lAct;s++)
-        baseInv->SetCoeff(s,j, baseInv->Coeff(s,j)/pivotElt);
+        LogEntry(LOG_METH2,"...Basis matrix is refactorized");
+    }
+    else
+    {
+        baseFactor -> Update(j,workVec);
+        tabRowIndex = NoVar;
 
-    delete[] pivotCand;
+        LogEntry(LOG_METH2,"...Basis factorization is updated");
+    }
 
-    LogEntry(LOG_METH2,"...Basis inverse is updated");
+    baseValid = true;
 
     CloseFold(ModLpPivoting,NO_INDENT);
 }
@@ -362,38 +410,39 @@ void goblinLPSolver::SolutionUpdate()
 {
     #if defined(_FAILSAVE_)
 
-    if (!baseInv)
-        Error(ERR_REJECTED,"SolutionUpdate","Base inverse does not exist");
+    if (!baseFactor)
+        Error(ERR_REJECTED,"SolutionUpdate","Base factorization does not exist");
     if (!baseValid)
-        Error(ERR_REJECTED,"SolutionUpdate","Base inverse is not up to date");
+        Error(ERR_REJECTED,"SolutionUpdate","Base factorization is not up to date");
 
     #endif
 
     OpenFold(ModLpPivoting,NO_INDENT);
 
-    // Compute primal solution
+    // Compute primal solution by BTRAN of the basic right-hand sides
 
-    for (TIndex i=0;i<lAct;i++)
+    for (TIndex j=0;j<lAct;j++)
     {
-        x[i] = 0;
+        //If basic restriction corresponds to free variable, then RHS=0
 
-        for (TIndex j=0;j<lAct;j++)
-        {
-            //If basic restriction corresponds to free variable, then RHS=0
-
-            TFloat RHS = 0;
-            TRestr k=Index(j);
+        TFloat RHS = 0;
+        TRestr k=Index(j);
 
-            if (RestrType(k)==BASIC_UB && UBound(k)<InfFloat)
-                RHS = UBound(k);
-            else if(LBound(k)> -InfFloat)
-                RHS = LBound(k);
+        if (RestrType(k)==BASIC_UB && UBound(k)<InfFloat)
+            RHS = UBound(k);
+        else if(LBound(k)> -InfFloat)
+            RHS = LBound(k);
 
-            x[i] += baseInv->Coeff(i,j)*RHS;
-        }
+        x[j] = RHS;
     }
 
-    // Compute dual solution
+    baseFactor -> BTran(x);
+
+    // Compute dual solution by FTRAN of the cost vector
+
+    for (TIndex j=0;j<lAct;j++) workVec[j] = Cost(j);
+
+    baseFactor -> FTran(workVec);
 
     for (TIndex i=0;i<kAct+lAct;i++)
     {
@@ -401,10 +450,7 @@ void goblinLPSolver::SolutionUpdate()
 
         if (RestrType(i)!=BASIC_UB && RestrType(i)!=BASIC_LB) continue;
 
-        TVar j2 = RevIndex(i);
-
-        for (TIndex j=0;j<lAct;j++)
-            y[i] += baseInv->Coeff(j,j2)*Cost(j);
+        y[i] = workVec[RevIndex(i)];
     }
 
     dataValid = true;
@@ -447,6 +493,42 @@ TFloat goblinLPSolver::Y(TRestr i,TLowerUpper rt)
 }
 
 
+TFloat goblinLPSolver::Slack(TRestr i,TLowerUpper lu)
+    const throw(ERRange)
+{
+    #if defined(_FAILSAVE_)
+
+    if (i>=kAct+lAct)  NoSuchRestr("Slack",i);
+
+    #endif
+
+    if (   i>=kAct
+        || (RestrType(i)==BASIC_UB && lu==UPPER)
+        || (RestrType(i)==BASIC_LB && lu==LOWER)
+        || (lu==LOWER && LBound(i)== -InfFloat)
+        || (lu==UPPER && UBound(i)== InfFloat)
+       )
+    {
+        return goblinILPWrapper::Slack(i,lu);
+    }
+
+    // Evaluate the restriction on the compressed row
+
+    if (!dataValid) EvaluateBasis();
+
+    if (rowFirst==NULL) CompressRows();
+
+    TFloat activity = 0;
+
+    for (TIndex q=rowFirst[i];q<rowFirst[i+1];q++)
+        activity += x[rowVar[q]]*rowCoeff[q];
+
+    if (lu==LOWER) return activity-LBound(i);
+
+    return UBound(i)-activity;
+}
+
+
 TFloat goblinLPSolver::Tableau(TIndex i,TIndex j)
     const throw(ERRange,ERRejected)
 {
@@ -466,12 +548,26 @@ TFloat goblinLPSolver::Tableau(TIndex i,TIndex j)
 
     TVar i0 = RevIndex(i);
 
-    if (j>=kAct) return baseInv->Coeff(j-kAct,i0);
+    // Tableau rows are usually requested for many j.
+    // So (A_B)^(-1)e_i is computed by BTRAN once and kept
+
+    if (tabRowIndex!=i0)
+    {
+        for (TVar k=0;k<lAct;k++) tabRow[k] = 0;
+
+        tabRow[i0] = 1;
+        baseFactor -> BTran(tabRow);
+        tabRowIndex = i0;
+    }
+
+    if (j>=kAct) return tabRow[j-kAct];
+
+    if (rowFirst==NULL) CompressRows();
 
     TFloat element = 0;
 
-    for (TVar k=0;k<lAct;k++)
-        element += Coeff(j,k)*baseInv->Coeff(k,i0);
+    for (TIndex q=rowFirst[j];q<rowFirst[j+1];q++)
+        element += rowCoeff[q]*tabRow[rowVar[q]];
 
     return element;
 }
@@ -492,5 +588,10 @@ TFloat goblinLPSolver::BaseInverse(TIndex i,TIndex j)
 
     if (!baseValid) EvaluateBasis();
 
-    return baseInv->Coeff(RevIndex(i),j);
+    for (TVar k=0;k<lAct;k++) workVec[k] = 0;
+
+    workVec[RevIndex(i)] = 1;
+    baseFactor -> FTran(workVec);
+
+    return workVec[j];
 }
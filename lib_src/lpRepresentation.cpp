@@ -48,10 +48,18 @@ goblinLPSolver::goblinLPSolver(TRestr kk,TVar ll,TIndex size,
     restrType = new TRestrType[kMax+lMax];
     index     = new TVar[lMax];
     revIndex  = new TVar[kMax+lMax];
-    baseInv   = NULL;
-    keptInv   = NULL;
-    x         = NULL;
-    y         = NULL;
+    baseFactor  = NULL;
+    tabRow      = NULL;
+    tabRowIndex = NoVar;
+    workVec     = NULL;
+    pivotAlpha  = NULL;
+    refWeight   = NULL;
+    x           = NULL;
+    y           = NULL;
+
+    rowFirst  = NULL;
+    rowVar    = NULL;
+    rowCoeff  = NULL;
 
     baseInitial = true;
     baseValid  = false;
@@ -132,10 +140,18 @@ goblinLPSolver::goblinLPSolver(const char* impFileName,
     restrType = new TRestrType[kMax+lMax];
     index     = new TVar[lMax];
     revIndex  = new TVar[kMax+lMax];
-    baseInv   = NULL;
-    keptInv   = NULL;
-    x         = NULL;
-    y         = NULL;
+    baseFactor  = NULL;
+    tabRow      = NULL;
+    tabRowIndex = NoVar;
+    workVec     = NULL;
+    pivotAlpha  = NULL;
+    refWeight   = NULL;
+    x           = NULL;
+    y           = NULL;
+
+    rowFirst  = NULL;
+    rowVar    = NULL;
+    rowCoeff  = NULL;
 
     baseInitial = true;
     baseValid  = false;
@@ -225,10 +241,9 @@ goblinLPSolver::~goblinLPSolver() throw()
     delete[] restrType;
     delete[] index;
     delete[] revIndex;
-    delete baseInv;
-    delete keptInv;
-    delete[] x;
-    delete[] y;
+    ReleaseBasisData();
+    ReleaseCompressedRows();
+    ReleasePricingWeights();
 
     delete coeff;
 
@@ -273,7 +288,14 @@ unsigned long goblinLPSolver::Allocated() const throw()
                 tmpSize += sizeof(char)*(strlen(varLabel[i])+1);
     }
 
-    if (baseValid)          tmpSize += (kAct+2*lAct)*sizeof(TFloat);
+    if (baseFactor!=NULL)
+        tmpSize += baseFactor->Size()+(kAct+5*lAct)*sizeof(TFloat);
+
+    if (refWeight!=NULL)
+        tmpSize += (kAct+lAct)*sizeof(TFloat);
+
+    if (rowFirst!=NULL)
+        tmpSize += (kAct+1)*sizeof(TIndex)+rowFirst[kAct]*(sizeof(TVar)+sizeof(TFloat));
 
     return tmpSize;
 }
@@ -318,6 +340,8 @@ TRestr goblinLPSolver::AddRestr(TFloat l,TFloat u)
 
     for (TVar j=0;j<lAct;j++) SetCoeff(kAct-1,j,0);
 
+    ReleaseCompressedRows();
+
     if (y!=NULL)
     {
         // Extend dual solution
@@ -375,50 +399,10 @@ TRestr goblinLPSolver::AddVar(TFloat l,TFloat u,TFloat c,TVarType vt)
 
     for (TRestr i=0;i<kAct;i++) SetCoeff(i,lAct-1,0);
 
-    if (baseInv)
-    {
-        if (baseValid)
-        {
-            // Reuse old basis information
-
-            denseMatrix<TIndex,TFloat> *newInv
-                = new denseMatrix<TIndex,TFloat>(lAct,lAct);
-
-            for (TIndex i=0;i<lAct-1;i++)
-            {
-                for (TIndex j=0;j<lAct-1;j++)
-                    newInv -> SetCoeff(i,j,baseInv->Coeff(i,j));
-
-                newInv -> SetCoeff(lAct-1,i,0);
-                newInv -> SetCoeff(i,lAct-1,0);
-            }
-
-            newInv -> SetCoeff(lAct-1,lAct-1,1);
-
-            delete keptInv;
-            keptInv = new denseMatrix<TIndex,TFloat>(lAct,lAct);
-
-            x = (TFloat *)GoblinRealloc(index,lAct*sizeof(TFloat));
+    // The basis matrix has grown. Refactorize on demand
 
-            if (RestrType(kAct+lAct-1)==BASIC_UB)
-                x[lAct-1] = -UBound(kAct+lAct-1);
-            else x[lAct-1] = LBound(kAct+lAct-1);
-
-            y = (TFloat *)GoblinRealloc(index,(kAct+lAct)*sizeof(TFloat));
-            y[kAct+lAct-1] = Cost(lAct-1);
-        }
-        else
-        {
-            delete baseInv;
-            baseInv   = NULL;
-            delete keptInv;
-            keptInv   = NULL;
-            delete[] x;
-            x         = NULL;
-            delete[] y;
-            y         = NULL;
-        }
-    }
+    ReleaseBasisData();
+    ReleaseCompressedRows();
 
     return lAct-1;
 }
@@ -634,11 +618,65 @@ void goblinLPSolver::SetCoeff(TRestr i,TVar j,TFloat aa)
 
     coeff -> ChangeKey(lMax*i+j,aa);
 
+    ReleaseCompressedRows();
+
     baseValid = false;
     dataValid = false;
 }
 
 
+void goblinLPSolver::CompressRows()
+    const throw()
+{
+    ReleaseCompressedRows();
+
+    TIndex nzMax = coeff->NZ()+1;
+
+    rowFirst = new TIndex[kAct+1];
+    rowVar   = new TVar[nzMax];
+    rowCoeff = new TFloat[nzMax];
+
+    TIndex nz = 0;
+
+    for (TRestr i=0;i<kAct;i++)
+    {
+        rowFirst[i] = nz;
+
+        for (TVar j=0;j<lAct;j++)
+        {
+            TFloat thisCoeff = Coeff(i,j);
+
+            if (thisCoeff==0) continue;
+
+            if (nz==nzMax)
+            {
+                nzMax *= 2;
+                rowVar   = (TVar*)GoblinRealloc(rowVar,nzMax*sizeof(TVar));
+                rowCoeff = (TFloat*)GoblinRealloc(rowCoeff,nzMax*sizeof(TFloat));
+            }
+
+            rowVar[nz] = j;
+            rowCoeff[nz] = thisCoeff;
+            nz++;
+        }
+    }
+
+    rowFirst[kAct] = nz;
+}
+
+
+void goblinLPSolver::ReleaseCompressedRows()
+    const throw()
+{
+    delete[] rowFirst;
+    rowFirst = NULL;
+    delete[] rowVar;
+    rowVar   = NULL;
+    delete[] rowCoeff;
+    rowCoeff = NULL;
+}
+
+
 TVar goblinLPSolver::GetRow(TRestr i,TVar* index,double* val)
     const throw(ERRange)
 {
@@ -1078,7 +1116,7 @@ void goblinLPSolver::SetVarType(TVar i,TVarType vt)
 
 
 static const char maxLabelLength = 20;
-static char thisVarLabel[maxLabelLength] = "";
+static __thread char thisVarLabel[maxLabelLength] = "";
 typedef char* TString;
 
 char* goblinLPSolver::VarLabel(TVar i,TOwnership tp)
@@ -1155,7 +1193,7 @@ void goblinLPSolver::SetVarLabel(TVar i,char* newLabel,TOwnership tp)
 }
 
 
-static char thisRestrLabel[maxLabelLength] = "";
+static __thread char thisRestrLabel[maxLabelLength] = "";
 
 char* goblinLPSolver::RestrLabel(TRestr i,TOwnership tp)
     const throw(ERRange)
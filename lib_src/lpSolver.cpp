@@ -23,6 +23,9 @@ TVar goblinLPSolver::PricePrimal()
 {
     OpenFold(ModLpPricing,NO_INDENT);
 
+    TVar i = NoVar;
+    TFloat bestScore = 0;
+
     for (TVar j=0;j<lAct;j++)
     {
         TRestr ind = Index(j);
@@ -38,18 +41,35 @@ TVar goblinLPSolver::PricePrimal()
             (RestrType(ind)==BASIC_UB && test> TOLERANCE)
            )
         {
-            sprintf(CT.logBuffer,"Pivot variable is %ld...",j);
-            LogEntry(LOG_METH2,CT.logBuffer);
+            if (CT.methLPPricing==int(FIRST_FIT))
+            {
+                i = j;
+                break;
+            }
+
+            // Dantzig rule, or reduced costs normalized by the reference weights
+
+            TFloat score = fabs(test);
 
-            CloseFold(ModLpPricing,NO_INDENT);
+            if (refWeight) score = test*test/refWeight[j];
 
-            return j;
+            if (score>bestScore)
+            {
+                i = j;
+                bestScore = score;
+            }
         }
     }
 
+    if (i!=NoVar)
+    {
+        sprintf(CT.logBuffer,"Pivot variable is %ld...",i);
+        LogEntry(LOG_METH2,CT.logBuffer);
+    }
+
     CloseFold(ModLpPricing,NO_INDENT);
 
-    return NoVar;
+    return i;
 }
 
 
@@ -178,6 +198,8 @@ TFloat goblinLPSolver::SolvePrimal()
     TFloat ret = InfFloat;
     unsigned long itCount = 0;
 
+    InitPricingWeights(false);
+
     while (CT.SolverRunning())
     {
         pivotColumn = PricePrimal();
@@ -220,11 +242,15 @@ TFloat goblinLPSolver::SolvePrimal()
 
         Trace(1);
 
+        if (pivotRow!=Index(pivotColumn)) UpdatePrimalWeights(pivotRow,pivotColumn);
+
         Pivot(Index(pivotColumn),pivotRow,pivotDir);
 
         itCount++;
     }
 
+    ReleasePricingWeights();
+
     pivotColumn = NoVar;
 
     if (CT.logMeth==1)
@@ -249,24 +275,47 @@ TRestr goblinLPSolver::PriceDual()
 {
     OpenFold(ModLpPricing,NO_INDENT);
 
-    for (TRestr j=0;j<kAct+lAct-1;j++)
+    TRestr k = NoRestr;
+    TFloat bestScore = 0;
+
+    for (TRestr j=0;j<kAct+lAct;j++)
     {
         if (RestrType(j)==BASIC_LB || RestrType(j)==BASIC_UB) continue;
 
-        if (Slack(j,LOWER)< -TOLERANCE || Slack(j,UPPER)< -TOLERANCE)
+        TFloat infeas = -Slack(j,LOWER);
+
+        if (infeas<=TOLERANCE) infeas = -Slack(j,UPPER);
+
+        if (infeas<=TOLERANCE) continue;
+
+        if (CT.methLPPricing==int(FIRST_FIT))
         {
-            sprintf(CT.logBuffer,"Entering row is %ld...",j);
-            LogEntry(LOG_METH2,CT.logBuffer);
+            k = j;
+            break;
+        }
 
-            CloseFold(ModLpPricing,NO_INDENT);
+        // Dantzig rule, or infeasibilities normalized by the reference weights
 
-            return j;
+        TFloat score = infeas;
+
+        if (refWeight) score = infeas*infeas/refWeight[j];
+
+        if (score>bestScore)
+        {
+            k = j;
+            bestScore = score;
         }
     }
 
+    if (k!=NoRestr)
+    {
+        sprintf(CT.logBuffer,"Entering row is %ld...",k);
+        LogEntry(LOG_METH2,CT.logBuffer);
+    }
+
     CloseFold(ModLpPricing,NO_INDENT);
 
-    return NoRestr;
+    return k;
 }
 
 
@@ -281,6 +330,14 @@ TVar goblinLPSolver::QTestDual(TRestr k)
 
     TFloat lambda = InfFloat;
     TVar i = NoVar;
+    bool freeRow = false;
+
+    // Compute the tableau column of the entering row by a single FTRAN.
+    // It is kept in pivotAlpha for the update of the pricing weights
+
+    if (!dataValid) EvaluateBasis();
+
+    RestrFTran(k,pivotAlpha);
 
     for (TVar j=0;j<lAct;j++)
     {
@@ -288,7 +345,7 @@ TVar goblinLPSolver::QTestDual(TRestr k)
 
         if (LBound(ind)>=UBound(ind)) continue;
 
-        TFloat pivotElt = sign*Tableau(Index(j),k);
+        TFloat pivotElt = sign*pivotAlpha[j];
         TFloat redKosten = Y(ind,TLowerUpper(RestrType(ind))); 
 
         if (LBound(ind)== -InfFloat && 
@@ -296,6 +353,7 @@ TVar goblinLPSolver::QTestDual(TRestr k)
             fabs(pivotElt)>EPSILON)
         {
             i = j;
+            freeRow = true;
             break;
         }
 
@@ -308,6 +366,11 @@ TVar goblinLPSolver::QTestDual(TRestr k)
         }
     }
 
+    if (CT.methLPQTest==int(BOUND_FLIPPING) && i!=NoVar && !freeRow)
+    {
+        i = BoundFlippingTest(k,sign);
+    }
+
     sprintf(CT.logBuffer,"...Pivot variable is %ld",i);
     LogEntry(LOG_METH2,CT.logBuffer);
 
@@ -317,6 +380,117 @@ TVar goblinLPSolver::QTestDual(TRestr k)
 }
 
 
+TVar goblinLPSolver::BoundFlippingTest(TRestr k,short sign)
+    throw()
+{
+    // The dual step length is increased beyond the first breakpoints as long
+    // as the primal infeasibility of row k is not compensated. Every basic
+    // restriction which is passed this way, is moved to its opposite bound
+
+    TFloat slope = (sign==1) ? -Slack(k,LOWER) : -Slack(k,UPPER);
+
+    TVar* candidate = new TVar[lAct];
+    TFloat* ratio = new TFloat[lAct];
+    TVar nCandidates = 0;
+
+    for (TVar j=0;j<lAct;j++)
+    {
+        TRestr ind = Index(j);
+
+        if (LBound(ind)>=UBound(ind)) continue;
+
+        TFloat pivotElt = sign*pivotAlpha[j];
+
+        if (   (pivotElt>EPSILON && RestrType(ind)==BASIC_LB)
+            || (pivotElt< -EPSILON && RestrType(ind)==BASIC_UB)
+           )
+        {
+            candidate[nCandidates] = j;
+            ratio[nCandidates] = Y(ind,TLowerUpper(RestrType(ind)))/pivotElt;
+            nCandidates++;
+        }
+    }
+
+    TVar i = NoVar;
+    TVar nFlips = 0;
+
+    for (TVar j=0;j<lAct;j++) workVec[j] = 0;
+
+    while (nCandidates>0)
+    {
+        // Select the next breakpoint. Ties are broken by the pivot size
+
+        TVar m = 0;
+
+        for (TVar l=1;l<nCandidates;l++)
+        {
+            if (   ratio[l]<ratio[m]
+                || (   ratio[l]==ratio[m]
+                    && fabs(pivotAlpha[candidate[l]])>fabs(pivotAlpha[candidate[m]]))
+               )
+            {
+                m = l;
+            }
+        }
+
+        TVar j = candidate[m];
+        TRestr ind = Index(j);
+
+        if (   nCandidates==1
+            || LBound(ind)== -InfFloat || UBound(ind)==InfFloat
+           )
+        {
+            i = j;
+            break;
+        }
+
+        slope -= fabs(pivotAlpha[j])*(UBound(ind)-LBound(ind));
+
+        if (slope<=TOLERANCE)
+        {
+            i = j;
+            break;
+        }
+
+        // Flip restriction ind and record the change of the basic right-hand side
+
+        if (RestrType(ind)==BASIC_LB)
+        {
+            SetRestrType(ind,UPPER);
+            workVec[j] = UBound(ind)-LBound(ind);
+        }
+        else
+        {
+            SetRestrType(ind,LOWER);
+            workVec[j] = LBound(ind)-UBound(ind);
+        }
+
+        nFlips++;
+        nCandidates--;
+        candidate[m] = candidate[nCandidates];
+        ratio[m] = ratio[nCandidates];
+    }
+
+    delete[] candidate;
+    delete[] ratio;
+
+    if (nFlips>0)
+    {
+        // The primal solution is updated by a single BTRAN. The dual
+        // solution is not affected
+
+        baseFactor -> BTran(workVec);
+
+        for (TVar j=0;j<lAct;j++) x[j] += workVec[j];
+
+        sprintf(CT.logBuffer,"...%lu bound flips",nFlips);
+        LogEntry(LOG_METH2,CT.logBuffer);
+    }
+
+    return i;
+}
+
+
 TFloat goblinLPSolver::SolveDual()
     throw() 
 {
@@ -331,6 +505,8 @@ TFloat goblinLPSolver::SolveDual()
     TFloat ret = InfFloat;
     unsigned long itCount = 0;
 
+    InitPricingWeights(true);
+
     while (CT.SolverRunning())
     {
         pivotRow = PriceDual();
@@ -368,11 +544,15 @@ TFloat goblinLPSolver::SolveDual()
 
         Trace(1);
 
+        UpdateDualWeights(pivotRow,pivotColumn);
+
         Pivot(Index(pivotColumn),pivotRow,pivotDir);
 
         itCount++;
     }
 
+    ReleasePricingWeights();
+
     if (CT.logMeth==1)
     {
         sprintf(CT.logBuffer,"%ld pivots in total",itCount);
@@ -385,6 +565,184 @@ TFloat goblinLPSolver::SolveDual()
 }
 
 
+//****************************************************************************//
+//                         Devex and steepest edge                            //
+//****************************************************************************//
+
+
+void goblinLPSolver::InitPricingWeights(bool dualMethod)
+    throw()
+{
+    ReleasePricingWeights();
+
+    if (   CT.methLPPricing!=int(DEVEX)
+        && CT.methLPPricing!=int(STEEPEST_EDGE)
+       )
+    {
+        return;
+    }
+
+    // Primal weights are indexed by the basis positions, dual weights by the
+    // restrictions. Devex starts with the current basis as reference framework
+
+    refWeight = new TFloat[kAct+lAct];
+
+    for (TRestr i=0;i<kAct+lAct;i++) refWeight[i] = 1;
+
+    if (!dualMethod || CT.methLPPricing!=int(STEEPEST_EDGE)) return;
+
+    // The dual steepest edge weight of a non-basic restriction is the squared
+    // norm of its tableau column. For the initial basis, this is the squared
+    // norm of the restriction row
+
+    if (!dataValid) EvaluateBasis();
+
+    if (rowFirst==NULL) CompressRows();
+
+    for (TRestr i=0;i<kAct+lAct;i++)
+    {
+        if (RestrType(i)==BASIC_LB || RestrType(i)==BASIC_UB) continue;
+
+        TFloat norm = 0;
+
+        if (baseInitial && i<kAct)
+        {
+            for (TIndex q=rowFirst[i];q<rowFirst[i+1];q++)
+                norm += rowCoeff[q]*rowCoeff[q];
+        }
+        else
+        {
+            RestrFTran(i,workVec);
+
+            for (TVar j=0;j<lAct;j++) norm += workVec[j]*workVec[j];
+        }
+
+        if (norm>TOLERANCE) refWeight[i] = norm;
+    }
+}
+
+
+void goblinLPSolver::ReleasePricingWeights()
+    throw()
+{
+    delete[] refWeight;
+    refWeight = NULL;
+}
+
+
+void goblinLPSolver::UpdatePrimalWeights(TRestr r,TVar p)
+    throw()
+{
+    // Devex update for entering row r and leaving basis position p
+
+    if (!refWeight) return;
+
+    RestrFTran(r,pivotAlpha);
+
+    TFloat alphaP = pivotAlpha[p];
+    TFloat weightP = refWeight[p];
+
+    if (fabs(alphaP)<EPSILON) return;
+
+    for (TVar i=0;i<lAct;i++)
+    {
+        if (i==p || pivotAlpha[i]==0) continue;
+
+        TFloat theta = pivotAlpha[i]/alphaP;
+
+        if (theta*theta*weightP>refWeight[i]) refWeight[i] = theta*theta*weightP;
+    }
+
+    refWeight[p] = weightP/(alphaP*alphaP);
+
+    if (refWeight[p]<1) refWeight[p] = 1;
+}
+
+
+void goblinLPSolver::UpdateDualWeights(TRestr r,TVar p)
+    throw()
+{
+    // Update for entering row r and leaving basis position p. The tableau
+    // column of r has been computed by QTestDual() and is kept in pivotAlpha
+
+    if (!refWeight) return;
+
+    TRestr q = Index(p);
+    TFloat alphaP = pivotAlpha[p];
+    TFloat weightR = refWeight[r];
+    bool steepestEdge = (CT.methLPPricing==int(STEEPEST_EDGE));
+
+    if (fabs(alphaP)<EPSILON) return;
+
+    TFloat alphaNorm = 0;
+
+    for (TVar j=0;j<lAct;j++) alphaNorm += pivotAlpha[j]*pivotAlpha[j];
+
+    if (steepestEdge)
+    {
+        // workVec is the BTRAN of the tableau column of r. Its inner product
+        // with a restriction row yields the inner product of the tableau columns
+
+        for (TVar j=0;j<lAct;j++) workVec[j] = pivotAlpha[j];
+
+        baseFactor -> BTran(workVec);
+
+        if (rowFirst==NULL) CompressRows();
+    }
+
+    for (TRestr k=0;k<kAct+lAct;k++)
+    {
+        if (k==r || RestrType(k)==BASIC_LB || RestrType(k)==BASIC_UB) continue;
+
+        // The tableau column of k has the entry rho at position p
+
+        TFloat rho = Tableau(q,k);
+
+        if (rho==0) continue;
+
+        TFloat theta = rho/alphaP;
+
+        if (!steepestEdge)
+        {
+            if (theta*theta*weightR>refWeight[k]) refWeight[k] = theta*theta*weightR;
+
+            continue;
+        }
+
+        TFloat kappa = 0;
+
+        if (k<kAct)
+        {
+            for (TIndex l=rowFirst[k];l<rowFirst[k+1];l++)
+                kappa += rowCoeff[l]*workVec[rowVar[l]];
+        }
+        else kappa = workVec[k-kAct];
+
+        TFloat weight = refWeight[k]-2*theta*(kappa-rho)
+                        +theta*theta*(alphaNorm-2*alphaP+1);
+
+        // The tableau column of k has the entry theta after the pivot
+
+        if (weight<theta*theta) weight = theta*theta;
+
+        refWeight[k] = weight;
+    }
+
+    // Weight of the leaving restriction
+
+    if (steepestEdge)
+    {
+        refWeight[q] = (alphaNorm-alphaP*alphaP+1)/(alphaP*alphaP);
+    }
+    else
+    {
+        refWeight[q] = weightR/(alphaP*alphaP);
+
+        if (refWeight[q]<1) refWeight[q] = 1;
+    }
+}
+
+
 //****************************************************************************//
 //                            Primal Phase I                                  //
 //****************************************************************************//
@@ -421,25 +779,55 @@ void goblinLPSolver::DuallyFeasibleBasis() throw()
     {
         EvaluateBasis(); // Remove this later
 
+        // A basic restriction with a wrong-signed reduced cost is moved to
+        // its opposite bound. If this bound is infinite, the cost vector is
+        // shifted by a multiple of the restriction row instead, so that the
+        // reduced cost becomes zero and the other reduced costs are preserved
+
+        TFloat* redCost = new TFloat[lAct];
+
         for (TVar j=0;j<lAct;j++)
         {
             TRestr i = Index(j);
-            TFloat c = Y(j,TLowerUpper(RestrType(i)));
+            redCost[j] = Y(i,TLowerUpper(RestrType(i)));
+        }
+
+        if (rowFirst==NULL) CompressRows();
 
-            if (RestrType(i)==BASIC_UB && c>0)
+        for (TVar j=0;j<lAct;j++)
+        {
+            TRestr i = Index(j);
+            TFloat c = redCost[j];
+
+            if (   (RestrType(i)==BASIC_UB && c<=0)
+                || (RestrType(i)==BASIC_LB && c>=0)
+               )
             {
-                SetRestrType(i,LOWER);
-                SetCost(j,Cost(j)+c);
+                continue;
             }
 
-            if (RestrType(i)==BASIC_LB && c<0)
+            if (RestrType(i)==BASIC_UB && LBound(i)> -InfFloat)
+            {
+                SetRestrType(i,LOWER);
+            }
+            else if (RestrType(i)==BASIC_LB && UBound(i)<InfFloat)
             {
                 SetRestrType(i,UPPER);
-                SetCost(j,Cost(j)-c);
             }
-
-            dataValid = true;
+            else if (i>=kAct)
+            {
+                SetCost(i-kAct,Cost(i-kAct)-c);
+            }
+            else
+            {
+                for (TIndex q=rowFirst[i];q<rowFirst[i+1];q++)
+                    SetCost(rowVar[q],Cost(rowVar[q])-c*rowCoeff[q]);
+            }
         }
+
+        delete[] redCost;
+
+        dataValid = false;
     }
 }
 
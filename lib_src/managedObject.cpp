@@ -65,7 +65,7 @@ char* managedObject::Display() const throw(ERFile,ERRejected)
 void managedObject::NoSuchNode(char* methodName,TNode v) const throw(ERRange)
 {
     if (v==NoNode) sprintf(CT.logBuffer,"Undefined node");
-    else sprintf(CT.logBuffer,"No such node: %ld",v);
+    else sprintf(CT.logBuffer,"No such node: %ld",(unsigned long)v);
 
     CT.Error(ERR_RANGE,OH,methodName,CT.logBuffer);
 }
@@ -73,7 +73,7 @@ void managedObject::NoSuchNode(char* methodName,TNode v) const throw(ERRange)
 
 void managedObject::NoMoreArcs(char* methodName,TNode v) const throw(ERRejected)
 {
-    sprintf(CT.logBuffer,"No more arcs: %ld",v);
+    sprintf(CT.logBuffer,"No more arcs: %ld",(unsigned long)v);
 
     CT.Error(ERR_REJECTED,OH,methodName,CT.logBuffer);
 }
@@ -82,7 +82,7 @@ void managedObject::NoMoreArcs(char* methodName,TNode v) const throw(ERRejected)
 void managedObject::NoSuchArc(char* methodName,TArc a) const throw(ERRange)
 {
     if (a==NoArc) sprintf(CT.logBuffer,"Undefined arc");
-    else sprintf(CT.logBuffer,"No such arc: %ld",a);
+    else sprintf(CT.logBuffer,"No such arc: %ld",(unsigned long)a);
 
     CT.Error(ERR_RANGE,OH,methodName,CT.logBuffer);
 }
@@ -90,7 +90,7 @@ void managedObject::NoSuchArc(char* methodName,TArc a) const throw(ERRange)
 
 void managedObject::CancelledArc(char* methodName,TArc a) const throw(ERRejected)
 {
-    sprintf(CT.logBuffer,"Cancelled arc: %ld",a);
+    sprintf(CT.logBuffer,"Cancelled arc: %ld",(unsigned long)a);
 
     CT.Error(ERR_RANGE,OH,methodName,CT.logBuffer);
 }
@@ -113,6 +113,14 @@ void managedObject::NoSuchItem(char* methodName,unsigned long i) const throw(ERR
 }
 
 
+void managedObject::NoSuchItem(char* methodName,unsigned int i) const throw(ERRange)
+{
+    sprintf(CT.logBuffer,"No such item: %u",i);
+
+    CT.Error(ERR_RANGE,OH,methodName,CT.logBuffer);
+}
+
+
 void managedObject::NoSuchItem(char* methodName,unsigned short i) const throw(ERRange)
 {
     sprintf(CT.logBuffer,"No such item: %d",i);
@@ -129,6 +137,14 @@ void managedObject::NoSuchIndex(char* methodName,unsigned long i) const throw(ER
 }
 
 
+void managedObject::NoSuchIndex(char* methodName,unsigned int i) const throw(ERRange)
+{
+    sprintf(CT.logBuffer,"No such index: %u",i);
+
+    CT.Error(ERR_RANGE,OH,methodName,CT.logBuffer);
+}
+
+
 void managedObject::NoSuchIndex(char* methodName,unsigned short i) const throw(ERRange)
 {
     sprintf(CT.logBuffer,"No such index: %d",i);
@@ -209,6 +225,8 @@ void managedObject::SetLabel(const char* l) throw()
 void managedObject::OpenFold(const TModule mod,const TOption opt)
     const throw(ERRejected)
 {
+    if (CT.WorkerThread()) return;
+
     CT.OpenFold(mod,opt);
 
     #if defined(_TIMERS_)
@@ -222,6 +240,8 @@ void managedObject::OpenFold(const TModule mod,const TOption opt)
 void managedObject::CloseFold(const TModule mod,const TOption opt)
     const throw(ERRejected)
 {
+    if (CT.WorkerThread()) return;
+
     #if defined(_TIMERS_)
 
     goblinTimer* TM = CT.globalTimer[listOfModules[mod].moduleTimer];
@@ -248,6 +268,19 @@ void managedObject::CloseFold(const TModule mod,const TOption opt)
             LogEntry(LOG_TIMERS,CT.logBuffer);
         }
 
+        for (unsigned i=0;i<goblinTimer::NoCounter;i++)
+        {
+            unsigned long thisCounter =
+                TM->Counter(goblinTimer::TOperationCounter(i));
+
+            if (thisCounter>0)
+            {
+                sprintf(CT.logBuffer,"%-15s : %9lu",
+                    goblinTimer::counterName[i],thisCounter);
+                LogEntry(LOG_TIMERS,CT.logBuffer);
+            }
+        }
+
         if (TM->FullInfo())
         {
             for (unsigned i=0;i<NoTimer;i++)
@@ -301,6 +334,8 @@ void managedObject::SetBounds(const TTimer tm,const TFloat lBound,
 {
     #if defined(_TIMERS_)
 
+    if (CT.WorkerThread()) return;
+
     #if defined(_FAILSAVE_)
 
     if (uBound<CT.globalTimer[tm]->LowerBound()-CT.epsilon)
@@ -348,18 +383,17 @@ void managedObject::SetBounds(const TTimer tm,const TFloat lBound,
         {
             if (CT.globalTimer[tm]->UpperBound()<InfFloat)
             {
-                sprintf(CT.logBuffer,"%s,%.3f]",
-                    CT.logBuffer,
+                sprintf(CT.logBuffer+strlen(CT.logBuffer),",%.3f]",
                     CT.globalTimer[tm]->UpperBound());
             }
             else
             {
-                sprintf(CT.logBuffer,"%s,infinity]",CT.logBuffer);
+                sprintf(CT.logBuffer+strlen(CT.logBuffer),",infinity]");
             }
         }
         else
         {
-            sprintf(CT.logBuffer,"%s,-infinity]",CT.logBuffer);
+            sprintf(CT.logBuffer+strlen(CT.logBuffer),",-infinity]");
         }
 
         LogEntry(LOG_GAPS,CT.logBuffer);
@@ -373,6 +407,8 @@ void managedObject::ResetBounds(const TTimer tm,const TFloat _lower,const TFloat
 {
     #if defined(_TIMERS_)
 
+    if (CT.WorkerThread()) return;
+
     CT.globalTimer[tm]->ResetBounds(_lower,_upper);
 
     #endif
@@ -38,10 +38,18 @@ mixedGraph::mixedGraph(const char* fileName,goblinController& _CT)
     LogEntry(LOG_IO,"Loading mixed graph...");
     if (!CT.logIO && CT.logMem) LogEntry(LOG_MEM,"Loading mixed graph...");
 
-    goblinImport F(fileName,CT);
-
-    F.Scan("mixed");
-    ReadAllData(F);
+    if (goblinBinaryImport::IsBinaryFile(fileName))
+    {
+        goblinBinaryImport F(fileName,CT);
+        F.CheckObjectClass("mixed");
+        ReadBinary(F);
+    }
+    else
+    {
+        goblinImport F(fileName,CT);
+        F.Scan("mixed");
+        ReadAllData(F);
+    }
 
     if (CT.sourceNode<n) SetSourceNode(CT.sourceNode);
     else SetSourceNode(NoNode);
@@ -73,7 +81,7 @@ mixedGraph::mixedGraph(abstractMixedGraph& G,TOption options) throw() :
 {
     X.SetCapacity(G.N(),2*G.M());
 
-    TIndex* originalArc = (options & OPT_MAPPINGS) ? new TArc[2*G.M()] : NULL;
+    TIndex* originalArc = (options & OPT_MAPPINGS) ? new TIndex[2*G.M()] : NULL;
 
     for (TNode u=0;u<n;u++)
     {
@@ -238,8 +246,8 @@ inducedSubgraph::inducedSubgraph(abstractMixedGraph& G,
 {
     X.SetCapacity(G.N(),G.M());
 
-    TIndex* originalNode = (options & OPT_MAPPINGS) ? new TNode[G.N()] : NULL;
-    TIndex* originalArc  = (options & OPT_MAPPINGS) ? new TArc[G.M()]  : NULL;
+    TIndex* originalNode = (options & OPT_MAPPINGS) ? new TIndex[G.N()] : NULL;
+    TIndex* originalArc  = (options & OPT_MAPPINGS) ? new TIndex[G.M()]  : NULL;
 
     TNode* mapNodes = new TNode[G.N()];
     for (TNode v=0;v<G.N();v++) mapNodes[v] = NoNode;
@@ -361,8 +369,8 @@ inducedSubgraph::inducedSubgraph(abstractMixedGraph& G,
 {
     X.SetCapacity(G.N(),G.M());
 
-    TIndex* originalNode = (options & OPT_MAPPINGS) ? new TNode[G.N()] : NULL;
-    TIndex* originalArc  = (options & OPT_MAPPINGS) ? new TArc[G.M()]  : NULL;
+    TIndex* originalNode = (options & OPT_MAPPINGS) ? new TIndex[G.N()] : NULL;
+    TIndex* originalArc  = (options & OPT_MAPPINGS) ? new TIndex[G.M()]  : NULL;
 
     TNode* mapNodes = new TNode[G.N()];
     for (TNode v=0;v<G.N();v++) mapNodes[v] = NoNode;
@@ -670,8 +678,8 @@ explicitSubdivision::explicitSubdivision(abstractMixedGraph& G,const TOption opt
 {
     X.SetCapacity(G.N()+G.NI(),G.M()+G.NI());
 
-    TIndex* originalNode = (options & OPT_MAPPINGS) ? new TNode[G.N()+G.NI()] : NULL;
-    TIndex* originalArc  = (options & OPT_MAPPINGS) ? new TArc[G.M()+G.NI()]  : NULL;
+    TIndex* originalNode = (options & OPT_MAPPINGS) ? new TIndex[G.N()+G.NI()] : NULL;
+    TIndex* originalArc  = (options & OPT_MAPPINGS) ? new TIndex[G.M()+G.NI()]  : NULL;
 
     for (TNode v=0;v<G.N();v++)
     {
@@ -111,7 +111,7 @@ nestedFamily<TItem>::~nestedFamily() throw()
 }
 
 
-static THandle LH = NoHandle;
+static __thread THandle LH;
  
 template <class TItem>
 char* nestedFamily<TItem>::Display() const throw()
@@ -171,12 +171,12 @@ void nestedFamily<TItem>::Display(TItem v) const throw(ERRange)
 {
     if (v<n)
     {
-        sprintf(this->CT.logBuffer,"%ld",v);
+        sprintf(this->CT.logBuffer,"%ld",(unsigned long)v);
         this -> LogAppend(LH,this->CT.logBuffer);
     }
     else
     {
-        sprintf(this->CT.logBuffer,"(%ld",v);
+        sprintf(this->CT.logBuffer,"(%ld",(unsigned long)v);
         this -> LogAppend(LH,this->CT.logBuffer);
 
         TNode u = UNDEFINED;
@@ -204,7 +204,7 @@ void nestedFamily<TItem>::Bud(TItem v) throw(ERRange,ERRejected)
 
     if (B[v]!=UNDEFINED)
     {
-        sprintf(this->CT.logBuffer,"Already present: %ld",v);
+        sprintf(this->CT.logBuffer,"Already present: %ld",(unsigned long)v);
         Error(ERR_REJECTED,"Bud",this->CT.logBuffer);
     }
 
@@ -282,25 +282,25 @@ void nestedFamily<TItem>::Merge(TItem s,TItem v) throw(ERRange,ERRejected)
 
     if (s<n || s>=n+m)
     {
-        sprintf(this->CT.logBuffer,"Not a set: %ld",s);
+        sprintf(this->CT.logBuffer,"Not a set: %ld",(unsigned long)s);
         Error(ERR_RANGE,"Merge",this->CT.logBuffer);
     }
 
     if (canonical[s-n]!=UNDEFINED)
     {
-        sprintf(this->CT.logBuffer,"Set is already fixed: %ld",s);
+        sprintf(this->CT.logBuffer,"Set is already fixed: %ld",(unsigned long)s);
         Error(ERR_REJECTED,"Merge",this->CT.logBuffer);
     }
 
     if (v>=n && canonical[v-n]==UNDEFINED)
     {
-        sprintf(this->CT.logBuffer,"Item has not been fixed: %ld",v);
+        sprintf(this->CT.logBuffer,"Item has not been fixed: %ld",(unsigned long)v);
         Error(ERR_REJECTED,"Merge",this->CT.logBuffer);
     }
 
     if (!Top(v))
     {
-        sprintf(this->CT.logBuffer,"Item is already shrunk: %ld",v);
+        sprintf(this->CT.logBuffer,"Item is already shrunk: %ld",(unsigned long)v);
         Error(ERR_REJECTED,"Merge",this->CT.logBuffer);
     }
 
@@ -354,19 +354,19 @@ void nestedFamily<TItem>::FixSet(TItem s) throw(ERRange,ERRejected)
 
     if (s<n || s>=n+m)
     {
-        sprintf(this->CT.logBuffer,"Not a set: %ld",s);
+        sprintf(this->CT.logBuffer,"Not a set: %ld",(unsigned long)s);
         Error(ERR_RANGE,"FixSet",this->CT.logBuffer);
     }
 
     if (canonical[s-n]!=UNDEFINED)
     {
-        sprintf(this->CT.logBuffer,"Set is already fixed: %ld",s);
+        sprintf(this->CT.logBuffer,"Set is already fixed: %ld",(unsigned long)s);
         Error(ERR_REJECTED,"FixSet",this->CT.logBuffer);
     }
 
     if (first[s-n]==UNDEFINED)
     {
-        sprintf(this->CT.logBuffer,"Set is empty: %ld",s);
+        sprintf(this->CT.logBuffer,"Set is empty: %ld",(unsigned long)s);
         Error(ERR_REJECTED,"FixSet",this->CT.logBuffer);
     }
 
@@ -406,7 +406,7 @@ bool nestedFamily<TItem>::Top(TItem v) const throw(ERRange)
 
         if (this->CT.logMeth>1 && this->CT.logWarn)
         {
-            sprintf(this->CT.logBuffer,"No such item: %ld",v);
+            sprintf(this->CT.logBuffer,"No such item: %ld",(unsigned long)v);
             Error(MSG_WARN,"Top",this->CT.logBuffer);
         }
 
@@ -434,7 +434,7 @@ TItem nestedFamily<TItem>::Find(TItem v) const throw(ERRange)
 
         if (this->CT.logMeth>1 && this->CT.logWarn)
         {
-            sprintf(this->CT.logBuffer,"No such item: %ld",v);
+            sprintf(this->CT.logBuffer,"No such item: %ld",(unsigned long)v);
             Error(MSG_WARN,"Find",this->CT.logBuffer);
         }
 
@@ -479,7 +479,7 @@ TItem nestedFamily<TItem>::Set(TItem v) const throw(ERRange)
 
         if (this->CT.logMeth>1 && this->CT.logWarn)
         {
-            sprintf(this->CT.logBuffer,"No such item: %ld",v);
+            sprintf(this->CT.logBuffer,"No such item: %ld",(unsigned long)v);
             Error(MSG_WARN,"Set",this->CT.logBuffer);
         }
 
@@ -499,7 +499,7 @@ TItem nestedFamily<TItem>::First(TItem v) const throw(ERRange)
 
     if (v>=n+m || v<n)
     {
-        sprintf(this->CT.logBuffer,"Not a set: %ld",v);
+        sprintf(this->CT.logBuffer,"Not a set: %ld",(unsigned long)v);
         Error(ERR_RANGE,"First",this->CT.logBuffer);
     }
 
@@ -511,7 +511,7 @@ TItem nestedFamily<TItem>::First(TItem v) const throw(ERRange)
 
         if (this->CT.logMeth>1 && this->CT.logWarn)
         {
-            sprintf(this->CT.logBuffer,"No such item: %ld",v);
+            sprintf(this->CT.logBuffer,"No such item: %ld",(unsigned long)v);
             Error(MSG_WARN,"First",this->CT.logBuffer);
         }
 
@@ -526,7 +526,7 @@ TItem nestedFamily<TItem>::First(TItem v) const throw(ERRange)
 
         if (this->CT.logMeth>1 && this->CT.logWarn)
         {
-            sprintf(this->CT.logBuffer,"Empty set: %ld",v);
+            sprintf(this->CT.logBuffer,"Empty set: %ld",(unsigned long)v);
             Error(MSG_WARN,"First",this->CT.logBuffer);
         }
 
@@ -548,13 +548,13 @@ TItem nestedFamily<TItem>::Next(TItem v) const throw(ERRange,ERRejected)
 
     if (B[v]==UNDEFINED)
     {
-        sprintf(this->CT.logBuffer,"No such item: %ld",v);
+        sprintf(this->CT.logBuffer,"No such item: %ld",(unsigned long)v);
         Error(ERR_REJECTED,"Next",this->CT.logBuffer);
     }
 
     if (next[v]==UNDEFINED)
     {
-        sprintf(this->CT.logBuffer,"Toplevel item: %ld",v);
+        sprintf(this->CT.logBuffer,"Toplevel item: %ld",(unsigned long)v);
         Error(ERR_REJECTED,"Next",this->CT.logBuffer);
     }
 
@@ -571,7 +571,7 @@ void nestedFamily<TItem>::Adjust(TItem s,TItem b) const throw(ERRange)
 
     if (s>=n+m || s<n)
     {
-        sprintf(this->CT.logBuffer,"Not a set: %ld",s);
+        sprintf(this->CT.logBuffer,"Not a set: %ld",(unsigned long)s);
         Error(ERR_RANGE,"Adjust",this->CT.logBuffer);
     }
 
@@ -611,13 +611,13 @@ void nestedFamily<TItem>::Split(TItem s) throw(ERRange,ERRejected)
 
     if (s>=n+m || s<n || B[s]==UNDEFINED)
     {
-        sprintf(this->CT.logBuffer,"Not a set: %ld",s);
+        sprintf(this->CT.logBuffer,"Not a set: %ld",(unsigned long)s);
         Error(ERR_RANGE,"Split",this->CT.logBuffer);
     }
 
     if (first[s-n]==UNDEFINED)
     {
-        sprintf(this->CT.logBuffer,"Empty set: %ld",s);
+        sprintf(this->CT.logBuffer,"Empty set: %ld",(unsigned long)s);
         Error(ERR_REJECTED,"Split",this->CT.logBuffer);
     }
 
@@ -625,13 +625,13 @@ void nestedFamily<TItem>::Split(TItem s) throw(ERRange,ERRejected)
 
     if (set[u]!=s)
     {
-        sprintf(this->CT.logBuffer,"Not a toplevel set: %ld",s);
+        sprintf(this->CT.logBuffer,"Not a toplevel set: %ld",(unsigned long)s);
         Error(ERR_REJECTED,"Split",this->CT.logBuffer);
     }
 
     if (canonical[s-n]==UNDEFINED)
     {
-        sprintf(this->CT.logBuffer,"Set has not been fixed: %ld",s);
+        sprintf(this->CT.logBuffer,"Set has not been fixed: %ld",(unsigned long)s);
         Error(ERR_REJECTED,"Split",this->CT.logBuffer);
     }
 
@@ -688,7 +688,7 @@ void nestedFamily<TItem>::Block(TItem v) const throw(ERRange,ERRejected)
 
     if (B[v]==UNDEFINED)
     {
-        sprintf(this->CT.logBuffer,"No such item: %ld",v);
+        sprintf(this->CT.logBuffer,"No such item: %ld",(unsigned long)v);
         Error(ERR_REJECTED,"Block",this->CT.logBuffer);
     }
 
@@ -740,7 +740,7 @@ void nestedFamily<TItem>::UnBlock(TItem v) const throw(ERRange,ERRejected)
 
     if (B[v]==UNDEFINED)
     {
-        sprintf(this->CT.logBuffer,"No such item: %ld",v);
+        sprintf(this->CT.logBuffer,"No such item: %ld",(unsigned long)v);
         Error(ERR_REJECTED,"UnBlock",this->CT.logBuffer);
     }
 
@@ -44,6 +44,37 @@ networkSimplex::networkSimplex(abstractDiGraph& GC) throw() :
     hotList  = new TArc[j+k];
     swapList = new TArc[j+k];
 
+    blockSize = TArc(sqrt(double(m)));
+    if (blockSize<10) blockSize = 10;
+
+    headLength = blockSize/100;
+    if (headLength<3) headLength = 3;
+
+    nextArc = 0;
+    nCand = 0;
+
+    candList = new TArc[headLength+blockSize];
+    candCost = new TFloat[headLength+blockSize];
+
+    // Copy the arc data which is accessed during pricing and ratio tests
+
+    tail   = new TNode[m];
+    head   = new TNode[m];
+    cost   = new TFloat[m];
+    resCap = new TFloat[2*m];
+
+    for (TArc a=0;a<m;a++)
+    {
+        tail[a] = G.StartNode(2*a);
+        head[a] = G.EndNode(2*a);
+        cost[a] = G.Length(2*a);
+        resCap[2*a] = G.ResCap(2*a);
+        resCap[2*a+1] = G.ResCap(2*a+1);
+    }
+
+    cycleLeft  = new TArc[n];
+    cycleRight = new TArc[n];
+
     // Initialize tree indices
 
     thread = new TNode[n];
@@ -56,11 +87,62 @@ networkSimplex::~networkSimplex() throw()
     delete[] hotList;
     delete[] swapList;
 
+    delete[] candList;
+    delete[] candCost;
+
+    delete[] tail;
+    delete[] head;
+    delete[] cost;
+    delete[] resCap;
+
+    delete[] cycleLeft;
+    delete[] cycleRight;
+
     delete[] thread;
     delete[] depth;
 }
 
 
+inline TNode networkSimplex::Start(TArc a) const throw()
+{
+    return (a&1) ? head[a>>1] : tail[a>>1];
+}
+
+
+inline TFloat networkSimplex::RedCost(TArc a) const throw()
+{
+    TArc a2 = (a>>1);
+    TFloat thisCost = cost[a2]+piG[tail[a2]]-piG[head[a2]];
+
+    return (a&1) ? -thisCost : thisCost;
+}
+
+
+inline TArc networkSimplex::Admissible(TArc a,TFloat& redCost) const throw()
+{
+    // Return the direction of the arc a (ranged [0,1,..,m-1]) in which
+    // it qualifies for pivoting, if there is one
+
+    TFloat thisCost = cost[a]+piG[tail[a]]-piG[head[a]];
+
+    if (thisCost<0)
+    {
+        if (resCap[2*a]<=0) return NoArc;
+
+        redCost = thisCost;
+        return 2*a;
+    }
+
+    if (thisCost>0 && resCap[2*a+1]>0)
+    {
+        redCost = -thisCost;
+        return 2*a+1;
+    }
+
+    return NoArc;
+}
+
+
 TArc networkSimplex::PivotArc() throw()
 {
     #if defined(_TIMERS_)
@@ -77,31 +159,41 @@ TArc networkSimplex::PivotArc() throw()
 
     TArc pivotArc = NoArc;
 
-    switch (CT.methLPPricing)
+    switch (CT.methNWPricing)
     {
-        case 0:
+        case PARTIAL_PRICING:
         {
             pivotArc = PartialPricing();
             break;
         }
-        case 1:
+        case MULTIPLE_PARTIAL:
         {
             pivotArc = MultiplePartialPricing();
             break;
         }
-        case 2:
+        case DANTZIG:
         {
             pivotArc = DantzigPricing();
             break;
         }
-        case 3:
+        case FIRST_ELIGIBLE:
         {
             pivotArc = FirstEligiblePricing();
             break;
         }
+        case BLOCK_SEARCH:
+        {
+            pivotArc = BlockSearchPricing();
+            break;
+        }
+        case ALTERING_LIST:
+        {
+            pivotArc = AlteringListPricing();
+            break;
+        }
         default:
         {
-            UnknownOption("PivotArc",CT.methLPPricing);
+            UnknownOption("PivotArc",CT.methNWPricing);
         }
     }
 
@@ -110,7 +202,7 @@ TArc networkSimplex::PivotArc() throw()
         if (pivotArc!=NoArc)
         {
             sprintf(CT.logBuffer,"...Pivot arc is %ld = (%ld,%ld)",
-                pivotArc,G.StartNode(pivotArc),G.EndNode(pivotArc));
+                (unsigned long)pivotArc,(unsigned long)G.StartNode(pivotArc),(unsigned long)G.EndNode(pivotArc));
             LogEntry(LOG_RES2,CT.logBuffer);
         }
         else LogEntry(LOG_RES2,"...Reached optimality");
@@ -129,14 +221,17 @@ TArc networkSimplex::PivotArc() throw()
 TArc networkSimplex::DantzigPricing() throw()
 {
     TArc pivotArc = NoArc;
+    TFloat minCost = 0;
 
-    for (TArc a=0;a<2*m;a++)
+    for (TArc a=0;a<m;a++)
     {
-        if (G.ResCap(a)>0 && G.RedLength(piG,a)<0 &&
-            (pivotArc==NoArc || G.RedLength(piG,a)<G.RedLength(piG,pivotArc))
-           )
+        TFloat thisCost = 0;
+        TArc a2 = Admissible(a,thisCost);
+
+        if (a2!=NoArc && (pivotArc==NoArc || thisCost<minCost))
         {
-            pivotArc = a;
+            pivotArc = a2;
+            minCost = thisCost;
         }
     }
 
@@ -150,7 +245,7 @@ TArc networkSimplex::FirstEligiblePricing() throw()
     {
         TArc a = (nextList+i)%(2*m);
 
-        if (G.ResCap(a)>0 && G.RedLength(piG,a)<0)
+        if (resCap[a]>0 && RedCost(a)<0)
         {
             nextList = (nextList+i+1)%(2*m);
 
@@ -165,6 +260,7 @@ TArc networkSimplex::FirstEligiblePricing() throw()
 TArc networkSimplex::PartialPricing() throw()
 {
     TArc pivotArc = NoArc;
+    TFloat minCost = 0;
 
     // Delete all arcs from hotList which are not admissible any longer
 
@@ -174,13 +270,20 @@ TArc networkSimplex::PartialPricing() throw()
     {
         TArc a = hotList[i];
 
-        if (G.ResCap(a)>0 && G.RedLength(piG,a)<0)
+        if (resCap[a]<=0) continue;
+
+        TFloat thisCost = RedCost(a);
+
+        if (thisCost<0)
         {
             swapList[lNext] = hotList[i];
             lNext++;
 
-            if (pivotArc==NoArc || G.RedLength(piG,a)<G.RedLength(piG,pivotArc))
+            if (pivotArc==NoArc || thisCost<minCost)
+            {
                 pivotArc = a;
+                minCost = thisCost;
+            }
         }
     }
 
@@ -202,19 +305,26 @@ TArc networkSimplex::PartialPricing() throw()
         {
             a = (nextList+i)%(2*m);
 
-            if (G.ResCap(a)>0 && G.RedLength(piG,a)<0)
+            if (resCap[a]<=0) continue;
+
+            TFloat thisCost = RedCost(a);
+
+            if (thisCost<0)
             {
                 hotList[l++] = a;
 
-                if (pivotArc==NoArc || G.RedLength(piG,a)<G.RedLength(piG,pivotArc))
+                if (pivotArc==NoArc || thisCost<minCost)
+                {
                     pivotArc = a;
+                    minCost = thisCost;
+                }
             }
         }
 
         if (l<j+k)
-            sprintf(CT.logBuffer,"...%ld candidates found",l);
+            sprintf(CT.logBuffer,"...%ld candidates found",(unsigned long)l);
         else
-            sprintf(CT.logBuffer,"...%ld arcs inspected",i);
+            sprintf(CT.logBuffer,"...%ld arcs inspected",(unsigned long)i);
 
         LogEntry(LOG_MEM,CT.logBuffer);
 
@@ -228,6 +338,7 @@ TArc networkSimplex::PartialPricing() throw()
 TArc networkSimplex::MultiplePartialPricing() throw()
 {
     TArc pivotArc = NoArc;
+    TFloat minCost = 0;
 
     // Delete all arcs from hotList which are not admissible any longer
 
@@ -235,17 +346,19 @@ TArc networkSimplex::MultiplePartialPricing() throw()
 
     for (TArc i=0;i<l;i++)
     {
-        TArc a = 2*hotList[i];
+        TFloat thisCost = 0;
+        TArc a = Admissible(hotList[i],thisCost);
 
-        if (G.RedLength(piG,a)>0) a++;
-
-        if (G.ResCap(a)>0 && G.RedLength(piG,a)<0)
+        if (a!=NoArc)
         {
             swapList[lNext] = hotList[i];
             lNext++;
 
-            if (pivotArc==NoArc || G.RedLength(piG,a)<G.RedLength(piG,pivotArc))
+            if (pivotArc==NoArc || thisCost<minCost)
+            {
                 pivotArc = a;
+                minCost = thisCost;
+            }
         }
     }
 
@@ -262,19 +375,23 @@ TArc networkSimplex::MultiplePartialPricing() throw()
     {
         for (TArc i=0;i<k;i++)
         {
-            TArc a = 2*(i*r+nextList);
+            TArc a2 = i*r+nextList;
 
-            if (a>=2*m) continue;
+            if (a2>=m) continue;
 
-            if (G.RedLength(piG,a)>0) a++;
+            TFloat thisCost = 0;
+            TArc a = Admissible(a2,thisCost);
 
-            if (G.ResCap(a)>0 && G.RedLength(piG,a)<0)
+            if (a!=NoArc)
             {
-                hotList[l] = i*r+nextList;
+                hotList[l] = a2;
                 l++;
 
-                if (pivotArc==NoArc || G.RedLength(piG,a)<G.RedLength(piG,pivotArc))
+                if (pivotArc==NoArc || thisCost<minCost)
+                {
                     pivotArc = a;
+                    minCost = thisCost;
+                }
             }
         }
 
@@ -287,6 +404,124 @@ TArc networkSimplex::MultiplePartialPricing() throw()
 }
 
 
+TArc networkSimplex::BlockSearchPricing() throw()
+{
+    TArc pivotArc = NoArc;
+    TFloat minCost = 0;
+    TArc a = nextArc;
+    TArc count = blockSize;
+
+    for (TArc i=0;i<m;i++)
+    {
+        TFloat thisCost = 0;
+        TArc a2 = Admissible(a,thisCost);
+
+        if (a2!=NoArc && (pivotArc==NoArc || thisCost<minCost))
+        {
+            pivotArc = a2;
+            minCost = thisCost;
+        }
+
+        if (++a==m) a = 0;
+
+        if (--count==0)
+        {
+            if (pivotArc!=NoArc) break;
+
+            count = blockSize;
+        }
+    }
+
+    nextArc = a;
+
+    return pivotArc;
+}
+
+
+TArc networkSimplex::AlteringListPricing() throw()
+{
+    // Recheck the candidates which have been kept from the previous call
+
+    for (TArc i=0;i<nCand;)
+    {
+        TFloat thisCost = 0;
+        TArc a = Admissible(candList[i]>>1,thisCost);
+
+        if (a!=NoArc)
+        {
+            candList[i] = a;
+            candCost[i] = thisCost;
+            i++;
+        }
+        else candList[i] = candList[--nCand];
+    }
+
+    // Extend the candidate list by block searches. The first block is
+    // required to add new candidates, the subsequent blocks are searched
+    // only if the candidate list is still empty
+
+    TArc a = nextArc;
+    TArc count = blockSize;
+    TArc limit = headLength;
+
+    for (TArc i=0;i<m;i++)
+    {
+        TFloat thisCost = 0;
+        TArc a2 = Admissible(a,thisCost);
+
+        if (a2!=NoArc)
+        {
+            candList[nCand] = a2;
+            candCost[nCand] = thisCost;
+            nCand++;
+        }
+
+        if (++a==m) a = 0;
+
+        if (--count==0)
+        {
+            if (nCand>limit) break;
+
+            limit = 0;
+            count = blockSize;
+        }
+    }
+
+    nextArc = a;
+
+    if (nCand==0) return NoArc;
+
+    // Move the best candidates to the head of the list
+
+    TArc newLength = (nCand<=headLength) ? nCand : headLength+1;
+
+    for (TArc i=0;i<newLength;i++)
+    {
+        TArc best = i;
+
+        for (TArc i2=i+1;i2<nCand;i2++)
+        {
+            if (candCost[i2]<candCost[best]) best = i2;
+        }
+
+        TArc swapArc = candList[i];
+        candList[i] = candList[best];
+        candList[best] = swapArc;
+
+        TFloat swapCost = candCost[i];
+        candCost[i] = candCost[best];
+        candCost[best] = swapCost;
+    }
+
+    TArc pivotArc = candList[0];
+
+    candList[0] = candList[newLength-1];
+    nCand = newLength-1;
+
+    return pivotArc;
+}
+
+
 void networkSimplex::InitThreadIndex() throw()
 {
     LogEntry(LOG_METH2,"Computing thread index...");
@@ -316,7 +551,7 @@ void networkSimplex::InitThreadIndex() throw()
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"  %ld",r);
+            sprintf(CT.logBuffer,"  %ld",(unsigned long)r);
             LogEntry(LOG_METH2,CT.logBuffer);
         }
 
@@ -341,7 +576,7 @@ void networkSimplex::InitThreadIndex() throw()
 
                     if (CT.logMeth>1)
                     {
-                        sprintf(CT.logBuffer,",%ld",v);
+                        sprintf(CT.logBuffer,",%ld",(unsigned long)v);
                         LogEntry(MSG_APPEND,CT.logBuffer);
                     }
 
@@ -389,7 +624,7 @@ void networkSimplex::ComputePotentials() throw()
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"%ld[0] ",r);
+            sprintf(CT.logBuffer,"%ld[0] ",(unsigned long)r);
             LogEntry(MSG_APPEND,CT.logBuffer);
         }
 
@@ -406,7 +641,7 @@ void networkSimplex::ComputePotentials() throw()
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"%ld[%g] ",v,piG[v]);
+                sprintf(CT.logBuffer,"%ld[%g] ",(unsigned long)v,piG[v]);
                 LogEntry(MSG_APPEND,CT.logBuffer);
             }
 
@@ -459,24 +694,29 @@ bool networkSimplex::PivotOperation(TArc pivot) throw()
 
     #endif
 
-    TNode u = G.StartNode(pivot);
-    TNode v = G.EndNode(pivot);
-    TFloat delta = G.ResCap(pivot);
+    TNode u = Start(pivot);
+    TNode v = Start(pivot^1);
+    TFloat delta = resCap[pivot];
+    TNode nLeft = 0;
+    TNode nRight = 0;
+
     while (v!=u && (depth[u]>0 || depth[v]>0))
     {
         if (depth[u]>depth[v])
         {
             TArc a = pred[u];
-            u = G.StartNode(a);
+            u = Start(a);
+            cycleLeft[nLeft++] = a;
 
-            if (G.ResCap(a)<delta) delta = G.ResCap(a);
+            if (resCap[a]<delta) delta = resCap[a];
         }
         else
         {
-            TArc a = pred[v];
-            v = G.StartNode(a);
+            TArc a = (pred[v]^1);
+            v = Start(a^1);
+            cycleRight[nRight++] = a;
 
-            if (G.ResCap(a^1)<delta) delta = G.ResCap(a^1);
+            if (resCap[a]<delta) delta = resCap[a];
         }
     }
 
@@ -497,45 +737,61 @@ bool networkSimplex::PivotOperation(TArc pivot) throw()
 
     #endif
 
-    u = G.StartNode(pivot);
-    v = G.EndNode(pivot);
+    // Traverse the cycle in the same order as before: The pivot arc, the
+    // path from its start node to the apex, the path from its end node to
+    // the apex. The graph object is updated only for non-degenerate pivots
+
     TArc leftCandidate = NoArc;
     TArc rightCandidate = NoArc;
     TNode nBlocking = 0;
-    G.Push(pivot,delta);
 
-    if (G.ResCap(pivot)==0)
+    if (delta>0)
+    {
+        G.Push(pivot,delta);
+        resCap[pivot] -= delta;
+        resCap[pivot^1] += delta;
+    }
+
+    if (resCap[pivot]==0)
     {
         nBlocking++;
         rightCandidate = pivot;
     }
 
-    while (v!=u && (depth[u]>0 || depth[v]>0))
+    for (TNode i=0;i<nLeft;i++)
     {
-        if (depth[u]>depth[v])
+        TArc a = cycleLeft[i];
+
+        if (delta>0)
         {
-            TArc a = pred[u];
-            u = G.StartNode(a);
             G.Push(a,delta);
+            resCap[a] -= delta;
+            resCap[a^1] += delta;
+        }
 
-            if (G.ResCap(a)==0)
-            {
-                nBlocking++;
+        if (resCap[a]==0)
+        {
+            nBlocking++;
 
-                if (leftCandidate==NoArc) leftCandidate = a;
-            }
+            if (leftCandidate==NoArc) leftCandidate = a;
         }
-        else
+    }
+
+    for (TNode i=0;i<nRight;i++)
+    {
+        TArc a = cycleRight[i];
+
+        if (delta>0)
         {
-            TArc a = pred[v];
-            v = G.StartNode(a);
-            G.Push(a^1,delta);
+            G.Push(a,delta);
+            resCap[a] -= delta;
+            resCap[a^1] += delta;
+        }
 
-            if (G.ResCap(a^1)==0)
-            {
-                nBlocking++;
-                rightCandidate = (a^1);
-            }
+        if (resCap[a]==0)
+        {
+            nBlocking++;
+            rightCandidate = a;
         }
     }
 
@@ -543,7 +799,7 @@ bool networkSimplex::PivotOperation(TArc pivot) throw()
 
     if (CT.logMeth>1)
     {
-        sprintf(CT.logBuffer,"...%ld blocking arcs found",nBlocking);
+        sprintf(CT.logBuffer,"...%ld blocking arcs found",(unsigned long)nBlocking);
         LogEntry(LOG_METH2,CT.logBuffer);
     }
 
@@ -561,7 +817,7 @@ bool networkSimplex::PivotOperation(TArc pivot) throw()
     TArc leaving = rightCandidate; // Arc omitted in the new base tree
     TNode r = NoNode;  // root node of the partial tree hanging from the pivot
     TNode fs = NoNode; // final node in the thread index of this partial tree
-    TFloat mu = G.RedLength(piG,pivot); // Change of potentials on this partial tree
+    TFloat mu = RedCost(pivot); // Change of potentials on this partial tree
 
     if (leaving!=NoArc)
     {
@@ -570,28 +826,29 @@ bool networkSimplex::PivotOperation(TArc pivot) throw()
         if (leaving!=pivot)
         {
             TArc a = (pivot^1);
-            r = v = G.EndNode(pivot);
+            r = v = Start(pivot^1);
             fs = UpdateThread(v,NoNode,NoNode);
 
             while (pred[v]!=(leaving^1))
             {
                 TArc a2 = pred[v];
                 pred[v] = (a^1);
-                v = G.StartNode(a2);
-                fs = UpdateThread(v,G.EndNode(a2),fs);
+                v = Start(a2);
+                fs = UpdateThread(v,Start(a2^1),fs);
                 a = a2;
             }
 
             pred[v] = (a^1);
 
-            TNode v = G.EndNode(leaving);
+            TNode v = Start(leaving^1);
+            TNode w = Start(leaving);
 
-            while (thread[v]!=G.StartNode(leaving)) v = thread[v];
+            while (thread[v]!=w) v = thread[v];
 
             thread[v] = thread[fs];
 
-            thread[fs] = thread[G.StartNode(pivot)];
-            thread[G.StartNode(pivot)] = G.EndNode(pivot);
+            thread[fs] = thread[Start(pivot)];
+            thread[Start(pivot)] = Start(pivot^1);
         }
     }
     else
@@ -599,36 +856,37 @@ bool networkSimplex::PivotOperation(TArc pivot) throw()
         leaving = leftCandidate;
 
         TArc a = pivot;
-        r = u = G.StartNode(pivot);
+        r = u = Start(pivot);
         fs = UpdateThread(u,NoNode,NoNode);
 
         while (pred[u]!=leaving)
         {
             TArc a2 = pred[u];
             pred[u] = (a^1);
-            u = G.StartNode(a2);
-            fs = UpdateThread(u,G.EndNode(a2),fs);
+            u = Start(a2);
+            fs = UpdateThread(u,Start(a2^1),fs);
             a = a2;
         }
 
         pred[u] = (a^1);
         mu *= -1;
 
-        TNode v = G.StartNode(leaving);
+        TNode v = Start(leaving);
+        TNode w = Start(leaving^1);
 
-        while (thread[v]!=G.EndNode(leaving)) v = thread[v];
+        while (thread[v]!=w) v = thread[v];
 
         thread[v] = thread[fs];
 
-        thread[fs] = thread[G.EndNode(pivot)];
-        thread[G.EndNode(pivot)] = G.StartNode(pivot);
+        thread[fs] = thread[Start(pivot^1)];
+        thread[Start(pivot^1)] = Start(pivot);
     }
 
     #if defined(_LOGGING_)
 
     if (CT.logRes>1 && leaving!=NoArc)
     {
-        sprintf(CT.logBuffer,"...Leaving arc is %ld",leaving);
+        sprintf(CT.logBuffer,"...Leaving arc is %ld",(unsigned long)leaving);
         LogEntry(LOG_RES2,CT.logBuffer);
         sprintf(CT.logBuffer,"...Primal improvement to %g",G.Weight());
         LogEntry(LOG_RES2,CT.logBuffer);
@@ -645,14 +903,14 @@ bool networkSimplex::PivotOperation(TArc pivot) throw()
         #endif
 
         piG[r] += mu;
-        depth[r] = depth[G.StartNode(pred[r])]+1;
+        depth[r] = depth[Start(pred[r])]+1;
 
         v = thread[r];
 
         while (v!=thread[fs])
         {
             piG[v] += mu;
-            depth[v] = depth[G.StartNode(pred[v])]+1;
+            depth[v] = depth[Start(pred[v])]+1;
 
             v = thread[v];
         }
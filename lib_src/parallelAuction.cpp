@@ -0,0 +1,546 @@
+
+//  This file forms part of the GOBLIN C++ Class Library.
+//
+//  Initially written by the GOBLIN developers, October 2026
+//
+//  Copying, compiling, distribution and modification
+//  of this source code is permitted only in accordance
+//  with the GOBLIN general licence information.
+
+/// \file   parallelAuction.cpp
+/// \brief  #parallelAuction class implementation
+
+#include "parallelAuction.h"
+
+
+// Rounds with less bidders times average degree are not split among
+// the worker threads, since the synchronization would dominate
+
+static const unsigned long minParallelWork = 16384;
+
+
+parallelAuction::parallelAuction(abstractBiGraph& GC)
+    throw(ERRejected) : managedObject(GC.Context()), G(GC)
+{
+    #if defined(_FAILSAVE_)
+
+    if (G.N1()!=G.N2())
+    {
+        Error(ERR_REJECTED,"parallelAuction",
+            "Numbers of left-hand and right-hand nodes differ");
+    }
+
+    #endif
+
+    n1 = G.N1();
+
+    X = G.FrozenIncidences();
+    localX = NULL;
+
+    if (!X)
+    {
+        localX = new csrRepresentation(G);
+        X = localX;
+    }
+
+    scale   = TFloat(n1+1);
+    alpha   = (CT.costScalingFactor>=2) ? CT.costScalingFactor : 2;
+    epsilon = 1;
+    range   = 0;
+
+    price       = new TFloat[n1];
+    profit      = new TFloat[n1];
+    assigned    = new TNode[n1];
+    assignedArc = new TArc[n1];
+    owner       = new TNode[n1];
+    bidder      = new TNode[n1];
+    nextBidder  = new TNode[n1];
+    freeObject  = new TNode[n1];
+    stacked     = new char[n1];
+    bidSlot     = new TArc[n1];
+    bidPrice    = new TFloat[n1];
+    bidProfit   = new TFloat[n1];
+    winner      = new TNode[n1];
+    bidRound    = new unsigned long[n1];
+
+    for (TNode i=0;i<n1;i++)
+    {
+        price[i]    = 0;
+        assigned[i] = NoNode;
+        owner[i]    = NoNode;
+        stacked[i]  = 0;
+        bidRound[i] = 0;
+    }
+
+    nAssigned = nBidders = nFreeObjects = 0;
+
+    priceBound = profitBound = InfFloat;
+    infeasible = false;
+
+    nThreads = CT.NumThreads();
+
+    if (nThreads>n1) nThreads = (n1>0) ? n1 : 1;
+
+    finished = false;
+
+    nRounds = nBids = nReverseBids = 0;
+
+    LogEntry(LOG_MEM,"...Auction data structures allocated");
+}
+
+
+parallelAuction::~parallelAuction() throw()
+{
+    delete[] price;
+    delete[] profit;
+    delete[] assigned;
+    delete[] assignedArc;
+    delete[] owner;
+    delete[] bidder;
+    delete[] nextBidder;
+    delete[] freeObject;
+    delete[] stacked;
+    delete[] bidSlot;
+    delete[] bidPrice;
+    delete[] bidProfit;
+    delete[] winner;
+    delete[] bidRound;
+
+    if (localX) delete localX;
+
+    LogEntry(LOG_MEM,"...Auction data structures disallocated");
+}
+
+
+unsigned long parallelAuction::Size() const throw()
+{
+    return
+          sizeof(parallelAuction)
+        + managedObject::Allocated()
+        + parallelAuction::Allocated();
+}
+
+
+unsigned long parallelAuction::Allocated() const throw()
+{
+    unsigned long tmpSize =
+          n1*(5*sizeof(TFloat)+7*sizeof(TNode)+2*sizeof(TArc))
+        + n1*(sizeof(char)+sizeof(unsigned long));
+
+    if (localX) tmpSize += localX->Size();
+
+    return tmpSize;
+}
+
+
+bool parallelAuction::Solve() throw()
+{
+    // Arc lengths are negated and scaled to benefits. Check that every
+    // person and every object has eligible arcs
+
+    TFloat minBenefit = InfFloat;
+    TFloat maxBenefit = -InfFloat;
+
+    for (TNode v=0;v<2*n1 && !infeasible;v++)
+    {
+        bool isolated = true;
+
+        for (TArc k=X->First(v);k<X->Stop(v);k++)
+        {
+            if (!X->Capacitated(k)) continue;
+
+            TFloat thisBenefit = -scale*X->Length(k);
+
+            if (thisBenefit<minBenefit) minBenefit = thisBenefit;
+            if (thisBenefit>maxBenefit) maxBenefit = thisBenefit;
+
+            isolated = false;
+        }
+
+        if (isolated) infeasible = true;
+    }
+
+    if (infeasible)
+    {
+        LogEntry(LOG_RES,"...Graph has isolated nodes");
+        return false;
+    }
+
+    range = maxBenefit-minBenefit;
+    epsilon = floor(range/alpha);
+
+    if (epsilon<1) epsilon = 1;
+
+    #if defined(_LOGGING_)
+
+    if (CT.logMeth)
+    {
+        sprintf(CT.logBuffer,"Initial epsilon = %g (scaled by %lu)",
+            epsilon,static_cast<unsigned long>(n1+1));
+        LogEntry(LOG_METH,CT.logBuffer);
+        sprintf(CT.logBuffer,"Starting %u worker threads...",nThreads);
+        LogEntry(LOG_METH,CT.logBuffer);
+    }
+
+    #endif
+
+    pthread_barrier_init(&barrier,NULL,nThreads);
+
+    pthread_t* threads = new pthread_t[nThreads];
+    TWorkerArg* args = new TWorkerArg[nThreads];
+
+    for (unsigned i=0;i<nThreads;i++)
+    {
+        args[i].P = this;
+        args[i].id = i;
+    }
+
+    for (unsigned i=1;i<nThreads;i++)
+    {
+        pthread_create(&threads[i],NULL,WorkerEntry,&args[i]);
+    }
+
+    bool complete = false;
+    unsigned long nPhases = 0;
+
+    while (true)
+    {
+        nPhases++;
+        complete = Phase();
+
+        if (!complete || epsilon<=1) break;
+
+        epsilon = floor(epsilon/alpha);
+
+        if (epsilon<1) epsilon = 1;
+    }
+
+    // Release the worker threads from their idle barrier
+    finished = true;
+    Barrier();
+
+    for (unsigned i=1;i<nThreads;i++) pthread_join(threads[i],NULL);
+
+    delete[] threads;
+    delete[] args;
+
+    pthread_barrier_destroy(&barrier);
+
+    if (CT.logRes>1)
+    {
+        sprintf(CT.logBuffer,
+            "...%lu phases, %lu rounds, %lu forward bids, %lu reverse bids",
+            nPhases,nRounds,nBids,nReverseBids);
+        LogEntry(LOG_RES2,CT.logBuffer);
+    }
+
+    if (!complete)
+    {
+        if (infeasible) LogEntry(LOG_RES,"...Graph does not have a perfect assignment");
+
+        return false;
+    }
+
+
+    // Write back the assignment
+
+    G.InitSubgraph();
+    TFloat weight = 0;
+
+    for (TNode i=0;i<n1;i++)
+    {
+        G.SetSub(assignedArc[i]&~TArc(1),1);
+        weight += G.Length(assignedArc[i]);
+    }
+
+    if (CT.logRes)
+    {
+        sprintf(CT.logBuffer,"...Perfect assignment of weight %g found",weight);
+        LogEntry(LOG_RES,CT.logBuffer);
+    }
+
+    return true;
+}
+
+
+void* parallelAuction::WorkerEntry(void* arg) throw()
+{
+    TWorkerArg* thisArg = static_cast<TWorkerArg*>(arg);
+    thisArg -> P -> Worker(thisArg->id);
+
+    return NULL;
+}
+
+
+void parallelAuction::Barrier() throw()
+{
+    pthread_barrier_wait(&barrier);
+}
+
+
+void parallelAuction::Worker(unsigned id) throw()
+{
+    while (true)
+    {
+        // Wait until the master thread has set up a round
+        Barrier();
+
+        if (finished) break;
+
+        TNode lo = TNode((nBidders*(unsigned long long)(id))/nThreads);
+        TNode hi = TNode((nBidders*(unsigned long long)(id+1))/nThreads);
+
+        ComputeBids(lo,hi);
+
+        Barrier();
+    }
+}
+
+
+bool parallelAuction::Phase() throw()
+{
+    // Start with an empty assignment, the prices of the previous phase and
+    // the profits which satisfy the complementary slackness conditions
+
+    TFloat maxPrice = -InfFloat;
+    TFloat maxProfit = -InfFloat;
+
+    for (TNode i=0;i<n1;i++)
+    {
+        TFloat thisProfit = -InfFloat;
+
+        for (TArc k=X->First(i);k<X->Stop(i);k++)
+        {
+            if (!X->Capacitated(k)) continue;
+
+            TFloat value = -scale*X->Length(k)-price[X->EndNode(k)-n1];
+
+            if (value>thisProfit) thisProfit = value;
+        }
+
+        profit[i] = thisProfit;
+        assigned[i] = NoNode;
+        owner[i] = NoNode;
+        bidder[i] = i;
+        freeObject[i] = n1-1-i;
+        stacked[i] = 1;
+
+        if (thisProfit>maxProfit) maxProfit = thisProfit;
+        if (price[i]>maxPrice) maxPrice = price[i];
+    }
+
+    nAssigned = 0;
+    nBidders = nFreeObjects = n1;
+
+    // For feasible instances, no price and no profit can increase by more
+    // than (2*n1-1) times the benefit range plus n1 times epsilon
+    priceBound = maxPrice+4*scale*(range+epsilon);
+    profitBound = maxProfit+4*scale*(range+epsilon);
+
+    bool forward = true;
+
+    while (nAssigned<n1)
+    {
+        TNode nAssignedBefore = nAssigned;
+
+        if (forward)
+        {
+            // Drop the persons which have been assigned by reverse bids
+
+            TNode nRemaining = 0;
+
+            for (TNode p=0;p<nBidders;p++)
+            {
+                if (assigned[bidder[p]]==NoNode) bidder[nRemaining++] = bidder[p];
+            }
+
+            nBidders = nRemaining;
+
+            while (nAssigned==nAssignedBefore && !infeasible) ForwardRound();
+        }
+        else
+        {
+            while (nAssigned==nAssignedBefore && !infeasible && nFreeObjects>0)
+            {
+                TNode j = freeObject[--nFreeObjects];
+                stacked[j] = 0;
+
+                if (owner[j]==NoNode) ReverseBid(j);
+            }
+        }
+
+        if (infeasible || !CT.SolverRunning()) return false;
+
+        forward = !forward;
+    }
+
+    #if defined(_LOGGING_)
+
+    if (CT.logMeth>1)
+    {
+        sprintf(CT.logBuffer,"...Phase with epsilon = %g completed",epsilon);
+        LogEntry(LOG_METH2,CT.logBuffer);
+    }
+
+    #endif
+
+    return true;
+}
+
+
+void parallelAuction::ComputeBids(TNode lo,TNode hi) throw()
+{
+    for (TNode p=lo;p<hi;p++)
+    {
+        TNode i = bidder[p];
+        TFloat best = -InfFloat;
+        TFloat second = -InfFloat;
+        TArc bestSlot = NoArc;
+
+        for (TArc k=X->First(i);k<X->Stop(i);k++)
+        {
+            if (!X->Capacitated(k)) continue;
+
+            TFloat value = -scale*X->Length(k)-price[X->EndNode(k)-n1];
+
+            if (value>best)
+            {
+                second = best;
+                best = value;
+                bestSlot = k;
+            }
+            else if (value>second) second = value;
+        }
+
+        // With a single eligible arc, the price is raised by epsilon
+        if (second==-InfFloat) second = best;
+
+        bidSlot[p] = bestSlot;
+        bidPrice[p] = -scale*X->Length(bestSlot)-second+epsilon;
+        bidProfit[p] = second-epsilon;
+    }
+}
+
+
+void parallelAuction::ForwardRound() throw()
+{
+    nRounds++;
+
+    unsigned long work = nBidders*(unsigned long)(X->NSlots()/(2*n1));
+
+    if (nThreads>1 && work>=minParallelWork)
+    {
+        Barrier();
+        ComputeBids(0,TNode(nBidders/nThreads));
+        Barrier();
+    }
+    else ComputeBids(0,nBidders);
+
+    nBids += nBidders;
+
+
+    // Determine the highest bid for every object
+
+    for (TNode p=0;p<nBidders;p++)
+    {
+        TNode j = X->EndNode(bidSlot[p])-n1;
+
+        if (bidRound[j]!=nRounds || bidPrice[p]>bidPrice[winner[j]])
+        {
+            bidRound[j] = nRounds;
+            winner[j] = p;
+        }
+    }
+
+
+    // Assign the objects to the winners. The persons which have lost their
+    // objects and the losing bidders form the next round
+
+    TNode nNext = 0;
+
+    for (TNode p=0;p<nBidders;p++)
+    {
+        TNode i = bidder[p];
+        TArc k = bidSlot[p];
+        TNode j = X->EndNode(k)-n1;
+
+        if (winner[j]!=p)
+        {
+            nextBidder[nNext++] = i;
+            continue;
+        }
+
+        TNode i0 = owner[j];
+
+        if (i0!=NoNode)
+        {
+            assigned[i0] = NoNode;
+            nextBidder[nNext++] = i0;
+        }
+        else nAssigned++;
+
+        owner[j] = i;
+        assigned[i] = j;
+        assignedArc[i] = X->Arc(k);
+        price[j] = bidPrice[p];
+        profit[i] = bidProfit[p];
+
+        if (price[j]>priceBound) infeasible = true;
+    }
+
+    TNode* swap = bidder;
+    bidder = nextBidder;
+    nextBidder = swap;
+    nBidders = nNext;
+}
+
+
+void parallelAuction::ReverseBid(TNode j) throw()
+{
+    nReverseBids++;
+
+    TFloat best = -InfFloat;
+    TFloat second = -InfFloat;
+    TArc bestSlot = NoArc;
+
+    for (TArc k=X->First(n1+j);k<X->Stop(n1+j);k++)
+    {
+        if (!X->Capacitated(k)) continue;
+
+        TFloat value = -scale*X->Length(k)-profit[X->EndNode(k)];
+
+        if (value>best)
+        {
+            second = best;
+            best = value;
+            bestSlot = k;
+        }
+        else if (value>second) second = value;
+    }
+
+    // With a single eligible arc, the profit is raised by epsilon
+    if (second==-InfFloat) second = best;
+
+    TNode i = X->EndNode(bestSlot);
+    TNode j0 = assigned[i];
+
+    if (j0!=NoNode)
+    {
+        owner[j0] = NoNode;
+
+        if (!stacked[j0])
+        {
+            freeObject[nFreeObjects++] = j0;
+            stacked[j0] = 1;
+        }
+    }
+    else nAssigned++;
+
+    owner[j] = i;
+    assigned[i] = j;
+    assignedArc[i] = X->Arc(bestSlot);
+    profit[i] = -scale*X->Length(bestSlot)-second+epsilon;
+    price[j] = second-epsilon;
+
+    if (profit[i]>profitBound) infeasible = true;
+}
@@ -0,0 +1,1300 @@
+
+//  This file forms part of the GOBLIN C++ Class Library.
+//
+//  Initially written by the GOBLIN developers, October 2026
+//
+//  Copying, compiling, distribution and modification
+//  of this source code is permitted only in accordance
+//  with the GOBLIN general licence information.
+
+/// \file   parallelComponents.cpp
+/// \brief  #parallelComponents class implementation
+
+#include "parallelComponents.h"
+
+
+parallelComponents::parallelComponents(abstractMixedGraph& GC)
+    throw() : managedObject(GC.Context()), G(GC)
+{
+    n = G.N();
+
+    X = G.FrozenIncidences();
+    localX = NULL;
+
+    if (!X)
+    {
+        localX = new csrRepresentation(G);
+        X = localX;
+    }
+
+    nThreads = CT.NumThreads();
+
+    if (nThreads>n) nThreads = (n>0) ? n : 1;
+
+    nodeLo = new TNode[nThreads+1];
+    count  = new TNode[nThreads+1];
+
+
+    // Balance the node ranges by the number of nodes plus the number of slots
+
+    unsigned long long total = (unsigned long long)(n)+X->NSlots();
+    nodeLo[0] = 0;
+
+    for (unsigned id=1;id<nThreads;id++)
+    {
+        unsigned long long target = (total*id)/nThreads;
+        TNode lo = nodeLo[id-1];
+        TNode hi = n;
+
+        while (lo<hi)
+        {
+            TNode v = lo+(hi-lo)/2;
+
+            if ((unsigned long long)(v)+X->First(v)<target) lo = v+1;
+            else hi = v;
+        }
+
+        nodeLo[id] = lo;
+    }
+
+    nodeLo[nThreads] = n;
+
+    parent = NULL;
+    hookArcs = NULL;
+    pred = NULL;
+    nodeColour = NULL;
+    edgeColour = NULL;
+
+    sequence = up = pre = size = low = high = firstChild = block = NULL;
+    cutNode = NULL;
+
+    rep = colour = NULL;
+    visited = NULL;
+    fwPred = NULL;
+    inDegree = outDegree = NULL;
+    active = next = current = NULL;
+    nActive = nNext = nCurrent = 0;
+
+    nComponents = nBlocks = nCutNodes = 0;
+    pivot = NoNode;
+    changed = false;
+    task = TASK_CONNECTED;
+
+    if (CT.logMeth>1)
+    {
+        sprintf(CT.logBuffer,"Starting %u worker threads...",nThreads);
+        LogEntry(LOG_METH2,CT.logBuffer);
+    }
+
+    LogEntry(LOG_MEM,"...Parallel component data structures allocated");
+}
+
+
+parallelComponents::~parallelComponents() throw()
+{
+    if (localX) delete localX;
+
+    delete[] nodeLo;
+    delete[] count;
+
+    delete[] const_cast<TNode*>(parent);
+    delete[] hookArcs;
+
+    delete[] sequence;
+    delete[] up;
+    delete[] pre;
+    delete[] size;
+    delete[] low;
+    delete[] high;
+    delete[] firstChild;
+    delete[] block;
+    delete[] cutNode;
+
+    delete[] const_cast<TNode*>(rep);
+    delete[] const_cast<TNode*>(colour);
+    delete[] visited;
+    delete[] fwPred;
+    delete[] const_cast<TNode*>(inDegree);
+    delete[] const_cast<TNode*>(outDegree);
+    delete[] active;
+    delete[] next;
+    delete[] current;
+
+    LogEntry(LOG_MEM,"...Parallel component data structures disallocated");
+}
+
+
+unsigned long parallelComponents::Size() const throw()
+{
+    return
+          sizeof(parallelComponents)
+        + managedObject::Allocated()
+        + parallelComponents::Allocated();
+}
+
+
+unsigned long parallelComponents::Allocated() const throw()
+{
+    unsigned long ret = 2*(nThreads+1)*sizeof(TNode);
+
+    if (localX) ret += localX->Size();
+
+    if (parent) ret += n*(sizeof(TNode)+sizeof(TArc));
+
+    if (pre) ret += n*(8*sizeof(TNode)+sizeof(char));
+
+    if (rep) ret += n*(7*sizeof(TNode)+sizeof(TArc)+sizeof(char));
+
+    return ret;
+}
+
+
+void* parallelComponents::WorkerEntry(void* arg) throw()
+{
+    TWorkerArg* thisArg = static_cast<TWorkerArg*>(arg);
+    thisArg -> P -> Worker(thisArg->id);
+
+    return NULL;
+}
+
+
+void parallelComponents::Run(TTask thisTask) throw()
+{
+    task = thisTask;
+
+    pthread_barrier_init(&barrier,NULL,nThreads);
+
+    pthread_t* threads = new pthread_t[nThreads];
+    TWorkerArg* args = new TWorkerArg[nThreads];
+
+    for (unsigned i=0;i<nThreads;i++)
+    {
+        args[i].P = this;
+        args[i].id = i;
+    }
+
+    for (unsigned i=1;i<nThreads;i++)
+    {
+        pthread_create(&threads[i],NULL,WorkerEntry,&args[i]);
+    }
+
+    Worker(0);
+
+    for (unsigned i=1;i<nThreads;i++) pthread_join(threads[i],NULL);
+
+    delete[] threads;
+    delete[] args;
+
+    pthread_barrier_destroy(&barrier);
+}
+
+
+void parallelComponents::Worker(unsigned id) throw()
+{
+    switch (task)
+    {
+        case TASK_CONNECTED:
+        {
+            ConnectedWorker(id);
+            break;
+        }
+        case TASK_LOW_HIGH:
+        {
+            LowHighWorker(id);
+            break;
+        }
+        case TASK_BLOCKS:
+        {
+            BlocksWorker(id);
+            break;
+        }
+        case TASK_BRIDGES:
+        {
+            BridgesWorker(id);
+            break;
+        }
+        case TASK_STRONG:
+        {
+            StrongWorker(id);
+            break;
+        }
+    }
+}
+
+
+void parallelComponents::Barrier() throw()
+{
+    pthread_barrier_wait(&barrier);
+}
+
+
+TNode parallelComponents::Find(TNode v) throw()
+{
+    // Path halving. Concurrent updates only redirect a node to one of
+    // its ancestors, and the root nodes are not manipulated here
+
+    while (true)
+    {
+        TNode p = parent[v];
+
+        if (p==v) return v;
+
+        TNode gp = parent[p];
+
+        if (gp!=p) __sync_bool_compare_and_swap(&parent[v],p,gp);
+
+        v = gp;
+    }
+}
+
+
+void parallelComponents::Unite(TNode u,TNode w,TArc a) throw()
+{
+    while (true)
+    {
+        TNode ru = Find(u);
+        TNode rw = Find(w);
+
+        if (ru==rw) return;
+
+        // Hook the root with the higher index, so that every tree
+        // is rooted at its minimum node index
+
+        if (ru<rw)
+        {
+            TNode swap = ru;
+            ru = rw;
+            rw = swap;
+        }
+
+        if (__sync_bool_compare_and_swap(&parent[ru],ru,rw))
+        {
+            hookArcs[ru] = a;
+            return;
+        }
+    }
+}
+
+
+TNode parallelComponents::PrefixSums() throw()
+{
+    TNode sum = 0;
+
+    for (unsigned i=0;i<nThreads;i++)
+    {
+        TNode thisCount = count[i];
+        count[i] = sum;
+        sum += thisCount;
+    }
+
+    return sum;
+}
+
+
+void parallelComponents::ColourByRoots(unsigned id) throw()
+{
+    // Number the union-find trees by increasing roots. Since the roots are
+    // the minimum nodes, this matches the numbering of the sequential methods
+
+    TNode lo = nodeLo[id];
+    TNode hi = nodeLo[id+1];
+    TNode nRoots = 0;
+
+    for (TNode v=lo;v<hi;v++)
+    {
+        TNode r = Find(v);
+
+        parent[v] = r;
+
+        if (r==v) nRoots++;
+    }
+
+    count[id] = nRoots;
+
+    Barrier();
+
+    if (id==0) nComponents = PrefixSums();
+
+    Barrier();
+
+    TNode c = count[id];
+
+    for (TNode v=lo;v<hi;v++)
+    {
+        if (parent[v]==v) nodeColour[v] = c++;
+    }
+
+    Barrier();
+
+    for (TNode v=lo;v<hi;v++)
+    {
+        if (parent[v]!=v) nodeColour[v] = nodeColour[parent[v]];
+    }
+}
+
+
+void parallelComponents::ConnectedWorker(unsigned id) throw()
+{
+    TNode lo = nodeLo[id];
+    TNode hi = nodeLo[id+1];
+
+    for (TNode v=lo;v<hi;v++)
+    {
+        parent[v] = v;
+        hookArcs[v] = NoArc;
+    }
+
+    Barrier();
+
+    for (TNode u=lo;u<hi;u++)
+    {
+        for (TArc k=X->First(u);k<X->Stop(u);k++)
+        {
+            if (!X->Capacitated(k)) continue;
+
+            TNode w = X->EndNode(k);
+
+            // Every edge is listed with both end nodes
+            if (w<=u) continue;
+
+            Unite(u,w,X->Arc(k));
+        }
+    }
+
+    Barrier();
+
+    ColourByRoots(id);
+}
+
+
+TNode parallelComponents::Connected() throw()
+{
+    nodeColour = G.InitNodeColours();
+    pred = G.InitPredecessors();
+
+    if (!parent)
+    {
+        parent = new TNode[n];
+        hookArcs = new TArc[n];
+    }
+
+    Run(TASK_CONNECTED);
+
+    OrientForest();
+
+    return nComponents;
+}
+
+
+void parallelComponents::OrientForest() throw()
+{
+    // Orient the forest of hook arcs, starting at the minimum nodes. This
+    // takes O(n) steps and is done by the master thread
+
+    if (!pre)
+    {
+        sequence   = new TNode[n];
+        up         = new TNode[n];
+        pre        = new TNode[n];
+        size       = new TNode[n];
+        low        = new TNode[n];
+        high       = new TNode[n];
+        firstChild = new TNode[n];
+        block      = new TNode[n];
+        cutNode    = new char[n];
+    }
+
+    TArc* adjFirst = new TArc[n+1];
+    TArc* adjArc   = new TArc[2*n];
+    TNode* adjHead = new TNode[2*n];
+    TArc* cursor   = new TArc[n];
+    TNode* hookStart = new TNode[n];
+    TNode* hookEnd = new TNode[n];
+
+    for (TNode v=0;v<=n;v++) adjFirst[v] = 0;
+
+    for (TNode r=0;r<n;r++)
+    {
+        TArc a = hookArcs[r];
+
+        if (a==NoArc) continue;
+
+        hookStart[r] = G.StartNode(a);
+        hookEnd[r] = G.EndNode(a);
+        adjFirst[hookStart[r]+1]++;
+        adjFirst[hookEnd[r]+1]++;
+    }
+
+    for (TNode v=0;v<n;v++) adjFirst[v+1] += adjFirst[v];
+
+    for (TNode v=0;v<n;v++) cursor[v] = adjFirst[v];
+
+    for (TNode r=0;r<n;r++)
+    {
+        TArc a = hookArcs[r];
+
+        if (a==NoArc) continue;
+
+        adjArc[cursor[hookStart[r]]] = a;
+        adjHead[cursor[hookStart[r]]++] = hookEnd[r];
+        adjArc[cursor[hookEnd[r]]] = a^1;
+        adjHead[cursor[hookEnd[r]]++] = hookStart[r];
+    }
+
+    delete[] hookStart;
+    delete[] hookEnd;
+
+
+    // Depth first search in the spanning forest
+
+    TNode i = 0;
+
+    for (TNode r=0;r<n;r++)
+    {
+        if (parent[r]!=r) continue;
+
+        pred[r] = NoArc;
+        up[r] = NoNode;
+        pre[r] = i;
+        sequence[i++] = r;
+        firstChild[r] = NoNode;
+        cursor[r] = adjFirst[r];
+
+        TNode u = r;
+
+        while (u!=NoNode)
+        {
+            if (cursor[u]<adjFirst[u+1])
+            {
+                TArc k = cursor[u]++;
+                TNode w = adjHead[k];
+
+                if (w==up[u]) continue;
+
+                pred[w] = adjArc[k];
+                up[w] = u;
+                pre[w] = i;
+                sequence[i++] = w;
+                firstChild[w] = NoNode;
+                cursor[w] = adjFirst[w];
+
+                if (firstChild[u]==NoNode) firstChild[u] = w;
+
+                u = w;
+            }
+            else u = up[u];
+        }
+    }
+
+    delete[] adjFirst;
+    delete[] adjArc;
+    delete[] adjHead;
+    delete[] cursor;
+
+    for (TNode v=0;v<n;v++) size[v] = 1;
+
+    for (TNode j=n;j>0;)
+    {
+        TNode v = sequence[--j];
+
+        if (up[v]!=NoNode) size[up[v]] += size[v];
+    }
+}
+
+
+void parallelComponents::LowHighWorker(unsigned id) throw()
+{
+    TNode lo = nodeLo[id];
+    TNode hi = nodeLo[id+1];
+
+    for (TNode u=lo;u<hi;u++)
+    {
+        TNode thisLow = pre[u];
+        TNode thisHigh = pre[u];
+
+        for (TArc k=X->First(u);k<X->Stop(u);k++)
+        {
+            if (!X->Capacitated(k)) continue;
+
+            TNode w = X->EndNode(k);
+            TArc a = X->Arc(k);
+
+            if (w==u || pred[w]==a || pred[u]==(a^1)) continue;
+
+            if (pre[w]<thisLow) thisLow = pre[w];
+            if (pre[w]>thisHigh) thisHigh = pre[w];
+        }
+
+        low[u] = thisLow;
+        high[u] = thisHigh;
+    }
+}
+
+
+TNode parallelComponents::NodeBlock(TNode v) const throw()
+{
+    if (up[v]!=NoNode) return block[v];
+
+    if (firstChild[v]!=NoNode) return block[firstChild[v]];
+
+    return NoNode;
+}
+
+
+void parallelComponents::BlocksWorker(unsigned id) throw()
+{
+    TNode lo = nodeLo[id];
+    TNode hi = nodeLo[id+1];
+
+    for (TNode v=lo;v<hi;v++)
+    {
+        parent[v] = v;
+        cutNode[v] = 0;
+    }
+
+    Barrier();
+
+
+    // Merge the tree edges entering u and w (indexed by u and w)
+    // if they lie on a common cycle
+
+    for (TNode u=lo;u<hi;u++)
+    {
+        for (TArc k=X->First(u);k<X->Stop(u);k++)
+        {
+            if (!X->Capacitated(k)) continue;
+
+            TNode w = X->EndNode(k);
+            TArc a = X->Arc(k);
+
+            if (w==u || pred[u]==(a^1)) continue;
+
+            if (pred[w]==a)
+            {
+                // Tree edge uw, check if some non-tree edge
+                // leaves the subtree of w, and bypasses u
+
+                if (   up[u]!=NoNode
+                    && (low[w]<pre[u] || high[w]>=pre[u]+size[u])
+                   )
+                {
+                    Unite(w,u,NoArc);
+                }
+            }
+            else if (pre[u]<pre[w] && pre[w]>=pre[u]+size[u])
+            {
+                // Non-tree edge between unrelated nodes
+                Unite(u,w,NoArc);
+            }
+        }
+    }
+
+    Barrier();
+
+    TNode nRoots = 0;
+
+    for (TNode v=lo;v<hi;v++)
+    {
+        if (up[v]==NoNode) continue;
+
+        TNode r = Find(v);
+
+        parent[v] = r;
+
+        if (r==v) nRoots++;
+    }
+
+    count[id] = nRoots;
+
+    Barrier();
+
+    if (id==0) nBlocks = PrefixSums();
+
+    Barrier();
+
+    TNode c = count[id];
+
+    for (TNode v=lo;v<hi;v++)
+    {
+        if (up[v]!=NoNode && parent[v]==v) block[v] = ++c;
+    }
+
+    Barrier();
+
+    for (TNode v=lo;v<hi;v++)
+    {
+        if (up[v]!=NoNode && parent[v]!=v) block[v] = block[parent[v]];
+    }
+
+    Barrier();
+
+
+    // Every block spanned by more than one node contains a tree edge
+    // incident with each of its nodes. Hence a node is a cut node if the
+    // incident tree edges belong to different blocks
+
+    for (TNode w=lo;w<hi;w++)
+    {
+        TNode u = up[w];
+
+        if (u!=NoNode && block[w]!=NodeBlock(u)) cutNode[u] = 1;
+    }
+
+    Barrier();
+
+    TNode thisCutNodes = 0;
+
+    for (TNode v=lo;v<hi;v++)
+    {
+        if (cutNode[v])
+        {
+            nodeColour[v] = abstractMixedGraph::CONN_CUT_NODE;
+            thisCutNodes++;
+        }
+        else nodeColour[v] = NodeBlock(v);
+    }
+
+    __sync_fetch_and_add(&nCutNodes,thisCutNodes);
+
+
+    // Every edge is coloured by the block of the tree edge entering the end
+    // node with the higher preorder number
+
+    for (TNode u=lo;u<hi;u++)
+    {
+        for (TArc k=X->First(u);k<X->Stop(u);k++)
+        {
+            TArc a = X->Arc(k);
+
+            if ((a&1) || !X->Capacitated(k)) continue;
+
+            TNode w = X->EndNode(k);
+            TNode thisBlock = NoNode;
+
+            if (w==u)
+            {
+                thisBlock = NodeBlock(u);
+            }
+            else if (pred[w]==a || (pred[u]!=(a^1) && pre[u]<pre[w]))
+            {
+                thisBlock = block[w];
+            }
+            else thisBlock = block[u];
+
+            // Loops at otherwise isolated nodes are assigned to colour 0
+            // as in the DFS method
+            edgeColour[a>>1] = (thisBlock==NoNode) ? 0 : TArc(thisBlock);
+        }
+    }
+}
+
+
+TNode parallelComponents::CutNodes() throw()
+{
+    Connected();
+
+    // No edge colour register is allocated for edgeless graphs
+    if (G.M()>0) edgeColour = G.InitEdgeColours();
+
+    nCutNodes = 0;
+
+    Run(TASK_LOW_HIGH);
+
+
+    // Propagate the low and high values up the spanning forest
+
+    for (TNode j=n;j>0;)
+    {
+        TNode v = sequence[--j];
+        TNode u = up[v];
+
+        if (u==NoNode) continue;
+
+        if (low[v]<low[u]) low[u] = low[v];
+        if (high[v]>high[u]) high[u] = high[v];
+    }
+
+    Run(TASK_BLOCKS);
+
+    return nBlocks;
+}
+
+
+void parallelComponents::BridgesWorker(unsigned id) throw()
+{
+    TNode lo = nodeLo[id];
+    TNode hi = nodeLo[id+1];
+
+    for (TNode v=lo;v<hi;v++) parent[v] = v;
+
+    Barrier();
+
+    for (TNode u=lo;u<hi;u++)
+    {
+        for (TArc k=X->First(u);k<X->Stop(u);k++)
+        {
+            if (!X->Capacitated(k)) continue;
+
+            TNode w = X->EndNode(k);
+            TArc a = X->Arc(k);
+
+            if (w==u || pred[u]==(a^1)) continue;
+
+            if (pred[w]==a)
+            {
+                // Skip the bridges. As in the DFS method, a bridge is not
+                // skipped if neither end node is a cut node, that is, if
+                // it forms a connected component on its own
+                if (   low[w]>=pre[w] && high[w]<pre[w]+size[w]
+                    && (cutNode[u] || cutNode[w])
+                   )
+                {
+                    continue;
+                }
+            }
+            else if (pre[w]<pre[u]) continue;
+
+            Unite(u,w,NoArc);
+        }
+    }
+
+    Barrier();
+
+    ColourByRoots(id);
+}
+
+
+TNode parallelComponents::TwoEdgeConnected() throw()
+{
+    Run(TASK_BRIDGES);
+
+
+    // Renumber the components starting with 1 as the DFS method does,
+    // and leave the isolated nodes uncoloured
+
+    TNode* index = new TNode[nComponents];
+
+    for (TNode c=0;c<nComponents;c++) index[c] = NoNode;
+
+    TNode k = 0;
+
+    for (TNode v=0;v<n;v++)
+    {
+        if (up[v]==NoNode && firstChild[v]==NoNode)
+        {
+            nodeColour[v] = NoNode;
+            continue;
+        }
+
+        TNode c = nodeColour[v];
+
+        if (index[c]==NoNode) index[c] = ++k;
+
+        nodeColour[v] = index[c];
+    }
+
+    delete[] index;
+
+    return nComponents;
+}
+
+
+void parallelComponents::CompactActive(unsigned id) throw()
+{
+    TNode lo = TNode((nActive*(unsigned long long)(id))/nThreads);
+    TNode hi = TNode((nActive*(unsigned long long)(id+1))/nThreads);
+    TNode nLeft = 0;
+
+    for (TNode i=lo;i<hi;i++)
+    {
+        if (rep[active[i]]==NoNode) nLeft++;
+    }
+
+    count[id] = nLeft;
+
+    Barrier();
+
+    if (id==0) nNext = PrefixSums();
+
+    Barrier();
+
+    TNode j = count[id];
+
+    for (TNode i=lo;i<hi;i++)
+    {
+        if (rep[active[i]]==NoNode) next[j++] = active[i];
+    }
+
+    Barrier();
+
+    if (id==0)
+    {
+        TNode* swap = active;
+        active = next;
+        next = swap;
+        nActive = nNext;
+        nNext = 0;
+    }
+
+    Barrier();
+}
+
+
+void parallelComponents::Trim(unsigned id) throw()
+{
+    // Nodes without eligible arcs from or to other unassigned nodes form
+    // trivial strong components. The arcs of every trimmed node are removed
+    // from the degree counts of its neighbours, so that trimming cascades
+    // until no further node can be trimmed
+
+    TNode lo = TNode((nActive*(unsigned long long)(id))/nThreads);
+    TNode hi = TNode((nActive*(unsigned long long)(id+1))/nThreads);
+
+    for (TNode i=lo;i<hi;i++)
+    {
+        TNode v = active[i];
+        TNode thisIn = 0;
+        TNode thisOut = 0;
+
+        if (rep[v]!=NoNode) continue;
+
+        for (TArc k=X->First(v);k<X->Stop(v);k++)
+        {
+            TNode w = X->EndNode(k);
+
+            if (w==v || rep[w]!=NoNode) continue;
+
+            if (X->PlainEligible(k)) thisOut++;
+            if (X->ReversePlainEligible(k)) thisIn++;
+        }
+
+        inDegree[v] = thisIn;
+        outDegree[v] = thisOut;
+    }
+
+    // No node must be trimmed before all degrees have been counted
+    Barrier();
+
+    for (TNode i=lo;i<hi;i++)
+    {
+        TNode v = active[i];
+
+        if (rep[v]!=NoNode) continue;
+
+        if (inDegree[v]==0 || outDegree[v]==0)
+        {
+            rep[v] = v;
+            current[__sync_fetch_and_add(&nCurrent,1)] = v;
+        }
+    }
+
+    Barrier();
+
+    while (nCurrent>0)
+    {
+        TNode sliceLo = TNode((nCurrent*(unsigned long long)(id))/nThreads);
+        TNode sliceHi = TNode((nCurrent*(unsigned long long)(id+1))/nThreads);
+
+        for (TNode i=sliceLo;i<sliceHi;i++)
+        {
+            TNode u = current[i];
+
+            for (TArc k=X->First(u);k<X->Stop(u);k++)
+            {
+                TNode w = X->EndNode(k);
+
+                if (rep[w]!=NoNode) continue;
+
+                TNode thisIn = 1;
+                TNode thisOut = 1;
+
+                if (X->PlainEligible(k))
+                    thisIn = __sync_sub_and_fetch(&inDegree[w],1);
+
+                if (X->ReversePlainEligible(k))
+                    thisOut = __sync_sub_and_fetch(&outDegree[w],1);
+
+                if (   (thisIn==0 || thisOut==0)
+                    && __sync_bool_compare_and_swap(&rep[w],NoNode,w)
+                   )
+                {
+                    next[__sync_fetch_and_add(&nNext,1)] = w;
+                }
+            }
+        }
+
+        Barrier();
+
+        if (id==0)
+        {
+            TNode* swap = current;
+            current = next;
+            next = swap;
+            nCurrent = nNext;
+            nNext = 0;
+        }
+
+        Barrier();
+    }
+
+    // All threads must have evaluated the loop condition
+    Barrier();
+
+    CompactActive(id);
+}
+
+
+void parallelComponents::SearchLayers(unsigned id,bool forward,char mark) throw()
+{
+    // Breadth first search among the unassigned nodes, starting with the
+    // nodes in current[]. If mark is zero, the search is restricted to the
+    // nodes of equal colour, and the representatives are assigned.
+    // Otherwise the reached nodes are marked in visited[]
+
+    while (true)
+    {
+        TNode lo = TNode((nCurrent*(unsigned long long)(id))/nThreads);
+        TNode hi = TNode((nCurrent*(unsigned long long)(id+1))/nThreads);
+
+        for (TNode i=lo;i<hi;i++)
+        {
+            TNode u = current[i];
+
+            for (TArc k=X->First(u);k<X->Stop(u);k++)
+            {
+                if (forward ? !X->PlainEligible(k) : !X->ReversePlainEligible(k))
+                    continue;
+
+                TNode w = X->EndNode(k);
+
+                if (rep[w]!=NoNode) continue;
+
+                if (mark)
+                {
+                    char thisMark = visited[w];
+
+                    // The backward search is restricted to the nodes reached
+                    // by the forward search
+                    if ((thisMark & mark) || (!forward && !(thisMark & 1)))
+                        continue;
+
+                    if (!__sync_bool_compare_and_swap(&visited[w],
+                            thisMark,char(thisMark | mark)))
+                        continue;
+
+                    if (forward) fwPred[w] = X->Arc(k);
+                }
+                else
+                {
+                    TNode c = colour[u];
+
+                    if (colour[w]!=c) continue;
+
+                    if (!__sync_bool_compare_and_swap(&rep[w],NoNode,c)) continue;
+
+                    pred[w] = X->Arc(k);
+                }
+
+                next[__sync_fetch_and_add(&nNext,1)] = w;
+            }
+        }
+
+        Barrier();
+
+        if (id==0)
+        {
+            TNode* swap = current;
+            current = next;
+            next = swap;
+            nCurrent = nNext;
+            nNext = 0;
+        }
+
+        Barrier();
+
+        if (nCurrent==0) break;
+    }
+
+    // All threads must have evaluated the loop condition
+    Barrier();
+}
+
+
+void parallelComponents::StrongWorker(unsigned id) throw()
+{
+    TNode lo = nodeLo[id];
+    TNode hi = nodeLo[id+1];
+
+    for (TNode v=lo;v<hi;v++)
+    {
+        rep[v] = NoNode;
+        visited[v] = 0;
+        fwPred[v] = NoArc;
+        active[v] = v;
+    }
+
+    if (id==0) nActive = n;
+
+    Barrier();
+
+    Trim(id);
+
+
+    // Forward-backward search from a node with maximum degree,
+    // to split off the giant strong component
+
+    if (nActive>0)
+    {
+        TNode sliceLo = TNode((nActive*(unsigned long long)(id))/nThreads);
+        TNode sliceHi = TNode((nActive*(unsigned long long)(id+1))/nThreads);
+        TNode best = NoNode;
+
+        for (TNode i=sliceLo;i<sliceHi;i++)
+        {
+            TNode v = active[i];
+
+            if (   best==NoNode
+                || X->Stop(v)-X->First(v)>X->Stop(best)-X->First(best)
+               )
+            {
+                best = v;
+            }
+        }
+
+        count[id] = best;
+
+        Barrier();
+
+        if (id==0)
+        {
+            pivot = NoNode;
+
+            for (unsigned i=0;i<nThreads;i++)
+            {
+                TNode v = count[i];
+
+                if (v==NoNode) continue;
+
+                if (   pivot==NoNode
+                    || X->Stop(v)-X->First(v)>X->Stop(pivot)-X->First(pivot)
+                   )
+                {
+                    pivot = v;
+                }
+            }
+
+            visited[pivot] = 1;
+            current[0] = pivot;
+            nCurrent = 1;
+            nNext = 0;
+        }
+
+        Barrier();
+
+        SearchLayers(id,true,1);
+
+        if (id==0)
+        {
+            visited[pivot] = 3;
+            current[0] = pivot;
+            nCurrent = 1;
+        }
+
+        Barrier();
+
+        SearchLayers(id,false,2);
+
+        for (TNode v=lo;v<hi;v++)
+        {
+            if (visited[v]==3)
+            {
+                rep[v] = pivot;
+                pred[v] = fwPred[v];
+            }
+        }
+
+        Barrier();
+
+        Trim(id);
+    }
+
+
+    // Colouring method: Propagate the maximum node index along the
+    // eligible arcs. Then every node whose colour is its own index is
+    // the root of a strong component, which is found by a backward search
+    // among the nodes of this colour
+
+    while (nActive>0)
+    {
+        TNode sliceLo = TNode((nActive*(unsigned long long)(id))/nThreads);
+        TNode sliceHi = TNode((nActive*(unsigned long long)(id+1))/nThreads);
+
+        for (TNode i=sliceLo;i<sliceHi;i++)
+        {
+            TNode v = active[i];
+            colour[v] = v;
+            visited[v] = 0;
+            current[i] = v;
+        }
+
+        if (id==0) nCurrent = nActive;
+
+        Barrier();
+
+        // Only the nodes whose colours have been raised in the previous
+        // round propagate their colours again
+
+        while (nCurrent>0)
+        {
+            TNode frontLo = TNode((nCurrent*(unsigned long long)(id))/nThreads);
+            TNode frontHi = TNode((nCurrent*(unsigned long long)(id+1))/nThreads);
+
+            for (TNode i=frontLo;i<frontHi;i++)
+            {
+                TNode v = current[i];
+                TNode c = colour[v];
+
+                for (TArc k=X->First(v);k<X->Stop(v);k++)
+                {
+                    if (!X->PlainEligible(k)) continue;
+
+                    TNode w = X->EndNode(k);
+
+                    if (rep[w]!=NoNode) continue;
+
+                    TNode thisColour = colour[w];
+
+                    while (thisColour<c)
+                    {
+                        if (__sync_bool_compare_and_swap(&colour[w],thisColour,c))
+                        {
+                            if (__sync_bool_compare_and_swap(&visited[w],0,1))
+                                next[__sync_fetch_and_add(&nNext,1)] = w;
+
+                            break;
+                        }
+
+                        thisColour = colour[w];
+                    }
+                }
+            }
+
+            Barrier();
+
+            if (id==0)
+            {
+                TNode* swap = current;
+                current = next;
+                next = swap;
+                nCurrent = nNext;
+                nNext = 0;
+            }
+
+            Barrier();
+
+            frontLo = TNode((nCurrent*(unsigned long long)(id))/nThreads);
+            frontHi = TNode((nCurrent*(unsigned long long)(id+1))/nThreads);
+
+            for (TNode i=frontLo;i<frontHi;i++) visited[current[i]] = 0;
+
+            Barrier();
+        }
+
+        // All threads must have evaluated the loop condition
+        Barrier();
+
+        for (TNode i=sliceLo;i<sliceHi;i++)
+        {
+            TNode v = active[i];
+
+            if (colour[v]==v)
+            {
+                rep[v] = v;
+                current[__sync_fetch_and_add(&nCurrent,1)] = v;
+            }
+        }
+
+        Barrier();
+
+        SearchLayers(id,false,0);
+
+        Trim(id);
+    }
+
+
+    // Number the strong components by their minimum nodes
+
+    for (TNode v=lo;v<hi;v++) colour[v] = NoNode;
+
+    Barrier();
+
+    for (TNode v=lo;v<hi;v++)
+    {
+        TNode r = rep[v];
+        TNode thisMin = colour[r];
+
+        while (v<thisMin)
+        {
+            if (__sync_bool_compare_and_swap(&colour[r],thisMin,v)) break;
+
+            thisMin = colour[r];
+        }
+    }
+
+    Barrier();
+
+    TNode nMin = 0;
+
+    for (TNode v=lo;v<hi;v++)
+    {
+        if (colour[rep[v]]==v) nMin++;
+    }
+
+    count[id] = nMin;
+
+    Barrier();
+
+    if (id==0) nComponents = PrefixSums();
+
+    Barrier();
+
+    TNode c = count[id];
+
+    for (TNode v=lo;v<hi;v++)
+    {
+        if (colour[rep[v]]==v) nodeColour[v] = c++;
+    }
+
+    Barrier();
+
+    for (TNode v=lo;v<hi;v++)
+    {
+        if (colour[rep[v]]!=v) nodeColour[v] = nodeColour[colour[rep[v]]];
+    }
+}
+
+
+TNode parallelComponents::StronglyConnected() throw()
+{
+    nodeColour = G.InitNodeColours();
+    pred = G.InitPredecessors();
+
+    if (!rep)
+    {
+        rep     = new TNode[n];
+        colour  = new TNode[n];
+        visited = new char[n];
+        fwPred  = new TArc[n];
+        inDegree  = new TNode[n];
+        outDegree = new TNode[n];
+        active  = new TNode[n];
+        next    = new TNode[n];
+        current = new TNode[n];
+    }
+
+    nCurrent = nNext = 0;
+
+    Run(TASK_STRONG);
+
+    return nComponents;
+}
@@ -0,0 +1,530 @@
+
+//  This file forms part of the GOBLIN C++ Class Library.
+//
+//  Initially written by the GOBLIN developers, October 2026
+//
+//  Copying, compiling, distribution and modification
+//  of this source code is permitted only in accordance
+//  with the GOBLIN general licence information.
+
+/// \file   parallelPushRelabel.cpp
+/// \brief  #parallelPushRelabel class implementation
+
+#include "parallelPushRelabel.h"
+
+
+// Atomic addition for floating point values, implemented by a
+// compare-and-swap loop on the binary representation
+
+static inline void AtomicAdd(TFloat* x,TFloat lambda) throw()
+{
+    union {TFloat value; unsigned long long bits;} oldVal, newVal;
+
+    do
+    {
+        oldVal.value = *const_cast<volatile TFloat*>(x);
+        newVal.value = oldVal.value+lambda;
+    }
+    while (!__sync_bool_compare_and_swap(
+                reinterpret_cast<unsigned long long*>(x),oldVal.bits,newVal.bits));
+}
+
+
+parallelPushRelabel::parallelPushRelabel(abstractDiGraph& GC,TNode ss,TNode tt)
+    throw(ERRange) : managedObject(GC.Context()), G(GC)
+{
+    #if defined(_FAILSAVE_)
+
+    if (ss>=G.N()) NoSuchNode("parallelPushRelabel",ss);
+
+    if (tt>=G.N()) NoSuchNode("parallelPushRelabel",tt);
+
+    #endif
+
+    n = G.N();
+    m = G.M();
+    s = ss;
+    t = tt;
+
+    first    = new TArc[n+1];
+    slotArc  = new TArc[2*m];
+    slotHead = new TNode[2*m];
+
+    resCap   = new TFloat[2*m];
+    initialResCap = new TFloat[2*m];
+    excess   = new TFloat[n];
+    incoming = new TFloat[n];
+    dist     = new TNode[n];
+    newDist  = new TNode[n];
+    listed   = new char[n];
+    active   = new TNode[n];
+    next     = new TNode[n];
+
+    TArc k = 0;
+
+    for (TNode v=0;v<n;v++)
+    {
+        first[v] = k;
+
+        TArc a = G.First(v);
+
+        if (a!=NoArc)
+        {
+            do
+            {
+                slotArc[k]  = a;
+                slotHead[k] = G.EndNode(a);
+                k++;
+
+                a = G.Right(a,v);
+            }
+            while (a!=G.First(v) && k<2*m);
+        }
+
+        excess[v]   = 0;
+        incoming[v] = 0;
+        dist[v]     = 0;
+        newDist[v]  = NoNode;
+        listed[v]   = 0;
+    }
+
+    first[n] = k;
+
+    for (TArc a=0;a<2*m;a++) initialResCap[a] = resCap[a] = G.ResCap(a);
+
+    nActive = nNext = 0;
+
+    nThreads = CT.NumThreads();
+
+    if (nThreads>n) nThreads = (n>0) ? n : 1;
+
+    bfsLevel = 0;
+    finished = false;
+    relabelNow = false;
+
+    nPush = nRelabel = nGlobalRelabel = 0;
+
+    LogEntry(LOG_MEM,"...Parallel push/relabel data structures allocated");
+}
+
+
+parallelPushRelabel::~parallelPushRelabel() throw()
+{
+    delete[] first;
+    delete[] slotArc;
+    delete[] slotHead;
+    delete[] resCap;
+    delete[] initialResCap;
+    delete[] excess;
+    delete[] incoming;
+    delete[] dist;
+    delete[] newDist;
+    delete[] listed;
+    delete[] active;
+    delete[] next;
+
+    LogEntry(LOG_MEM,"...Parallel push/relabel data structures disallocated");
+}
+
+
+unsigned long parallelPushRelabel::Size() const throw()
+{
+    return
+          sizeof(parallelPushRelabel)
+        + managedObject::Allocated()
+        + parallelPushRelabel::Allocated();
+}
+
+
+unsigned long parallelPushRelabel::Allocated() const throw()
+{
+    return
+          (n+1)*sizeof(TArc)
+        + 2*m*(sizeof(TArc)+sizeof(TNode)+2*sizeof(TFloat))
+        + n*(2*sizeof(TFloat)+4*sizeof(TNode)+sizeof(char));
+}
+
+
+TFloat parallelPushRelabel::Solve() throw(ERRange)
+{
+    // Push all flow away from the root node
+
+    for (TNode v=0;v<n;v++) excess[v] = G.Divergence(v);
+
+    for (TArc k=first[s];k<first[s+1];k++)
+    {
+        TArc a = slotArc[k];
+
+        if (G.UCap(a)==InfCap)
+        {
+            Error(ERR_RANGE,"Solve",
+                "Arcs emanating from source must have finite capacities");
+        }
+
+        TFloat lambda = resCap[a];
+
+        if (lambda<=0) continue;
+
+        resCap[a] = 0;
+        resCap[a^1] += lambda;
+        excess[s] -= lambda;
+        excess[slotHead[k]] += lambda;
+    }
+
+    if (CT.logMeth)
+    {
+        sprintf(CT.logBuffer,"Starting %u worker threads...",nThreads);
+        LogEntry(LOG_METH,CT.logBuffer);
+    }
+
+    pthread_barrier_init(&barrier,NULL,nThreads);
+
+    pthread_t* threads = new pthread_t[nThreads];
+    TWorkerArg* args = new TWorkerArg[nThreads];
+
+    for (unsigned i=0;i<nThreads;i++)
+    {
+        args[i].P = this;
+        args[i].id = i;
+    }
+
+    for (unsigned i=1;i<nThreads;i++)
+    {
+        pthread_create(&threads[i],NULL,WorkerEntry,&args[i]);
+    }
+
+    Worker(0);
+
+    for (unsigned i=1;i<nThreads;i++) pthread_join(threads[i],NULL);
+
+    delete[] threads;
+    delete[] args;
+
+    pthread_barrier_destroy(&barrier);
+
+
+    // Write back the flow
+
+    for (TArc a=0;a<m;a++)
+    {
+        TFloat lambda = initialResCap[2*a]-resCap[2*a];
+
+        if (lambda>0) G.Push(2*a,lambda);
+        else if (lambda<0) G.Push(2*a+1,-lambda);
+    }
+
+    if (CT.logRes>1)
+    {
+        sprintf(CT.logBuffer,
+            "...%lu pushes, %lu relabels, %lu global relabels",
+            nPush,nRelabel,nGlobalRelabel);
+        LogEntry(LOG_RES2,CT.logBuffer);
+    }
+
+    #if defined(_TIMERS_)
+
+    goblinTimer* TM = CT.globalTimer[TimerMaxFlow];
+    TM -> IncreaseCounter(goblinTimer::COUNT_PUSH,nPush);
+    TM -> IncreaseCounter(goblinTimer::COUNT_RELABEL,nRelabel);
+    TM -> IncreaseCounter(goblinTimer::COUNT_GLOBAL_RELABEL,nGlobalRelabel);
+
+    #endif
+
+    return G.Divergence(t);
+}
+
+
+void* parallelPushRelabel::WorkerEntry(void* arg) throw()
+{
+    TWorkerArg* thisArg = static_cast<TWorkerArg*>(arg);
+    thisArg -> P -> Worker(thisArg->id);
+
+    return NULL;
+}
+
+
+void parallelPushRelabel::Barrier() throw()
+{
+    pthread_barrier_wait(&barrier);
+}
+
+
+void parallelPushRelabel::Enlist(TNode v) throw()
+{
+    if (__sync_bool_compare_and_swap(&listed[v],0,1))
+    {
+        next[__sync_fetch_and_add(&nNext,1)] = v;
+    }
+}
+
+
+void parallelPushRelabel::Discharge(TNode u) throw()
+{
+    TFloat thisExcess = excess[u];
+
+    for (TArc k=first[u];k<first[u+1] && thisExcess>0;k++)
+    {
+        TNode v = slotHead[k];
+
+        // Check the labels first: The reverse arc might be manipulated by
+        // the thread which discharges v, but only if v=dist[u]+1
+        if (dist[u]!=dist[v]+1) continue;
+
+        TArc a = slotArc[k];
+        TFloat lambda = resCap[a];
+
+        if (lambda<=0) continue;
+
+        if (lambda>thisExcess) lambda = thisExcess;
+
+        resCap[a] -= lambda;
+        resCap[a^1] += lambda;
+        thisExcess -= lambda;
+
+        AtomicAdd(&incoming[v],lambda);
+
+        if (v!=s && v!=t) Enlist(v);
+    }
+
+    excess[u] = thisExcess;
+}
+
+
+void parallelPushRelabel::Relabel(TNode u) throw()
+{
+    TNode dMin = NoNode;
+
+    for (TArc k=first[u];k<first[u+1];k++)
+    {
+        TNode v = slotHead[k];
+
+        if (resCap[slotArc[k]]>0 && dist[v]<dMin) dMin = dist[v];
+    }
+
+    if (dMin<2*n)
+    {
+        newDist[u] = dMin+1;
+        Enlist(u);
+    }
+    else newDist[u] = 2*n;
+}
+
+
+void parallelPushRelabel::Worker(unsigned id) throw()
+{
+    GlobalRelabel(id);
+
+    while (true)
+    {
+        TNode lo = TNode((nActive*(unsigned long long)(id))/nThreads);
+        TNode hi = TNode((nActive*(unsigned long long)(id+1))/nThreads);
+
+        unsigned long thisPush = 0;
+        unsigned long thisRelabel = 0;
+
+
+        // Discharge all active nodes with respect to the current labels
+
+        for (TNode i=lo;i<hi;i++)
+        {
+            TNode u = active[i];
+            TFloat thisExcess = excess[u];
+
+            Discharge(u);
+
+            if (excess[u]<thisExcess) thisPush++;
+        }
+
+        Barrier();
+
+
+        // Relabel the active nodes which still have excesses. This reads
+        // the labels from the beginning of the round
+
+        for (TNode i=lo;i<hi;i++)
+        {
+            TNode u = active[i];
+
+            if (excess[u]>0)
+            {
+                Relabel(u);
+                thisRelabel++;
+            }
+        }
+
+        if (thisPush>0) __sync_fetch_and_add(&nPush,thisPush);
+        if (thisRelabel>0) __sync_fetch_and_add(&nRelabel,thisRelabel);
+
+        Barrier();
+
+
+        // Commit the new labels and the received excesses
+
+        for (TNode i=lo;i<hi;i++)
+        {
+            TNode u = active[i];
+
+            if (newDist[u]!=NoNode)
+            {
+                dist[u] = newDist[u];
+                newDist[u] = NoNode;
+            }
+        }
+
+        TNode nextLo = TNode((nNext*(unsigned long long)(id))/nThreads);
+        TNode nextHi = TNode((nNext*(unsigned long long)(id+1))/nThreads);
+
+        for (TNode i=nextLo;i<nextHi;i++)
+        {
+            TNode v = next[i];
+
+            excess[v] += incoming[v];
+            incoming[v] = 0;
+            listed[v] = 0;
+        }
+
+        Barrier();
+
+        if (id==0)
+        {
+            TNode* swap = active;
+            active = next;
+            next = swap;
+            nActive = nNext;
+            nNext = 0;
+
+            finished = (nActive==0 || !CT.SolverRunning());
+            relabelNow = (nRelabel>(nGlobalRelabel+1)*(unsigned long)(n));
+        }
+
+        Barrier();
+
+        if (finished) break;
+
+        if (relabelNow) GlobalRelabel(id);
+    }
+}
+
+
+void parallelPushRelabel::GlobalRelabel(unsigned id) throw()
+{
+    TNode lo = TNode((n*(unsigned long long)(id))/nThreads);
+    TNode hi = TNode((n*(unsigned long long)(id+1))/nThreads);
+
+    for (TNode v=lo;v<hi;v++) dist[v] = NoNode;
+
+    if (id==0)
+    {
+        nActive = 0;
+        nNext = 0;
+        bfsLevel = 0;
+    }
+
+    Barrier();
+
+
+    // Exact distances to t and to the nodes with deficits in the residual
+    // network. Deficits are left by the initial pseudo-flow and can absorb
+    // excesses just as t does
+
+    for (TNode v=lo;v<hi;v++)
+    {
+        if (v==t || (v!=s && excess[v]<0))
+        {
+            dist[v] = 0;
+            active[__sync_fetch_and_add(&nActive,1)] = v;
+        }
+    }
+
+    if (id==0) dist[s] = n;
+
+    Barrier();
+
+    SearchLayers(id);
+
+    // All threads must have evaluated the loop condition in SearchLayers()
+    Barrier();
+
+
+    // Nodes which cannot reach t or a deficit must return their excess to s
+
+    if (id==0)
+    {
+        active[0] = s;
+        nActive = 1;
+        bfsLevel = n;
+    }
+
+    Barrier();
+
+    SearchLayers(id);
+
+
+    // Rebuild the work list
+
+    for (TNode v=lo;v<hi;v++)
+    {
+        if (dist[v]==NoNode) dist[v] = 2*n;
+
+        if (v!=s && v!=t && excess[v]>0 && dist[v]<2*n) Enlist(v);
+    }
+
+    Barrier();
+
+    if (id==0)
+    {
+        TNode* swap = active;
+        active = next;
+        next = swap;
+        nActive = nNext;
+        nNext = 0;
+
+        for (TNode i=0;i<nActive;i++) listed[active[i]] = 0;
+
+        nGlobalRelabel++;
+    }
+
+    Barrier();
+}
+
+
+void parallelPushRelabel::SearchLayers(unsigned id) throw()
+{
+    while (nActive>0)
+    {
+        TNode lo = TNode((nActive*(unsigned long long)(id))/nThreads);
+        TNode hi = TNode((nActive*(unsigned long long)(id+1))/nThreads);
+
+        for (TNode i=lo;i<hi;i++)
+        {
+            TNode u = active[i];
+
+            for (TArc k=first[u];k<first[u+1];k++)
+            {
+                TNode v = slotHead[k];
+
+                if (   resCap[slotArc[k]^1]>0
+                    && dist[v]==NoNode
+                    && __sync_bool_compare_and_swap(&dist[v],NoNode,bfsLevel+1)
+                   )
+                {
+                    next[__sync_fetch_and_add(&nNext,1)] = v;
+                }
+            }
+        }
+
+        Barrier();
+
+        if (id==0)
+        {
+            TNode* swap = active;
+            active = next;
+            next = swap;
+            nActive = nNext;
+            nNext = 0;
+            bfsLevel++;
+        }
+
+        Barrier();
+    }
+}
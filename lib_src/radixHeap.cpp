@@ -0,0 +1,434 @@
+
+//  This file forms part of the GOBLIN C++ Class Library.
+//
+//  Initially written by the GOBLIN developers, October 2026
+//
+//  Copying, compiling, distribution and modification
+//  of this source code is permitted only in accordance
+//  with the GOBLIN general licence information.
+
+/// \file   radixHeap.cpp
+/// \brief  #radixHeap class implementation
+
+#include "radixHeap.h"
+
+
+template <class TItem,class TKey>
+radixHeap<TItem,TKey>::radixHeap(TItem _n,goblinController &thisContext)
+    throw() : managedObject(thisContext)
+{
+    #if defined(_TIMERS_)
+
+    this -> CT.globalTimer[TimerPrioQ] -> Enable();
+
+    #endif
+
+    n = _n;
+
+    next = new TItem[n];
+    prev = new TItem[n];
+    bucket = new unsigned char[n];
+    key = new TKey[n];
+
+    for (TItem w=0;w<n;w++) bucket[w] = NO_BUCKET();
+
+    for (unsigned i=0;i<nBuckets;i++) first[i] = UITEM_MAX();
+
+    last = 0;
+    maxIndex = 0;
+
+    this -> LogEntry(LOG_MEM,"...Radix heap instanciated");
+
+    #if defined(_TIMERS_)
+
+    this -> CT.globalTimer[TimerPrioQ] -> Disable();
+
+    #endif
+}
+
+
+template <class TItem,class TKey>
+void radixHeap<TItem,TKey>::Init() throw()
+{
+    #if defined(_TIMERS_)
+
+    this -> CT.globalTimer[TimerPrioQ] -> Enable();
+
+    #endif
+
+    if (maxIndex*100<n)
+    {
+        for (unsigned i=0;i<nBuckets;i++)
+        {
+            for (TItem w=first[i];w!=UITEM_MAX();w=next[w]) bucket[w] = NO_BUCKET();
+        }
+    }
+    else
+    {
+        for (TItem w=0;w<n;w++) bucket[w] = NO_BUCKET();
+    }
+
+    for (unsigned i=0;i<nBuckets;i++) first[i] = UITEM_MAX();
+
+    last = 0;
+    maxIndex = 0;
+
+    #if defined(_TIMERS_)
+
+    this -> CT.globalTimer[TimerPrioQ] -> Disable();
+
+    #endif
+}
+
+
+template <class TItem,class TKey>
+unsigned long radixHeap<TItem,TKey>::Size() const throw()
+{
+    return
+          sizeof(radixHeap<TItem,TKey>)
+        + managedObject::Allocated()
+        + radixHeap::Allocated();
+}
+
+
+template <class TItem,class TKey>
+unsigned long radixHeap<TItem,TKey>::Allocated() const throw()
+{
+    return
+          2*n*sizeof(TItem)
+        + n*sizeof(unsigned char)
+        + n*sizeof(TKey);
+}
+
+
+template <class TItem,class TKey>
+char* radixHeap<TItem,TKey>::Display() const throw()
+{
+    this -> LogEntry(MSG_TRACE,"Radix heap");
+
+    if (Empty())
+    {
+        this -> LogEntry(MSG_TRACE2,"    ---");
+        return NULL;
+    }
+
+    for (unsigned i=0;i<nBuckets;i++)
+    {
+        if (first[i]==UITEM_MAX()) continue;
+
+        sprintf(this->CT.logBuffer,"    %2d : ",i);
+        THandle LH = this->LogStart(MSG_TRACE2,this->CT.logBuffer);
+
+        for (TItem w=first[i];w!=UITEM_MAX();w=next[w])
+        {
+            sprintf(this->CT.logBuffer,"%ld[%g]",(unsigned long)w,key[w]);
+            this -> LogAppend(LH,this->CT.logBuffer);
+
+            if (next[w]!=UITEM_MAX()) this -> LogAppend(LH,", ");
+        }
+
+        this -> LogEnd(LH);
+    }
+
+    return NULL;
+}
+
+
+template <class TItem,class TKey>
+radixHeap<TItem,TKey>::~radixHeap() throw()
+{
+    #if defined(_TIMERS_)
+
+    this -> CT.globalTimer[TimerPrioQ] -> Enable();
+
+    #endif
+
+    delete[] next;
+    delete[] prev;
+    delete[] bucket;
+    delete[] key;
+
+    this -> LogEntry(LOG_MEM,"...Radix heap disallocated");
+
+    #if defined(_TIMERS_)
+
+    this -> CT.globalTimer[TimerPrioQ] -> Disable();
+
+    #endif
+}
+
+
+template <class TItem,class TKey>
+unsigned char radixHeap<TItem,TKey>::BucketIndex(unsigned long k) const throw()
+{
+    unsigned long diff = k^last;
+
+    if (diff==0) return 0;
+
+    #if defined(__GNUC__)
+
+    return (unsigned char)(8*sizeof(unsigned long)-__builtin_clzl(diff));
+
+    #else
+
+    unsigned char i = 1;
+
+    while (diff>>=1) i++;
+
+    return i;
+
+    #endif
+}
+
+
+template <class TItem,class TKey>
+void radixHeap<TItem,TKey>::Link(TItem w,unsigned char i) throw()
+{
+    bucket[w] = i;
+    prev[w] = UITEM_MAX();
+    next[w] = first[i];
+
+    if (first[i]!=UITEM_MAX()) prev[first[i]] = w;
+
+    first[i] = w;
+}
+
+
+template <class TItem,class TKey>
+void radixHeap<TItem,TKey>::Unlink(TItem w) throw()
+{
+    if (prev[w]!=UITEM_MAX()) next[prev[w]] = next[w];
+    else first[bucket[w]] = next[w];
+
+    if (next[w]!=UITEM_MAX()) prev[next[w]] = prev[w];
+
+    bucket[w] = NO_BUCKET();
+}
+
+
+template <class TItem,class TKey>
+TItem radixHeap<TItem,TKey>::MinElement(unsigned char i) const throw()
+{
+    TItem minItem = first[i];
+
+    for (TItem w=next[minItem];w!=UITEM_MAX();w=next[w])
+    {
+        if (key[w]<key[minItem]) minItem = w;
+    }
+
+    return minItem;
+}
+
+
+template <class TItem,class TKey>
+void radixHeap<TItem,TKey>::Insert(TItem w,TKey alpha) throw(ERRange,ERRejected)
+{
+    #if defined(_FAILSAVE_)
+
+    if (w>=n) this->NoSuchIndex("Insert",w);
+
+    if (bucket[w]!=NO_BUCKET())
+        this -> Error(ERR_REJECTED,"Insert","Element is already on the heap");
+
+    if (alpha<TKey(last) || alpha>MaxRadixHeapKey || alpha!=floor(alpha))
+        this -> Error(ERR_REJECTED,"Insert","Key must be integral and monotone");
+
+    #endif
+
+    #if defined(_TIMERS_)
+
+    this -> CT.globalTimer[TimerPrioQ] -> Enable();
+
+    #endif
+
+    key[w] = alpha;
+    Link(w,BucketIndex((unsigned long)(alpha)));
+    maxIndex++;
+
+    #if defined(_TIMERS_)
+
+    this -> CT.globalTimer[TimerPrioQ] -> Disable();
+
+    #endif
+
+    #if defined(_TRACING_)
+
+    if (this->CT.traceData) Display();
+
+    #endif
+}
+
+
+template <class TItem,class TKey>
+void radixHeap<TItem,TKey>::Delete(TItem w) throw(ERRange)
+{
+    #if defined(_FAILSAVE_)
+
+    if (w>=n || bucket[w]==NO_BUCKET()) this->NoSuchItem("Delete",w);
+
+    #endif
+
+    #if defined(_TIMERS_)
+
+    this -> CT.globalTimer[TimerPrioQ] -> Enable();
+
+    #endif
+
+    Unlink(w);
+    maxIndex--;
+
+    #if defined(_TIMERS_)
+
+    this -> CT.globalTimer[TimerPrioQ] -> Disable();
+
+    #endif
+
+    #if defined(_TRACING_)
+
+    if (this->CT.traceData) Display();
+
+    #endif
+}
+
+
+template <class TItem,class TKey>
+TItem radixHeap<TItem,TKey>::Delete() throw(ERRejected)
+{
+    #if defined(_FAILSAVE_)
+
+    if (maxIndex==0) this -> Error(ERR_REJECTED,"Delete","Heap is empty");
+
+    #endif
+
+    #if defined(_TIMERS_)
+
+    this -> CT.globalTimer[TimerPrioQ] -> Enable();
+
+    #endif
+
+    TItem w = first[0];
+
+    if (w==UITEM_MAX())
+    {
+        // Advance to the minimum key and redistribute the elements of the
+        // first non-empty bucket. All these elements move to lower buckets.
+        // The returned element is the same as for Peek()
+
+        unsigned char i = 1;
+
+        while (first[i]==UITEM_MAX()) i++;
+
+        w = MinElement(i);
+        last = (unsigned long)(key[w]);
+
+        TItem x = first[i];
+        first[i] = UITEM_MAX();
+
+        while (x!=UITEM_MAX())
+        {
+            TItem y = next[x];
+            Link(x,BucketIndex((unsigned long)(key[x])));
+            x = y;
+        }
+    }
+
+    Unlink(w);
+    maxIndex--;
+
+    #if defined(_TIMERS_)
+
+    this -> CT.globalTimer[TimerPrioQ] -> Disable();
+
+    #endif
+
+    #if defined(_TRACING_)
+
+    if (this->CT.traceData) Display();
+
+    #endif
+
+    return w;
+}
+
+
+template <class TItem,class TKey>
+TKey radixHeap<TItem,TKey>::Key(TItem w) const throw(ERRange)
+{
+    #if defined(_FAILSAVE_)
+
+    if (w>=n || bucket[w]==NO_BUCKET()) this->NoSuchItem("Key",w);
+
+    #endif
+
+    return key[w];
+}
+
+
+template <class TItem,class TKey>
+void radixHeap<TItem,TKey>::ChangeKey(TItem w,TKey alpha) throw(ERRange,ERRejected)
+{
+    #if defined(_FAILSAVE_)
+
+    if (w>=n || bucket[w]==NO_BUCKET()) this->NoSuchItem("ChangeKey",w);
+
+    if (alpha<TKey(last) || alpha>MaxRadixHeapKey || alpha!=floor(alpha))
+        this -> Error(ERR_REJECTED,"ChangeKey","Key must be integral and monotone");
+
+    #endif
+
+    #if defined(_TIMERS_)
+
+    this -> CT.globalTimer[TimerPrioQ] -> Enable();
+
+    #endif
+
+    key[w] = alpha;
+
+    unsigned char i = BucketIndex((unsigned long)(alpha));
+
+    if (i!=bucket[w])
+    {
+        Unlink(w);
+        Link(w,i);
+    }
+
+    #if defined(_TIMERS_)
+
+    this -> CT.globalTimer[TimerPrioQ] -> Disable();
+
+    #endif
+
+    #if defined(_TRACING_)
+
+    if (this->CT.traceData) Display();
+
+    #endif
+}
+
+
+template <class TItem,class TKey>
+TItem radixHeap<TItem,TKey>::Peek() const throw(ERRejected)
+{
+    #if defined(_FAILSAVE_)
+
+    if (maxIndex==0) this -> Error(ERR_REJECTED,"Peek","Heap is empty");
+
+    #endif
+
+    if (first[0]!=UITEM_MAX()) return first[0];
+
+    unsigned char i = 1;
+
+    while (first[i]==UITEM_MAX()) i++;
+
+    return MinElement(i);
+}
+
+
+template class radixHeap<TNode,TFloat>;
+
+#if defined(_BIG_ARCS_)
+
+template class radixHeap<TArc,TFloat>;
+
+#endif
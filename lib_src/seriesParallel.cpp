@@ -522,7 +522,7 @@ abstractMixedGraph* abstractMixedGraph::ESP_DecompositionTree(
 
             sprintf(CT.logBuffer,
                 "Serial reduction of %li[%li]%li[%li]%li to %li[%li]%li",
-                w1,a1^1,v,a2,w2,w1,2*aNew,w2);
+                (unsigned long)w1,(unsigned long)(a1^1),(unsigned long)v,(unsigned long)a2,(unsigned long)w2,(unsigned long)w1,(unsigned long)(2*aNew),(unsigned long)w2);
             LogEntry(LOG_METH2,CT.logBuffer);
 
             Q.Insert(w1,INSERT_NO_THROW);
@@ -594,7 +594,7 @@ abstractMixedGraph* abstractMixedGraph::ESP_DecompositionTree(
 
             sprintf(CT.logBuffer,
                 "Parallel reduction of %li[%li,%li]%li to %li[%li]%li",
-                v,parallelArc1,parallelArc2,G.EndNode(parallelArc1),v,2*aNew,G.EndNode(parallelArc1));
+                (unsigned long)v,(unsigned long)parallelArc1,(unsigned long)parallelArc2,(unsigned long)G.EndNode(parallelArc1),(unsigned long)v,(unsigned long)(2*aNew),(unsigned long)G.EndNode(parallelArc1));
             LogEntry(LOG_METH2,CT.logBuffer);
 
             GR -> CancelArc(parallelArc1);
@@ -140,7 +140,7 @@ TNode layeredShrNetwork::DDFS(TArc thisPetal) throw(ERRange)
     if (CT.logMeth>1)
     {
         sprintf(CT.logBuffer,"Starting DDFS(%ld), rooted at nodes %ld and %ld",
-            thisPetal,left,right);
+            (unsigned long)thisPetal,(unsigned long)left,(unsigned long)right);
         LogEntry(LOG_METH2,CT.logBuffer);
         OpenFold();
     }
@@ -178,7 +178,7 @@ TNode layeredShrNetwork::DDFS(TArc thisPetal) throw(ERRange)
                     if (CT.logMeth>1)
                     {
                         sprintf(CT.logBuffer,
-                            "Node %ld explored by the left DFS",left);
+                            "Node %ld explored by the left DFS",(unsigned long)left);
                         LogEntry(LOG_METH2,CT.logBuffer);
                     }
 
@@ -198,7 +198,7 @@ TNode layeredShrNetwork::DDFS(TArc thisPetal) throw(ERRange)
                     if (CT.logMeth>1)
                     {
                         sprintf(CT.logBuffer,
-                            "Left backtracking to node %ld",left);
+                            "Left backtracking to node %ld",(unsigned long)left);
                         LogEntry(LOG_METH2,CT.logBuffer);
                     }
 
@@ -241,7 +241,7 @@ TNode layeredShrNetwork::DDFS(TArc thisPetal) throw(ERRange)
                     if (CT.logMeth>1)
                     {
                         sprintf(CT.logBuffer,
-                            "Node %ld explored by the right DFS",right);
+                            "Node %ld explored by the right DFS",(unsigned long)right);
                         LogEntry(LOG_METH2,CT.logBuffer);
                     }
 
@@ -261,7 +261,7 @@ TNode layeredShrNetwork::DDFS(TArc thisPetal) throw(ERRange)
                     if (CT.logMeth>1)
                     {
                         sprintf(CT.logBuffer,
-                            "Right backtracking to node %ld",right);
+                            "Right backtracking to node %ld",(unsigned long)right);
                         LogEntry(LOG_METH2,CT.logBuffer);
                     }
 
@@ -282,10 +282,10 @@ TNode layeredShrNetwork::DDFS(TArc thisPetal) throw(ERRange)
                     if (CT.logMeth>1)
                     {
                         sprintf(CT.logBuffer,
-                            "Node %ld moved to the right DFS",right);
+                            "Node %ld moved to the right DFS",(unsigned long)right);
                         LogEntry(LOG_METH2,CT.logBuffer);
                         sprintf(CT.logBuffer,
-                            "Left backtracking to node %ld",left);
+                            "Left backtracking to node %ld",(unsigned long)left);
                         LogEntry(LOG_METH2,CT.logBuffer);
                     }
 
@@ -322,7 +322,7 @@ void layeredShrNetwork::ShrinkBlossom (TNode b,TArc thisPetal,TFloat tenacity)
 
     if (CT.logMeth>1 && !LeftSupport->Empty())
     {
-        sprintf(CT.logBuffer,"Shrinking %ld",b);
+        sprintf(CT.logBuffer,"Shrinking %ld",(unsigned long)b);
         LH = LogStart(LOG_METH2,CT.logBuffer);
     }
 
@@ -340,7 +340,7 @@ void layeredShrNetwork::ShrinkBlossom (TNode b,TArc thisPetal,TFloat tenacity)
 
         if (CT.logMeth>1 && w!=b)
         {
-            sprintf(CT.logBuffer,",%ld",w);
+            sprintf(CT.logBuffer,",%ld",(unsigned long)w);
             LogAppend(LH,CT.logBuffer);
         }
 
@@ -397,7 +397,7 @@ void layeredShrNetwork::ShrinkBlossom (TNode b,TArc thisPetal,TFloat tenacity)
 
         if (CT.logMeth>1 && w!=b)
         {
-            sprintf(CT.logBuffer,",%ld",w);
+            sprintf(CT.logBuffer,",%ld",(unsigned long)w);
             LogAppend(LH,CT.logBuffer);
         }
 
@@ -475,7 +475,7 @@ void layeredShrNetwork::Expand(TNode x,TNode y) throw()
 
     if (dist[y]<dist[x])
     {
-        sprintf(CT.logBuffer,"Missing start node: %ld",x);
+        sprintf(CT.logBuffer,"Missing start node: %ld",(unsigned long)x);
         InternalError1("Expand");
     }
 
@@ -504,7 +504,7 @@ void layeredShrNetwork::Expand(TNode x,TNode y) throw()
             if (CT.logMeth>1)
             {
                 sprintf(CT.logBuffer,
-                    "Expand(%ld,%ld) puts pred[%ld] = %ld (prop)",x,y,y,a);
+                    "Expand(%ld,%ld) puts pred[%ld] = %ld (prop)",(unsigned long)x,(unsigned long)y,(unsigned long)y,(unsigned long)a);
                 LogEntry(LOG_METH2,CT.logBuffer);
             }
 
@@ -518,7 +518,7 @@ void layeredShrNetwork::Expand(TNode x,TNode y) throw()
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"Expand(%ld,%ld) started...",x,y);
+                sprintf(CT.logBuffer,"Expand(%ld,%ld) started...",(unsigned long)x,(unsigned long)y);
                 LogEntry(LOG_METH2,CT.logBuffer);
                 OpenFold();
             }
@@ -545,7 +545,7 @@ void layeredShrNetwork::Expand(TNode x,TNode y) throw()
             if (CT.logMeth>1)
             {
                 CloseFold();
-                sprintf(CT.logBuffer,"...Expand(%ld,%ld) complete",x,y);
+                sprintf(CT.logBuffer,"...Expand(%ld,%ld) complete",(unsigned long)x,(unsigned long)y);
                 LogEntry(LOG_METH2,CT.logBuffer);
             }
 
@@ -565,7 +565,7 @@ void layeredShrNetwork::CoExpand(TNode x,TNode y) throw()
 
     if (dist[cx]<dist[cy])
     {
-        sprintf(CT.logBuffer,"Missing end node: %ld",y);
+        sprintf(CT.logBuffer,"Missing end node: %ld",(unsigned long)y);
         InternalError1("CoExpand");
     }
 
@@ -594,7 +594,7 @@ void layeredShrNetwork::CoExpand(TNode x,TNode y) throw()
             if (CT.logMeth>1)
             {
                 sprintf(CT.logBuffer,
-                    "CoExpand(%ld,%ld) puts pred[%ld] = %ld (co-prop)",x,y,u,a);
+                    "CoExpand(%ld,%ld) puts pred[%ld] = %ld (co-prop)",(unsigned long)x,(unsigned long)y,(unsigned long)u,(unsigned long)a);
                 LogEntry(LOG_METH2,CT.logBuffer);
             }
 
@@ -608,7 +608,7 @@ void layeredShrNetwork::CoExpand(TNode x,TNode y) throw()
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"CoExpand(%ld,%ld) started...",x,y);
+                sprintf(CT.logBuffer,"CoExpand(%ld,%ld) started...",(unsigned long)x,(unsigned long)y);
                 LogEntry(LOG_METH2,CT.logBuffer);
                 OpenFold();
             }
@@ -637,7 +637,7 @@ void layeredShrNetwork::CoExpand(TNode x,TNode y) throw()
             if (CT.logMeth>1)
             {
                 CloseFold();
-                sprintf(CT.logBuffer,"...CoExpand(%ld,%ld) complete",x,y);
+                sprintf(CT.logBuffer,"...CoExpand(%ld,%ld) complete",(unsigned long)x,(unsigned long)y);
                 LogEntry(LOG_METH2,CT.logBuffer);
             }
 
@@ -667,7 +667,7 @@ void layeredShrNetwork::Traverse(TNode b,TNode x,TNode y,TArc thisPetal,
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"pred[%ld] = %ld (prop)",w,a);
+            sprintf(CT.logBuffer,"pred[%ld] = %ld (prop)",(unsigned long)w,(unsigned long)a);
             LogEntry(LOG_METH2,CT.logBuffer);
         }
 
@@ -684,7 +684,7 @@ void layeredShrNetwork::Traverse(TNode b,TNode x,TNode y,TArc thisPetal,
 
     if (CT.logMeth>1)
     {
-        sprintf(CT.logBuffer,"pred[%ld] = %ld (petal)",v,thisPetal);
+        sprintf(CT.logBuffer,"pred[%ld] = %ld (petal)",(unsigned long)v,(unsigned long)thisPetal);
         LogEntry(LOG_METH2,CT.logBuffer);
     }
 
@@ -706,7 +706,7 @@ void layeredShrNetwork::Traverse(TNode b,TNode x,TNode y,TArc thisPetal,
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"pred[%ld] = %ld (co-prop)",z,a);
+            sprintf(CT.logBuffer,"pred[%ld] = %ld (co-prop)",(unsigned long)z,(unsigned long)a);
             LogEntry(LOG_METH2,CT.logBuffer);
         }
 
@@ -496,6 +496,15 @@ TFloat branchAsyTSP::SolveRelaxation() throw()
 
     if (unfixed==0 && !Feasible()) return InfFloat;
 
+    // Read the scheme state once and consistently. The scheme may be
+    // updated by other threads during parallel node evaluation
+    TArc thisIterations = 0;
+    branchScheme<TArc,TFloat>::TSearchState thisState =
+        branchScheme<TArc,TFloat>::INITIAL_DFS;
+    TFloat savedObjective = InfFloat;
+
+    if (scheme!=NULL) scheme -> Snapshot(thisIterations,thisState,savedObjective);
+
     TFloat objective = InfFloat;
     try
     {
@@ -503,17 +512,17 @@ TFloat branchAsyTSP::SolveRelaxation() throw()
 
         if (    scheme != NULL
              && relaxationMethod >= X->TSP_RELAX_FAST
-             && scheme->nIterations > 1
+             && thisIterations > 1
              && unfixed > 0
-             && scheme->SearchState() != scheme->INITIAL_DFS
-             && objective < scheme->savedObjective-1+CT.epsilon
+             && thisState != scheme->INITIAL_DFS
+             && objective < savedObjective-1+CT.epsilon
            )
         {
             // Apply subgradient optimization for most effective pruning
 
             X -> InitSubgraph();
             X -> ReleasePredecessors();
-            TFloat upperBound = scheme->savedObjective;
+            TFloat upperBound = savedObjective;
             objective = X->TSP_SubOpt1Tree(relaxationMethod,root,upperBound,true);
             X -> MinTree(X->MST_EDMONDS,X->MST_ONE_CYCLE_REDUCED,root);
         }
@@ -863,7 +872,7 @@ TFloat abstractMixedGraph::TSP_SubOpt1Tree(TRelaxTSP method,TNode root,
     TNode bestDev = n;
     unsigned int step = 0;
 
-    sprintf(CT.logBuffer,"Computing minimum %ld-tree...",root);
+    sprintf(CT.logBuffer,"Computing minimum %ld-tree...",(unsigned long)root);
     LogEntry(LOG_METH,CT.logBuffer);
     CT.SuppressLogging();
     TFloat thisBound = MinTree(MST_EDMONDS,MST_ONE_CYCLE_REDUCED,root);
@@ -933,7 +942,7 @@ TFloat abstractMixedGraph::TSP_SubOpt1Tree(TRelaxTSP method,TNode root,
 
         if (step>1)
         {
-            sprintf(CT.logBuffer,"Computing minimum %ld-tree...",root);
+            sprintf(CT.logBuffer,"Computing minimum %ld-tree...",(unsigned long)root);
             LogEntry(LOG_METH,CT.logBuffer);
             CT.SuppressLogging();
             thisBound = MinTree(MST_EDMONDS,MST_ONE_CYCLE_REDUCED,root);
@@ -988,7 +997,7 @@ TFloat abstractMixedGraph::TSP_SubOpt1Tree(TRelaxTSP method,TNode root,
 
         if (CT.logMeth>=2)
         {
-            sprintf(CT.logBuffer,"Nodes with incorrect degrees: %ld",dev);
+            sprintf(CT.logBuffer,"Nodes with incorrect degrees: %ld",(unsigned long)dev);
             LogEntry(LOG_METH2,CT.logBuffer);
         }
 
@@ -1351,7 +1360,7 @@ TFloat abstractMixedGraph::TSP_HeuristicRandom() throw(ERRejected)
 
     if (CT.logMeth>1)
     {
-        sprintf(CT.logBuffer,"Constructed tour: 0,%ld",x);
+        sprintf(CT.logBuffer,"Constructed tour: 0,%ld",(unsigned long)x);
         LH = LogStart(LOG_METH2,CT.logBuffer);
     }
 
@@ -1382,7 +1391,7 @@ TFloat abstractMixedGraph::TSP_HeuristicRandom() throw(ERRejected)
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,",%ld",x);
+            sprintf(CT.logBuffer,",%ld",(unsigned long)x);
             LogAppend(LH,CT.logBuffer);
         }
 
@@ -1476,7 +1485,7 @@ TFloat abstractMixedGraph::TSP_HeuristicInsert(THeurTSP method,TNode r) throw(ER
 
     if (CT.logMeth>1)
     {
-        sprintf(CT.logBuffer,"Root node: %ld",r);
+        sprintf(CT.logBuffer,"Root node: %ld",(unsigned long)r);
         LogEntry(LOG_METH2,CT.logBuffer);
         LH = LogStart(LOG_METH2,"Inserted nodes: ");
     }
@@ -1533,7 +1542,7 @@ TFloat abstractMixedGraph::TSP_HeuristicInsert(THeurTSP method,TNode r) throw(ER
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"%ld,",optNode);
+            sprintf(CT.logBuffer,"%ld,",(unsigned long)optNode);
             LogAppend(LH,CT.logBuffer);
         }
 
@@ -1612,7 +1621,7 @@ TFloat abstractMixedGraph::TSP_HeuristicInsert(THeurTSP method,TNode r) throw(ER
         LogEntry(LOG_RES,CT.logBuffer);
     }
 
-    if (CT.methLocal==LOCAL_OPTIMIZE) sum = TSP_LocalSearch(pred);
+    if (CT.methLocal>=LOCAL_OPTIMIZE) sum = TSP_LocalSearch(pred);
 
     return sum;
 }
@@ -1803,7 +1812,7 @@ TFloat abstractMixedGraph::TSP_HeuristicTree(TNode r) throw(ERRange,ERRejected)
         LogEntry(LOG_RES,CT.logBuffer);
     }
 
-    if (CT.methLocal==LOCAL_OPTIMIZE) sum = TSP_LocalSearch(pred);
+    if (CT.methLocal>=LOCAL_OPTIMIZE) sum = TSP_LocalSearch(pred);
 
     return sum;
 }
@@ -1825,12 +1834,19 @@ TFloat abstractMixedGraph::TSP_LocalSearch(TArc* pred) throw(ERRejected)
     {
         abstractGraph* G = static_cast<abstractGraph*>(this);
 
-        while (CT.SolverRunning() && G->TSP_2Exchange(pred,-MaxLength())) {};
-
-        while (CT.SolverRunning())
+        if (CT.methLocal==LOCAL_LIN_KERNIGHAN)
         {
-            if (G->TSP_2Exchange(pred,0)) continue;
-            if (!TSP_NodeExchange(pred,0)) break;
+            G -> TSP_LinKernighan(pred);
+        }
+        else
+        {
+            while (CT.SolverRunning() && G->TSP_2Exchange(pred,-MaxLength())) {};
+
+            while (CT.SolverRunning())
+            {
+                if (G->TSP_2Exchange(pred,0)) continue;
+                if (!TSP_NodeExchange(pred,0)) break;
+            }
         }
     }
     else
@@ -1918,7 +1934,7 @@ bool abstractMixedGraph::TSP_NodeExchange(TArc* pred,TFloat limit) throw(ERRejec
                     LogEntry(LOG_METH2,CT.logBuffer);
                     sprintf(CT.logBuffer,
                         "New tour: ... %ld %ld ... %ld %ld %ld ...",
-                        u1,v1,u2,x,v2);
+                        (unsigned long)u1,(unsigned long)v1,(unsigned long)u2,(unsigned long)x,(unsigned long)v2);
                     LogEntry(LOG_METH2,CT.logBuffer);
                 }
 
@@ -99,7 +99,7 @@ branchColour::branchColour(abstractMixedGraph& GC,TNode kk,char mode) throw():
 
         if (CT.logMeth)
         {
-            sprintf(CT.logBuffer,"Starting with %ld-clique",i);
+            sprintf(CT.logBuffer,"Starting with %ld-clique",(unsigned long)i);
             LogEntry(LOG_METH,CT.logBuffer);
         }
 
@@ -235,13 +235,13 @@ void branchColour::SetColour(TNode v,TNode c) throw(ERRange,ERRejected)
 
     if (c>=k)
     {
-        sprintf(CT.logBuffer,"No such colour: %ld",c);
+        sprintf(CT.logBuffer,"No such colour: %ld",(unsigned long)c);
         Error(ERR_RANGE,"SetColour",CT.logBuffer);
     }
 
     if (!active[v])
     {
-        sprintf(CT.logBuffer,"Node is coloured or dominated: %ld",v);
+        sprintf(CT.logBuffer,"Node is coloured or dominated: %ld",(unsigned long)v);
         Error(ERR_REJECTED,"SetColour",CT.logBuffer);
     }
 
@@ -294,7 +294,7 @@ void branchColour::Reduce(TNode w) throw(ERRange,ERRejected)
 
         if (conflicts[w]>=k || !active[w])
         {
-            sprintf(CT.logBuffer,"Inappropriate node: %ld",w);
+            sprintf(CT.logBuffer,"Inappropriate node: %ld",(unsigned long)w);
             Error(ERR_REJECTED,"Reduce",CT.logBuffer);
         }
 
@@ -420,7 +420,7 @@ bool branchColour::Complete() throw(ERRejected)
 
             if (c==k)
             {
-                sprintf(CT.logBuffer,"Got stuck at node %ld",v);
+                sprintf(CT.logBuffer,"Got stuck at node %ld",(unsigned long)v);
                 Error(ERR_REJECTED,"Complete",CT.logBuffer);
             }
 
@@ -439,7 +439,7 @@ bool branchColour::Complete() throw(ERRejected)
 
             if (c==k)
             {
-                sprintf(CT.logBuffer,"Got stuck at node %ld",v);
+                sprintf(CT.logBuffer,"Got stuck at node %ld",(unsigned long)v);
                 Error(ERR_REJECTED,"Complete",CT.logBuffer);
             }
 
@@ -761,7 +761,7 @@ TNode abstractMixedGraph::NodeColouring(TNode k) throw()
 
     if (CT.logMeth)
     {
-        sprintf(CT.logBuffer,"Searching for %ld-node colouring...",k0);
+        sprintf(CT.logBuffer,"Searching for %ld-node colouring...",(unsigned long)k0);
         LogEntry(LOG_METH,CT.logBuffer);
     }
 
@@ -781,7 +781,7 @@ TNode abstractMixedGraph::NodeColouring(TNode k) throw()
     if (maxColour<NoNode)
     {
         sprintf(CT.logBuffer,
-            "Starting with %ld-node colouring...",maxColour);
+            "Starting with %ld-node colouring...",(unsigned long)maxColour);
         LogEntry(LOG_METH,CT.logBuffer);
         SetUpperBound(TimerColour,maxColour);
     }
@@ -798,7 +798,7 @@ TNode abstractMixedGraph::NodeColouring(TNode k) throw()
     if (!scheme->feasible)
     {
         delete scheme;
-        sprintf(CT.logBuffer,"...No %ld-node colouring exists",k0);
+        sprintf(CT.logBuffer,"...No %ld-node colouring exists",(unsigned long)k0);
         LogEntry(LOG_RES,CT.logBuffer);
         CloseFold(ModColour);
         CT.maxBBIterations = savedNumBBIterations;
@@ -813,7 +813,7 @@ TNode abstractMixedGraph::NodeColouring(TNode k) throw()
 
         if (CT.logRes)
         {
-            sprintf(CT.logBuffer,"...%ld-node colouring found",maxColour);
+            sprintf(CT.logBuffer,"...%ld-node colouring found",(unsigned long)maxColour);
             LogEntry(LOG_RES,CT.logBuffer);
         }
     }
@@ -836,7 +836,7 @@ TNode abstractMixedGraph::NodeColouring(TNode k) throw()
 
         if (CT.logMeth)
         {
-            sprintf(CT.logBuffer,"Searching for %ld-node colouring...",k0);
+            sprintf(CT.logBuffer,"Searching for %ld-node colouring...",(unsigned long)k0);
             LogEntry(LOG_METH,CT.logBuffer);
         }
 
@@ -884,7 +884,7 @@ TNode abstractMixedGraph::NodeColouring(TNode k) throw()
 
             if (CT.logRes)
             {
-                sprintf(CT.logBuffer,"...%ld-node colouring found",maxColour);
+                sprintf(CT.logBuffer,"...%ld-node colouring found",(unsigned long)maxColour);
                 LogEntry(LOG_RES,CT.logBuffer);
             }
         }
@@ -898,7 +898,7 @@ TNode abstractMixedGraph::NodeColouring(TNode k) throw()
         delete[] savedClique;
     }
 
-    if (   CT.methLocal==LOCAL_OPTIMIZE
+    if (   CT.methLocal>=LOCAL_OPTIMIZE
         && LowerBound(TimerColour)<UpperBound(TimerColour)
        )
     {
@@ -949,11 +949,11 @@ TNode abstractMixedGraph::PlanarColouring() throw(ERRejected)
 
     if (CT.logRes)
     {
-        sprintf(CT.logBuffer,"...%ld-node colouring found",maxColour);
+        sprintf(CT.logBuffer,"...%ld-node colouring found",(unsigned long)maxColour);
         LogEntry(LOG_RES,CT.logBuffer);
     }
 
-    if (   CT.methLocal==LOCAL_OPTIMIZE
+    if (   CT.methLocal>=LOCAL_OPTIMIZE
         && LowerBound(TimerColour)<UpperBound(TimerColour)
        )
     {
@@ -1093,7 +1093,7 @@ TNode abstractMixedGraph::NCLocalSearch() throw(ERRejected)
             if (CT.logMeth>1)
             {
                 sprintf(CT.logBuffer,
-                    "Colour of node %ld is changed to %ld",v,nodeColour[v]);
+                    "Colour of node %ld is changed to %ld",(unsigned long)v,(unsigned long)nodeColour[v]);
                 LogEntry(LOG_METH2,CT.logBuffer);
             }
 
@@ -1151,7 +1151,7 @@ bool abstractMixedGraph::NCKempeExchange(TNode* nodeColour,TNode r,TNode x) thro
     if (CT.logMeth>1)
     {
         sprintf(CT.logBuffer,
-             "Alternating colours %ld,%ld...",colour1,colour2);
+             "Alternating colours %ld,%ld...",(unsigned long)colour1,(unsigned long)colour2);
         LogEntry(LOG_METH2,CT.logBuffer);
     }
 
@@ -1172,7 +1172,7 @@ bool abstractMixedGraph::NCKempeExchange(TNode* nodeColour,TNode r,TNode x) thro
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"%ld ",u);
+            sprintf(CT.logBuffer,"%ld ",(unsigned long)u);
             LogAppend(LH,CT.logBuffer);
         }
 
@@ -1214,7 +1214,7 @@ TNode abstractMixedGraph::CliqueCover(TNode k) throw()
     if (CT.logMeth)
     {
         if (k==NoNode) sprintf(CT.logBuffer,"Computing minimum clique cover...");
-        else sprintf(CT.logBuffer,"Computing %ld-clique cover...",k);
+        else sprintf(CT.logBuffer,"Computing %ld-clique cover...",(unsigned long)k);
         LogEntry(LOG_METH,CT.logBuffer);
     }
     OpenFold(ModColour);
@@ -1242,8 +1242,8 @@ TNode abstractMixedGraph::CliqueCover(TNode k) throw()
 
     if (CT.logRes) 
     {
-        if (chi>0) sprintf(CT.logBuffer,"...%ld-clique cover found",chi);
-        else sprintf(CT.logBuffer,"...No %ld-clique cover found",k);
+        if (chi>0) sprintf(CT.logBuffer,"...%ld-clique cover found",(unsigned long)chi);
+        else sprintf(CT.logBuffer,"...No %ld-clique cover found",(unsigned long)k);
         LogEntry(LOG_RES,CT.logBuffer);
     }
 
@@ -1256,7 +1256,7 @@ TArc abstractMixedGraph::EdgeColouring(TArc k) throw(ERRange)
     if (CT.logMeth)
     {
         if (k==NoNode) sprintf(CT.logBuffer,"Computing minimum edge colouring...");
-        else sprintf(CT.logBuffer,"Computing %ld-edge colouring...",k);
+        else sprintf(CT.logBuffer,"Computing %ld-edge colouring...",(unsigned long)k);
         LogEntry(LOG_METH,CT.logBuffer);
     }
     OpenFold(ModColour);
@@ -1273,7 +1273,7 @@ TArc abstractMixedGraph::EdgeColouring(TArc k) throw(ERRange)
     {
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"Colouring arc %ld...",2*a);
+            sprintf(CT.logBuffer,"Colouring arc %ld...",(unsigned long)(2*a));
             LogEntry(LOG_METH2,CT.logBuffer);
         }
 
@@ -1300,7 +1300,7 @@ TArc abstractMixedGraph::EdgeColouring(TArc k) throw(ERRange)
             delete G;
 
             CloseFold(ModColour);
-            sprintf(CT.logBuffer,"...No %ld-edge colouring exists",k);
+            sprintf(CT.logBuffer,"...No %ld-edge colouring exists",(unsigned long)k);
             LogEntry(LOG_RES,CT.logBuffer);
 
             return NoNode;
@@ -1319,7 +1319,7 @@ TArc abstractMixedGraph::EdgeColouring(TArc k) throw(ERRange)
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"...Available colour is %ld",alpha);
+            sprintf(CT.logBuffer,"...Available colour is %ld",(unsigned long)alpha);
             LogEntry(LOG_METH2,CT.logBuffer);
         }
 
@@ -1380,7 +1380,7 @@ TArc abstractMixedGraph::EdgeColouring(TArc k) throw(ERRange)
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"...Available colour is %ld",beta);
+                sprintf(CT.logBuffer,"...Available colour is %ld",(unsigned long)beta);
                 LogEntry(LOG_METH2,CT.logBuffer);
             }
 
@@ -1406,7 +1406,7 @@ TArc abstractMixedGraph::EdgeColouring(TArc k) throw(ERRange)
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"...Next arc is %ld",aNext);
+                sprintf(CT.logBuffer,"...Next arc is %ld",(unsigned long)aNext);
                 LogEntry(LOG_METH2,CT.logBuffer);
             }
 
@@ -1449,7 +1449,7 @@ TArc abstractMixedGraph::EdgeColouring(TArc k) throw(ERRange)
 
     if (CT.logRes)
     {
-        sprintf(CT.logBuffer,"...%ld-edge colouring found",chi);
+        sprintf(CT.logBuffer,"...%ld-edge colouring found",(unsigned long)chi);
         LogEntry(LOG_RES,CT.logBuffer);
     }
 
@@ -1457,7 +1457,7 @@ TArc abstractMixedGraph::EdgeColouring(TArc k) throw(ERRange)
 
     // Apply local search if a k = chi-1 colouring was requested
 
-    if (CT.methLocal==LOCAL_OPTIMIZE && k<chi)
+    if (CT.methLocal>=LOCAL_OPTIMIZE && k<chi)
     {
         chi = G->NCLocalSearch();
     }
@@ -1483,8 +1483,8 @@ TArc abstractMixedGraph::EdgeColouring(TArc k) throw(ERRange)
 
     if (CT.logRes)
     {
-        if (chi>0) sprintf(CT.logBuffer,"...%ld-edge colouring found",chi);
-        else sprintf(CT.logBuffer,"...No %ld-edge colouring found",k);
+        if (chi>0) sprintf(CT.logBuffer,"...%ld-edge colouring found",(unsigned long)chi);
+        else sprintf(CT.logBuffer,"...No %ld-edge colouring found",(unsigned long)k);
 
         LogEntry(LOG_RES,CT.logBuffer);
     }
@@ -14,6 +14,7 @@
 #include "sparseGraph.h"
 #include "sparseDigraph.h"
 #include "staticStack.h"
+#include "parallelComponents.h"
 
 
 bool abstractMixedGraph::StronglyConnected() throw()
@@ -24,6 +25,8 @@ bool abstractMixedGraph::StronglyConnected() throw()
         return Connected();
     }
 
+    if (CT.methComponents==COMP_PARALLEL) return ParallelStronglyConnected();
+
     OpenFold(ModStrongComponents,NO_INDENT);
 
     LogEntry(LOG_METH,"Computing strongly connected components...");
@@ -134,7 +137,7 @@ bool abstractMixedGraph::StronglyConnected() throw()
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"Component %ld: %ld",i,u);
+                sprintf(CT.logBuffer,"Component %ld: %ld",(unsigned long)i,(unsigned long)u);
                 LH = LogStart(LOG_METH2,CT.logBuffer);
             }
 
@@ -158,7 +161,7 @@ bool abstractMixedGraph::StronglyConnected() throw()
 
                         if (CT.logMeth>1)
                         {
-                            sprintf(CT.logBuffer,",%ld",u);
+                            sprintf(CT.logBuffer,",%ld",(unsigned long)u);
                             LogAppend(LH,CT.logBuffer);
                         }
 
@@ -217,7 +220,7 @@ bool abstractMixedGraph::StronglyConnected() throw()
 
     if (CT.logRes)
     {
-        sprintf(CT.logBuffer,"...Graph has %ld strongly connected components",i);
+        sprintf(CT.logBuffer,"...Graph has %ld strongly connected components",(unsigned long)i);
         LogEntry(LOG_RES,CT.logBuffer);
     }
 
@@ -231,6 +234,8 @@ bool abstractMixedGraph::StronglyConnected() throw()
 
 bool abstractMixedGraph::Connected() throw()
 {
+    if (CT.methComponents==COMP_PARALLEL && n>0) return ParallelConnected();
+
     OpenFold(ModComponents,NO_INDENT);
 
     LogEntry(LOG_METH,"Computing connected components...");
@@ -267,7 +272,7 @@ bool abstractMixedGraph::Connected() throw()
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"Component %ld: %ld",i,u);
+            sprintf(CT.logBuffer,"Component %ld: %ld",(unsigned long)i,(unsigned long)u);
             LH = LogStart(LOG_METH2,CT.logBuffer);
         }
 
@@ -290,7 +295,7 @@ bool abstractMixedGraph::Connected() throw()
 
                     if (CT.logMeth>1)
                     {
-                        sprintf(CT.logBuffer,",%ld",u);
+                        sprintf(CT.logBuffer,",%ld",(unsigned long)u);
                         LogAppend(LH,CT.logBuffer);
                     }
 
@@ -329,7 +334,7 @@ bool abstractMixedGraph::Connected() throw()
 
     if (CT.logRes)
     {
-        sprintf(CT.logBuffer,"...Graph has %ld connected components",i);
+        sprintf(CT.logBuffer,"...Graph has %ld connected components",(unsigned long)i);
         LogEntry(LOG_RES,CT.logBuffer);
     }
 
@@ -343,6 +348,14 @@ bool abstractMixedGraph::Connected() throw()
 
 abstractMixedGraph::TRetDFS abstractMixedGraph::CutNodes(TArc rootArc,TNode* order,TArc* lowArc) throw()
 {
+    // Void graphs are handled by the sequential code without allocating edge colours
+    if (   CT.methComponents==COMP_PARALLEL && m>0
+        && rootArc==NoArc && order==NULL && lowArc==NULL
+       )
+    {
+        return ParallelCutNodes();
+    }
+
     OpenFold(ModBiconnectivity,NO_INDENT);
 
     LogEntry(LOG_METH,"Computing blocks and cut nodes... ");
@@ -503,7 +516,7 @@ abstractMixedGraph::TRetDFS abstractMixedGraph::CutNodes(TArc rootArc,TNode* ord
 
                     if (CT.logMeth>1)
                     {
-                        sprintf(CT.logBuffer,"Block %ld: %ld,",nBlocks,w);
+                        sprintf(CT.logBuffer,"Block %ld: %ld,",(unsigned long)nBlocks,(unsigned long)w);
                         LH = LogStart(LOG_METH2,CT.logBuffer);
                     }
 
@@ -537,7 +550,7 @@ abstractMixedGraph::TRetDFS abstractMixedGraph::CutNodes(TArc rootArc,TNode* ord
 
                         if (CT.logMeth>1)
                         {
-                            sprintf(CT.logBuffer,"%ld,",v);
+                            sprintf(CT.logBuffer,"%ld,",(unsigned long)v);
                             LogAppend(LH,CT.logBuffer);
                         }
 
@@ -568,7 +581,7 @@ abstractMixedGraph::TRetDFS abstractMixedGraph::CutNodes(TArc rootArc,TNode* ord
 
                     if (CT.logMeth>1)
                     {
-                        sprintf(CT.logBuffer,"%ld",u);
+                        sprintf(CT.logBuffer,"%ld",(unsigned long)u);
                         LogEnd(LH,CT.logBuffer);
                     }
 
@@ -621,7 +634,7 @@ abstractMixedGraph::TRetDFS abstractMixedGraph::CutNodes(TArc rootArc,TNode* ord
     {
         sprintf(CT.logBuffer,
             "...Graph has %ld components, %ld blocks and %ld cut nodes",
-            nComponents,nBlocks,c);
+            (unsigned long)nComponents,(unsigned long)nBlocks,(unsigned long)c);
         LogEntry(LOG_RES,CT.logBuffer);
     }
 
@@ -642,6 +655,8 @@ abstractMixedGraph::TRetDFS abstractMixedGraph::CutNodes(TArc rootArc,TNode* ord
 
 bool abstractMixedGraph::Biconnected() throw()
 {
+    if (CT.methComponents==COMP_PARALLEL && n>0) return ParallelBiconnected();
+
     OpenFold(ModBiconnectivity,NO_INDENT);
 
     LogEntry(LOG_METH,"Computing 2-connected components...");
@@ -709,7 +724,7 @@ bool abstractMixedGraph::Biconnected() throw()
     if (CT.logRes)
     {
         sprintf(CT.logBuffer,"...Graph has %ld 2-edge connected components",
-            ncomponents);
+            (unsigned long)ncomponents);
         LogEntry(LOG_RES,CT.logBuffer);
     }
 
@@ -719,6 +734,114 @@ bool abstractMixedGraph::Biconnected() throw()
 }
 
 
+bool abstractMixedGraph::ParallelConnected() throw()
+{
+    OpenFold(ModParallelComponents,NO_INDENT);
+
+    LogEntry(LOG_METH,"Computing connected components in parallel...");
+
+    parallelComponents P(*this);
+    TNode i = P.Connected();
+
+    Trace(n);
+
+    if (CT.logRes)
+    {
+        sprintf(CT.logBuffer,"...Graph has %ld connected components",(unsigned long)i);
+        LogEntry(LOG_RES,CT.logBuffer);
+    }
+
+    SetBounds(TimerComponents,i,i);
+
+    CloseFold(ModParallelComponents,NO_INDENT);
+
+    return (i<=1);
+}
+
+
+bool abstractMixedGraph::ParallelStronglyConnected() throw()
+{
+    OpenFold(ModParallelStrongComp,NO_INDENT);
+
+    LogEntry(LOG_METH,"Computing strongly connected components in parallel...");
+
+    parallelComponents P(*this);
+    TNode i = P.StronglyConnected();
+
+    Trace(n);
+
+    if (CT.logRes)
+    {
+        sprintf(CT.logBuffer,"...Graph has %ld strongly connected components",(unsigned long)i);
+        LogEntry(LOG_RES,CT.logBuffer);
+    }
+
+    SetBounds(TimerComponents,i,i);
+
+    CloseFold(ModParallelStrongComp,NO_INDENT);
+
+    return (i<=1);
+}
+
+
+abstractMixedGraph::TRetDFS abstractMixedGraph::ParallelCutNodes() throw()
+{
+    OpenFold(ModParallelComponents,NO_INDENT);
+
+    LogEntry(LOG_METH,"Computing blocks and cut nodes in parallel...");
+
+    parallelComponents P(*this);
+    TNode nBlocks = P.CutNodes();
+    TNode nComponents = P.NComponents();
+
+    Trace(n);
+
+    if (CT.logRes)
+    {
+        sprintf(CT.logBuffer,
+            "...Graph has %ld components, %ld blocks and %ld cut nodes",
+            (unsigned long)nComponents,(unsigned long)nBlocks,(unsigned long)P.NCutNodes());
+        LogEntry(LOG_RES,CT.logBuffer);
+    }
+
+    SetBounds(TimerComponents,nBlocks,nBlocks);
+
+    CloseFold(ModParallelComponents,NO_INDENT);
+
+    if (nComponents>1) return DFS_DISCONNECTED;
+    if (nBlocks<=1)    return DFS_BICONNECTED;
+
+    return DFS_MULTIPLE_BLOCKS;
+}
+
+
+bool abstractMixedGraph::ParallelBiconnected() throw()
+{
+    OpenFold(ModParallelComponents,NO_INDENT);
+
+    LogEntry(LOG_METH,"Computing 2-edge connected components in parallel...");
+
+    parallelComponents P(*this);
+    P.CutNodes();
+    TNode nComponents = P.TwoEdgeConnected();
+
+    Trace(n);
+
+    if (CT.logRes)
+    {
+        sprintf(CT.logBuffer,"...Graph has %ld 2-edge connected components",
+            (unsigned long)nComponents);
+        LogEntry(LOG_RES,CT.logBuffer);
+    }
+
+    SetBounds(TimerComponents,nComponents,nComponents);
+
+    CloseFold(ModParallelComponents,NO_INDENT);
+
+    return (nComponents==1);
+}
+
+
 bool abstractMixedGraph::STNumbering(TArc rootArc,TNode source,TNode target) throw()
 {
     OpenFold(ModBiconnectivity,NO_INDENT);
@@ -841,7 +964,7 @@ bool abstractMixedGraph::STNumbering(TArc rootArc,TNode source,TNode target) thr
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"Path 0 : %ld",target);
+            sprintf(CT.logBuffer,"Path 0 : %ld",(unsigned long)target);
             LH = LogStart(LOG_METH2,CT.logBuffer);
         }
 
@@ -864,7 +987,7 @@ bool abstractMixedGraph::STNumbering(TArc rootArc,TNode source,TNode target) thr
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"[%ld]%ld",a2^1,w);
+                sprintf(CT.logBuffer,"[%ld]%ld",(unsigned long)(a2^1),(unsigned long)w);
                 LogAppend(LH,CT.logBuffer);
             }
 
@@ -943,7 +1066,7 @@ bool abstractMixedGraph::STNumbering(TArc rootArc,TNode source,TNode target) thr
 
                 if (CT.logMeth>1)
                 {
-                    sprintf(CT.logBuffer,"Path %ld : %ld",nrPath,w);
+                    sprintf(CT.logBuffer,"Path %ld : %ld",(unsigned long)nrPath,(unsigned long)w);
                     LH = LogStart(LOG_METH2,CT.logBuffer);
                 }
 
@@ -964,7 +1087,7 @@ bool abstractMixedGraph::STNumbering(TArc rootArc,TNode source,TNode target) thr
 
                     if (CT.logMeth>1)
                     {
-                        sprintf(CT.logBuffer,"[%ld]%ld",a2^1,w);
+                        sprintf(CT.logBuffer,"[%ld]%ld",(unsigned long)(a2^1),(unsigned long)w);
                         LogAppend(LH,CT.logBuffer);
                     }
 
@@ -1012,12 +1135,12 @@ bool abstractMixedGraph::STNumbering(TArc rootArc,TNode source,TNode target) thr
 
     if (feasible)
     {
-        sprintf(CT.logBuffer,"...(%lu,%lu)-numbering found",source,target);
+        sprintf(CT.logBuffer,"...(%lu,%lu)-numbering found",(unsigned long)source,(unsigned long)target);
         LogEntry(LOG_RES,CT.logBuffer);
     }
     else
     {
-        sprintf(CT.logBuffer,"...No (%lu,%lu)-numbering exists",source,target);
+        sprintf(CT.logBuffer,"...No (%lu,%lu)-numbering exists",(unsigned long)source,(unsigned long)target);
         LogEntry(LOG_RES,CT.logBuffer);
     }
 
@@ -1118,12 +1241,12 @@ bool abstractMixedGraph::EdgeConnected(TCap k) throw()
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"Trying to separate: %ld",revMap[0]);
+                sprintf(CT.logBuffer,"Trying to separate: %ld",(unsigned long)revMap[0]);
                 THandle LH = LogStart(LOG_METH2,CT.logBuffer);
 
                 for (TNode u=1;u<nCurrent;u++)
                 {
-                    sprintf(CT.logBuffer,",%ld",revMap[u]);
+                    sprintf(CT.logBuffer,",%ld",(unsigned long)revMap[u]);
                     LogAppend(LH,CT.logBuffer);
                 }
 
@@ -1176,7 +1299,7 @@ bool abstractMixedGraph::EdgeConnected(TCap k) throw()
     delete[] map;
     delete[] revMap;
 
-    sprintf(CT.logBuffer,"...Graph has %ld %g-edge connected components",cNext,k);
+    sprintf(CT.logBuffer,"...Graph has %ld %g-edge connected components",(unsigned long)cNext,k);
     LogEntry(LOG_RES,CT.logBuffer);
 
     CloseFold(ModComponents,NO_INDENT);
@@ -1275,12 +1398,12 @@ bool abstractMixedGraph::StronglyEdgeConnected(TCap k) throw()
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"Trying to separate: %ld",revMap[0]);
+                sprintf(CT.logBuffer,"Trying to separate: %ld",(unsigned long)revMap[0]);
                 THandle LH = LogStart(LOG_METH2,CT.logBuffer);
 
                 for (TNode u=1;u<nCurrent;u++)
                 {
-                    sprintf(CT.logBuffer,",%ld",revMap[u]);
+                    sprintf(CT.logBuffer,",%ld",(unsigned long)revMap[u]);
                     LogAppend(LH,CT.logBuffer);
                 }
 
@@ -1334,7 +1457,7 @@ bool abstractMixedGraph::StronglyEdgeConnected(TCap k) throw()
     delete[] revMap;
 
     sprintf(CT.logBuffer,
-        "...Graph has %ld strong %g-edge connected components",cNext,k);
+        "...Graph has %ld strong %g-edge connected components",(unsigned long)cNext,k);
     LogEntry(LOG_RES,CT.logBuffer);
 
     CloseFold(ModComponents,NO_INDENT);
@@ -40,7 +40,11 @@ TFloat abstractBalancedFNW::MinCBalFlow(TNode s) throw(ERRange,ERRejected)
             break;
         }
         case 1:
+        case 2:
         {
+            // The native blossom method (2) applies to 1-matching problems
+            // only and is dispatched by abstractGraph::MinCMatching()
+
             ret = EnhancedPD(s);
             break;
         }
@@ -15,6 +15,7 @@
 #include "nestedFamily.h"
 #include "lpSolver.h"
 #include "networkSimplex.h"
+#include "radixHeap.h"
 
 
 TFloat abstractMixedGraph::MinCostSTFlow(TMethMCFST method,TNode s,TNode t)
@@ -58,7 +59,7 @@ TFloat abstractMixedGraph::MinCostSTFlow(TMethMCFST method,TNode s,TNode t)
 
         if (G->Divergence(i)!=G->Demand(i))
         {
-            sprintf(CT.logBuffer,"Node %lu is unbalanced",i);
+            sprintf(CT.logBuffer,"Node %lu is unbalanced",(unsigned long)i);
             Error(ERR_REJECTED,"MinCostSTFlow",CT.logBuffer);
         }
     }
@@ -83,7 +84,7 @@ TFloat abstractMixedGraph::MinCostSTFlow(TMethMCFST method,TNode s,TNode t)
 
     if (CT.logMeth)
     {
-        sprintf(CT.logBuffer,"Computing minimum cost (%ld,%ld)-flow...",s,t);
+        sprintf(CT.logBuffer,"Computing minimum cost (%ld,%ld)-flow...",(unsigned long)s,(unsigned long)t);
         LogEntry(LOG_METH,CT.logBuffer);
     }
 
@@ -245,6 +246,24 @@ TFloat abstractDiGraph::MCF_BusackerGowen(TNode s,TNode t) throw(ERRejected)
 }
 
 
+static bool IntegralPotentials(const TFloat* potential,TNode n) throw()
+{
+    if (!potential) return true;
+
+    for (TNode v=0;v<n;v++)
+    {
+        if (   fabs(potential[v])>MaxRadixHeapKey/4
+            || potential[v]!=floor(potential[v])
+           )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
 TFloat abstractDiGraph::MCF_EdmondsKarp(TNode s,TNode t) throw(ERRejected)
 {
     TFloat delta = Demand(t);
@@ -300,7 +319,14 @@ TFloat abstractDiGraph::MCF_EdmondsKarp(TNode s,TNode t) throw(ERRejected)
     #endif
 
 
-    nHeap = NewNodeHeap();
+    // The reduced length distance labels are non-negative. If the length
+    // labels and the node potentials are integral, the distance labels can
+    // be managed by a monotone priority queue
+    if (IntegralLengths() && IntegralPotentials(GetPotentials(),n))
+    {
+        nHeap = NewMonotoneNodeHeap();
+    }
+    else nHeap = NewNodeHeap();
 
     TArc* pred = NULL;
 
@@ -432,6 +458,11 @@ TFloat abstractMixedGraph::MinCostBFlow(TMethMCF method) throw(ERRejected)
             ret = G->MCF_CostScaling(method);
             break;
         }
+        case MCF_BF_ENHANCED:
+        {
+            ret = G->MCF_EnhancedCostScaling();
+            break;
+        }
         case MCF_BF_MEAN:
         {
             ret = G->MCF_MinMeanCycleCanceling();
@@ -808,7 +839,7 @@ TFloat abstractDiGraph::MCF_CostScaling(TMethMCF method) throw()
                 {
                     sprintf(CT.logBuffer,
                         "Pushed %g flow units from node %ld to node %ld",
-                        ResCap(a),StartNode(a),EndNode(a));
+                        ResCap(a),(unsigned long)StartNode(a),(unsigned long)EndNode(a));
                     LogEntry(LOG_METH2,CT.logBuffer);
                 }
 
@@ -865,7 +896,7 @@ TFloat abstractDiGraph::MCF_CostScaling(TMethMCF method) throw()
                     {
                         sprintf(CT.logBuffer,
                             "Pushed %g flow units from node %ld to node %ld",
-                            Lambda,v,w);
+                            Lambda,(unsigned long)v,(unsigned long)w);
                         LogEntry(LOG_METH2,CT.logBuffer);
                     }
 
@@ -884,7 +915,7 @@ TFloat abstractDiGraph::MCF_CostScaling(TMethMCF method) throw()
                 if (CT.logMeth>1)
                 {
                     sprintf(CT.logBuffer,"Relabelled node %ld: %g -> %g",
-                        v,potential[v],potential[v]-epsilon/2);
+                        (unsigned long)v,potential[v],potential[v]-epsilon/2);
                     LogEntry(LOG_METH2,CT.logBuffer);
                 }
 
@@ -1183,7 +1214,7 @@ TFloat abstractDiGraph::MCF_NWSimplex() throw()
     {
         unbounded = NWSimplexData.PivotOperation(a);
 
-        static TArc i = 1;
+        static __thread TArc i = 1;
         i++;
 
         if (i*100>m)
@@ -1371,7 +1402,7 @@ void abstractDiGraph::MCF_NWSimplexStrongTree() throw()
 
                 if (CT.logMeth>1)
                 {
-                    sprintf(CT.logBuffer,"inArc[%ld] = %ld",v,a);
+                    sprintf(CT.logBuffer,"inArc[%ld] = %ld",(unsigned long)v,(unsigned long)a);
                     LogEntry(LOG_METH2,CT.logBuffer);
                 }
 
@@ -1401,7 +1432,7 @@ void abstractDiGraph::MCF_NWSimplexStrongTree() throw()
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"Merging cycle (%ld",u);
+                sprintf(CT.logBuffer,"Merging cycle (%ld",(unsigned long)u);
                 LH = LogStart(LOG_METH2,CT.logBuffer);
             }
 
@@ -1420,7 +1451,7 @@ void abstractDiGraph::MCF_NWSimplexStrongTree() throw()
 
                 if (CT.logMeth>1)
                 {
-                    sprintf(CT.logBuffer,",%ld",w);
+                    sprintf(CT.logBuffer,",%ld",(unsigned long)w);
                     LogAppend(LH,CT.logBuffer);
                 }
 
@@ -1432,7 +1463,7 @@ void abstractDiGraph::MCF_NWSimplexStrongTree() throw()
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,",%ld)",u);
+                sprintf(CT.logBuffer,",%ld)",(unsigned long)u);
                 LogEnd(LH,CT.logBuffer);
             }
 
@@ -1476,7 +1507,7 @@ void abstractDiGraph::MCF_NWSimplexStrongTree() throw()
 
             if (CT.logMeth>1 && IsDirected())
             {
-                sprintf(CT.logBuffer,"inArc[%ld] = *",thisRoot);
+                sprintf(CT.logBuffer,"inArc[%ld] = *",(unsigned long)thisRoot);
                 LogEntry(LOG_METH2,CT.logBuffer);
             }
 
@@ -1493,7 +1524,7 @@ void abstractDiGraph::MCF_NWSimplexStrongTree() throw()
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"inArc[%ld] = %ld",u,a);
+                sprintf(CT.logBuffer,"inArc[%ld] = %ld",(unsigned long)u,(unsigned long)a);
                 LogEntry(LOG_METH2,CT.logBuffer);
             }
 
@@ -1513,7 +1544,7 @@ void abstractDiGraph::MCF_NWSimplexStrongTree() throw()
 
     if (CT.logRes && n>rank+1)
     {
-        sprintf(CT.logBuffer,"...Network splits into %ld independent problems",n-rank);
+        sprintf(CT.logBuffer,"...Network splits into %ld independent problems",(unsigned long)(n-rank));
         LogEntry(LOG_METH,CT.logBuffer);
     }
 }
@@ -14,6 +14,7 @@
 #include "sparseBigraph.h"
 #include "graphToBalanced.h"
 #include "bigraphToDigraph.h"
+#include "parallelAuction.h"
 #include "binaryHeap.h"
 
 
@@ -80,6 +81,11 @@ bool abstractGraph::MinCMatching() throw()
     {
         ret = PMHeuristicsCandidates();
     }
+    else if (CT.methMinCBalFlow==2 && CDemand() && MaxDemand()==1 && MaxLCap()==0)
+    {
+        ret = PMWeightedBlossom();
+        Trace();
+    }
     else
     {
         InitSubgraph();
@@ -108,16 +114,24 @@ bool abstractGraph::MinCMatching(TCap cDeg) throw()
 
     OpenFold(ModMatching);
 
-    InitSubgraph();
     bool ret = false;
 
-    try
+    if (CT.methMinCBalFlow==2 && cDeg==1 && MaxLCap()==0)
     {
-        graphToBalanced G(*this,cDeg);
-        G.MinCBalFlow(G.Source());
-        ret = G.Perfect();
+        ret = PMWeightedBlossom();
+    }
+    else
+    {
+        InitSubgraph();
+
+        try
+        {
+            graphToBalanced G(*this,cDeg);
+            G.MinCBalFlow(G.Source());
+            ret = G.Perfect();
+        }
+        catch (ERRejected) {}
     }
-    catch (ERRejected) {}
 
     Trace();
 
@@ -228,7 +242,7 @@ bool abstractGraph::PMHeuristicsCandidates() throw()
 
     if (CT.logRes)
     {
-        sprintf(CT.logBuffer,"...candidate subgraph has %ld arcs",G.M());
+        sprintf(CT.logBuffer,"...candidate subgraph has %ld arcs",(unsigned long)G.M());
         LogEntry(LOG_RES,CT.logBuffer);
     }
 
@@ -384,7 +398,7 @@ TFloat abstractGraph::PMHeuristicsRandom() throw()
                 {
                     sprintf(CT.logBuffer,
                         "Adding arc %ld(%ld)%ld with multiplicity %.3f",
-                        v,a,w,lambda);
+                        (unsigned long)v,(unsigned long)a,(unsigned long)w,lambda);
                     LogEntry(LOG_METH2,CT.logBuffer);
                 }
             }
@@ -560,6 +574,13 @@ bool abstractBiGraph::MaximumAssignment(TCap *pLower,TCap *pDeg) throw()
 }
 
 
+bool abstractBiGraph::NativeAssignment(TCap cDeg) throw()
+{
+    return (   CT.methAssignment!=MCA_FLOW
+            && n1==n2 && n1>0 && cDeg==1 && MaxLCap()==0);
+}
+
+
 bool abstractBiGraph::MinCAssignment() throw()
 {
     LogEntry(LOG_METH,"Computing optimal assignment...");
@@ -567,8 +588,22 @@ bool abstractBiGraph::MinCAssignment() throw()
     OpenFold(ModMatching);
 
     bool ret = false;
+    bool native = CDemand() && NativeAssignment(MaxDemand());
 
-    if (IsDense() && CT.methCandidates>=0)
+    if (native)
+    {
+        if (CT.methAssignment==MCA_AUCTION) ret = MCA_Auction();
+        else ret = MCA_JonkerVolgenant();
+    }
+
+    // Without a perfect assignment, the flow method determines
+    // a maximum assignment of minimum cost
+
+    if (native && (ret || !CT.SolverRunning()))
+    {
+        Trace();
+    }
+    else if (IsDense() && CT.methCandidates>=0)
     {
         ret = PMHeuristicsCandidates();
     }
@@ -599,16 +634,26 @@ bool abstractBiGraph::MinCAssignment(TCap cDeg) throw()
 
     OpenFold(ModMatching);
 
-    InitSubgraph();
     bool ret = false;
 
-    try
+    if (NativeAssignment(cDeg))
     {
-        bigraphToDigraph G(*this,cDeg);
-        G.MinCostSTFlow(G.Source(),G.Target());
-        ret = G.Perfect();
+        if (CT.methAssignment==MCA_AUCTION) ret = MCA_Auction();
+        else ret = MCA_JonkerVolgenant();
+    }
+
+    if (!ret && CT.SolverRunning())
+    {
+        InitSubgraph();
+
+        try
+        {
+            bigraphToDigraph G(*this,cDeg);
+            G.MinCostSTFlow(G.Source(),G.Target());
+            ret = G.Perfect();
+        }
+        catch (ERRejected) {CloseFold();};
     }
-    catch (ERRejected) {CloseFold();};
 
     Trace();
 
@@ -643,6 +688,46 @@ bool abstractBiGraph::MinCAssignment(TCap *pLower,TCap *pDeg) throw()
 }
 
 
+bool abstractBiGraph::MCA_Auction() throw()
+{
+    // The method depends on integral arc lengths. Scaled lengths and
+    // prices must be represented exactly by floating point numbers
+
+    TFloat maxLength = 0;
+    bool integral = true;
+
+    for (TArc a=0;a<m && integral;a++)
+    {
+        TFloat l = fabs(Length(2*a));
+
+        if (l!=floor(l) || l==InfFloat) integral = false;
+
+        if (l>maxLength) maxLength = l;
+    }
+
+    if (!integral || maxLength*(n1+1)*(n1+1)*16>1e15)
+    {
+        LogEntry(LOG_METH,"...Arc lengths are not small integers");
+        return MCA_JonkerVolgenant();
+    }
+
+    OpenFold(ModAuction,SHOW_TITLE);
+
+    bool ret = false;
+
+    try
+    {
+        parallelAuction A(*this);
+        ret = A.Solve();
+    }
+    catch (ERRejected) {}
+
+    CloseFold(ModAuction);
+
+    return ret;
+}
+
+
 bool abstractBiGraph::PMHeuristicsCandidates() throw()
 {
     LogEntry(LOG_METH,"(Candidate Subgraph Heuristics)");
@@ -709,7 +794,7 @@ bool abstractBiGraph::PMHeuristicsCandidates() throw()
 
     if (CT.logRes)
     {
-        sprintf(CT.logBuffer,"...candidate subgraph has %ld arcs",G.M());
+        sprintf(CT.logBuffer,"...candidate subgraph has %ld arcs",(unsigned long)G.M());
         LogEntry(LOG_RES,CT.logBuffer);
     }
 
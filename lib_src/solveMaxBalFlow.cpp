@@ -423,7 +423,7 @@ void abstractBalancedFNW::Expand(TFloat* dist,TArc* pred,TNode x,TNode y) throw(
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"Expand(%ld,%ld) puts ",x,y);
+            sprintf(CT.logBuffer,"Expand(%ld,%ld) puts ",(unsigned long)x,(unsigned long)y);
             LH = LogStart(LOG_METH2,CT.logBuffer);
         }
 
@@ -439,7 +439,7 @@ void abstractBalancedFNW::Expand(TFloat* dist,TArc* pred,TNode x,TNode y) throw(
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"pred[%ld] = %ld (prop)",y,a);
+                sprintf(CT.logBuffer,"pred[%ld] = %ld (prop)",(unsigned long)y,(unsigned long)a);
                 LogAppend(LH,CT.logBuffer);
             }
 
@@ -458,7 +458,7 @@ void abstractBalancedFNW::Expand(TFloat* dist,TArc* pred,TNode x,TNode y) throw(
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"pred[%ld] = %ld (petal)",v,a);
+                sprintf(CT.logBuffer,"pred[%ld] = %ld (petal)",(unsigned long)v,(unsigned long)a);
                 LogAppend(LH,CT.logBuffer);
             }
 
@@ -494,7 +494,7 @@ void abstractBalancedFNW::CoExpand(TFloat* dist,TArc* pred,TNode v,TNode y) thro
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"CoExpand(%ld,%ld) puts ",v,y);
+            sprintf(CT.logBuffer,"CoExpand(%ld,%ld) puts ",(unsigned long)v,(unsigned long)y);
             LogEntry(LOG_METH2,CT.logBuffer);
         }
 
@@ -513,7 +513,7 @@ void abstractBalancedFNW::CoExpand(TFloat* dist,TArc* pred,TNode v,TNode y) thro
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"pred[%ld] = %ld (co-prop)",x,a);
+                sprintf(CT.logBuffer,"pred[%ld] = %ld (co-prop)",(unsigned long)x,(unsigned long)a);
                 LogAppend(LH,CT.logBuffer);
             }
 
@@ -532,7 +532,7 @@ void abstractBalancedFNW::CoExpand(TFloat* dist,TArc* pred,TNode v,TNode y) thro
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"pred[%ld] = %ld (petal)",w,a);
+                sprintf(CT.logBuffer,"pred[%ld] = %ld (petal)",(unsigned long)w,(unsigned long)a);
                 LogAppend(LH,CT.logBuffer);
             }
 
@@ -583,7 +583,7 @@ bool abstractBalancedFNW::BNSKocayStone(TNode s,TNode t) throw(ERRange)
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"Expanding node %ld",u);
+            sprintf(CT.logBuffer,"Expanding node %ld",(unsigned long)u);
             LogEntry(LOG_METH2,CT.logBuffer);
         }
 
@@ -607,7 +607,7 @@ bool abstractBalancedFNW::BNSKocayStone(TNode s,TNode t) throw(ERRange)
 
                     if (CT.logMeth>1)
                     {
-                        sprintf(CT.logBuffer,"New bud {%ld}",v);
+                        sprintf(CT.logBuffer,"New bud {%ld}",(unsigned long)v);
                         LogEntry(LOG_METH2,CT.logBuffer);
                     }
 
@@ -704,7 +704,7 @@ bool abstractBalancedFNW::BNSKocayStone(TNode s,TNode t) throw(ERRange)
 
                     if (CT.logMeth>1)
                     {
-                        sprintf(CT.logBuffer,"Shrinking %ld",x);
+                        sprintf(CT.logBuffer,"Shrinking %ld",(unsigned long)x);
                         LH = LogStart(LOG_METH2,CT.logBuffer);
                     }
 
@@ -719,7 +719,7 @@ bool abstractBalancedFNW::BNSKocayStone(TNode s,TNode t) throw(ERRange)
 
                         if (CT.logMeth>1)
                         {
-                            sprintf(CT.logBuffer,",%ld",y);
+                            sprintf(CT.logBuffer,",%ld",(unsigned long)y);
                             LogAppend(LH,CT.logBuffer);
                         }
 
@@ -810,7 +810,7 @@ bool abstractBalancedFNW::BNSKamedaMunro(TNode s,TNode t) throw(ERRange)
 
             if (u!=NoNode && CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"Backtracking to %ld",u);
+                sprintf(CT.logBuffer,"Backtracking to %ld",(unsigned long)u);
                 LogEntry(LOG_METH2,CT.logBuffer);
             }
 
@@ -840,7 +840,7 @@ bool abstractBalancedFNW::BNSKamedaMunro(TNode s,TNode t) throw(ERRange)
                     if (CT.logMeth>1)
                     {
                         sprintf(CT.logBuffer,"New bud {%ld}, timestamp = %ld",
-                            v,timeStamp[v]);
+                            (unsigned long)v,(unsigned long)timeStamp[v]);
                         LogEntry(LOG_METH2,CT.logBuffer);
                     }
 
@@ -852,7 +852,7 @@ bool abstractBalancedFNW::BNSKamedaMunro(TNode s,TNode t) throw(ERRange)
 
                     if (CT.logMeth>1)
                     {
-                        sprintf(CT.logBuffer,"New bud {%ld}",v);
+                        sprintf(CT.logBuffer,"New bud {%ld}",(unsigned long)v);
                         LogEntry(LOG_METH2,CT.logBuffer);
                     }
 
@@ -892,7 +892,7 @@ bool abstractBalancedFNW::BNSKamedaMunro(TNode s,TNode t) throw(ERRange)
 
                     if (CT.logMeth>1)
                     {
-                        sprintf(CT.logBuffer,"Shrinking %ld",u);
+                        sprintf(CT.logBuffer,"Shrinking %ld",(unsigned long)u);
                         LH = LogStart(LOG_METH2,CT.logBuffer);
                     }
 
@@ -921,7 +921,7 @@ bool abstractBalancedFNW::BNSKamedaMunro(TNode s,TNode t) throw(ERRange)
 
                         if (CT.logMeth>1)
                         {
-                            sprintf(CT.logBuffer,"Shrinking %ld",u);
+                            sprintf(CT.logBuffer,"Shrinking %ld",(unsigned long)u);
                             LH = LogStart(LOG_METH2,CT.logBuffer);
                         }
 
@@ -951,7 +951,7 @@ bool abstractBalancedFNW::BNSKamedaMunro(TNode s,TNode t) throw(ERRange)
 
                     if (CT.logMeth>1)
                     {
-                        sprintf(CT.logBuffer,",%ld",u);
+                        sprintf(CT.logBuffer,",%ld",(unsigned long)u);
                         LogAppend(LH,CT.logBuffer);
                     }
 
@@ -963,7 +963,7 @@ bool abstractBalancedFNW::BNSKamedaMunro(TNode s,TNode t) throw(ERRange)
                 if (shrunk && CT.logMeth>1)
                 {
                     sprintf(CT.logBuffer," (tenacity %g, target %ld)",
-                        tenacity,v);
+                        tenacity,(unsigned long)v);
                     LogEnd(LH,CT.logBuffer);
                 }
 
@@ -976,7 +976,7 @@ bool abstractBalancedFNW::BNSKamedaMunro(TNode s,TNode t) throw(ERRange)
 
                 if (shrunk && CT.logMeth>1)
                 {
-                    sprintf(CT.logBuffer,"Considering node %ld",u);
+                    sprintf(CT.logBuffer,"Considering node %ld",(unsigned long)u);
                     LogEntry(LOG_METH2,CT.logBuffer);
                 }
 
@@ -1031,7 +1031,7 @@ bool abstractBalancedFNW::BNSHeuristicsBF(TNode s,TNode t) throw(ERRange)
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"%ld,",u);
+            sprintf(CT.logBuffer,"%ld,",(unsigned long)u);
             LogAppend(LH,CT.logBuffer);
         }
 
@@ -1204,7 +1204,7 @@ TFloat abstractBalancedFNW::MicaliVazirani(TNode s,TNode tt) throw(ERRange)
             if (CT.logMeth && Q[i]!=NULL && !Q[i]->Empty())
             {
                 sprintf(CT.logBuffer,
-                    "Exploring minlevel nodes with distance %ld...",i+1);
+                    "Exploring minlevel nodes with distance %ld...",(unsigned long)(i+1));
                 LogEntry(LOG_METH2,CT.logBuffer);
             }
 
@@ -1223,7 +1223,7 @@ TFloat abstractBalancedFNW::MicaliVazirani(TNode s,TNode tt) throw(ERRange)
 
                 if (CT.logMeth>1)
                 {
-                    sprintf(CT.logBuffer,"Expanding node %ld",v);
+                    sprintf(CT.logBuffer,"Expanding node %ld",(unsigned long)v);
                     LogEntry(LOG_METH2,CT.logBuffer);
                     OpenFold();
                 }
@@ -1247,7 +1247,7 @@ TFloat abstractBalancedFNW::MicaliVazirani(TNode s,TNode tt) throw(ERRange)
 
                                 if (CT.logMeth>1)
                                 {
-                                    sprintf(CT.logBuffer,"Node %ld explored",w);
+                                    sprintf(CT.logBuffer,"Node %ld explored",(unsigned long)w);
                                     LogEntry(LOG_METH2,CT.logBuffer);
                                 }
 
@@ -1269,7 +1269,7 @@ TFloat abstractBalancedFNW::MicaliVazirani(TNode s,TNode tt) throw(ERRange)
                             if (CT.logMeth>1)
                             {
                                 sprintf(CT.logBuffer,
-                                    "Prop %ld with end node %ld inserted",a,w);
+                                    "Prop %ld with end node %ld inserted",(unsigned long)a,(unsigned long)w);
                                 LogEntry(LOG_METH2,CT.logBuffer);
                             }
 
@@ -1287,7 +1287,7 @@ TFloat abstractBalancedFNW::MicaliVazirani(TNode s,TNode tt) throw(ERRange)
                                 if (CT.logMeth>1)
                                 {
                                     sprintf(CT.logBuffer,
-                                        "Anomaly %ld with end node %ld detected",a,w);
+                                        "Anomaly %ld with end node %ld detected",(unsigned long)a,(unsigned long)w);
                                     LogEntry(LOG_METH2,CT.logBuffer);
                                 }
 
@@ -1312,7 +1312,7 @@ TFloat abstractBalancedFNW::MicaliVazirani(TNode s,TNode tt) throw(ERRange)
                                 if (CT.logMeth>1)
                                 {
                                     sprintf(CT.logBuffer,
-                                        "Bridge %ld with tenacity %ld detected",a,index);
+                                        "Bridge %ld with tenacity %ld detected",(unsigned long)a,(unsigned long)index);
                                     LogEntry(LOG_METH2,CT.logBuffer);
                                 }
 
@@ -1348,7 +1348,7 @@ TFloat abstractBalancedFNW::MicaliVazirani(TNode s,TNode tt) throw(ERRange)
                 if (CT.logMeth && !Bridges[tenacity]->Empty())
                 {
                     sprintf(CT.logBuffer,
-                        "Exploring maxlevel nodes with tenacity %ld...",tenacity);
+                        "Exploring maxlevel nodes with tenacity %ld...",(unsigned long)tenacity);
                     LogEntry(LOG_METH2,CT.logBuffer);
                 }
 
@@ -1396,7 +1396,7 @@ TFloat abstractBalancedFNW::MicaliVazirani(TNode s,TNode tt) throw(ERRange)
                 if (CT.logMeth && !Bridges[tenacity]->Empty())
                 {
                     sprintf(CT.logBuffer,
-                        "Exploring maxlevel nodes with tenacity %ld...",tenacity);
+                        "Exploring maxlevel nodes with tenacity %ld...",(unsigned long)tenacity);
                     LogEntry(LOG_METH2,CT.logBuffer);
                 }
 
@@ -1454,7 +1454,7 @@ TFloat abstractBalancedFNW::MicaliVazirani(TNode s,TNode tt) throw(ERRange)
                 if (CT.logMeth)
                 {
                     sprintf(CT.logBuffer,
-                        "...Phase %ld complete",i);
+                        "...Phase %ld complete",(unsigned long)i);
                     LogEntry(LOG_METH,CT.logBuffer);
                 }
 
@@ -224,7 +224,7 @@ TNode branchMaxCut::SelectVariable() throw()
 
     if (maxNode==NoNode)
     {
-        sprintf(CT.logBuffer,"All variables are fixed: %ld",unfixed);
+        sprintf(CT.logBuffer,"All variables are fixed: %ld",(unsigned long)unfixed);
         InternalError1("Raise");
     }
 
@@ -683,8 +683,8 @@ TFloat abstractMixedGraph::MXC_HeuristicGRASP(TNode s,TNode t)
 
         if (CT.logMeth>1)
         {
-            if (dir) sprintf(CT.logBuffer,"%ld[S] ",u);
-            else sprintf(CT.logBuffer,"%ld[T] ",u);
+            if (dir) sprintf(CT.logBuffer,"%ld[S] ",(unsigned long)u);
+            else sprintf(CT.logBuffer,"%ld[T] ",(unsigned long)u);
 
             LogAppend(LH,CT.logBuffer);
         }
@@ -716,7 +716,7 @@ TFloat abstractMixedGraph::MXC_HeuristicGRASP(TNode s,TNode t)
         LogEntry(LOG_RES,CT.logBuffer);
     }
 
-    if (CT.methLocal==LOCAL_OPTIMIZE) weight = MXC_LocalSearch(nodeColour,s,t);
+    if (CT.methLocal>=LOCAL_OPTIMIZE) weight = MXC_LocalSearch(nodeColour,s,t);
 
     return weight;
 }
@@ -822,7 +822,7 @@ TFloat abstractMixedGraph::MXC_LocalSearch(TNode* nodeColour,TNode s,TNode t)
         {
             sprintf(CT.logBuffer,
                 "Node %ld moves to component %c",
-                maxNode,char('S'+nodeColour[maxNode]));
+                (unsigned long)maxNode,char('S'+nodeColour[maxNode]));
             LogEntry(LOG_METH2,CT.logBuffer);
         }
 
@@ -1021,7 +1021,7 @@ TFloat abstractGraph::MXC_DualTJoin(TNode s) throw(ERRange,ERRejected)
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"%ld ",u);
+            sprintf(CT.logBuffer,"%ld ",(unsigned long)u);
             LogAppend(LH,CT.logBuffer);
         }
 
@@ -1171,7 +1171,7 @@ TFloat abstractGraph::MXC_HeuristicTree(TNode s,TNode t)
     sprintf(CT.logBuffer,"...Cut has weight %g",weight);
     LogEntry(LOG_RES,CT.logBuffer);
 
-    if (CT.methLocal==LOCAL_OPTIMIZE) weight = MXC_LocalSearch(nodeColour,s,t);
+    if (CT.methLocal>=LOCAL_OPTIMIZE) weight = MXC_LocalSearch(nodeColour,s,t);
 
     return weight;
 }
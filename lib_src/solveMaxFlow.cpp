@@ -14,6 +14,8 @@
 #include "denseDigraph.h"
 #include "staticQueue.h"
 #include "auxiliaryNetwork.h"
+#include "incidenceScanner.h"
+#include "parallelPushRelabel.h"
 
 
 TFloat abstractMixedGraph::MaxFlow(TMethMXF method,TNode s,TNode t) throw(ERRange,ERRejected)
@@ -44,7 +46,7 @@ TFloat abstractMixedGraph::MaxFlow(TMethMXF method,TNode s,TNode t) throw(ERRang
 
     if (CT.logMeth)
     {
-        sprintf(CT.logBuffer,"Computing maximum (%ld,%ld)-flow...",s,t);
+        sprintf(CT.logBuffer,"Computing maximum (%ld,%ld)-flow...",(unsigned long)s,(unsigned long)t);
         LogEntry(LOG_METH,CT.logBuffer);
     }
 
@@ -77,6 +79,12 @@ TFloat abstractMixedGraph::MaxFlow(TMethMXF method,TNode s,TNode t) throw(ERRang
             ret = G->MXF_CapacityScaling(s,t);
             break;
         }
+        case MXF_PREFLOW_PARALLEL:
+        {
+            ret = G->MXF_PushRelabelParallel(s,t);
+            G->BFS(SPX_RESIDUAL,s,t);
+            break;
+        }
         default:
         {
             if (!IsDirected()) delete G;
@@ -135,12 +143,15 @@ TFloat abstractDiGraph::MXF_EdmondsKarp(TNode s,TNode t) throw(ERRange)
 
     TFloat val = 0;
     TArc a = First(s);
-    do
+
+    // The source node may be isolated
+    while (a!=NoArc)
     {
         if (!Blocking(a)) val += Flow(a);
         a = Right(a,s);
+
+        if (a==First(s)) break;
     }
-    while (a!=First(s));
 
     SetLowerBound(TimerMaxFlow,val);
 
@@ -194,12 +205,15 @@ TFloat abstractDiGraph::MXF_CapacityScaling(TNode s,TNode t) throw(ERRange)
 
     TFloat val = 0;
     TArc a = First(s);
-    do
+
+    // The source node may be isolated
+    while (a!=NoArc)
     {
         if (!Blocking(a)) val += Flow(a);
         a = Right(a,s);
+
+        if (a==First(s)) break;
     }
-    while (a!=First(s));
 
     SetLowerBound(TimerMaxFlow,val);
 
@@ -284,12 +298,15 @@ TFloat abstractDiGraph::MXF_Dinic(TNode s,TNode t) throw(ERRange)
 
     TFloat val = 0;
     TArc a = First(s);
-    do
+
+    // The source node may be isolated
+    while (a!=NoArc)
     {
         if (!Blocking(a)) val += Flow(a);
         a = Right(a,s);
+
+        if (a==First(s)) break;
     }
-    while (a!=First(s));
 
     SetLowerBound(TimerMaxFlow,val);
 
@@ -340,7 +357,7 @@ TFloat abstractDiGraph::MXF_Dinic(TNode s,TNode t) throw(ERRange)
 
                     if (CT.logMeth>1)
                     {
-                        sprintf(CT.logBuffer,"%ld(%ld)%ld ",u,a,v);
+                        sprintf(CT.logBuffer,"%ld(%ld)%ld ",(unsigned long)u,(unsigned long)a,(unsigned long)v);
                         LogAppend(LH,CT.logBuffer);
                     }
 
@@ -431,6 +448,26 @@ TFloat abstractDiGraph::MXF_Dinic(TNode s,TNode t) throw(ERRange)
 
 
 TFloat abstractDiGraph::MXF_PushRelabel(TNode s,TNode t) throw(ERRange)
+{
+    if (IsFrozen())
+    {
+        frozenScanner I(*FrozenIncidences());
+        return MXF_PushRelabel(I,s,t);
+    }
+
+    if (Representation() && IsSparse())
+    {
+        sparseScanner I(*this);
+        return MXF_PushRelabel(I,s,t);
+    }
+
+    genericScanner I(*this);
+    return MXF_PushRelabel(I,s,t);
+}
+
+
+template <class TScanner>
+TFloat abstractDiGraph::MXF_PushRelabel(const TScanner& I,TNode s,TNode t) throw(ERRange)
 {
     // Push-and-Relabel method which supports the following selection
     // strategies:
@@ -438,6 +475,9 @@ TFloat abstractDiGraph::MXF_PushRelabel(TNode s,TNode t) throw(ERRange)
     // methMXF == 2 : First-in first-out, O(n^3)
     // methMXF == 3 : Highest label, O(n^2 m^(1/2))
     // methMXF == 4 : Excess scaling, O(nm + n^2 log(U))
+    //
+    // The gap heuristics and the global relabelling are applied according to
+    // the context parameter methMXFHeur
 
     #if defined(_PROGRESS_)
 
@@ -458,7 +498,7 @@ TFloat abstractDiGraph::MXF_PushRelabel(TNode s,TNode t) throw(ERRange)
     // operations. Admissible[u] contains of all arcs a=uv such that
     // rescap(a)>0 and dist[u]=dist[v]+1.
 
-    staticQueue<TNode,TFloat> **Admissible = new staticQueue<TNode,TFloat>*[n];
+    staticQueue<TArc,TFloat> **Admissible = new staticQueue<TArc,TFloat>*[n];
     Admissible[0] = new staticQueue<TArc,TFloat>(2*m,CT);
 
     for (TNode i=1;i<n;i++)
@@ -475,12 +515,10 @@ TFloat abstractDiGraph::MXF_PushRelabel(TNode s,TNode t) throw(ERRange)
 
     // Push all flow away from the root node
 
-    THandle H = Investigate();
-    investigator &I = Investigator(H);
     bool unbounded = false;
-    while (I.Active(s))
+    for (TArc k=I.First(s);k!=NoArc;k=I.Next(s,k))
     {
-        TArc a = I.Read(s);
+        TArc a = I.Arc(k);
 
         if (UCap(a)!=InfCap) Push(a,ResCap(a));
         else unbounded = true;
@@ -521,7 +559,7 @@ TFloat abstractDiGraph::MXF_PushRelabel(TNode s,TNode t) throw(ERRange)
 
                 if (CT.logMeth>1)
                 {
-                    sprintf(CT.logBuffer,"%ld ",v);
+                    sprintf(CT.logBuffer,"%ld ",(unsigned long)v);
                     LogAppend(LH,CT.logBuffer);
                 }
 
@@ -543,6 +581,35 @@ TFloat abstractDiGraph::MXF_PushRelabel(TNode s,TNode t) throw(ERRange)
         }
     }
 
+    unsigned long nPush = 0;
+    unsigned long nRelabel = 0;
+    unsigned long nGlobalRelabel = 0;
+    unsigned long nGap = 0;
+
+    // Number of nodes for every distance label below n, used by the gap heuristics
+    TNode* labelCount = NULL;
+
+    if (CT.methMXFHeur & MXF_HEUR_GAP)
+    {
+        labelCount = new TNode[n];
+
+        for (TNode i=0;i<n;i++) labelCount[i] = 0;
+
+        for (TNode v=0;v<n;v++)
+        {
+            if (dist[v]<n) labelCount[dist[v]]++;
+        }
+    }
+
+    bool globalRelabel = (CT.methMXFHeur & MXF_HEUR_GLOBAL);
+    unsigned long nextGlobalRelabel = n;
+
+    if (globalRelabel && !unbounded)
+    {
+        MXF_GlobalRelabel(I,s,t,dist,Admissible,Q,labelCount);
+        nGlobalRelabel++;
+    }
+
     SetBounds(TimerMaxFlow,Divergence(t),-Divergence(s));
 
     #if defined(_PROGRESS_)
@@ -573,10 +640,18 @@ TFloat abstractDiGraph::MXF_PushRelabel(TNode s,TNode t) throw(ERRange)
                     lambda = delta-Divergence(v);
                 }
 
-                // All non-saturating pushes must carry at least delta/2 units
+                // All non-saturating pushes must carry at least delta/2 units.
+                // If the end node has a large excess, it is processed first,
+                // and the arc is retained for the next time when u is selected
                 if (2*lambda<delta && lambda<ResCap(a))
                 {
-                    if (dist[u]==dist[v]+1) canRelabel = false;
+                    if (dist[u]==dist[v]+1)
+                    {
+                        Admissible[u] -> Insert(a);
+                        canRelabel = false;
+                        break;
+                    }
+
                     continue;
                 }
             }
@@ -588,7 +663,7 @@ TFloat abstractDiGraph::MXF_PushRelabel(TNode s,TNode t) throw(ERRange)
                 if (CT.logMeth>1)
                 {
                     sprintf(CT.logBuffer,
-                        "Push %g flow units from node %ld to node %ld",lambda,u,v);
+                        "Push %g flow units from node %ld to node %ld",lambda,(unsigned long)u,(unsigned long)v);
                     LogEntry(LOG_METH2,CT.logBuffer);
                 }
 
@@ -598,7 +673,9 @@ TFloat abstractDiGraph::MXF_PushRelabel(TNode s,TNode t) throw(ERRange)
                 {
                     if (CT.methMXF!=4)
                     {
-                        if (Divergence(v)==0) Q->Insert(v,-dist[v]);
+                        // Deficits of the initial flow are filled first
+                        if (Divergence(v)<=0 && Divergence(v)+lambda>0)
+                            Q->Insert(v,-dist[v]);
                     }
                     else if (    2*Divergence(v)<delta
                               && 2*(Divergence(v)+lambda)>=delta
@@ -608,7 +685,7 @@ TFloat abstractDiGraph::MXF_PushRelabel(TNode s,TNode t) throw(ERRange)
 
                         #if defined(_LOGGING_)
 
-                        sprintf(CT.logBuffer,"Activating node %ld ",v);
+                        sprintf(CT.logBuffer,"Activating node %ld ",(unsigned long)v);
                         LogEntry(LOG_METH2,CT.logBuffer);
 
                         #endif
@@ -616,6 +693,7 @@ TFloat abstractDiGraph::MXF_PushRelabel(TNode s,TNode t) throw(ERRange)
                 }
 
                 Push(a,lambda);
+                nPush++;
 
                 if (v==s) SetUpperBound(TimerMaxFlow,-Divergence(s));
                 if (v==t) SetLowerBound(TimerMaxFlow,Divergence(t));
@@ -641,15 +719,19 @@ TFloat abstractDiGraph::MXF_PushRelabel(TNode s,TNode t) throw(ERRange)
             }
         }
 
+        if (!canRelabel && CT.methMXF==4 && 2*Divergence(u)>=delta)
+        {
+            Q -> Insert(u,dist[u]);
+        }
+
         if (canRelabel && Divergence(u)>0)
         {
-            I.Reset(u);
             TNode dMin = NoNode;
 
-            while (I.Active(u))
+            for (TArc k=I.First(u);k!=NoArc;k=I.Next(u,k))
             {
-                TArc a = I.Read(u);
-                TNode v = EndNode(a);
+                TArc a = I.Arc(k);
+                TNode v = I.EndNode(k);
                 if (ResCap(a)>0 && dist[v]<=dMin)
                 {
                     dMin = dist[v];
@@ -679,13 +761,25 @@ TFloat abstractDiGraph::MXF_PushRelabel(TNode s,TNode t) throw(ERRange)
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"Relabelled node %lu: %lu -> %lu",u,dist[u],dMin+1);
+                sprintf(CT.logBuffer,"Relabelled node %lu: %lu -> %lu",(unsigned long)u,(unsigned long)dist[u],(unsigned long)(dMin+1));
                 LogEntry(LOG_METH2,CT.logBuffer);
             }
 
             #endif
 
+            TNode oldLabel = dist[u];
             dist[u] = dMin+1;
+            nRelabel++;
+
+            if (labelCount)
+            {
+                if (dist[u]<n) labelCount[dist[u]]++;
+
+                if (oldLabel<n && --labelCount[oldLabel]==0)
+                {
+                    if (MXF_GapRelabel(I,oldLabel,dist,Admissible,labelCount)>0) nGap++;
+                }
+            }
 
             if (CT.methMXF!=4)
             {
@@ -699,7 +793,15 @@ TFloat abstractDiGraph::MXF_PushRelabel(TNode s,TNode t) throw(ERRange)
             Trace();
         }
 
-        if (CT.methMXF==4 && Q->Empty() && delta>2)
+        if (globalRelabel && nRelabel>=nextGlobalRelabel)
+        {
+            MXF_GlobalRelabel(I,s,t,dist,Admissible,Q,labelCount);
+            nGlobalRelabel++;
+            nextGlobalRelabel = nRelabel+n;
+        }
+
+        // Skip the scaling phases without any large excess node
+        while (CT.methMXF==4 && Q->Empty() && delta>2)
         {
             delta = ceil(delta/2);
 
@@ -725,7 +827,7 @@ TFloat abstractDiGraph::MXF_PushRelabel(TNode s,TNode t) throw(ERRange)
 
                     if (CT.logMeth>1)
                     {
-                        sprintf(CT.logBuffer,"%ld ",v);
+                        sprintf(CT.logBuffer,"%ld ",(unsigned long)v);
                         LogAppend(LH,CT.logBuffer);
                     }
 
@@ -741,16 +843,37 @@ TFloat abstractDiGraph::MXF_PushRelabel(TNode s,TNode t) throw(ERRange)
         }
     }
 
-    Close(H);
-
     delete Q;
 
     for (TNode i=1;i<n;i++) delete Admissible[i];
     delete Admissible[0];
     delete[] Admissible;
 
+    if (labelCount) delete[] labelCount;
+
+    // Do not restrict the residual network in subsequent searches
+    if (CT.methMXF==4) delta = 0;
+
     ReleasePredecessors();
 
+    if (CT.logRes>1)
+    {
+        sprintf(CT.logBuffer,
+            "...%lu pushes, %lu relabels, %lu global relabels, %lu gaps",
+            nPush,nRelabel,nGlobalRelabel,nGap);
+        LogEntry(LOG_RES2,CT.logBuffer);
+    }
+
+    #if defined(_TIMERS_)
+
+    goblinTimer* TM = CT.globalTimer[TimerMaxFlow];
+    TM -> IncreaseCounter(goblinTimer::COUNT_PUSH,nPush);
+    TM -> IncreaseCounter(goblinTimer::COUNT_RELABEL,nRelabel);
+    TM -> IncreaseCounter(goblinTimer::COUNT_GLOBAL_RELABEL,nGlobalRelabel);
+    TM -> IncreaseCounter(goblinTimer::COUNT_GAP,nGap);
+
+    #endif
+
     if (unbounded) Error(ERR_RANGE,"MXF_PushRelabel",
         "Arcs emanating from source must have finite capacities");
 
@@ -758,3 +881,154 @@ TFloat abstractDiGraph::MXF_PushRelabel(TNode s,TNode t) throw(ERRange)
 
     return Divergence(t);
 }
+
+
+template <class TScanner>
+void abstractDiGraph::MXF_GlobalRelabel(const TScanner& I,TNode s,TNode t,TNode* dist,
+    staticQueue<TArc,TFloat>** Admissible,goblinQueue<TNode,TFloat>* Q,
+    TNode* labelCount) throw()
+{
+    // The residual network is searched without the capacity threshold
+    // which is used by the excess scaling method
+    TFloat savedDelta = delta;
+    delta = 0;
+
+    BFS(TOptSPX(SPX_RESIDUAL | SPX_REVERSE),t);
+    TFloat* distBFS = GetDistanceLabels();
+
+    for (TNode v=0;v<n;v++)
+    {
+        dist[v] = (distBFS[v]==InfFloat) ? NoNode : TNode(distBFS[v]);
+    }
+
+    dist[s] = n;
+
+    BFS(TOptSPX(SPX_RESIDUAL | SPX_REVERSE),s);
+    distBFS = GetDistanceLabels();
+
+    for (TNode v=0;v<n;v++)
+    {
+        if (dist[v]!=NoNode) continue;
+
+        dist[v] = (distBFS[v]==InfFloat) ? 2*n : n+TNode(distBFS[v]);
+    }
+
+    delta = savedDelta;
+
+    if (labelCount)
+    {
+        for (TNode i=0;i<n;i++) labelCount[i] = 0;
+
+        for (TNode v=0;v<n;v++)
+        {
+            if (dist[v]<n) labelCount[dist[v]]++;
+        }
+    }
+
+    for (TNode u=0;u<n;u++)
+    {
+        Admissible[u] -> Init();
+
+        for (TArc k=I.First(u);k!=NoArc;k=I.Next(u,k))
+        {
+            TArc a = I.Arc(k);
+
+            if (ResCap(a)>0 && dist[u]==dist[I.EndNode(k)]+1)
+                Admissible[u] -> Insert(a);
+        }
+    }
+
+    Q -> Init();
+
+    for (TNode v=0;v<n;v++)
+    {
+        if (v==s || v==t) continue;
+
+        if (CT.methMXF==4)
+        {
+            if (2*Divergence(v)>=delta && Divergence(v)>0) Q->Insert(v,dist[v]);
+        }
+        else if (Divergence(v)>0) Q->Insert(v,-dist[v]);
+    }
+
+    #if defined(_LOGGING_)
+
+    if (CT.logMeth>1) LogEntry(LOG_METH2,"Exact distance labels computed");
+
+    #endif
+}
+
+
+template <class TScanner>
+TNode abstractDiGraph::MXF_GapRelabel(const TScanner& I,TNode gap,TNode* dist,
+    staticQueue<TArc,TFloat>** Admissible,TNode* labelCount) throw()
+{
+    TNode nLifted = 0;
+
+    for (TNode v=0;v<n;v++)
+    {
+        if (dist[v]>gap && dist[v]<n)
+        {
+            labelCount[dist[v]]--;
+            dist[v] = n+1;
+            nLifted++;
+        }
+    }
+
+    if (nLifted==0) return 0;
+
+    #if defined(_LOGGING_)
+
+    if (CT.logMeth>1)
+    {
+        sprintf(CT.logBuffer,"Gap at label %lu, %lu nodes lifted",(unsigned long)gap,(unsigned long)nLifted);
+        LogEntry(LOG_METH2,CT.logBuffer);
+    }
+
+    #endif
+
+    // Update the admissible arcs which are incident with lifted nodes
+
+    for (TNode u=0;u<n;u++)
+    {
+        if (dist[u]!=n+1) continue;
+
+        Admissible[u] -> Init();
+
+        for (TArc k=I.First(u);k!=NoArc;k=I.Next(u,k))
+        {
+            TArc a = I.Arc(k);
+            TNode v = I.EndNode(k);
+
+            if (ResCap(a)>0 && dist[v]==n) Admissible[u]->Insert(a);
+
+            if (ResCap(a^1)>0 && dist[v]==n+2)
+                Admissible[v] -> Insert(a^1,INSERT_NO_THROW);
+        }
+    }
+
+    return nLifted;
+}
+
+
+TFloat abstractDiGraph::MXF_PushRelabelParallel(TNode s,TNode t) throw(ERRange)
+{
+    OpenFold(ModPushRelabelParallel,SHOW_TITLE);
+
+    parallelPushRelabel P(*this,s,t);
+    TFloat ret = InfCap;
+
+    try
+    {
+        ret = P.Solve();
+    }
+    catch (ERRange)
+    {
+        CloseFold(ModPushRelabelParallel);
+        throw ERRange();
+    }
+
+    CloseFold(ModPushRelabelParallel);
+
+    return ret;
+}
@@ -59,67 +59,455 @@ TCap abstractMixedGraph::NodeConnectivity(TNode source,TNode target,TOptNodeSpli
 
         #endif
 
-        #if defined(_PROGRESS_)
+        lambda = MCC_NodeSplittingPairs(G,MCC_MAP_UNDERLYING | mode,TimerMinCut);
+    }
 
-        InitProgressCounter((n*(n-1))/2);
-        SetProgressNext(1);
+    if (CT.SolverRunning()) SetBounds(TimerMinCut,lambda,lambda);
 
-        #endif
+    CloseFold();
+    sprintf(CT.logBuffer,"...Node connectivity is %g",lambda);
+    LogEntry(LOG_RES,CT.logBuffer);
+    CloseFold(ModMinCut,NO_INDENT);
+
+    return lambda;
+}
+
+
+/// \brief  Mark the nodes which are linked with a given node
+///
+/// \param G         The original graph
+/// \param v         A node index
+/// \param directed  If false, ignore the arc orientations
+/// \param outMark   Returns outMark[w]==v for all nodes w linked by an arc vw
+/// \param inMark    If not NULL, returns inMark[w]==v for all nodes w linked by an arc wv
+///
+/// In the directed setting, only non-blocking arcs are considered. Other
+/// entries of the mark arrays are not changed.
+static void MarkLinkedNodes(const abstractMixedGraph& G,TNode v,bool directed,
+    TNode* outMark,TNode* inMark) throw()
+{
+    TArc a = G.First(v);
+
+    if (a==NoArc) return;
+
+    do
+    {
+        TNode w = G.EndNode(a);
+
+        if (!directed || !G.Blocking(a)) outMark[w] = v;
+
+        if (inMark && (!directed || !G.Blocking(a^1))) inMark[w] = v;
+
+        a = G.Right(a,v);
+    }
+    while (a!=G.First(v));
+}
+
+
+/// \brief  Select the node pairs of the Esfahanian-Hakimi method
+///
+/// \param G         The original graph
+/// \param directed  If false, ignore the arc orientations
+/// \param left      Returns the left-hand nodes
+/// \param right     Returns the right-hand nodes
+///
+/// For a node v0 of minimum degree, this lists all node pairs (v0,w) and,
+/// in the directed setting, (w,v0) which are not linked by an arc. Then all
+/// non-linked pairs (x,y) are added, where x is an in-neighbour and y is an
+/// out-neighbour of v0. A minimum node cut either excludes v0 or separates
+/// some neighbours of v0, so that it is a minimum cut for one of the pairs.
+static void SelectNodePairs(const abstractMixedGraph& G,bool directed,
+    std::vector<TNode>& left,std::vector<TNode>& right) throw()
+{
+    TNode n = G.N();
+    TNode* outMark = new TNode[n];
+    TNode* inMark = new TNode[n];
+
+    for (TNode w=0;w<n;w++) outMark[w] = inMark[w] = NoNode;
+
+    // Choose v0 such that the number of neighbour pairs is minimal
+
+    TNode v0 = NoNode;
+    double minPairs = 0;
+
+    for (TNode v=0;v<n;v++)
+    {
+        MarkLinkedNodes(G,v,directed,outMark,directed ? inMark : NULL);
+
+        double nOut = 0;
+        double nIn = 0;
 
-        for (TNode v=0;v<n && CT.SolverRunning();v++)
+        for (TArc a=G.First(v);a!=NoArc;)
         {
-            for (TNode w=v+1;w<n;w++)
+            TNode w = G.EndNode(a);
+
+            if (w!=v && outMark[w]==v)
             {
-                if (Adjacency(v,w,ADJ_SEARCH)!=NoArc)
-                {
-                    #if defined(_PROGRESS_)
+                outMark[w] = NoNode;
+                nOut++;
+            }
 
-                    ProgressStep(1);
+            if (directed && w!=v && inMark[w]==v)
+            {
+                inMark[w] = NoNode;
+                nIn++;
+            }
 
-                    #endif
+            a = G.Right(a,v);
 
-                    continue;
-                }
+            if (a==G.First(v)) break;
+        }
 
-                CT.SuppressLogging();
-                TCap val = G.MCC_StrongEdgeConnectivity(2*v+1,2*w);
-                CT.RestoreLogging();
+        double nPairs = directed ? nIn*nOut : nOut*nOut;
 
-                #if defined(_PROGRESS_)
+        if (v0==NoNode || nPairs<minPairs)
+        {
+            v0 = v;
+            minPairs = nPairs;
+        }
+    }
 
-                ProgressStep(1);
+    for (TNode w=0;w<n;w++) outMark[w] = inMark[w] = NoNode;
 
-                #endif
+    if (v0==NoNode)
+    {
+        delete[] outMark;
+        delete[] inMark;
+        return;
+    }
 
-                if (val>=lambda) continue;
+    MarkLinkedNodes(G,v0,directed,outMark,inMark);
 
-                #if defined(_LOGGING_)
+    std::vector<TNode> outList;
+    std::vector<TNode> inList;
 
-                if (CT.logRes>=2)
-                {
-                    sprintf(CT.logBuffer,
-                        "Minimum (%ld,%ld)-cut has capacity %g",v,w,val);
-                    LogEntry(LOG_RES2,CT.logBuffer);
-                }
+    for (TNode w=0;w<n;w++)
+    {
+        if (w==v0) continue;
 
-                #endif
+        if (outMark[w]==v0)
+        {
+            outList.push_back(w);
+        }
+        else
+        {
+            left.push_back(v0);
+            right.push_back(w);
+        }
+
+        if (!directed) continue;
+
+        if (inMark[w]==v0)
+        {
+            inList.push_back(w);
+        }
+        else
+        {
+            left.push_back(w);
+            right.push_back(v0);
+        }
+    }
+
+    if (!directed) inList = outList;
+
+    // Neighbour pairs. The node indices serve as mark stamps, and the
+    // marks of v0 are not needed any longer
+
+    for (TNode w=0;w<n;w++) outMark[w] = NoNode;
+
+    for (size_t i=0;i<inList.size();i++)
+    {
+        TNode x = inList[i];
+
+        MarkLinkedNodes(G,x,directed,outMark,NULL);
+
+        for (size_t j=(directed ? 0 : i+1);j<outList.size();j++)
+        {
+            TNode y = outList[j];
+
+            if (y==x || outMark[y]==x) continue;
+
+            left.push_back(x);
+            right.push_back(y);
+        }
+    }
+
+    delete[] outMark;
+    delete[] inMark;
+}
+
+
+/// \brief  Shared data of a concurrent node pair evaluation
+struct TNodePairTask
+{
+    nodeSplitting**     split;      ///< One copy of the split graph per thread
+    unsigned long       nPairs;     ///< Number of node pairs
+    const TNode*        left;       ///< The left-hand nodes
+    const TNode*        right;      ///< The right-hand nodes
+    unsigned long       next;       ///< The next pair to be claimed by a thread
+    TCap*               bestValue;  ///< Minimum cut capacity found by each thread
+    unsigned long*      bestPair;   ///< Position of the respective node pair
+};
+
+
+/// \brief  Argument record of the node pair worker threads
+struct TNodePairArg
+{
+    TNodePairTask*  task;
+    unsigned        id;
+};
+
+
+static void* NodePairWorker(void* arg) throw()
+{
+    TNodePairArg* thisArg = static_cast<TNodePairArg*>(arg);
+    TNodePairTask& task = *(thisArg->task);
+    unsigned id = thisArg->id;
+    nodeSplitting& G = *(task.split[id]);
+
+    bool wasWorker = goblinController::WorkerThread();
+    goblinController::SetWorkerThread(true);
+
+    while (G.Context().SolverRunning())
+    {
+        unsigned long k = __sync_fetch_and_add(&task.next,1UL);
+
+        if (k>=task.nPairs) break;
+
+        TCap val = G.StrongEdgeConnectivity(abstractMixedGraph::MCC_DEFAULT,
+                        2*task.left[k]+1,2*task.right[k]);
+
+        if (val<task.bestValue[id])
+        {
+            task.bestValue[id] = val;
+            task.bestPair[id] = k;
+        }
+    }
+
+    goblinController::SetWorkerThread(wasWorker);
+
+    return NULL;
+}
+
+
+/// \brief  Evaluate a list of node pairs concurrently
+///
+/// \param split     The split graph copies, one per thread
+/// \param nThreads  The number of split graph copies
+/// \param nPairs    The number of node pairs
+/// \param left      The left-hand nodes
+/// \param right     The right-hand nodes
+/// \param lambda    Returns the minimum cut capacity
+/// \return          The position of the first minimizing node pair, or nPairs
+///
+/// The pairs are claimed one by one by the threads, so that the load is
+/// balanced even if the max-flow problems differ in size.
+static unsigned long MinimumPairCut(nodeSplitting** split,unsigned nThreads,
+    unsigned long nPairs,const TNode* left,const TNode* right,TCap& lambda) throw()
+{
+    lambda = InfFloat;
+
+    if (nPairs==0) return nPairs;
+
+    if (nThreads>nPairs) nThreads = unsigned(nPairs);
+
+    TNodePairTask task;
+    task.split = split;
+    task.nPairs = nPairs;
+    task.left = left;
+    task.right = right;
+    task.next = 0;
+    task.bestValue = new TCap[nThreads];
+    task.bestPair = new unsigned long[nThreads];
+
+    pthread_t* threads = new pthread_t[nThreads];
+    TNodePairArg* args = new TNodePairArg[nThreads];
+
+    for (unsigned i=0;i<nThreads;i++)
+    {
+        task.bestValue[i] = InfFloat;
+        task.bestPair[i] = nPairs;
+        args[i].task = &task;
+        args[i].id = i;
+    }
+
+    for (unsigned i=1;i<nThreads;i++)
+    {
+        pthread_create(&threads[i],NULL,NodePairWorker,&args[i]);
+    }
+
+    NodePairWorker(&args[0]);
+
+    for (unsigned i=1;i<nThreads;i++) pthread_join(threads[i],NULL);
+
+    // Reduce by the cut capacities and, for ties, by the pair positions.
+    // So the result does not depend on the thread scheduling
+
+    unsigned long bestPair = nPairs;
+
+    for (unsigned i=0;i<nThreads;i++)
+    {
+        if (task.bestPair[i]==nPairs) continue;
+
+        if (   bestPair==nPairs
+            || task.bestValue[i]<lambda
+            || (task.bestValue[i]==lambda && task.bestPair[i]<bestPair)
+           )
+        {
+            lambda = task.bestValue[i];
+            bestPair = task.bestPair[i];
+        }
+    }
+
+    delete[] threads;
+    delete[] args;
+    delete[] task.bestValue;
+    delete[] task.bestPair;
+
+    return bestPair;
+}
+
+
+TCap abstractMixedGraph::MCC_NodeSplittingPairs(nodeSplitting& G,TOption options,TTimer timer)
+    throw()
+{
+    bool directed = !(options & MCC_MAP_UNDERLYING);
 
-                SetUpperBound(TimerMinCut,val);
+    unsigned nThreads = CT.NumThreads();
 
-                lambda = val;
-                G.MapEdgeCut();
+    if (nThreads>n) nThreads = (n>0) ? n : 1;
 
-                Trace();
+    nodeSplitting** split = new nodeSplitting*[nThreads];
+    split[0] = &G;
+
+    CT.SuppressLogging();
+
+    for (unsigned i=1;i<nThreads;i++) split[i] = new nodeSplitting(*this,options);
+
+    CT.RestoreLogging();
+
+    bool selective = !(options & MCC_ALL_PAIRS) && G.NodeCutsOnly();
+
+    std::vector<TNode> left;
+    std::vector<TNode> right;
+    unsigned long nRounds = n;
+
+    if (selective)
+    {
+        SelectNodePairs(*this,directed,left,right);
+        nRounds = (left.size()+n-1)/n;
+
+        sprintf(CT.logBuffer,"Esfahanian-Hakimi selection of %lu node pairs",
+            (unsigned long)left.size());
+        LogEntry(LOG_METH2,CT.logBuffer);
+    }
+    else
+    {
+        left.resize(n);
+        right.resize(n);
+    }
+
+    #if defined(_PROGRESS_)
+
+    if (selective) InitProgressCounter(left.size());
+    else if (directed) InitProgressCounter(n*(n-1));
+    else InitProgressCounter((n*(n-1))/2);
+
+    SetProgressNext(1);
+
+    #endif
+
+    TNode* mark = new TNode[n];
+
+    for (TNode w=0;w<n;w++) mark[w] = NoNode;
+
+    TCap lambda = InfFloat;
+    TNode bestLeft = NoNode;
+    TNode bestRight = NoNode;
+
+    // Either the selected pairs are processed in blocks of n pairs, or
+    // the non-adjacent pairs of every left-hand node form one block
+
+    for (unsigned long r=0;r<nRounds && CT.SolverRunning();r++)
+    {
+        unsigned long offset = 0;
+        unsigned long nPairs = 0;
+        unsigned long nSteps = 0;
+
+        if (selective)
+        {
+            offset = r*n;
+            nPairs = left.size()-offset;
+
+            if (nPairs>n) nPairs = n;
+
+            nSteps = nPairs;
+        }
+        else
+        {
+            TNode v = TNode(r);
+
+            MarkLinkedNodes(*this,v,directed,mark,NULL);
+
+            for (TNode w=(directed ? 0 : v+1);w<n;w++)
+            {
+                if (w==v || mark[w]==v) continue;
+
+                left[nPairs] = v;
+                right[nPairs] = w;
+                nPairs++;
             }
+
+            nSteps = directed ? n-1 : n-1-v;
+        }
+
+        TCap val = InfFloat;
+        unsigned long k = (nPairs==0) ? 0 :
+            MinimumPairCut(split,nThreads,nPairs,&left[offset],&right[offset],val);
+
+        #if defined(_PROGRESS_)
+
+        ProgressStep(nSteps);
+
+        #endif
+
+        if (k>=nPairs || val>=lambda) continue;
+
+        #if defined(_LOGGING_)
+
+        if (CT.logRes>=2)
+        {
+            sprintf(CT.logBuffer,"Minimum (%ld,%ld)-cut has capacity %g",
+                (unsigned long)left[offset+k],(unsigned long)right[offset+k],val);
+            LogEntry(LOG_RES2,CT.logBuffer);
         }
+
+        #endif
+
+        SetUpperBound(timer,val);
+
+        lambda = val;
+        bestLeft = left[offset+k];
+        bestRight = right[offset+k];
     }
 
-    if (CT.SolverRunning()) SetBounds(TimerMinCut,lambda,lambda);
+    delete[] mark;
 
-    CloseFold();
-    sprintf(CT.logBuffer,"...Node connectivity is %g",lambda);
-    LogEntry(LOG_RES,CT.logBuffer);
-    CloseFold(ModMinCut,NO_INDENT);
+    for (unsigned i=1;i<nThreads;i++) delete split[i];
+
+    delete[] split;
+
+    if (bestLeft!=NoNode)
+    {
+        // Only the cut capacities have been recorded. Restore the cut itself
+        CT.SuppressLogging();
+        G.MCC_StrongEdgeConnectivity(2*bestLeft+1,2*bestRight);
+        CT.RestoreLogging();
+
+        G.MapEdgeCut();
+
+        Trace();
+    }
 
     return lambda;
 }
@@ -169,6 +557,26 @@ void nodeSplitting::MapEdgeCut() throw()
 }
 
 
+bool nodeSplitting::NodeCutsOnly() const throw()
+{
+    TArc mSplit = M()-G.N();
+
+    for (TArc a=0;a<mSplit;a++)
+    {
+        TCap thisCap = UCap(2*a);
+
+        if (   thisCap<UCap(2*(mSplit+StartNode(2*a)/2))
+            || thisCap<UCap(2*(mSplit+EndNode(2*a)/2))
+           )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
 TCap abstractMixedGraph::EdgeConnectivity(TMethMCC method,TNode source,TNode target)
     throw(ERRange)
 {
@@ -193,6 +601,10 @@ TCap abstractMixedGraph::EdgeConnectivity(TMethMCC method,TNode source,TNode tar
     {
         lambda = MCC_NodeIdentification();
     }
+    else if (method==MCC_STOER_WAGNER && !(source!=NoNode && target!=NoNode))
+    {
+        lambda = MCC_StoerWagner();
+    }
     else
     {
         diGraph G(n,CT);
@@ -282,7 +694,7 @@ TCap abstractMixedGraph::StrongNodeConnectivity(TNode source,TNode target,TOptNo
     LogEntry(LOG_METH,"Computing strong node connectivity...");
     OpenFold();
 
-    nodeSplitting G(*this,mode & MCC_MAP_DEMANDS);
+    nodeSplitting G(*this,mode & (MCC_MAP_DEMANDS | MCC_ALL_PAIRS));
     TCap lambda = InfFloat;
 
     if (source<n)
@@ -311,63 +723,7 @@ TCap abstractMixedGraph::StrongNodeConnectivity(TNode source,TNode target,TOptNo
 
         #endif
 
-        #if defined(_PROGRESS_)
-
-        InitProgressCounter(n*(n-1));
-        SetProgressNext(1);
-
-        #endif
-
-        for (TNode v=0;v<n && CT.SolverRunning();v++)
-        {
-            for (TNode w=0;w<n && CT.SolverRunning();w++)
-            {
-                if (v==w) continue;
-
-                TArc a = Adjacency(v,w,ADJ_SEARCH);
-
-                if (a!=NoArc && !Blocking(a))
-                {
-                    #if defined(_PROGRESS_)
-
-                    ProgressStep(1);
-
-                    #endif
-
-                    continue;
-                }
-
-                CT.SuppressLogging();
-                TCap val = G.MCC_StrongEdgeConnectivity(2*v+1,2*w);
-                CT.RestoreLogging();
-
-                #if defined(_PROGRESS_)
-
-                ProgressStep(1);
-
-                #endif
-
-                if (val>=lambda) continue;
-
-                #if defined(_LOGGING_)
-
-                if (CT.logRes>=2)
-                {
-                    sprintf(CT.logBuffer,
-                        "Minimum (%ld,%ld)-cut has capacity %g",v,w,val);
-                    LogEntry(LOG_RES2,CT.logBuffer);
-                }
-
-                #endif
-
-                SetUpperBound(TimerMinCut,val);
-
-                lambda = val;
-                G.MapEdgeCut();
-
-                Trace();
-            }
-        }
+        lambda = MCC_NodeSplittingPairs(G,mode & (MCC_MAP_DEMANDS | MCC_ALL_PAIRS),TimerStrongConn);
     }
 
     if (CT.SolverRunning()) SetBounds(TimerStrongConn,lambda,lambda);
@@ -423,7 +779,7 @@ TCap abstractMixedGraph::MCC_StrongEdgeConnectivity() throw()
         if (CT.logRes>=2)
         {
             sprintf(CT.logBuffer,
-                "Minimum (%ld,%ld)-cut has capacity %g",source,target,val);
+                "Minimum (%ld,%ld)-cut has capacity %g",(unsigned long)source,(unsigned long)target,val);
             LogEntry(LOG_RES2,CT.logBuffer);
         }
 
@@ -454,7 +810,7 @@ TCap abstractMixedGraph::MCC_StrongEdgeConnectivity(TMethMCC method,TNode source
 {
     OpenFold(ModStrongConn,NO_INDENT);
 
-    sprintf(CT.logBuffer,"Computing strong edge %ld-connectivity...",source);
+    sprintf(CT.logBuffer,"Computing strong edge %ld-connectivity...",(unsigned long)source);
     LogEntry(LOG_METH,CT.logBuffer);
 
     diGraph G(*this);
@@ -505,7 +861,7 @@ TCap abstractMixedGraph::MCC_StrongEdgeConnectivity(TMethMCC method,TNode source
             if (CT.logRes>=2)
             {
                 sprintf(CT.logBuffer,
-                    "Minimum (%ld,%ld)-cut has capacity %g",source,target,val);
+                    "Minimum (%ld,%ld)-cut has capacity %g",(unsigned long)source,(unsigned long)target,val);
                 LogEntry(LOG_RES2,CT.logBuffer);
             }
 
@@ -524,7 +880,7 @@ TCap abstractMixedGraph::MCC_StrongEdgeConnectivity(TMethMCC method,TNode source
 
         CloseFold();
 
-        sprintf(CT.logBuffer,"...Strong edge %ld-connectivity is %g",source,lambda);
+        sprintf(CT.logBuffer,"...Strong edge %ld-connectivity is %g",(unsigned long)source,lambda);
         LogEntry(LOG_RES,CT.logBuffer);
     }
 
@@ -539,7 +895,7 @@ TCap abstractMixedGraph::MCC_StrongEdgeConnectivity(TNode source,TNode target)
 {
     OpenFold(ModStrongConn,NO_INDENT);
 
-    sprintf(CT.logBuffer,"Computing strong edge (%ld,%ld)-connectivity...",source,target);
+    sprintf(CT.logBuffer,"Computing strong edge (%ld,%ld)-connectivity...",(unsigned long)source,(unsigned long)target);
     LogEntry(LOG_METH,CT.logBuffer);
 
     OpenFold();
@@ -574,7 +930,7 @@ TCap abstractMixedGraph::MCC_StrongEdgeConnectivity(TNode source,TNode target)
 
     CloseFold();
 
-    sprintf(CT.logBuffer,"...Strong edge (%ld,%ld)-connectivity is %g",source,target,lambda);
+    sprintf(CT.logBuffer,"...Strong edge (%ld,%ld)-connectivity is %g",(unsigned long)source,(unsigned long)target,lambda);
     LogEntry(LOG_RES,CT.logBuffer);
 
     CloseFold(ModStrongConn,NO_INDENT);
@@ -713,7 +1069,7 @@ TCap abstractDiGraph::MCC_HaoOrlin(TMethMCC method,TNode r) throw(ERRange)
 
     for (TNode itc=1;itc<n && !unbounded;itc++)
     {
-        sprintf(CT.logBuffer,"New sink node is %ld",t);
+        sprintf(CT.logBuffer,"New sink node is %ld",(unsigned long)t);
         LogEntry(LOG_METH,CT.logBuffer);
 
         while (!(Q->Empty()) && !unbounded)
@@ -740,7 +1096,7 @@ TCap abstractDiGraph::MCC_HaoOrlin(TMethMCC method,TNode r) throw(ERRange)
                     if (CT.logMeth>1)
                     {
                         sprintf(CT.logBuffer,
-                            "Pushed %g flow units from node %ld to node %ld",Lambda,u,v);
+                            "Pushed %g flow units from node %ld to node %ld",Lambda,(unsigned long)u,(unsigned long)v);
                         LogEntry(LOG_METH2,CT.logBuffer);
                     }
 
@@ -778,7 +1134,7 @@ TCap abstractDiGraph::MCC_HaoOrlin(TMethMCC method,TNode r) throw(ERRange)
 
                             if (CT.logMeth>1)
                             {
-                                sprintf(CT.logBuffer,"dorm[%ld] = %ld",v,dormMax);
+                                sprintf(CT.logBuffer,"dorm[%ld] = %ld",(unsigned long)v,(unsigned long)dormMax);
                                 LogEntry(LOG_METH2,CT.logBuffer);
                             }
 
@@ -838,7 +1194,7 @@ TCap abstractDiGraph::MCC_HaoOrlin(TMethMCC method,TNode r) throw(ERRange)
                         if (CT.logMeth>1)
                         {
                             sprintf(CT.logBuffer,
-                                "Relabelled node %ld: %g -> %g",u,dist[u],dMin+1);
+                                "Relabelled node %ld: %g -> %g",(unsigned long)u,dist[u],dMin+1);
                             LogEntry(LOG_METH2,CT.logBuffer);
                         }
 
@@ -858,7 +1214,7 @@ TCap abstractDiGraph::MCC_HaoOrlin(TMethMCC method,TNode r) throw(ERRange)
 
                         if (CT.logMeth>1)
                         {
-                            sprintf(CT.logBuffer,"dorm[%ld] = %ld",u,dormMax);
+                            sprintf(CT.logBuffer,"dorm[%ld] = %ld",(unsigned long)u,(unsigned long)dormMax);
                             LogEntry(LOG_METH2,CT.logBuffer);
                         }
 
@@ -962,7 +1318,7 @@ TCap abstractDiGraph::MCC_HaoOrlin(TMethMCC method,TNode r) throw(ERRange)
 
                     if (CT.logMeth>1)
                     {
-                        sprintf(CT.logBuffer," %ld",i);
+                        sprintf(CT.logBuffer," %ld",(unsigned long)i);
                         LogEntry(MSG_APPEND,CT.logBuffer);
                     }
 
@@ -995,7 +1351,7 @@ TCap abstractDiGraph::MCC_HaoOrlin(TMethMCC method,TNode r) throw(ERRange)
 
     CloseFold(ModHaoOrlin);
 
-    sprintf(CT.logBuffer,"...Strong edge %ld-connectivity is %g",r,minCap);
+    sprintf(CT.logBuffer,"...Strong edge %ld-connectivity is %g",(unsigned long)r,minCap);
     LogEntry(LOG_RES,CT.logBuffer);
 
     return minCap;
@@ -1064,7 +1420,7 @@ TCap abstractMixedGraph::MCC_LegalOrdering(TNode r,TNode &x,TNode &y)
 
         if (CT.logMeth>1 && I.Active(u))
         {
-            sprintf(CT.logBuffer,"%ld ",u);
+            sprintf(CT.logBuffer,"%ld ",(unsigned long)u);
             LogAppend(LH,CT.logBuffer);
         }
 
@@ -1111,7 +1467,7 @@ TCap abstractMixedGraph::MCC_LegalOrdering(TNode r,TNode &x,TNode &y)
 
     if (CT.logRes)
     {
-        sprintf(CT.logBuffer,"...delta(%ld)-cut has capacity: %g",x,ret);
+        sprintf(CT.logBuffer,"...delta(%ld)-cut has capacity: %g",(unsigned long)x,ret);
         LogEntry(LOG_RES2,CT.logBuffer);
     }
 
@@ -1215,3 +1571,621 @@ TCap abstractMixedGraph::MCC_NodeIdentification()
 
     return lambda;
 }
+
+
+
+TCap abstractMixedGraph::MCC_StoerWagner() throw()
+{
+    OpenFold(ModNodeIdentification,SHOW_TITLE);
+
+    LogEntry(LOG_METH,"(Stoer-Wagner method with Nagamochi-Ibaraki contractions)");
+
+    #if defined(_PROGRESS_)
+
+    InitProgressCounter((n>0) ? n-1 : 0);
+
+    #endif
+
+    disjointFamily<TNode> P(n,CT);
+
+    // The members of every node set form a list from first[r] to last[r],
+    // where r is the canonical element. Lists are only concatenated
+
+    TNode* rep = new TNode[n];
+    TNode* first = new TNode[n];
+    TNode* last = new TNode[n];
+    TNode* next = new TNode[n];
+
+    for (TNode v=0;v<n;v++)
+    {
+        P.Bud(v);
+        rep[v] = first[v] = last[v] = v;
+        next[v] = NoNode;
+    }
+
+    TFloat* key = new TFloat[n];
+    TNode* stamp = new TNode[n];
+
+    for (TNode v=0;v<n;v++) stamp[v] = NoNode;
+
+    goblinQueue<TNode,TFloat> *Q = NULL;
+
+    if (nHeap!=NULL)
+    {
+        Q = nHeap;
+        Q -> Init();
+    }
+    else Q = NewNodeHeap();
+
+    THandle H = Investigate();
+    investigator &I = Investigator(H);
+
+    std::vector<TNode> pairs;
+
+    TCap lambda = InfCap;
+    TNode bestFirst = NoNode;
+    TNode bestLast = NoNode;
+    TNode nSets = n;
+    bool disconnected = false;
+
+    for (TNode phase=0;nSets>1 && CT.SolverRunning();phase++)
+    {
+        // Maximum adjacency ordering of the node sets. The stamps distinguish
+        // the queued sets (2*phase) from the scanned sets (2*phase+1)
+
+        pairs.clear();
+
+        TNode prevSet = NoNode;
+        TNode lastSet = NoNode;
+        TNode nScanned = 0;
+
+        TNode r = rep[0];
+        key[r] = 0;
+        stamp[r] = 2*phase;
+        Q -> Insert(r,0);
+
+        while (!(Q->Empty()))
+        {
+            TNode u = Q->Delete();
+
+            stamp[u] = 2*phase+1;
+            prevSet = lastSet;
+            lastSet = u;
+            nScanned++;
+
+            TCap degree = 0;
+
+            for (TNode x=first[u];x!=NoNode;x=next[x])
+            {
+                I.Reset(x);
+
+                while (I.Active(x))
+                {
+                    TArc a = I.Read(x);
+                    TNode v = rep[EndNode(a)];
+
+                    if (v==u) continue;
+
+                    TCap thisCap = UCap(a);
+                    degree += thisCap;
+
+                    if (stamp[v]==2*phase+1) continue;
+
+                    if (stamp[v]!=2*phase)
+                    {
+                        key[v] = thisCap;
+                        stamp[v] = 2*phase;
+                        Q -> Insert(v,-key[v]);
+                    }
+                    else
+                    {
+                        key[v] += thisCap;
+                        Q -> ChangeKey(v,-key[v]);
+                    }
+
+                    // The connectivity of u and v is at least key[v]
+                    if (key[v]>=lambda && key[v]-thisCap<lambda)
+                    {
+                        pairs.push_back(u);
+                        pairs.push_back(v);
+                    }
+                }
+
+                if (x==last[u]) break;
+            }
+
+            if (degree<lambda)
+            {
+                // The node set u is a cut with the capacity degree
+
+                lambda = degree;
+                bestFirst = first[u];
+                bestLast = last[u];
+
+                SetUpperBound(TimerMinCut,lambda);
+
+                #if defined(_LOGGING_)
+
+                if (CT.logRes>=2)
+                {
+                    sprintf(CT.logBuffer,"Minimum cut has capacity %g",lambda);
+                    LogEntry(LOG_RES2,CT.logBuffer);
+                }
+
+                #endif
+            }
+        }
+
+        if (nScanned<nSets)
+        {
+            // The scanned node sets form a connected component
+            disconnected = true;
+            lambda = 0;
+            break;
+        }
+
+        // The last node set is a cut of the phase. By the Stoer-Wagner theorem,
+        // its capacity is the connectivity of the final two node sets
+
+        if (lastSet==NoNode || prevSet==NoNode) break;
+
+        pairs.push_back(prevSet);
+        pairs.push_back(lastSet);
+
+        for (size_t i=0;i<pairs.size();i+=2)
+        {
+            TNode x = P.Find(pairs[i]);
+            TNode y = P.Find(pairs[i+1]);
+
+            if (x==y) continue;
+
+            P.Merge(x,y);
+
+            TNode z = P.Find(x);
+            TNode w = (z==x) ? y : x;
+
+            next[last[z]] = first[w];
+            last[z] = last[w];
+            first[w] = last[w] = NoNode;
+            nSets--;
+
+            #if defined(_PROGRESS_)
+
+            ProgressStep(1);
+
+            #endif
+        }
+
+        for (TNode v=0;v<n;v++) rep[v] = P.Find(v);
+
+        Trace(1);
+    }
+
+    Close(H);
+
+    if (nHeap==NULL) delete Q;
+
+    TNode* chi = InitNodeColours(CONN_LEFT_HAND);
+
+    if (disconnected)
+    {
+        for (TNode v=0;v<n;v++)
+        {
+            chi[v] = (stamp[rep[v]]==stamp[rep[0]]) ? CONN_LEFT_HAND : CONN_RIGHT_HAND;
+        }
+    }
+    else if (bestFirst!=NoNode)
+    {
+        for (TNode v=bestFirst;v!=NoNode;v=next[v])
+        {
+            chi[v] = CONN_RIGHT_HAND;
+
+            if (v==bestLast) break;
+        }
+    }
+
+    delete[] rep;
+    delete[] first;
+    delete[] last;
+    delete[] next;
+    delete[] key;
+    delete[] stamp;
+
+    Trace();
+
+    if (CT.SolverRunning()) SetLowerBound(TimerMinCut,lambda);
+
+    CloseFold(ModNodeIdentification);
+
+    if (CT.logRes)
+    {
+        sprintf(CT.logBuffer,"...Edge connectivity is %g",lambda);
+        LogEntry(LOG_RES,CT.logBuffer);
+    }
+
+    return lambda;
+}
+
+
+/// \brief  Shared data of a concurrent evaluation of Gusfield flows
+struct TCutTreeTask
+{
+    diGraph**                       flowGraph;  ///< One copy of the original graph per thread
+    abstractMixedGraph::TMethMXF    method;     ///< The applied max-flow method
+    TNode                           n;          ///< Number of graph nodes
+    unsigned long                   nSlots;     ///< Number of max-flow problems
+    const TNode*                    source;     ///< The source nodes
+    const TNode*                    target;     ///< The target nodes
+    TCap*                           value;      ///< Returns the minimum cut capacities
+    char*                           sourceSide; ///< Returns the cuts, nSlots rows of n entries
+    unsigned long                   next;       ///< The next slot to be claimed by a thread
+};
+
+
+/// \brief  Argument record of the cut tree worker threads
+struct TCutTreeArg
+{
+    TCutTreeTask*   task;
+    unsigned        id;
+};
+
+
+static void* CutTreeWorker(void* arg) throw()
+{
+    TCutTreeArg* thisArg = static_cast<TCutTreeArg*>(arg);
+    TCutTreeTask& task = *(thisArg->task);
+    diGraph& G = *(task.flowGraph[thisArg->id]);
+
+    bool wasWorker = goblinController::WorkerThread();
+    goblinController::SetWorkerThread(true);
+
+    while (G.Context().SolverRunning())
+    {
+        unsigned long k = __sync_fetch_and_add(&task.next,1UL);
+
+        if (k>=task.nSlots) break;
+
+        G.InitSubgraph();
+        G.MaxFlow(task.method,task.source[k],task.target[k]);
+        task.value[k] = G.FlowValue(task.source[k],task.target[k]);
+
+        TFloat* dist = G.GetDistanceLabels();
+        char* side = task.sourceSide+k*task.n;
+
+        for (TNode u=0;u<task.n;u++) side[u] = (dist[u]<InfFloat);
+    }
+
+    goblinController::SetWorkerThread(wasWorker);
+
+    return NULL;
+}
+
+
+gomoryHuTree::gomoryHuTree(abstractGraph& G,TMethMXF method) throw() :
+    managedObject(G.Context()),
+    diGraph(G.N(),G.Context(),true)
+{
+    LogEntry(LOG_MAN,"Computing Gomory-Hu tree...");
+
+    nLevels = 0;
+    depth = NULL;
+    ancestor = NULL;
+    pathCap = NULL;
+
+    unsigned nThreads = CT.NumThreads();
+
+    if (nThreads+1>n) nThreads = (n>1) ? n-1 : 1;
+
+    diGraph** flowGraph = new diGraph*[nThreads];
+
+    CT.SuppressLogging();
+
+    for (unsigned i=0;i<nThreads;i++)
+    {
+        flowGraph[i] = new diGraph(n,CT,true);
+        flowGraph[i] -> Representation() -> SetCDemand(0);
+
+        for (TArc a=0;a<2*G.M();a++)
+        {
+            flowGraph[i] -> InsertArc(G.StartNode(a),G.EndNode(a),G.UCap(a),0);
+        }
+    }
+
+    CT.RestoreLogging();
+
+    TNode* parent = new TNode[n];
+    TCap* value = new TCap[n];
+
+    for (TNode v=0;v<n;v++)
+    {
+        parent[v] = 0;
+        value[v] = InfCap;
+    }
+
+    TNode* source = new TNode[nThreads];
+    TNode* target = new TNode[nThreads];
+    TCap* slotValue = new TCap[nThreads];
+    char* sourceSide = new char[nThreads*n];
+
+    pthread_t* threads = new pthread_t[nThreads];
+    TCutTreeArg* args = new TCutTreeArg[nThreads];
+
+    TCutTreeTask task;
+    task.flowGraph = flowGraph;
+    task.method = method;
+    task.n = n;
+    task.source = source;
+    task.target = target;
+    task.value = slotValue;
+    task.sourceSide = sourceSide;
+
+    for (unsigned i=0;i<nThreads;i++)
+    {
+        args[i].task = &task;
+        args[i].id = i;
+    }
+
+    #if defined(_PROGRESS_)
+
+    InitProgressCounter((n>0) ? n-1 : 0);
+    SetProgressNext(1);
+
+    #endif
+
+    // Gusfield's method processes the nodes s=1,2,..,n-1 in this order, and
+    // the target of s is the current parent node. A window of nodes is solved
+    // concurrently and speculatively, with the parent nodes at the window start
+
+    TNode s = 1;
+
+    while (s<n && CT.SolverRunning())
+    {
+        unsigned long nSlots = n-s;
+
+        if (nSlots>nThreads) nSlots = nThreads;
+
+        for (unsigned long k=0;k<nSlots;k++)
+        {
+            source[k] = s+TNode(k);
+            target[k] = parent[s+k];
+        }
+
+        task.nSlots = nSlots;
+        task.next = 0;
+
+        for (unsigned i=1;i<nSlots;i++)
+        {
+            pthread_create(&threads[i],NULL,CutTreeWorker,&args[i]);
+        }
+
+        CutTreeWorker(&args[0]);
+
+        for (unsigned i=1;i<nSlots;i++) pthread_join(threads[i],NULL);
+
+        if (!CT.SolverRunning()) break;
+
+        // Commit the flows in the order of the source nodes. Stop at the first
+        // flow whose target node has been changed by the previous commits
+
+        for (unsigned long k=0;k<nSlots;k++)
+        {
+            TNode v = source[k];
+            TNode t = parent[v];
+
+            if (t!=target[k]) break;
+
+            const char* side = sourceSide+k*n;
+            TCap thisValue = slotValue[k];
+
+            value[v] = thisValue;
+
+            for (TNode u=0;u<n;u++)
+            {
+                if (u!=v && side[u] && parent[u]==t) parent[u] = v;
+            }
+
+            if (side[parent[t]])
+            {
+                parent[v] = parent[t];
+                parent[t] = v;
+                value[v] = value[t];
+                value[t] = thisValue;
+            }
+
+            s++;
+
+            #if defined(_PROGRESS_)
+
+            ProgressStep(1);
+
+            #endif
+        }
+    }
+
+    for (unsigned i=0;i<nThreads;i++) delete flowGraph[i];
+
+    delete[] flowGraph;
+    delete[] source;
+    delete[] target;
+    delete[] slotValue;
+    delete[] sourceSide;
+    delete[] threads;
+    delete[] args;
+
+    for (TNode v=1;v<n;v++) InsertArc(v,parent[v],value[v],value[v]);
+
+    for (TNode v=0;v<n;v++)
+    {
+        for (TDim i=0;i<G.Dim();i++) X.SetC(v,i,G.C(v,i));
+    }
+
+    if (n>0) parent[0] = NoNode;
+
+    InitQueries(parent,value);
+
+    delete[] parent;
+    delete[] value;
+
+    if (CT.traceLevel==2) Display();
+}
+
+
+gomoryHuTree::~gomoryHuTree() throw()
+{
+    delete[] depth;
+    delete[] ancestor;
+    delete[] pathCap;
+}
+
+
+unsigned long gomoryHuTree::Size() const throw()
+{
+    return
+          sizeof(gomoryHuTree)
+        + managedObject::Allocated()
+        + abstractMixedGraph::Allocated()
+        + abstractDiGraph::Allocated()
+        + diGraph::Allocated()
+        + gomoryHuTree::Allocated();
+}
+
+
+unsigned long gomoryHuTree::Allocated() const throw()
+{
+    return n*sizeof(TNode)+nLevels*n*(sizeof(TNode)+sizeof(TCap));
+}
+
+
+void gomoryHuTree::InitQueries(const TNode* parent,const TCap* value) throw()
+{
+    if (n==0) return;
+
+    nLevels = 1;
+
+    while (nLevels<8*sizeof(TNode)-1 && (TNode(1)<<nLevels)<n) nLevels++;
+
+    depth = new TNode[n];
+    ancestor = new TNode[nLevels*n];
+    pathCap = new TCap[nLevels*n];
+
+    // Determine the node depths by a breadth first search from the root
+
+    TNode* firstChild = new TNode[n];
+    TNode* nextSibling = new TNode[n];
+    TNode* order = new TNode[n];
+
+    for (TNode v=0;v<n;v++) firstChild[v] = NoNode;
+
+    for (TNode v=n-1;v>0;v--)
+    {
+        nextSibling[v] = firstChild[parent[v]];
+        firstChild[parent[v]] = v;
+    }
+
+    TNode head = 0;
+    TNode tail = 1;
+    order[0] = 0;
+    depth[0] = 0;
+
+    while (head<tail)
+    {
+        TNode u = order[head++];
+
+        for (TNode w=firstChild[u];w!=NoNode;w=nextSibling[w])
+        {
+            depth[w] = depth[u]+1;
+            order[tail++] = w;
+        }
+    }
+
+    delete[] firstChild;
+    delete[] nextSibling;
+    delete[] order;
+
+    for (TNode v=0;v<n;v++)
+    {
+        ancestor[v] = (v==0) ? 0 : parent[v];
+        pathCap[v] = (v==0) ? InfCap : value[v];
+    }
+
+    for (TNode k=1;k<nLevels;k++)
+    {
+        for (TNode v=0;v<n;v++)
+        {
+            TNode w = ancestor[(k-1)*n+v];
+
+            ancestor[k*n+v] = ancestor[(k-1)*n+w];
+            pathCap[k*n+v] = pathCap[(k-1)*n+v];
+
+            if (pathCap[(k-1)*n+w]<pathCap[k*n+v]) pathCap[k*n+v] = pathCap[(k-1)*n+w];
+        }
+    }
+}
+
+
+TCap gomoryHuTree::MinCutValue(TNode u,TNode v) const throw(ERRange)
+{
+    #if defined(_FAILSAVE_)
+
+    if (u>=n) NoSuchNode("MinCutValue",u);
+
+    if (v>=n) NoSuchNode("MinCutValue",v);
+
+    #endif
+
+    TCap ret = InfCap;
+
+    if (depth[u]<depth[v])
+    {
+        TNode w = u;
+        u = v;
+        v = w;
+    }
+
+    // Lift u to the depth of v
+
+    TNode diff = depth[u]-depth[v];
+
+    for (TNode k=0;diff>0;k++,diff>>=1)
+    {
+        if (!(diff&1)) continue;
+
+        if (pathCap[k*n+u]<ret) ret = pathCap[k*n+u];
+
+        u = ancestor[k*n+u];
+    }
+
+    if (u==v) return ret;
+
+    // Lift u and v to the children of the lowest common ancestor
+
+    for (TNode k=nLevels;k>0;k--)
+    {
+        if (ancestor[(k-1)*n+u]==ancestor[(k-1)*n+v]) continue;
+
+        if (pathCap[(k-1)*n+u]<ret) ret = pathCap[(k-1)*n+u];
+
+        if (pathCap[(k-1)*n+v]<ret) ret = pathCap[(k-1)*n+v];
+
+        u = ancestor[(k-1)*n+u];
+        v = ancestor[(k-1)*n+v];
+    }
+
+    if (pathCap[u]<ret) ret = pathCap[u];
+
+    if (pathCap[v]<ret) ret = pathCap[v];
+
+    return ret;
+}
+
+
+gomoryHuTree* abstractGraph::GomoryHuTree(TMethMXF method) throw()
+{
+    OpenFold(ModMinCut,NO_INDENT);
+
+    gomoryHuTree* T = new gomoryHuTree(*this,method);
+
+    CloseFold(ModMinCut,NO_INDENT);
+
+    return T;
+}
@@ -14,6 +14,8 @@
 #include "nestedFamily.h"
 #include "abstractGraph.h"
 #include "staticQueue.h"
+#include "incidenceScanner.h"
+#include "dAryHeap.h"
 
 
 TFloat abstractMixedGraph::MinTree(TMethMST method,TOptMST characteristic,TNode r)
@@ -131,6 +133,27 @@ TFloat abstractMixedGraph::MST_Prim(TMethMST method,
 
     #endif
 
+    if (frozen)
+    {
+        frozenScanner I(*frozen);
+        return MST_Prim(I,method,characteristic,r);
+    }
+
+    if (Representation() && IsSparse())
+    {
+        sparseScanner I(*this);
+        return MST_Prim(I,method,characteristic,r);
+    }
+
+    genericScanner I(*this);
+    return MST_Prim(I,method,characteristic,r);
+}
+
+
+template <class TScanner>
+TFloat abstractMixedGraph::MST_Prim(const TScanner& I,TMethMST method,
+    TOptMST characteristic,TNode r) throw(ERRange,ERRejected)
+{
     TModule moduleID = ModPrim2;
 
     if (!CLCap() || MaxLCap()>0) method = MST_PRIM2;
@@ -152,8 +175,6 @@ TFloat abstractMixedGraph::MST_Prim(TMethMST method,
     TFloat* potential = GetPotentials();
 
     TFloat sum = 0;
-    THandle H = Investigate();
-    investigator &I = Investigator(H);
 
     TNode nExplored = 0;
     TNode r2 = r;
@@ -166,11 +187,11 @@ TFloat abstractMixedGraph::MST_Prim(TMethMST method,
         TArc a1 = NoArc;
         TArc a2 = NoArc;
 
-        while (I.Active(r))
+        for (TArc k=I.First(r);k!=NoArc;k=I.Next(r,k))
         {
-            TArc a = I.Read(r);
+            TArc a = I.Arc(k);
 
-            if (EndNode(a)!=r && UCap(a)>0)
+            if (I.EndNode(k)!=r && I.Capacitated(k))
             {
                 if (   a1==NoArc || LCap(a)>0
                     || (   sign*MST_Length(characteristic,potential,a)
@@ -196,10 +217,9 @@ TFloat abstractMixedGraph::MST_Prim(TMethMST method,
 
         if (a2==NoArc)
         {
-            Close(H);
             CloseFold(moduleID);
 
-            sprintf(CT.logBuffer,"...There is no cycle through node %ld",r);
+            sprintf(CT.logBuffer,"...There is no cycle through node %ld",(unsigned long)r);
             LogEntry(LOG_RES,CT.logBuffer);
             SetBounds(TimerMinTree,sign*InfFloat,sign*InfFloat);
 
@@ -226,7 +246,7 @@ TFloat abstractMixedGraph::MST_Prim(TMethMST method,
 
     if (CT.logMeth>1 && r!=r2)
     {
-        sprintf(CT.logBuffer,"%ld ",r);
+        sprintf(CT.logBuffer,"%ld ",(unsigned long)r);
         LogAppend(LH,CT.logBuffer);
     }
 
@@ -242,7 +262,7 @@ TFloat abstractMixedGraph::MST_Prim(TMethMST method,
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"%ld ",u);
+                sprintf(CT.logBuffer,"%ld ",(unsigned long)u);
                 LogAppend(LH,CT.logBuffer);
             }
 
@@ -252,13 +272,14 @@ TFloat abstractMixedGraph::MST_Prim(TMethMST method,
             dist[u] = -sign*InfFloat;
             nExplored++;
 
-            while (I.Active(u))
+            for (TArc k=I.First(u);k!=NoArc;k=I.Next(u,k))
             {
-                TArc a = I.Read(u);
-                TNode v = EndNode(a);
-                TFloat l = MST_Length(characteristic,potential,a);
+                TArc a = I.Arc(k);
+                TNode v = I.EndNode(k);
+                TFloat l = (characteristic & MST_REDUCED) ?
+                                RedLength(potential,a) : I.Length(k);
 
-                if (sign*dist[v]>sign*l && UCap(a)>0)
+                if (sign*dist[v]>sign*l && I.Capacitated(k))
                 {
                     dist[v] = l;
                     pred[v] = a;
@@ -280,9 +301,17 @@ TFloat abstractMixedGraph::MST_Prim(TMethMST method,
     {
         // Enhanced version of the algorithm
 
+        bool lowerBounds = (!CLCap() || MaxLCap()>0);
         goblinQueue<TNode,TFloat>* Q = nHeap;
 
         if (Q!=NULL) Q -> Init();
+        else if (CT.methPQ==1 && m>2*n)
+        {
+            // The keys are not monotone so that radix heaps do not apply. But
+            // there are up to m key decreases and only n deletions. A d-ary
+            // heap with d ~ m/n is preferable to the default binary heap then
+            Q = new dAryHeap<TNode,TFloat>(n,CT,TNode(m/n));
+        }
         else Q = NewNodeHeap();
 
         Q -> Insert(u,0);
@@ -299,24 +328,25 @@ TFloat abstractMixedGraph::MST_Prim(TMethMST method,
 
             if (CT.logMeth>=2)
             {
-                sprintf(CT.logBuffer,"%ld ",u);
+                sprintf(CT.logBuffer,"%ld ",(unsigned long)u);
                 LogAppend(LH,CT.logBuffer);
             }
 
             #endif
 
-            while (I.Active(u))
+            for (TArc k=I.First(u);k!=NoArc;k=I.Next(u,k))
             {
-                TArc a = I.Read(u);
-                TNode v = EndNode(a);
+                TArc a = I.Arc(k);
+                TNode v = I.EndNode(k);
                 TFloat l = -sign*InfFloat;
 
-                if (LCap(a)==0)
+                if (!lowerBounds || LCap(a)==0)
                 {
-                    l = MST_Length(characteristic,potential,a);
+                    l = (characteristic & MST_REDUCED) ?
+                            RedLength(potential,a) : I.Length(k);
                 }
 
-                if (sign*dist[v]>sign*l && UCap(a)>0)
+                if (sign*dist[v]>sign*l && I.Capacitated(k))
                 {
                     if (dist[v]==sign*InfFloat)
                     {
@@ -341,7 +371,6 @@ TFloat abstractMixedGraph::MST_Prim(TMethMST method,
 
     #endif
 
-    Close(H);
     CloseFold(moduleID);
 
     if (nExplored<n)
@@ -422,7 +451,7 @@ TFloat abstractMixedGraph::MST_Kruskal(TOptMST characteristic,TNode r)
 
                 sprintf(CT.logBuffer,
                     "Mandatory arc %ld (%ld,%ld), length: %g",
-                    2*a,u,v,MST_Length(characteristic,potential,2*a));
+                    (unsigned long)(2*a),(unsigned long)u,(unsigned long)v,MST_Length(characteristic,potential,2*a));
                 LogEntry(LOG_METH2,CT.logBuffer);
 
                 #endif
@@ -465,7 +494,7 @@ TFloat abstractMixedGraph::MST_Kruskal(TOptMST characteristic,TNode r)
             {
                 sprintf(CT.logBuffer,
                     "Contracted arc %ld (%ld,%ld), length: %g",
-                    a,Bu,Bv,MST_Length(characteristic,potential,a));
+                    (unsigned long)a,(unsigned long)Bu,(unsigned long)Bv,MST_Length(characteristic,potential,a));
                 LogEntry(LOG_METH2,CT.logBuffer);
             }
 
@@ -487,7 +516,7 @@ TFloat abstractMixedGraph::MST_Kruskal(TOptMST characteristic,TNode r)
         if (rank<n-2)
         {
             CloseFold(ModKruskal);
-            sprintf(CT.logBuffer,"...%ld is a cut node",r);
+            sprintf(CT.logBuffer,"...%ld is a cut node",(unsigned long)r);
             LogEntry(LOG_RES,CT.logBuffer);
             SetBounds(TimerMinTree,sign*InfFloat,sign*InfFloat);
 
@@ -541,7 +570,7 @@ TFloat abstractMixedGraph::MST_Kruskal(TOptMST characteristic,TNode r)
         if (fixedArcs>2)
         {
             CloseFold(ModKruskal);
-            sprintf(CT.logBuffer,"...Too much fixed arcs adjacent with %ld",r);
+            sprintf(CT.logBuffer,"...Too much fixed arcs adjacent with %ld",(unsigned long)r);
             LogEntry(LOG_RES,CT.logBuffer);
             SetBounds(TimerMinTree,sign*InfFloat,sign*InfFloat);
 
@@ -551,7 +580,7 @@ TFloat abstractMixedGraph::MST_Kruskal(TOptMST characteristic,TNode r)
         if (a2==NoArc)
         {
             CloseFold(ModKruskal);
-            sprintf(CT.logBuffer,"...There is no cycle through node %ld",r);
+            sprintf(CT.logBuffer,"...There is no cycle through node %ld",(unsigned long)r);
             LogEntry(LOG_RES,CT.logBuffer);
             SetBounds(TimerMinTree,sign*InfFloat,sign*InfFloat);
 
@@ -564,12 +593,12 @@ TFloat abstractMixedGraph::MST_Kruskal(TOptMST characteristic,TNode r)
         {
             sprintf(CT.logBuffer,
                 "Adding arc %ld with end nodes %ld and %ld, arc length: %g",
-                a1,r,EndNode(a1),MST_Length(characteristic,potential,a1));
+                (unsigned long)a1,(unsigned long)r,(unsigned long)EndNode(a1),MST_Length(characteristic,potential,a1));
             LogEntry(LOG_METH2,CT.logBuffer);
 
             sprintf(CT.logBuffer,
                 "Adding arc %ld with end nodes %ld and %ld, arc length: %g",
-                a2,r,EndNode(a2),MST_Length(characteristic,potential,a2));
+                (unsigned long)a2,(unsigned long)r,(unsigned long)EndNode(a2),MST_Length(characteristic,potential,a2));
             LogEntry(LOG_METH2,CT.logBuffer);
         }
 
@@ -587,7 +616,7 @@ TFloat abstractMixedGraph::MST_Kruskal(TOptMST characteristic,TNode r)
 
     if (!(characteristic & MST_ONE_CYCLE) && rank<n-1)
     {
-        sprintf(CT.logBuffer,"...Graph rank is %ld",rank);
+        sprintf(CT.logBuffer,"...Graph rank is %ld",(unsigned long)rank);
         LogEntry(LOG_RES,CT.logBuffer);
 
         sum = sign*InfFloat;
@@ -723,7 +752,7 @@ TFloat abstractMixedGraph::MST_Edmonds(TOptMST characteristic,TNode r)
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"inArc[%ld] = %ld",v,minArc);
+            sprintf(CT.logBuffer,"inArc[%ld] = %ld",(unsigned long)v,(unsigned long)minArc);
             LogEntry(LOG_METH2,CT.logBuffer);
         }
 
@@ -755,7 +784,7 @@ TFloat abstractMixedGraph::MST_Edmonds(TOptMST characteristic,TNode r)
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"Merging cycle (%ld",u);
+            sprintf(CT.logBuffer,"Merging cycle (%ld",(unsigned long)u);
             LH = LogStart(LOG_METH2,CT.logBuffer);
         }
 
@@ -772,7 +801,7 @@ TFloat abstractMixedGraph::MST_Edmonds(TOptMST characteristic,TNode r)
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,",%ld",w);
+                sprintf(CT.logBuffer,",%ld",(unsigned long)w);
                 LogAppend(LH,CT.logBuffer);
             }
 
@@ -783,7 +812,7 @@ TFloat abstractMixedGraph::MST_Edmonds(TOptMST characteristic,TNode r)
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,",%ld)",u);
+            sprintf(CT.logBuffer,",%ld)",(unsigned long)u);
             LogEnd(LH,CT.logBuffer);
         }
 
@@ -896,7 +925,7 @@ TFloat abstractMixedGraph::MST_Edmonds(TOptMST characteristic,TNode r)
 
             if (CT.logMeth>1 && IsDirected())
             {
-                sprintf(CT.logBuffer,"inArc[%ld] = *",thisRoot);
+                sprintf(CT.logBuffer,"inArc[%ld] = *",(unsigned long)thisRoot);
                 LogEntry(LOG_METH2,CT.logBuffer);
             }
 
@@ -913,7 +942,7 @@ TFloat abstractMixedGraph::MST_Edmonds(TOptMST characteristic,TNode r)
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"inArc[%ld] = %ld",u,a);
+                sprintf(CT.logBuffer,"inArc[%ld] = %ld",(unsigned long)u,(unsigned long)a);
                 LogEntry(LOG_METH2,CT.logBuffer);
             }
 
@@ -962,7 +991,7 @@ TFloat abstractMixedGraph::MST_Edmonds(TOptMST characteristic,TNode r)
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"inArc[%ld] = %ld",r,minArc);
+                sprintf(CT.logBuffer,"inArc[%ld] = %ld",(unsigned long)r,(unsigned long)minArc);
                 LogEntry(LOG_METH2,CT.logBuffer);
             }
 
@@ -994,7 +1023,7 @@ TFloat abstractMixedGraph::MST_Edmonds(TOptMST characteristic,TNode r)
 
         if (CT.logRes)
         {
-            sprintf(CT.logBuffer,"...Graph rank is %ld",rank);
+            sprintf(CT.logBuffer,"...Graph rank is %ld",(unsigned long)rank);
             LogEntry(LOG_RES,CT.logBuffer);
         }
     }
@@ -14,6 +14,7 @@
 #include "mixedGraph.h"
 #include "staticQueue.h"
 #include "staticStack.h"
+#include "depthFirstSearch.h"
 #include "subgraph.h"
 #include "segment.h"
 #include "sparseBigraph.h"
@@ -28,42 +29,77 @@ enum TEdgeType {
 
 
 // Requires 2-connectivity
-void preparingDFS(abstractMixedGraph& G, TNode v,
-                  attribute<bool>& V_T, int& card_V_T,
-                  attribute<int>& EdgeType, attribute<TArc>& pred,
-                  attribute<TNode>& PreO, attribute<TNode>& PostO, int& POST,
-                  attribute<TNode>& Low1, attribute<TNode>& Low2)
+class preparingDFS : public depthFirstSearch
 {
-    TArc Adj_v = G.First(v);
-    TNode w;
+private:
+
+    attribute<bool>&    V_T;
+    int&                card_V_T;
+    attribute<int>&     EdgeType;
+    attribute<TArc>&    pred;
+    attribute<TNode>&   PreO;
+    attribute<TNode>&   PostO;
+    int&                POST;
+    attribute<TNode>&   Low1;
+    attribute<TNode>&   Low2;
+
+public:
+
+    preparingDFS(abstractMixedGraph& G,
+                 attribute<bool>& _V_T, int& _card_V_T,
+                 attribute<int>& _EdgeType, attribute<TArc>& _pred,
+                 attribute<TNode>& _PreO, attribute<TNode>& _PostO, int& _POST,
+                 attribute<TNode>& _Low1, attribute<TNode>& _Low2) throw() :
+        depthFirstSearch(G),
+        V_T(_V_T), card_V_T(_card_V_T), EdgeType(_EdgeType), pred(_pred),
+        PreO(_PreO), PostO(_PostO), POST(_POST), Low1(_Low1), Low2(_Low2) {};
+    ~preparingDFS() throw() {};
+
+protected:
+
+    void    PreVisit(TNode w,TArc Adj_v) throw();
+    void    PostVisit(TNode v,TArc Adj_v) throw();
+    void    NonTreeArc(TArc Adj_v) throw();
+
+};
+
+
+void preparingDFS::PreVisit(TNode w,TArc Adj_v) throw()
+{
+    // The root node is marked by the caller
+    if (Adj_v==NoArc) return;
+
+    V_T.SetValue(w,true);
+    EdgeType.SetValue(Adj_v, TreeEdge);
+    card_V_T++;
+    pred.SetValue(w,Adj_v);
+    PreO.SetValue(w,card_V_T);
+}
+
+
+void preparingDFS::NonTreeArc(TArc Adj_v) throw()
+{
+    TNode v = G.StartNode(Adj_v);
+    TNode w = G.EndNode(Adj_v);
+
+    if ((pred.GetValue(v) != NoArc) &&
+        (PreO[w] < PreO[G.StartNode(pred.GetValue(v))] )) {
+        EdgeType.SetValue(Adj_v, BackEdge);
+        Low1.SetValue(Adj_v>>1, PreO[w]);
+        Low2.SetValue(Adj_v>>1, PreO[v]);
+    }
+}
 
-    do {
-        w = G.EndNode(Adj_v);
-
-        if (V_T[w] == false) {
-            V_T.SetValue(w,true);
-            EdgeType.SetValue(Adj_v, TreeEdge);
-            card_V_T++;
-            pred.SetValue(w,Adj_v);
-            PreO.SetValue(w,card_V_T);
-            preparingDFS(G,w,V_T,card_V_T,EdgeType,pred,PreO,PostO,POST,Low1,Low2);
-        }
-        else if ((pred.GetValue(v) != NoArc) &&
-                 (PreO[w] < PreO[G.StartNode(pred.GetValue(v))] )) {
-            EdgeType.SetValue(Adj_v, BackEdge);
-            Low1.SetValue(Adj_v>>1, PreO[w]);
-            Low2.SetValue(Adj_v>>1, PreO[v]);
-        }
-        Adj_v = G.Right(Adj_v,NoNode);
-    } while (Adj_v != G.First(v));
 
+void preparingDFS::PostVisit(TNode v,TArc) throw()
+{
     PostO.SetValue(v,POST);
     POST++;
 
+    TNode w;
     TNode L1, L2;
-    TNode a, b;
     TArc Adj_w;
-    Adj_v = G.First(v);
+    TArc Adj_v = G.First(v);
     do {
         if (EdgeType[Adj_v] == TreeEdge) {
             w = G.EndNode(Adj_v);
@@ -71,8 +107,6 @@ void preparingDFS(abstractMixedGraph& G, TNode v,
             L2 = PreO[w];
             Adj_w = G.First(w);
             do {
-                a = G.StartNode(Adj_w);
-                b = G.EndNode(Adj_w);
                 if ((EdgeType[Adj_w]==BackEdge) || (EdgeType[Adj_w]==TreeEdge)) {
                     if (Low1[Adj_w>>1] < L1) {
                         L2 = L1;
@@ -186,9 +220,18 @@ TSegPath::TSegPath(TArc StartArc) {
 
 TSegPath::~TSegPath()
 {
-    for (size_t i=0; i<Emanat.size(); i++)
-        delete Emanat[i];
+    // Release the path tree without recursion
+    vector<TSegPath*> Pending(Emanat);
     Emanat.clear();
+
+    while (!Pending.empty())
+    {
+        TSegPath* Seg = Pending.back();
+        Pending.pop_back();
+        Pending.insert(Pending.end(),Seg->Emanat.begin(),Seg->Emanat.end());
+        Seg->Emanat.clear();
+        delete Seg;
+    }
 }
 
 
@@ -197,45 +240,58 @@ TSegPath* createSegPath(abstractMixedGraph& G, attribute<TNode>& PreO,
     const TArc StartArc)
 {
     G.OpenFold();
-    sprintf(G.Context().logBuffer,"Create Seg(%li,%li): ",
-            G.StartNode(StartArc),G.EndNode(StartArc));
-    G.LogEntry(LOG_METH2, G.Context().logBuffer);
 
-    TSegPath* Seg = new TSegPath(StartArc);
-    vector<TSegPath*>::iterator EmanatPos = Seg->Emanat.begin();
+    TSegPath* RootSeg = new TSegPath(StartArc);
 
-    TArc g = StartArc;
-    while (EdgeType[g] == TreeEdge)
+    // Segments which have been generated but whose paths have not been traversed
+    vector<TSegPath*> Pending(1,RootSeg);
+
+    while (!Pending.empty())
     {
-        g = G.First(G.EndNode(g));
+        TSegPath* Seg = Pending.back();
+        Pending.pop_back();
 
-        sprintf(G.Context().logBuffer,"add edge (%li,%li)",
-                G.StartNode(g),G.EndNode(g));
+        sprintf(G.Context().logBuffer,"Create Seg(%li,%li): ",
+                (unsigned long)G.StartNode(Seg->e),(unsigned long)G.EndNode(Seg->e));
         G.LogEntry(LOG_METH2, G.Context().logBuffer);
 
-        TArc e = G.Right(g,NoNode);
-        while (e != g)
+        vector<TSegPath*>::iterator EmanatPos = Seg->Emanat.begin();
+
+        TArc g = Seg->e;
+        while (EdgeType[g] == TreeEdge)
         {
-            if ((EdgeType[e] == BackEdge) || (EdgeType[e] == TreeEdge))
+            g = G.First(G.EndNode(g));
+
+            sprintf(G.Context().logBuffer,"add edge (%li,%li)",
+                    (unsigned long)G.StartNode(g),(unsigned long)G.EndNode(g));
+            G.LogEntry(LOG_METH2, G.Context().logBuffer);
+
+            TArc e = G.Right(g,NoNode);
+            while (e != g)
             {
-                TSegPath* ChildSeg = createSegPath(G,PreO,EdgeType,Low1,Low2,e);
-                EmanatPos = Seg->Emanat.insert(EmanatPos,ChildSeg);
-                EmanatPos++;
+                if ((EdgeType[e] == BackEdge) || (EdgeType[e] == TreeEdge))
+                {
+                    TSegPath* ChildSeg = new TSegPath(e);
+                    EmanatPos = Seg->Emanat.insert(EmanatPos,ChildSeg);
+                    EmanatPos++;
+                    Pending.push_back(ChildSeg);
+                }
+                e = G.Right(e,NoNode);
             }
-            e = G.Right(e,NoNode);
+
+            if (!Seg->Emanat.empty())
+                EmanatPos = Seg->Emanat.begin();
         }
 
-        if (!Seg->Emanat.empty())
-            EmanatPos = Seg->Emanat.begin();
-    }
+        Seg->Low1Edge = g;
+        for (TIndex i=0; i<Seg->Emanat.size(); i++)
+            Seg->Emanat[i]->Emanat_Index = i;
 
-    Seg->Low1Edge = g;
-    for (TIndex i=0; i<Seg->Emanat.size(); i++)
-        Seg->Emanat[i]->Emanat_Index = i;
+        G.LogEntry(LOG_METH2, ";");
+    }
 
-    G.LogEntry(LOG_METH2, ";");
     G.CloseFold();
-    return Seg;
+    return RootSeg;
 }
 
 
@@ -255,30 +311,39 @@ void printList(abstractMixedGraph& G,list<TNode>& l)
 {
     THandle LH = G.LogStart(LOG_METH2, "{");
     for (list<TNode>::iterator i=l.begin(); i!=l.end(); i++) {
-        sprintf(G.Context().logBuffer,"%li ",*i);
+        sprintf(G.Context().logBuffer,"%li ",(unsigned long)*i);
         G.LogAppend(LH, G.Context().logBuffer);
     }
     G.LogEnd(LH, "}");
 }
 
 
-void printPathTree(abstractMixedGraph& G, attribute<int>& EdgeType, TSegPath* Seg)
+void printPathTree(abstractMixedGraph& G, attribute<int>& EdgeType, TSegPath* RootSeg)
 {
-    TArc g = Seg->e;
-    sprintf(G.Context().logBuffer," (%li,",G.StartNode(g));
-    THandle LH = G.LogStart(LOG_METH2, G.Context().logBuffer);
+    // Preorder traversal of the path tree by an explicit stack
+    vector<TSegPath*> Pending(1,RootSeg);
 
-    while (EdgeType.GetValue(g) == TreeEdge) {
-        sprintf(G.Context().logBuffer,"%li,",G.EndNode(g));
-        G.LogAppend(LH, G.Context().logBuffer);
-        g = G.First(G.EndNode(g));
-    }
-    sprintf(G.Context().logBuffer,"%li)",G.EndNode(g));
-    G.LogEnd(LH, G.Context().logBuffer);
+    while (!Pending.empty())
+    {
+        TSegPath* Seg = Pending.back();
+        Pending.pop_back();
+
+        TArc g = Seg->e;
+        sprintf(G.Context().logBuffer," (%li,",(unsigned long)G.StartNode(g));
+        THandle LH = G.LogStart(LOG_METH2, G.Context().logBuffer);
+
+        while (EdgeType.GetValue(g) == TreeEdge) {
+            sprintf(G.Context().logBuffer,"%li,",(unsigned long)G.EndNode(g));
+            G.LogAppend(LH, G.Context().logBuffer);
+            g = G.First(G.EndNode(g));
+        }
+        sprintf(G.Context().logBuffer,"%li)",(unsigned long)G.EndNode(g));
+        G.LogEnd(LH, G.Context().logBuffer);
 
-    vector<TSegPath*>::iterator EmanatPos = Seg->Emanat.begin();
-    for (; EmanatPos != Seg->Emanat.end(); EmanatPos++)
-        printPathTree(G,EdgeType,*EmanatPos);
+        vector<TSegPath*>::reverse_iterator EmanatPos = Seg->Emanat.rbegin();
+        for (; EmanatPos != Seg->Emanat.rend(); EmanatPos++)
+            Pending.push_back(*EmanatPos);
+    }
 }
 
 
@@ -304,8 +369,8 @@ void printSegGrCs(abstractMixedGraph& G, attribute<TNode>& PreO,
         list<TSegPath*>::iterator S;
         for (S=C->L->Segments.begin(); S!=C->L->Segments.end(); S++) {
             sprintf(G.Context().logBuffer,"Seg(%li,%li),",
-                    PreO.GetValue(G.StartNode((*S)->e)),
-                    PreO.GetValue(G.EndNode((*S)->e)));
+                    (unsigned long)PreO.GetValue(G.StartNode((*S)->e)),
+                    (unsigned long)PreO.GetValue(G.EndNode((*S)->e)));
             G.LogAppend(LH, G.Context().logBuffer);
         }
         G.LogEnd(LH, "}");
@@ -314,8 +379,8 @@ void printSegGrCs(abstractMixedGraph& G, attribute<TNode>& PreO,
         LH = G.LogStart(LOG_METH2, G.Context().logBuffer);
         for (S=C->R->Segments.begin(); S!=C->R->Segments.end(); S++) {
             sprintf(G.Context().logBuffer,"Seg(%li,%li),",
-                    PreO.GetValue(G.StartNode((*S)->e)),
-                    PreO.GetValue(G.EndNode((*S)->e)));
+                    (unsigned long)PreO.GetValue(G.StartNode((*S)->e)),
+                    (unsigned long)PreO.GetValue(G.EndNode((*S)->e)));
             G.LogAppend(LH, G.Context().logBuffer);
         }
         G.LogEnd(LH, "}");
@@ -390,168 +455,188 @@ void extractKuratowski(abstractMixedGraph& G, attribute<TNode>& PreO,
                        TSegPath* disturbingSeg_i);
 
 
-/* stronglyplanar returns a sorted list of all attachment points of
-   segment Seg in SegHeads */
-bool stronglyplanar(abstractMixedGraph& G, attribute<TNode>& PreO,
-                    attribute<int>& EdgeType, attribute<TNode>& Low1,
-                    attribute<TNode>& Low2, TSegPath* FatherSeg, TSegPath& Seg,
-                    bool extractMinor, list<TNode>& SegHeads)
+/* The path tree is traversed by an explicit stack of TStronglyPlanarFrame
+   objects. Every frame holds the local data of one segment: the segment
+   graph components SegGrCs of the emanating segments processed so far,
+   and the index i of the emanating segment which is processed next */
+struct TStronglyPlanarFrame {
+    TSegPath*           FatherSeg;
+    TSegPath*           Seg;
+    list<TNode>*        SegHeads;
+    list<TSegGrComp>    SegGrCs;    //indices sorted descendent
+    TIndex              i;
+    bool                childPending;
+};
+
+
+static void openStronglyPlanar(abstractMixedGraph& G, list<TStronglyPlanarFrame>& Frames,
+                    TSegPath* FatherSeg, TSegPath& Seg, list<TNode>& SegHeads)
 {
-    list<TSegGrComp> SegGrCs;       //indices sorted descendent
-    list<TSegGrComp>::iterator C, C1;
+    TStronglyPlanarFrame F;
+    F.FatherSeg = FatherSeg;
+    F.Seg = &Seg;
+    F.SegHeads = &SegHeads;
+    F.i = 0;
+    F.childPending = false;
+    Frames.push_back(F);
 
     sprintf(G.Context().logBuffer,"Seg(%li,%li)... ",
-            G.StartNode(Seg.e), G.EndNode(Seg.e));
+            (unsigned long)G.StartNode(Seg.e), (unsigned long)G.EndNode(Seg.e));
     G.LogEntry(LOG_METH, G.Context().logBuffer);
     G.OpenFold();
+}
 
-    for (TIndex i=0; i<Seg.Emanat.size(); i++)
-    {
-        sprintf(G.Context().logBuffer,"calculate SG_%li(Seg(%li,%li))",
-            i,G.StartNode(Seg.e), G.EndNode(Seg.e));
-        G.LogEntry(LOG_METH2, G.Context().logBuffer);
-
-        TSegPath* Seg_i = Seg.Emanat[i];
-
-        if (!stronglyplanar(G,PreO,EdgeType,Low1,Low2,&Seg,*Seg_i,
-                            extractMinor,Seg_i->Att))
-        {
-            for (C=SegGrCs.begin();C!=SegGrCs.end();C++) {
-                delete C->L;
-                delete C->R;
-            }
-
-            sprintf(G.Context().logBuffer,"... Seg(%li,%li) is not strongly planar",
-                G.StartNode(Seg.e), G.EndNode(Seg.e));
-            G.LogEntry(LOG_RES, G.Context().logBuffer);
-            G.CloseFold();
-
-            return false;
-        }
 
-        //test, if SG_i(e) (=SG_{i-1}(e)+Seg(e_i)) is bipartit
-        C = SegGrCs.begin();
-        while ( C != SegGrCs.end() && (
-            (!C->L->Att.empty() && C->L->Att.front()>Low1[Seg_i->e>>1]) ||
-            (!C->R->Att.empty() && C->R->Att.front()>Low1[Seg_i->e>>1]) ))
+/* Adds the strongly planar segment Seg.Emanat[i] to the segment graph */
+static bool addEmanatingSegment(abstractMixedGraph& G, attribute<TNode>& PreO,
+                    attribute<int>& EdgeType, attribute<TNode>& Low1,
+                    TStronglyPlanarFrame& F, bool extractMinor)
+{
+    TSegPath& Seg = *F.Seg;
+    TSegPath* FatherSeg = F.FatherSeg;
+    list<TNode>& SegHeads = *F.SegHeads;
+    list<TSegGrComp>& SegGrCs = F.SegGrCs;
+    list<TSegGrComp>::iterator C, C1;
+    TIndex i = F.i;
+    TSegPath* Seg_i = Seg.Emanat[i];
+
+    //test, if SG_i(e) (=SG_{i-1}(e)+Seg(e_i)) is bipartit
+    C = SegGrCs.begin();
+    while ( C != SegGrCs.end() && (
+        (!C->L->Att.empty() && C->L->Att.front()>Low1[Seg_i->e>>1]) ||
+        (!C->R->Att.empty() && C->R->Att.front()>Low1[Seg_i->e>>1]) ))
+    {
+        if (!C->L->Att.empty() && C->L->Att.front()>Low1[Seg_i->e>>1])
         {
+            TSegGrCompSide* HSide = C->L;
+            C->L = C->R;
+            C->R = HSide;
             if (!C->L->Att.empty() && C->L->Att.front()>Low1[Seg_i->e>>1])
             {
-                TSegGrCompSide* HSide = C->L;
-                C->L = C->R;
-                C->R = HSide;
-                if (!C->L->Att.empty() && C->L->Att.front()>Low1[Seg_i->e>>1])
-                {
-                    sprintf(G.Context().logBuffer,
-                        "... Seg(%li,%li) is not strongly planar, because adding of Seg(%li,%li)",
-                        G.StartNode(Seg.e), G.EndNode(Seg.e),
-                        G.StartNode(Seg_i->e), G.EndNode(Seg_i->e));
-                    G.LogEntry(LOG_RES, G.Context().logBuffer);
-                    sprintf(G.Context().logBuffer,
-                        "to SG_%li(Seg(%li,%li)) makes the segment graph non-bipartit",
-                        i, G.StartNode(Seg.e), G.EndNode(Seg.e));
-                    G.LogEntry(LOG_RES, G.Context().logBuffer);
-                    G.CloseFold();
-
-                    if (extractMinor) {
-                        Seg_i->Att.push_front(PreO[G.StartNode(Seg_i->e)]);
-                        Seg.Att = SegHeads;  // sind doch noch leer?!?
-                        extractKuratowski(G,PreO,EdgeType,Low1,*FatherSeg,
-                                          Seg,*C,Seg_i);
-                    }
+                sprintf(G.Context().logBuffer,
+                    "... Seg(%li,%li) is not strongly planar, because adding of Seg(%li,%li)",
+                    (unsigned long)G.StartNode(Seg.e), (unsigned long)G.EndNode(Seg.e),
+                    (unsigned long)G.StartNode(Seg_i->e), (unsigned long)G.EndNode(Seg_i->e));
+                G.LogEntry(LOG_RES, G.Context().logBuffer);
+                sprintf(G.Context().logBuffer,
+                    "to SG_%li(Seg(%li,%li)) makes the segment graph non-bipartit",
+                    i, (unsigned long)G.StartNode(Seg.e), (unsigned long)G.EndNode(Seg.e));
+                G.LogEntry(LOG_RES, G.Context().logBuffer);
+                G.CloseFold();
 
-                    for (C=SegGrCs.begin();C!=SegGrCs.end();C++) {
-                        delete C->L;
-                        delete C->R;
-                    }
+                if (extractMinor) {
+                    Seg_i->Att.push_front(PreO[G.StartNode(Seg_i->e)]);
+                    Seg.Att = SegHeads;  // sind doch noch leer?!?
+                    extractKuratowski(G,PreO,EdgeType,Low1,*FatherSeg,
+                                      Seg,*C,Seg_i);
+                }
 
-                    return false;
+                for (C=SegGrCs.begin();C!=SegGrCs.end();C++) {
+                    delete C->L;
+                    delete C->R;
                 }
+
+                return false;
             }
-            C++;
         }
-        C1 = C;
+        C++;
+    }
+    C1 = C;
 
-        // update SG_{i-1} to SG_i
-        C = SegGrCs.begin();
-        if (C != C1)
-        {  // Seg_i is directly linked to (at least) last component of SegGrCs
-            C++;
-            while (C != C1) {
-                sprintf(G.Context().logBuffer,
-                    "merge C_%u into C_%u and delete C_%u from SG_%li(Seg(%li,%li))",
-                    SegGrCs.size()-1,SegGrCs.size()-2,SegGrCs.size()-1,
-                    i,G.StartNode(Seg.e),G.EndNode(Seg.e));
-                G.LogEntry(LOG_METH2, G.Context().logBuffer);
+    // update SG_{i-1} to SG_i
+    C = SegGrCs.begin();
+    if (C != C1)
+    {  // Seg_i is directly linked to (at least) last component of SegGrCs
+        C++;
+        while (C != C1) {
+            sprintf(G.Context().logBuffer,
+                "merge C_%u into C_%u and delete C_%u from SG_%li(Seg(%li,%li))",
+                SegGrCs.size()-1,SegGrCs.size()-2,SegGrCs.size()-1,
+                i,(unsigned long)G.StartNode(Seg.e),(unsigned long)G.EndNode(Seg.e));
+            G.LogEntry(LOG_METH2, G.Context().logBuffer);
 
-                C->L->Att.splice(C->L->Att.begin(), SegGrCs.front().L->Att);
-                C->L->Segments.splice(C->L->Segments.begin(), SegGrCs.front().L->Segments);
+            C->L->Att.splice(C->L->Att.begin(), SegGrCs.front().L->Att);
+            C->L->Segments.splice(C->L->Segments.begin(), SegGrCs.front().L->Segments);
 
-                C->R->Att.splice(C->R->Att.begin(), SegGrCs.front().R->Att);
-                C->R->Segments.splice(C->R->Segments.begin(), SegGrCs.front().R->Segments);
+            C->R->Att.splice(C->R->Att.begin(), SegGrCs.front().R->Att);
+            C->R->Segments.splice(C->R->Segments.begin(), SegGrCs.front().R->Segments);
 
-                C++;
-                delete SegGrCs.front().L;
-                delete SegGrCs.front().R;
-                SegGrCs.pop_front();
-            }
-            C = SegGrCs.begin();
+            C++;
+            delete SegGrCs.front().L;
+            delete SegGrCs.front().R;
+            SegGrCs.pop_front();
         }
-        else {
-            sprintf(G.Context().logBuffer,
-                "create new component for Seg(%li,%li) in SG_%li(Seg(%li,%li))",
-                G.StartNode(Seg_i->e),G.EndNode(Seg_i->e),
-                i,G.StartNode(Seg.e),G.EndNode(Seg.e));
-            G.LogEntry(LOG_METH2, G.Context().logBuffer);
+        C = SegGrCs.begin();
+    }
+    else {
+        sprintf(G.Context().logBuffer,
+            "create new component for Seg(%li,%li) in SG_%li(Seg(%li,%li))",
+            (unsigned long)G.StartNode(Seg_i->e),(unsigned long)G.EndNode(Seg_i->e),
+            i,(unsigned long)G.StartNode(Seg.e),(unsigned long)G.EndNode(Seg.e));
+        G.LogEntry(LOG_METH2, G.Context().logBuffer);
 
-            TSegGrComp GC = {new TSegGrCompSide, new TSegGrCompSide};
-            SegGrCs.push_front(GC);
-            C = SegGrCs.begin();
-        }
+        TSegGrComp GC = {new TSegGrCompSide, new TSegGrCompSide};
+        SegGrCs.push_front(GC);
+        C = SegGrCs.begin();
+    }
 
-        // copy Seg_i.Att to front of C->L->Att
-        C->L->Att.insert(C->L->Att.begin(),Seg_i->Att.begin(),Seg_i->Att.end());
-        Seg_i->Att.push_front(PreO[G.StartNode(Seg_i->e)]);
-        C->L->Segments.push_front(Seg_i);
+    // copy Seg_i.Att to front of C->L->Att
+    C->L->Att.insert(C->L->Att.begin(),Seg_i->Att.begin(),Seg_i->Att.end());
+    Seg_i->Att.push_front(PreO[G.StartNode(Seg_i->e)]);
+    C->L->Segments.push_front(Seg_i);
 
-        printSegGrCs(G,PreO,SegGrCs);
+    printSegGrCs(G,PreO,SegGrCs);
 
 
-        sprintf(G.Context().logBuffer, "update Att_%li to Att_%li",i,i+1);
-        G.LogEntry(LOG_METH2, G.Context().logBuffer);
+    sprintf(G.Context().logBuffer, "update Att_%li to Att_%li",i,i+1);
+    G.LogEntry(LOG_METH2, G.Context().logBuffer);
 
-        TNode Tail_e_i1;
-        if (i+1 < Seg.Emanat.size())
-            Tail_e_i1 = PreO[G.StartNode(Seg.Emanat[i+1]->e)];
-        else
-            Tail_e_i1 = PreO[G.StartNode(Seg.e)];
+    TNode Tail_e_i1;
+    if (i+1 < Seg.Emanat.size())
+        Tail_e_i1 = PreO[G.StartNode(Seg.Emanat[i+1]->e)];
+    else
+        Tail_e_i1 = PreO[G.StartNode(Seg.e)];
 
-        C = SegGrCs.begin();
-        bool cont = true;
-        while (cont && (C != SegGrCs.end())) {
-            while (!C->L->Att.empty() && (C->L->Att.front() >= Tail_e_i1))
-                C->L->Att.pop_front();
+    C = SegGrCs.begin();
+    bool cont = true;
+    while (cont && (C != SegGrCs.end())) {
+        while (!C->L->Att.empty() && (C->L->Att.front() >= Tail_e_i1))
+            C->L->Att.pop_front();
 
-            while (!C->R->Att.empty() && (C->R->Att.front() >= Tail_e_i1))
-                C->R->Att.pop_front();
+        while (!C->R->Att.empty() && (C->R->Att.front() >= Tail_e_i1))
+            C->R->Att.pop_front();
 
-            if (C->L->Att.empty() && C->R->Att.empty()) {
-                // alphaL is set by bipartition
-                list<TSegPath*>::iterator S;
-                for(S=C->L->Segments.begin(); S!=C->L->Segments.end(); S++)
-                    (*S)->alphaL = true;
+        if (C->L->Att.empty() && C->R->Att.empty()) {
+            // alphaL is set by bipartition
+            list<TSegPath*>::iterator S;
+            for(S=C->L->Segments.begin(); S!=C->L->Segments.end(); S++)
+                (*S)->alphaL = true;
 
-                C = SegGrCs.begin();
-                delete C->L;
-                delete C->R;
-                SegGrCs.pop_front();
-                C = SegGrCs.begin();
-            }
-            else {
-                cont = false;
-            }
+            C = SegGrCs.begin();
+            delete C->L;
+            delete C->R;
+            SegGrCs.pop_front();
+            C = SegGrCs.begin();
+        }
+        else {
+            cont = false;
         }
-    } // end of for-loop
+    }
+
+    return true;
+}
+
+
+/* Decides if Seg is strongly planar after all emanating segments have been added */
+static bool closeStronglyPlanar(abstractMixedGraph& G, attribute<TNode>& PreO,
+                    attribute<int>& EdgeType, attribute<TNode>& Low1,
+                    TStronglyPlanarFrame& F, bool extractMinor)
+{
+    TSegPath& Seg = *F.Seg;
+    TSegPath* FatherSeg = F.FatherSeg;
+    list<TNode>& SegHeads = *F.SegHeads;
+    list<TSegGrComp>& SegGrCs = F.SegGrCs;
+    list<TSegGrComp>::iterator C;
 
     // Is Seg strongly planar?
     C = SegGrCs.end();
@@ -567,11 +652,11 @@ bool stronglyplanar(abstractMixedGraph& G, attribute<TNode>& PreO,
             {
                 sprintf(G.Context().logBuffer,
                     "... Seg(%li,%li) is planar, but not strongly planar, because ",
-                    G.StartNode(Seg.e), G.EndNode(Seg.e));
+                    (unsigned long)G.StartNode(Seg.e), (unsigned long)G.EndNode(Seg.e));
                 G.LogEntry(LOG_RES, G.Context().logBuffer);
                 sprintf(G.Context().logBuffer,
                     "Att(L(C[%i]))>Low1(e)  AND  Att(R(C[%i]))>Low1(e) with Low1(e)=%li",
-                    k, k, Low1.GetValue(Seg.e>>1));
+                    k, k, (unsigned long)Low1.GetValue(Seg.e>>1));
                 G.LogEntry(LOG_RES, G.Context().logBuffer);
                 G.CloseFold();
 
@@ -613,7 +698,7 @@ bool stronglyplanar(abstractMixedGraph& G, attribute<TNode>& PreO,
         Seg.Emanat[i]->Att.clear();
 
     sprintf(G.Context().logBuffer,"... Seg(%li,%li) is strongly planar",
-                G.StartNode(Seg.e), G.EndNode(Seg.e));
+                (unsigned long)G.StartNode(Seg.e), (unsigned long)G.EndNode(Seg.e));
     G.LogEntry(LOG_RES, G.Context().logBuffer);
     G.CloseFold();
 
@@ -621,6 +706,75 @@ bool stronglyplanar(abstractMixedGraph& G, attribute<TNode>& PreO,
 }
 
 
+/* stronglyplanar returns a sorted list of all attachment points of
+   segment Seg in SegHeads */
+bool stronglyplanar(abstractMixedGraph& G, attribute<TNode>& PreO,
+                    attribute<int>& EdgeType, attribute<TNode>& Low1,
+                    attribute<TNode>& Low2, TSegPath* FatherSeg, TSegPath& Seg,
+                    bool extractMinor, list<TNode>& SegHeads)
+{
+    list<TStronglyPlanarFrame> Frames;
+    openStronglyPlanar(G,Frames,FatherSeg,Seg,SegHeads);
+
+    // The result for the most recently finished segment
+    bool planar = true;
+
+    while (!Frames.empty())
+    {
+        TStronglyPlanarFrame& F = Frames.back();
+
+        if (F.childPending)
+        {
+            F.childPending = false;
+
+            if (!planar)
+            {
+                list<TSegGrComp>::iterator C;
+                for (C=F.SegGrCs.begin();C!=F.SegGrCs.end();C++) {
+                    delete C->L;
+                    delete C->R;
+                }
+
+                sprintf(G.Context().logBuffer,"... Seg(%li,%li) is not strongly planar",
+                    (unsigned long)G.StartNode(F.Seg->e), (unsigned long)G.EndNode(F.Seg->e));
+                G.LogEntry(LOG_RES, G.Context().logBuffer);
+                G.CloseFold();
+            }
+            else
+            {
+                planar = addEmanatingSegment(G,PreO,EdgeType,Low1,F,extractMinor);
+            }
+
+            if (!planar)
+            {
+                Frames.pop_back();
+                continue;
+            }
+
+            F.i++;
+        }
+
+        if (F.i < F.Seg->Emanat.size())
+        {
+            sprintf(G.Context().logBuffer,"calculate SG_%li(Seg(%li,%li))",
+                F.i,(unsigned long)G.StartNode(F.Seg->e), (unsigned long)G.EndNode(F.Seg->e));
+            G.LogEntry(LOG_METH2, G.Context().logBuffer);
+
+            TSegPath* Seg_i = F.Seg->Emanat[F.i];
+
+            F.childPending = true;
+            openStronglyPlanar(G,Frames,F.Seg,*Seg_i,Seg_i->Att);
+            continue;
+        }
+
+        planar = closeStronglyPlanar(G,PreO,EdgeType,Low1,F,extractMinor);
+        Frames.pop_back();
+    }
+
+    return planar;
+}
+
+
 /*
  Die Funktion IsDirectlyLinked prueft, ob zwei Segmente S1 und S2 direkt
  verbunden sind. Zur Repraesentation reichen deren Verbindungspunkte
@@ -775,7 +929,7 @@ void MinOddSGCycle(abstractMixedGraph& G, attribute<TNode>& PreO,
         SegX++;
 
     sprintf(G.Context().logBuffer,"SegX = Seg(%li,%li)",
-            G.StartNode((*SegX)->e), G.EndNode((*SegX)->e));
+            (unsigned long)G.StartNode((*SegX)->e), (unsigned long)G.EndNode((*SegX)->e));
     G.LogEntry(LOG_METH2, G.Context().logBuffer);
 
     list<TSegPath*>::iterator SegY = C.R->Segments.begin();
@@ -784,7 +938,7 @@ void MinOddSGCycle(abstractMixedGraph& G, attribute<TNode>& PreO,
         SegY++;
 
     sprintf(G.Context().logBuffer,"SegY = Seg(%li,%li)",
-            G.StartNode((*SegY)->e), G.EndNode((*SegY)->e));
+            (unsigned long)G.StartNode((*SegY)->e), (unsigned long)G.EndNode((*SegY)->e));
     G.LogEntry(LOG_METH2, G.Context().logBuffer);
 
     list<TSegPath*>::iterator A, B;
@@ -811,13 +965,13 @@ void MinOddSGCycle(abstractMixedGraph& G, attribute<TNode>& PreO,
     for (S=SideA->Segments.begin(); S!=SideA->Segments.end(); S++)
     {
         sprintf(G.Context().logBuffer,"Seg(%li,%li)",
-                G.StartNode((*S)->e), G.EndNode((*S)->e));
+                (unsigned long)G.StartNode((*S)->e), (unsigned long)G.EndNode((*S)->e));
         G.LogEntry(LOG_METH2, G.Context().logBuffer);
 
         list<TNode>::iterator v = (*S)->Att.begin();
         v++;
         for (; v!=(*S)->Att.end(); v++) {
-            sprintf(G.Context().logBuffer,"->%li",*v);
+            sprintf(G.Context().logBuffer,"->%li",(unsigned long)*v);
             G.LogAppend(LOG_METH2, G.Context().logBuffer);
             SideASegmentsOfAtt[*v].push_back(*S);
         }
@@ -829,13 +983,13 @@ void MinOddSGCycle(abstractMixedGraph& G, attribute<TNode>& PreO,
     for (S=SideB->Segments.begin(); S!=SideB->Segments.end(); S++)
     {
         sprintf(G.Context().logBuffer,"Seg(%li,%li)",
-                G.StartNode((*S)->e), G.EndNode((*S)->e));
+                (unsigned long)G.StartNode((*S)->e), (unsigned long)G.EndNode((*S)->e));
         G.LogEntry(LOG_METH2, G.Context().logBuffer);
 
         list<TNode>::iterator v = (*S)->Att.begin();
         v++;
         for (; v!=(*S)->Att.end(); v++) {
-            sprintf(G.Context().logBuffer,"->%li",*v);
+            sprintf(G.Context().logBuffer,"->%li",(unsigned long)*v);
             G.LogAppend(LOG_METH, G.Context().logBuffer);
             SideBSegmentsOfAtt[*v].push_back(*S);
         }
@@ -859,7 +1013,7 @@ void MinOddSGCycle(abstractMixedGraph& G, attribute<TNode>& PreO,
             for (S=SideASegmentsOfAtt[v].begin(); S!=SideASegmentsOfAtt[v].end(); S++)
             {
                 sprintf(G.Context().logBuffer,"ASeg(%li,%li)",
-                        G.StartNode((*S)->e), G.EndNode((*S)->e));
+                        (unsigned long)G.StartNode((*S)->e), (unsigned long)G.EndNode((*S)->e));
                 G.LogEntry(LOG_METH2, G.Context().logBuffer);
                 if (TailSmax <= PreO[G.StartNode((*S)->e)]) {
                     Smax = S;
@@ -878,7 +1032,7 @@ void MinOddSGCycle(abstractMixedGraph& G, attribute<TNode>& PreO,
             for (S=SideBSegmentsOfAtt[v].begin(); S!=SideBSegmentsOfAtt[v].end(); S++)
             {
                 sprintf(G.Context().logBuffer,"BSeg(%li,%li)",
-                        G.StartNode((*S)->e), G.EndNode((*S)->e));
+                        (unsigned long)G.StartNode((*S)->e), (unsigned long)G.EndNode((*S)->e));
                 G.LogEntry(LOG_METH2, G.Context().logBuffer);
                 if (TailSmax <= PreO[G.StartNode((*S)->e)]) {
                     Smax = S;
@@ -906,13 +1060,13 @@ void ColorPartOfCycle(abstractMixedGraph& G, TArc a, TNode t, TArc Colour,
 {
     if (log) {
         sprintf(G.Context().logBuffer,"cycle   from %li to %li (colour=%li): ",
-            G.EndNode(a),t,Colour);
+            (unsigned long)G.EndNode(a),(unsigned long)t,(unsigned long)Colour);
         G.LogEntry(LOG_METH2, G.Context().logBuffer);
     }
     attribute<TArc>* pred = G.Registers()->GetAttribute<TArc>(TokRegPredecessor);
 
     while (G.EndNode(a) != t) {
-        sprintf(G.Context().logBuffer," (%li,%li)",G.EndNode(a),G.StartNode(a));
+        sprintf(G.Context().logBuffer," (%li,%li)",(unsigned long)G.EndNode(a),(unsigned long)G.StartNode(a));
         G.LogAppend(LOG_METH2, G.Context().logBuffer);
 
         EdgeColour.SetValue(a>>1,Colour);
@@ -924,7 +1078,7 @@ void goThroughPath(abstractMixedGraph& G, attribute<TArc>& EdgeColour,
                    TSegPath& Seg, TArc Colour)
 {
     sprintf(G.Context().logBuffer,"path    from %li to %li (colour=%li): ",
-            G.EndNode(Seg.Low1Edge),G.StartNode(Seg.e),Colour);
+            (unsigned long)G.EndNode(Seg.Low1Edge),(unsigned long)G.StartNode(Seg.e),(unsigned long)Colour);
     G.LogEntry(LOG_METH2, G.Context().logBuffer);
 
     ColorPartOfCycle(G, Seg.Low1Edge, G.StartNode(Seg.e), Colour, EdgeColour, false);
@@ -950,7 +1104,7 @@ TNode goThroughSeg(abstractMixedGraph& G, attribute<TArc>& EdgeColour,
          attribute<TNode>& PreO, TSegPath& Seg, TNode a, TNode b, TArc Colour)
 {
     attribute<TArc>* pred = G.Registers()->GetAttribute<TArc>(TokRegPredecessor);
-    sprintf(G.Context().logBuffer,"segment from %li to %li (colour=%li): ",a,b,Colour);
+    sprintf(G.Context().logBuffer,"segment from %li to %li (colour=%li): ",(unsigned long)a,(unsigned long)b,(unsigned long)Colour);
     G.LogEntry(LOG_METH2, G.Context().logBuffer);
 
     TArc e_a = findAttEdge(G, Seg, a);
@@ -964,24 +1118,24 @@ TNode goThroughSeg(abstractMixedGraph& G, attribute<TArc>& EdgeColour,
         return b;
     }
     else {
-        sprintf(G.Context().logBuffer," (%li,%li)",G.StartNode(e_a),G.EndNode(e_a));
+        sprintf(G.Context().logBuffer," (%li,%li)",(unsigned long)G.StartNode(e_a),(unsigned long)G.EndNode(e_a));
         G.LogAppend(LOG_METH2, G.Context().logBuffer);
         EdgeColour.SetValue(e_a>>1, Colour);
 
-        sprintf(G.Context().logBuffer," (%li,%li)",G.StartNode(e_b),G.EndNode(e_b));
+        sprintf(G.Context().logBuffer," (%li,%li)",(unsigned long)G.StartNode(e_b),(unsigned long)G.EndNode(e_b));
         G.LogAppend(LOG_METH2, G.Context().logBuffer);
         EdgeColour.SetValue(e_b>>1, Colour);
 
         while (G.StartNode(e_a) != G.StartNode(e_b)) {
             if (PreO.GetValue(G.StartNode(e_a))<PreO.GetValue(G.StartNode(e_b))) {
                 e_b = pred->GetValue(G.StartNode(e_b));
-                sprintf(G.Context().logBuffer," (%li,%li)",G.StartNode(e_b), G.EndNode(e_b));
+                sprintf(G.Context().logBuffer," (%li,%li)",(unsigned long)G.StartNode(e_b), (unsigned long)G.EndNode(e_b));
                 G.LogAppend(LOG_METH2, G.Context().logBuffer);
                 EdgeColour.SetValue(e_b>>1, Colour);
             }
             else {
                 e_a = pred->GetValue(G.StartNode(e_a));
-                sprintf(G.Context().logBuffer," (%li,%li)",G.StartNode(e_a), G.EndNode(e_a));
+                sprintf(G.Context().logBuffer," (%li,%li)",(unsigned long)G.StartNode(e_a), (unsigned long)G.EndNode(e_a));
                 G.LogAppend(LOG_METH2, G.Context().logBuffer);
                 EdgeColour.SetValue(e_a>>1, Colour);
             }
@@ -1002,35 +1156,35 @@ TNode oneNode(abstractMixedGraph& G, attribute<TArc>& EdgeColour,
     TArc e_y3 = findAttEdge(G, Seg, y3);
 
     x3 = G.StartNode(e_x3);
-    sprintf(G.Context().logBuffer," ( %li,%li)",x3,G.EndNode(e_x3));
+    sprintf(G.Context().logBuffer," ( %li,%li)",(unsigned long)x3,(unsigned long)G.EndNode(e_x3));
     G.LogEntry(LOG_METH2, G.Context().logBuffer);
 
     x1 = G.StartNode(e_x1);
-    sprintf(G.Context().logBuffer," ( %li,%li)",x1,G.EndNode(e_x1));
+    sprintf(G.Context().logBuffer," ( %li,%li)",(unsigned long)x1,(unsigned long)G.EndNode(e_x1));
     G.LogEntry(LOG_METH2, G.Context().logBuffer);
 
     y3 = G.StartNode(e_y3);
-    sprintf(G.Context().logBuffer," ( %li,%li)",y3,G.EndNode(e_y3));
+    sprintf(G.Context().logBuffer," ( %li,%li)",(unsigned long)y3,(unsigned long)G.EndNode(e_y3));
     G.LogAppend(LOG_METH2, G.Context().logBuffer);
 
     while (x3 != x1) {
         if (PreO.GetValue(x3) < PreO.GetValue(x1)) {
             e_x1 = pred->GetValue(x1);
             x1 = G.StartNode(e_x1);
-            sprintf(G.Context().logBuffer," ( %li,%li)",x1,G.EndNode(e_x1));
+            sprintf(G.Context().logBuffer," ( %li,%li)",(unsigned long)x1,(unsigned long)G.EndNode(e_x1));
             G.LogAppend(LOG_METH2, G.Context().logBuffer);
         }
         else {
             e_x3 = pred->GetValue(x3);
             x3 = G.StartNode(e_x3);
-            sprintf(G.Context().logBuffer," ( %li,%li)",x3,G.EndNode(e_x3));
+            sprintf(G.Context().logBuffer," ( %li,%li)",(unsigned long)x3,(unsigned long)G.EndNode(e_x3));
             G.LogAppend(LOG_METH2, G.Context().logBuffer);
         }
     }
     while (PreO.GetValue(x3) < PreO.GetValue(y3)) {
         e_y3 = pred->GetValue(y3);
         y3 = G.StartNode(e_y3);
-        sprintf(G.Context().logBuffer," ( %li,%li)",x1,G.EndNode(e_y3));
+        sprintf(G.Context().logBuffer," ( %li,%li)",(unsigned long)x1,(unsigned long)G.EndNode(e_y3));
         G.LogAppend(LOG_METH2, G.Context().logBuffer);
     }
     if (x3 == y3)
@@ -1224,13 +1378,13 @@ void basicCase1(abstractMixedGraph& G, attribute<TNode>& PreO, TNode* OrigOrd,
     }
 
     sprintf(G.Context().logBuffer,"S1=(%li,%li); ",
-            G.StartNode(S1->Seg->e),G.EndNode(S1->Seg->e));
+            (unsigned long)G.StartNode(S1->Seg->e),(unsigned long)G.EndNode(S1->Seg->e));
     G.LogEntry(LOG_METH2, G.Context().logBuffer);
     sprintf(G.Context().logBuffer,"S2=(%li,%li); ",
-            G.StartNode(S2->Seg->e),G.EndNode(S2->Seg->e));
+            (unsigned long)G.StartNode(S2->Seg->e),(unsigned long)G.EndNode(S2->Seg->e));
     G.LogAppend(LOG_METH2, G.Context().logBuffer);
     sprintf(G.Context().logBuffer,"S3=(%li,%li);",
-            G.StartNode(S3->Seg->e),G.EndNode(S3->Seg->e));
+            (unsigned long)G.StartNode(S3->Seg->e),(unsigned long)G.EndNode(S3->Seg->e));
     G.LogAppend(LOG_METH2, G.Context().logBuffer);
 
     //Fallunterscheidung
@@ -1608,7 +1762,7 @@ void basicCase2(abstractMixedGraph& G, attribute<TNode>& PreO, TNode* OrigOrd,
             k = 3;
         else // a[2] != b[2]
             k = 4;
-        sprintf(G.Context().logBuffer,"(k = %li)", k);
+        sprintf(G.Context().logBuffer,"(k = %li)", (unsigned long)k);
         G.LogAppend(LOG_METH2,G.Context().logBuffer);
 
         /* Legende: Betrachtet man bei k=0 die Knoten a_j und b_j, j=0,1,...,4,
@@ -1725,7 +1879,7 @@ void extractKuratowski(abstractMixedGraph& G, attribute<TNode>& PreO,
 
         TArc g = FatherSeg.e;
         sprintf(G.Context().logBuffer," f=Seg(%li,%li) ",
-               G.StartNode(FatherSeg.e),G.EndNode(FatherSeg.e));
+               (unsigned long)G.StartNode(FatherSeg.e),(unsigned long)G.EndNode(FatherSeg.e));
         G.LogAppend(LOG_METH2, G.Context().logBuffer);
         while (G.StartNode(g) != G.StartNode(Seg.e)) {
             g = G.First(G.EndNode(g));
@@ -1733,7 +1887,7 @@ void extractKuratowski(abstractMixedGraph& G, attribute<TNode>& PreO,
         disturbingSeg_i = new TSegPath(g);
         disturbingSeg_i->e = g;//Kante, die in StartNode(e) weggeht
         sprintf(G.Context().logBuffer,"-> e=(%li,%li),",
-                G.StartNode(g),G.EndNode(g));
+                (unsigned long)G.StartNode(g),(unsigned long)G.EndNode(g));
         G.LogAppend(LOG_METH2, G.Context().logBuffer);
 
         //Laufe Stem(f) rueckwaerts beginned bei StartNode(e) bis Low1(e)
@@ -1745,7 +1899,7 @@ void extractKuratowski(abstractMixedGraph& G, attribute<TNode>& PreO,
         }
         disturbingSeg_i->Low1Edge = g;//Kante auf Cycle(f), die nach Low1(Seg->e) geht
         sprintf(G.Context().logBuffer,"-> Low1Edge=(%li,%li),",
-               G.StartNode(g),G.EndNode(g));
+               (unsigned long)G.StartNode(g),(unsigned long)G.EndNode(g));
         G.LogAppend(LOG_METH2, G.Context().logBuffer);
         EdgeType[FatherSeg.Low1Edge] = TreeEdge;
         EdgeType[g] = BackEdge;
@@ -1764,7 +1918,7 @@ void extractKuratowski(abstractMixedGraph& G, attribute<TNode>& PreO,
     for (vector<TSegPath*>::iterator S=MinCycle.begin(); S!=MinCycle.end(); S++)
     {
         sprintf(G.Context().logBuffer,"Seg(%li,%li),",
-                G.StartNode((*S)->e), G.EndNode((*S)->e));
+                (unsigned long)G.StartNode((*S)->e), (unsigned long)G.EndNode((*S)->e));
         G.LogAppend(LOG_METH2, G.Context().logBuffer);
     }
     G.LogEntry(LOG_METH2, "");
@@ -1792,95 +1946,154 @@ void extractKuratowski(abstractMixedGraph& G, attribute<TNode>& PreO,
 }
 
 
-void embedding(abstractMixedGraph& G, attribute<int>& EdgeType, TSegPath& Seg,
-               bool canonical, list<TArc>& U, list<TArc>& A, TArc* predArc)
-{
-    sparseRepresentation* GR = static_cast<sparseRepresentation*>(G.Representation());
+/* The path tree is traversed by an explicit stack of TEmbeddingFrame objects.
+   Every frame holds the local data of one tree segment: the current path arc g
+   with start node v, the next emanating segment Seg_i, and the arc lists
+   U, A which are filled for the father segment */
+struct TEmbeddingFrame {
+    TSegPath*                   Seg;
+    bool                        canonical;
+    list<TArc>*                 U;
+    list<TArc>*                 A;
+    TArc                        g;
+    TNode                       v;
+    vector<TSegPath*>::iterator Seg_i;
+    list<TArc>                  U2, A2, AL, AR;
+    bool                        childPending;
+};
+
 
+static void openEmbedding(abstractMixedGraph& G, list<TEmbeddingFrame>& Frames,
+               TSegPath& Seg, bool canonical, list<TArc>& U, list<TArc>& A)
+{
     G.OpenFold();
     if (canonical != Seg.alphaL)
         sprintf(G.Context().logBuffer,"Embed Seg(%li,%li) on right; ",
-            G.StartNode(Seg.e),G.EndNode(Seg.e));
+            (unsigned long)G.StartNode(Seg.e),(unsigned long)G.EndNode(Seg.e));
     else
         sprintf(G.Context().logBuffer,"Embed Seg(%li,%li) on left; ",
-            G.StartNode(Seg.e),G.EndNode(Seg.e));
+            (unsigned long)G.StartNode(Seg.e),(unsigned long)G.EndNode(Seg.e));
     G.LogEntry(LOG_METH2, G.Context().logBuffer);
 
+    Frames.push_back(TEmbeddingFrame());
+
+    TEmbeddingFrame& F = Frames.back();
+    F.Seg = &Seg;
+    F.canonical = canonical;
+    F.U = &U;
+    F.A = &A;
+    F.g = Seg.Low1Edge;
+    F.v = G.StartNode(F.g);
+    F.Seg_i = Seg.Emanat.begin();
+    F.childPending = false;
+
+    U.push_back(F.g);
+}
+
+
+void embedding(abstractMixedGraph& G, attribute<int>& EdgeType, TSegPath& RootSeg,
+               bool canonical, list<TArc>& RootU, list<TArc>& RootA, TArc* predArc)
+{
+    sparseRepresentation* GR = static_cast<sparseRepresentation*>(G.Representation());
     attribute<TArc>* pred = G.Registers()->GetAttribute<TArc>(TokRegPredecessor);
-    TArc g = Seg.Low1Edge;
-    TNode v = G.StartNode(g);
-    U.push_back(g);
-
-    vector<TSegPath*>::iterator Seg_i = Seg.Emanat.begin();
-    list<TArc> U2, A2, AL, AR;
-
-    while (g != Seg.e) {
-        while ((Seg_i != Seg.Emanat.end()) && (G.StartNode((*Seg_i)->e)==v)) {
-            if (EdgeType.GetValue((*Seg_i)->e) == TreeEdge) {
-                embedding(G, EdgeType, **Seg_i, (canonical!=(*Seg_i)->alphaL),
-                          U2, A2, predArc);
+
+    list<TEmbeddingFrame> Frames;
+    openEmbedding(G,Frames,RootSeg,canonical,RootU,RootA);
+
+    while (!Frames.empty())
+    {
+        TEmbeddingFrame& F = Frames.back();
+        TSegPath& Seg = *F.Seg;
+        list<TArc>& U = *F.U;
+        list<TArc>& A = *F.A;
+        vector<TSegPath*>::iterator& Seg_i = F.Seg_i;
+        list<TArc>& U2 = F.U2;
+        list<TArc>& A2 = F.A2;
+        list<TArc>& AL = F.AL;
+        list<TArc>& AR = F.AR;
+        bool descend = false;
+
+        while (F.g != Seg.e) {
+            while ((Seg_i != Seg.Emanat.end()) && (G.StartNode((*Seg_i)->e)==F.v)) {
+                if (F.childPending) {
+                    // The tree segment *Seg_i has been embedded
+                    F.childPending = false;
+                }
+                else if (EdgeType.GetValue((*Seg_i)->e) == TreeEdge) {
+                    F.childPending = true;
+                    openEmbedding(G,Frames,**Seg_i,(F.canonical!=(*Seg_i)->alphaL),
+                                  U2,A2);
+                    descend = true;
+                    break;
+                }
+                else {
+                    G.OpenFold();
+                    if (F.canonical != (*Seg_i)->alphaL)
+                        sprintf(G.Context().logBuffer,"Embed Seg(%li,%li) on right;",
+                            (unsigned long)G.StartNode((*Seg_i)->e),(unsigned long)G.EndNode((*Seg_i)->e));
+                    else
+                        sprintf(G.Context().logBuffer,"Embed Seg(%li,%li) on left;",
+                            (unsigned long)G.StartNode((*Seg_i)->e),(unsigned long)G.EndNode((*Seg_i)->e));
+                    G.LogEntry(LOG_METH2, G.Context().logBuffer);
+
+                    U2.push_back((*Seg_i)->e);
+                    A2.push_back((*Seg_i)->e ^ 1);
+                    G.CloseFold();
+                }
+
+                if (F.canonical != (*Seg_i)->alphaL) {
+                    U.splice(U.begin(), U2);
+                    AR.splice(AR.end(), A2);
+                }
+                else {
+                    U.splice(U.end(), U2);
+                    AL.splice(AL.begin(), A2);
+                }
+                Seg_i++;
             }
-            else {
-                G.OpenFold();
-                if (canonical != (*Seg_i)->alphaL)
-                    sprintf(G.Context().logBuffer,"Embed Seg(%li,%li) on right;",
-                        G.StartNode((*Seg_i)->e),G.EndNode((*Seg_i)->e));
-                else
-                    sprintf(G.Context().logBuffer,"Embed Seg(%li,%li) on left;",
-                        G.StartNode((*Seg_i)->e),G.EndNode((*Seg_i)->e));
-                G.LogEntry(LOG_METH2, G.Context().logBuffer);
 
-                U2.push_back((*Seg_i)->e);
-                A2.push_back((*Seg_i)->e ^ 1);
-                G.CloseFold();
+            if (descend) break;
+
+            F.g = pred->GetValue(F.v);
+            F.v = G.StartNode(F.g);
+            U.push_front(F.g^1);
+
+            //output
+            list<TArc>::iterator a = U.begin();
+            TArc b = *a;
+            GR->SetFirst(G.EndNode(F.g),*a);
+            a++;
+            while (a != U.end()) {
+                if (predArc)
+                    predArc[*a] = b^1;
+                GR->SetRight(b,*a);
+                b = *a;
+                a++;
             }
+            if (predArc)
+                predArc[U.front()] = U.back() ^ 1;
 
-            if (canonical != (*Seg_i)->alphaL) {
-                U.splice(U.begin(), U2);
-                AR.splice(AR.end(), A2);
+            //preparing for next loop
+            U.clear();
+            while (!AR.empty() && (G.StartNode(AR.back()) == F.v)) {
+                U.push_back(AR.back());
+                AR.pop_back();
             }
-            else {
-                U.splice(U.end(), U2);
-                AL.splice(AL.begin(), A2);
+            U.push_front(F.g);
+            while (!AL.empty() && (G.StartNode(AL.front()) == F.v)) {
+                U.splice(U.begin(), AL, AL.begin());
             }
-            Seg_i++;
         }
 
-        g = pred->GetValue(v);
-        v = G.StartNode(g);
-        U.push_front(g^1);
+        if (descend) continue;
 
-        //output
-        list<TArc>::iterator a = U.begin();
-        TArc b = *a;
-        GR->SetFirst(G.EndNode(g),*a);
-        a++;
-        while (a != U.end()) {
-            if (predArc)
-                predArc[*a] = b^1;
-            GR->SetRight(b,*a);
-            b = *a;
-            a++;
-        }
-        if (predArc)
-            predArc[U.front()] = U.back() ^ 1;
+        A.splice(A.end(), AL);
+        A.push_back(Seg.Low1Edge ^ 1);
+        A.splice(A.end(), AR);
 
-        //preparing for next loop
-        U.clear();
-        while (!AR.empty() && (G.StartNode(AR.back()) == v)) {
-            U.push_back(AR.back());
-            AR.pop_back();
-        }
-        U.push_front(g);
-        while (!AL.empty() && (G.StartNode(AL.front()) == v)) {
-            U.splice(U.begin(), AL, AL.begin());
-        }
+        G.CloseFold();
+        Frames.pop_back();
     }
-    A.splice(A.end(), AL);
-    A.push_back(Seg.Low1Edge ^ 1);
-    A.splice(A.end(), AR);
-
-    G.CloseFold();
 }
 
 
@@ -1911,8 +2124,8 @@ bool abstractMixedGraph::PlanarityHopcroftTarjan(TArc* predArc,
     PreO->SetValue(0,0);
 
     LogEntry(LOG_METH,"First DFS...");
-    preparingDFS(*this,0,*V_T,card_V_T,*EdgeType,*pred,*PreO,
-                 *PostO,POST, *Low1,*Low2);
+    preparingDFS(*this,*V_T,card_V_T,*EdgeType,*pred,*PreO,
+                 *PostO,POST,*Low1,*Low2).Search(0);
 
     LogEntry(LOG_METH,"Reordering arcs...");
     reorder(*this,*EdgeType,*PreO,*Low1,*Low2);
@@ -2030,7 +2243,7 @@ static void determineSegments(TSegData& SD, abstractSubgraph* oldSegment,
         abstractMixedGraph* G);
 static void determinePossibleRegions(TSegData&,TRegData&,abstractMixedGraph*,bool);
 
-static staticStack<TNode,TFloat>* Q;
+static __thread staticStack<TNode,TFloat>* Q;
 
 
 bool abstractMixedGraph::IsPlanar(TMethPlanarity method,TOptPlanarity options)
@@ -2164,7 +2377,7 @@ bool abstractMixedGraph::PlanarityMethod(
 
         if ((predArc && H.M()>1) || (H.M()>8 && H.N()>4 && H.M()>H.N()+2))
         {
-            sprintf(CT.logBuffer,"Embedding block %li...",c);
+            sprintf(CT.logBuffer,"Embedding block %li...",(unsigned long)c);
             LogEntry(LOG_METH,CT.logBuffer);
 
             if (method==PLANAR_DMP)
@@ -2290,7 +2503,7 @@ bool abstractMixedGraph::PlanarityMethod(
 
         if (mLoops>0 && CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"...%li loops embedded",mLoops);
+            sprintf(CT.logBuffer,"...%li loops embedded",(unsigned long)mLoops);
             LogEntry(LOG_METH2,CT.logBuffer);
         }
 
@@ -2342,7 +2555,7 @@ bool abstractMixedGraph::PlanarityMethod(
 
         if (mParallels>0 && CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"...%li parallel arcs embedded",mParallels);
+            sprintf(CT.logBuffer,"...%li parallel arcs embedded",(unsigned long)mParallels);
             LogEntry(LOG_METH2,CT.logBuffer);
         }
     }
@@ -2440,7 +2653,7 @@ bool abstractMixedGraph::PlanarityDMP64(TArc* predArc) throw (ERRejected)
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer, "%ld[%ld]",w,a^1);
+            sprintf(CT.logBuffer, "%ld[%ld]",(unsigned long)w,(unsigned long)(a^1));
             LogAppend(LH,CT.logBuffer);
         }
 
@@ -2470,7 +2683,7 @@ bool abstractMixedGraph::PlanarityDMP64(TArc* predArc) throw (ERRejected)
 
     if (CT.logMeth>1)
     {
-        sprintf(CT.logBuffer, "%ld[%ld]%ld)",w,a^1,v);
+        sprintf(CT.logBuffer, "%ld[%ld]%ld)",(unsigned long)w,(unsigned long)(a^1),(unsigned long)v);
         LogEnd(LH,CT.logBuffer);
     }
 
@@ -2533,7 +2746,7 @@ bool abstractMixedGraph::PlanarityDMP64(TArc* predArc) throw (ERRejected)
         {
             sprintf(CT.logBuffer,
                 "Segment %li has a minimum number of possible regions",
-                SegData.EmbSegNo);
+                (unsigned long)SegData.EmbSegNo);
             LogEntry(LOG_METH2,CT.logBuffer);
         }
 
@@ -2625,7 +2838,7 @@ bool abstractMixedGraph::PlanarityDMP64(TArc* predArc) throw (ERRejected)
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer, "%ld[%ld]",v1_succ,a^1);
+                sprintf(CT.logBuffer, "%ld[%ld]",(unsigned long)v1_succ,(unsigned long)(a^1));
                 LogAppend(LH,CT.logBuffer);
             }
 
@@ -2642,7 +2855,7 @@ bool abstractMixedGraph::PlanarityDMP64(TArc* predArc) throw (ERRejected)
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer, "%ld)",v1_succ);
+            sprintf(CT.logBuffer, "%ld)",(unsigned long)v1_succ);
             LogEnd(LH,CT.logBuffer);
         }
         CloseFold();
@@ -2666,7 +2879,7 @@ bool abstractMixedGraph::PlanarityDMP64(TArc* predArc) throw (ERRejected)
             // This implicitly deletes ToEmbed;
             delete Embedded;
 
-            sprintf(CT.logBuffer,"Segment %li cannot be embedded!",SegData.EmbSegNo);
+            sprintf(CT.logBuffer,"Segment %li cannot be embedded!",(unsigned long)SegData.EmbSegNo);
             LogEntry(LOG_METH2,CT.logBuffer);
             CloseFold();
             CloseFold(ModPlanarityDMP);
@@ -2719,7 +2932,7 @@ void determineSegments(TSegData& SD, abstractSubgraph* oldSegment,
         for (TNode c=SD.EmbSegNo; c<SD.Count; c++)
             SD.Segments[c] = SD.Segments[c+1];
 
-        sprintf(CT.logBuffer,"Former segment has %li arcs", m);
+        sprintf(CT.logBuffer,"Former segment has %li arcs", (unsigned long)m);
         G->LogEntry(LOG_METH2,CT.logBuffer);
 
         if (m == 1)
@@ -2757,7 +2970,7 @@ void determineSegments(TSegData& SD, abstractSubgraph* oldSegment,
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"Component %ld:",CompCount);
+            sprintf(CT.logBuffer,"Component %ld:",(unsigned long)CompCount);
             LH = G->LogStart(LOG_METH2,CT.logBuffer);
         }
 
@@ -2771,7 +2984,7 @@ void determineSegments(TSegData& SD, abstractSubgraph* oldSegment,
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer," %ld",u);
+                sprintf(CT.logBuffer," %ld",(unsigned long)u);
                 G -> LogAppend(LH,CT.logBuffer);
             }
 
@@ -2997,7 +3210,7 @@ void determinePossibleRegions(TSegData &SegData,TRegData &RegData,abstractMixedG
     {
         Segment = SegData.Segments[s];
 
-        sprintf(CT.logBuffer,"Segment %ld fits into regions",s);
+        sprintf(CT.logBuffer,"Segment %ld fits into regions",(unsigned long)s);
         LH = G->LogStart(LOG_METH2,CT.logBuffer);
 
         for (int r=0; r<RegData.Count; r++)
@@ -3014,7 +3227,7 @@ void determinePossibleRegions(TSegData &SegData,TRegData &RegData,abstractMixedG
 
         for (TNode CN = 0; CN<Segment->GetContactNodeCount(); CN++)
         {
-            sprintf(CT.logBuffer," %ld",Segment->GetContactNode(CN));
+            sprintf(CT.logBuffer," %ld",(unsigned long)Segment->GetContactNode(CN));
             G -> LogAppend(LH,CT.logBuffer);
         }
 
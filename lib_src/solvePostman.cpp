@@ -143,7 +143,7 @@ void abstractDiGraph::ChinesePostman(bool adjustUCap) throw(ERRejected)
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"Divergence(%ld) = %g",v,Divergence(v));
+                sprintf(CT.logBuffer,"Divergence(%ld) = %g",(unsigned long)v,Divergence(v));
                 LogEntry(LOG_METH2,CT.logBuffer);
             }
 
@@ -162,7 +162,7 @@ void abstractDiGraph::ChinesePostman(bool adjustUCap) throw(ERRejected)
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"Divergence(%ld) = %g",v,Divergence(v));
+                sprintf(CT.logBuffer,"Divergence(%ld) = %g",(unsigned long)v,Divergence(v));
                 LogEntry(LOG_METH2,CT.logBuffer);
             }
 
@@ -177,7 +177,7 @@ void abstractDiGraph::ChinesePostman(bool adjustUCap) throw(ERRejected)
 
     if (CT.logRes)
     {
-        sprintf(CT.logBuffer,"...Problem has %ld unbalanced nodes",n0);
+        sprintf(CT.logBuffer,"...Problem has %ld unbalanced nodes",(unsigned long)n0);
         LogEntry(LOG_RES,CT.logBuffer);
     }
 
@@ -321,7 +321,7 @@ void abstractDiGraph::ChinesePostman(bool adjustUCap) throw(ERRejected)
             if (CT.logMeth>1)
             {
                 LogEntry(LOG_METH2,"Adding the path (in reverse order):");
-                sprintf(CT.logBuffer,"(%ld",v);
+                sprintf(CT.logBuffer,"(%ld",(unsigned long)v);
                 LH = LogStart(LOG_METH2,CT.logBuffer);
             }
 
@@ -341,7 +341,7 @@ void abstractDiGraph::ChinesePostman(bool adjustUCap) throw(ERRejected)
 
                 if (CT.logMeth>1)
                 {
-                    sprintf(CT.logBuffer,",%ld",v);
+                    sprintf(CT.logBuffer,",%ld",(unsigned long)v);
                     LogAppend(LH,CT.logBuffer);
                 }
 
@@ -409,7 +409,7 @@ bool abstractMixedGraph::EulerCycle(TArc* pred) throw(ERRejected)
 
     if (CT.logMeth>1)
     {
-        sprintf(CT.logBuffer,"Initial cycle: (%ld[%ld]",StartNode(a),a);
+        sprintf(CT.logBuffer,"Initial cycle: (%ld[%ld]",(unsigned long)StartNode(a),(unsigned long)a);
         LH = LogStart(LOG_METH2,CT.logBuffer);
     }
 
@@ -434,7 +434,7 @@ bool abstractMixedGraph::EulerCycle(TArc* pred) throw(ERRejected)
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"%ld[%ld]",u,a);
+                sprintf(CT.logBuffer,"%ld[%ld]",(unsigned long)u,(unsigned long)a);
                 LogAppend(LH,CT.logBuffer);
             }
 
@@ -447,7 +447,7 @@ bool abstractMixedGraph::EulerCycle(TArc* pred) throw(ERRejected)
 
     if (CT.logMeth>1)
     {
-        sprintf(CT.logBuffer,"%ld)",EndNode(a));
+        sprintf(CT.logBuffer,"%ld)",(unsigned long)EndNode(a));
         LogEnd(LH,CT.logBuffer);
     }
 
@@ -478,7 +478,7 @@ bool abstractMixedGraph::EulerCycle(TArc* pred) throw(ERRejected)
             if (CT.logMeth>1)
             {
                 sprintf(CT.logBuffer,"Inserting before %ld: (%ld[%ld]",
-                    a,StartNode(a2),a2);
+                    (unsigned long)a,(unsigned long)StartNode(a2),(unsigned long)a2);
                 LH = LogStart(LOG_METH2,CT.logBuffer);
             }
 
@@ -505,7 +505,7 @@ bool abstractMixedGraph::EulerCycle(TArc* pred) throw(ERRejected)
 
                     if (CT.logMeth>1)
                     {
-                        sprintf(CT.logBuffer,"%ld[%ld]",u,a2);
+                        sprintf(CT.logBuffer,"%ld[%ld]",(unsigned long)u,(unsigned long)a2);
                         LogAppend(LH,CT.logBuffer);
                     }
 
@@ -518,7 +518,7 @@ bool abstractMixedGraph::EulerCycle(TArc* pred) throw(ERRejected)
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"%ld)",EndNode(a2));
+                sprintf(CT.logBuffer,"%ld)",(unsigned long)EndNode(a2));
                 LogEnd(LH,CT.logBuffer);
             }
 
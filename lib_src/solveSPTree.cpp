@@ -13,6 +13,7 @@
 #include "abstractGraph.h"
 #include "abstractDigraph.h"
 #include "staticQueue.h"
+#include "incidenceScanner.h"
 
 
 bool abstractMixedGraph::ShortestPath(TMethSPX method,TOptSPX characteristic,
@@ -80,6 +81,27 @@ bool abstractMixedGraph::ShortestPath(TMethSPX method,TOptSPX characteristic,
             ret = SPX_BellmanFord(characteristic,s,t);
             break;
         }
+        case SPX_BIDIRECTIONAL:
+        case SPX_ASTAR:
+        {
+            if (t==NoNode)
+            {
+                // Point-to-point methods, compute a full tree instead
+                ret =  (SPX_Dijkstra(characteristic,
+                                    singletonIndex<TNode>(s,n,CT),
+                                    voidIndex<TNode>(n,CT)) != NoNode);
+            }
+            else if (method==SPX_BIDIRECTIONAL)
+            {
+                ret = SPX_Bidirectional(characteristic,s,t);
+            }
+            else
+            {
+                ret = SPX_AStar(characteristic,s,t);
+            }
+
+            break;
+        }
         case SPX_BFS:
         {
             #if defined(_FAILSAVE_)
@@ -194,6 +216,27 @@ bool abstractMixedGraph::BFS(TOptSPX characteristic,TNode s,TNode t) throw(ERRan
 
     #endif
 
+    if (frozen)
+    {
+        frozenScanner I(*frozen);
+        return BFS(I,characteristic,s,t);
+    }
+
+    if (Representation() && IsSparse())
+    {
+        sparseScanner I(*this);
+        return BFS(I,characteristic,s,t);
+    }
+
+    genericScanner I(*this);
+    return BFS(I,characteristic,s,t);
+}
+
+
+template <class TScanner>
+bool abstractMixedGraph::BFS(const TScanner& I,TOptSPX characteristic,TNode s,TNode t)
+    throw(ERRange)
+{
     OpenFold(ModSPTree,NO_INDENT);
 
     #if defined(_PROGRESS_)
@@ -222,6 +265,9 @@ bool abstractMixedGraph::BFS(TOptSPX characteristic,TNode s,TNode t) throw(ERRan
         LogEntry(LOG_METH,"Graph is searched...");
     }
 
+    bool reverse = (characteristic & SPX_REVERSE);
+    characteristic = TOptSPX(characteristic & ~SPX_REVERSE);
+
     OpenFold();
 
     #if defined(_LOGGING_)
@@ -230,9 +276,6 @@ bool abstractMixedGraph::BFS(TOptSPX characteristic,TNode s,TNode t) throw(ERRan
 
     #endif
 
-    THandle H = Investigate();
-    investigator &I = Investigator(H);
-
     bool searching = true;
     while (!(Q.Empty()) && searching)
     {
@@ -243,26 +286,38 @@ bool abstractMixedGraph::BFS(TOptSPX characteristic,TNode s,TNode t) throw(ERRan
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"%ld ",u);
+            sprintf(CT.logBuffer,"%ld ",(unsigned long)u);
             LogAppend(LH,CT.logBuffer);
         }
 
         #endif
 
-        while (I.Active(u))
+        for (TArc k=I.First(u);k!=NoArc;k=I.Next(u,k))
         {
-            TArc a = I.Read(u);
-            TNode v = EndNode(a);
+            TNode v = I.EndNode(k);
 
-            if (dist[v]==InfFloat && Eligible(characteristic,a))
+            if (dist[v]!=InfFloat) continue;
+
+            TArc a = I.Arc(k);
+
+            if (reverse)
             {
-                dist[v] = dist[u]+1;
-                Trace(Q); 
-                Q.Insert(v);
-                pred[v] = a;
+                a = a^1;
 
-                if (v==t) searching = false;
+                if (!Eligible(characteristic,a)) continue;
+            }
+            else if (characteristic==SPX_PLAIN)
+            {
+                if (!I.PlainEligible(k)) continue;
             }
+            else if (!Eligible(characteristic,a)) continue;
+
+            dist[v] = dist[u]+1;
+            Trace(Q); 
+            Q.Insert(v);
+            pred[v] = a;
+
+            if (v==t) searching = false;
         }
 
         Trace(1);
@@ -274,8 +329,6 @@ bool abstractMixedGraph::BFS(TOptSPX characteristic,TNode s,TNode t) throw(ERRan
 
     #endif
 
-    Close(H);
-
     CloseFold();
 
 //    if (t!=NoNode) SetBounds(TimerSPTree,dist[t],dist[t]);
@@ -289,6 +342,27 @@ bool abstractMixedGraph::BFS(TOptSPX characteristic,TNode s,TNode t) throw(ERRan
 
 TNode abstractMixedGraph::SPX_Dijkstra(TOptSPX characteristic,
     const indexSet<TNode>& S,const indexSet<TNode>& T) throw(ERRange,ERRejected)
+{
+    if (frozen)
+    {
+        frozenScanner I(*frozen);
+        return SPX_Dijkstra(I,characteristic,S,T);
+    }
+
+    if (Representation() && IsSparse())
+    {
+        sparseScanner I(*this);
+        return SPX_Dijkstra(I,characteristic,S,T);
+    }
+
+    genericScanner I(*this);
+    return SPX_Dijkstra(I,characteristic,S,T);
+}
+
+
+template <class TScanner>
+TNode abstractMixedGraph::SPX_Dijkstra(const TScanner& I,TOptSPX characteristic,
+    const indexSet<TNode>& S,const indexSet<TNode>& T) throw(ERRange,ERRejected)
 {
     OpenFold(ModDikjstra,SHOW_TITLE);
 
@@ -309,6 +383,12 @@ TNode abstractMixedGraph::SPX_Dijkstra(TOptSPX characteristic,
         Q = nHeap;
         Q -> Init();
     }
+    else if (characteristic==SPX_PLAIN && IntegralLengths())
+    {
+        // The distance labels are deleted from the queue in increasing
+        // order. With integral length labels, a radix heap applies
+        Q = NewMonotoneNodeHeap();
+    }
     else Q = NewNodeHeap();
 
     for (TNode s=S.First();s<n;s=S.Successor(s))
@@ -325,8 +405,6 @@ TNode abstractMixedGraph::SPX_Dijkstra(TOptSPX characteristic,
 
     #endif
 
-    THandle H = Investigate();
-    investigator &I = Investigator(H);
     while (!(Q->Empty()))
     {
         TNode u = Q->Delete();
@@ -339,25 +417,24 @@ TNode abstractMixedGraph::SPX_Dijkstra(TOptSPX characteristic,
 
         #if defined(_LOGGING_)
 
-        if (CT.logMeth>1 && I.Active(u))
+        if (CT.logMeth>1 && I.First(u)!=NoArc)
         {
-            sprintf(CT.logBuffer," %ld[%g]",u,dist[u]);
+            sprintf(CT.logBuffer," %ld[%g]",(unsigned long)u,dist[u]);
             LogAppend(LH,CT.logBuffer);
         }
 
         #endif
 
-        while (I.Active(u))
+        for (TArc k=I.First(u);k!=NoArc;k=I.Next(u,k))
         {
-            TArc a = I.Read(u);
-            TFloat l = Length(a);
-
-            if (characteristic!=SPX_PLAIN) l = RedLength(potential,a);
-
-            TNode v = EndNode(a);
+            TArc a = I.Arc(k);
+            TFloat l = (characteristic==SPX_PLAIN) ? I.Length(k) : RedLength(potential,a);
+            TNode v = I.EndNode(k);
             TFloat dd = dist[u]+l;
 
-            if (dist[v]>dd && Eligible(characteristic,a))
+            if (   dist[v]>dd
+                && ((characteristic==SPX_PLAIN) ? I.PlainEligible(k) : Eligible(characteristic,a))
+               )
             {
                 #if defined(_FAILSAVE_)
 
@@ -386,8 +463,6 @@ TNode abstractMixedGraph::SPX_Dijkstra(TOptSPX characteristic,
 
     #endif
 
-    Close(H);
-
     if (!nHeap) delete Q;
 
 //    if (t!=NoNode) SetBounds(TimerSPTree,dist[t],dist[t]);
@@ -398,6 +473,379 @@ TNode abstractMixedGraph::SPX_Dijkstra(TOptSPX characteristic,
 }
 
 
+bool abstractMixedGraph::SPX_Bidirectional(TOptSPX characteristic,TNode s,TNode t)
+    throw(ERRange,ERRejected)
+{
+    #if defined(_FAILSAVE_)
+
+    if (s>=n) NoSuchNode("SPX_Bidirectional",s);
+
+    if (t>=n) NoSuchNode("SPX_Bidirectional",t);
+
+    #endif
+
+    if (frozen)
+    {
+        frozenScanner I(*frozen);
+        return SPX_Bidirectional(I,characteristic,s,t);
+    }
+
+    if (Representation() && IsSparse())
+    {
+        sparseScanner I(*this);
+        return SPX_Bidirectional(I,characteristic,s,t);
+    }
+
+    genericScanner I(*this);
+    return SPX_Bidirectional(I,characteristic,s,t);
+}
+
+
+template <class TScanner>
+bool abstractMixedGraph::SPX_Bidirectional(const TScanner& I,TOptSPX characteristic,
+    TNode s,TNode t) throw(ERRange,ERRejected)
+{
+    OpenFold(ModBidirectional,SHOW_TITLE);
+
+    #if defined(_PROGRESS_)
+
+    InitProgressCounter(n);
+
+    #endif
+
+    TFloat* dist = InitDistanceLabels();
+    TFloat* potential = GetPotentials();
+    TArc* pred = InitPredecessors();
+
+    // Labels of the backward search: distBack[v] is the length of the
+    // shortest vt-path found so far, and succ[v] is the first arc on it
+    TFloat* distBack = new TFloat[n];
+    TArc* succ = new TArc[n];
+
+    for (TNode v=0;v<n;v++)
+    {
+        distBack[v] = InfFloat;
+        succ[v] = NoArc;
+    }
+
+    goblinQueue<TNode,TFloat>* Q = NULL;
+    goblinQueue<TNode,TFloat>* QBack = NULL;
+
+    if (characteristic==SPX_PLAIN && IntegralLengths())
+    {
+        Q = NewMonotoneNodeHeap();
+        QBack = NewMonotoneNodeHeap();
+    }
+    else
+    {
+        Q = NewNodeHeap();
+        QBack = NewNodeHeap();
+    }
+
+    dist[s] = 0;
+    distBack[t] = 0;
+    Q -> Insert(s,0);
+    QBack -> Insert(t,0);
+
+    // The shortest st-path found so far runs through the node meet
+    TFloat mu = InfFloat;
+    TNode meet = NoNode;
+
+    if (s==t)
+    {
+        mu = 0;
+        meet = s;
+    }
+
+    while (!(Q->Empty()) && !(QBack->Empty()))
+    {
+        TFloat minForward = dist[Q->Peek()];
+        TFloat minBackward = distBack[QBack->Peek()];
+
+        if (minForward+minBackward>=mu) break;
+
+        if (minForward<=minBackward)
+        {
+            TNode u = Q->Delete();
+
+            for (TArc k=I.First(u);k!=NoArc;k=I.Next(u,k))
+            {
+                TArc a = I.Arc(k);
+                TFloat l = (characteristic==SPX_PLAIN) ? I.Length(k) : RedLength(potential,a);
+                TNode v = I.EndNode(k);
+                TFloat dd = dist[u]+l;
+
+                if (   dist[v]<=dd
+                    || !((characteristic==SPX_PLAIN) ? I.PlainEligible(k) : Eligible(characteristic,a))
+                   )
+                {
+                    continue;
+                }
+
+                #if defined(_FAILSAVE_)
+
+                if (l<-CT.epsilon)
+                {
+                    CloseFold(ModBidirectional);
+                    Error(ERR_REJECTED,"SPX_Bidirectional","Negative arc length");
+                }
+
+                #endif
+
+                if (dist[v]==InfFloat) Q->Insert(v,dd);
+                else Q->ChangeKey(v,dd);
+
+                dist[v] = dd;
+                pred[v] = a;
+
+                if (distBack[v]!=InfFloat && dd+distBack[v]<mu)
+                {
+                    mu = dd+distBack[v];
+                    meet = v;
+                }
+            }
+        }
+        else
+        {
+            TNode u = QBack->Delete();
+
+            // Arcs are traversed in backward direction, that is,
+            // the arcs Arc(k)^1 are traversed from EndNode(k) to u
+            for (TArc k=I.First(u);k!=NoArc;k=I.Next(u,k))
+            {
+                TArc a = I.Arc(k)^1;
+                TFloat l = (characteristic==SPX_PLAIN) ? I.Length(k) : RedLength(potential,a);
+                TNode v = I.EndNode(k);
+                TFloat dd = distBack[u]+l;
+
+                if (   distBack[v]<=dd
+                    || !((characteristic==SPX_PLAIN) ? I.ReversePlainEligible(k) : Eligible(characteristic,a))
+                   )
+                {
+                    continue;
+                }
+
+                #if defined(_FAILSAVE_)
+
+                if (l<-CT.epsilon)
+                {
+                    CloseFold(ModBidirectional);
+                    Error(ERR_REJECTED,"SPX_Bidirectional","Negative arc length");
+                }
+
+                #endif
+
+                if (distBack[v]==InfFloat) QBack->Insert(v,dd);
+                else QBack->ChangeKey(v,dd);
+
+                distBack[v] = dd;
+                succ[v] = a;
+
+                if (dist[v]!=InfFloat && dd+dist[v]<mu)
+                {
+                    mu = dd+dist[v];
+                    meet = v;
+                }
+            }
+        }
+
+        Trace(1);
+    }
+
+    delete Q;
+    delete QBack;
+
+    if (meet!=NoNode)
+    {
+        // Splice the backward path into the predecessor labels. With zero
+        // length arcs, the backward path might run into the forward path
+        // again. Then splice at the last common node
+
+        char* onPath = new char[n];
+
+        for (TNode v=0;v<n;v++) onPath[v] = 0;
+
+        for (TNode v=meet;v!=s;v=StartNode(pred[v])) onPath[v] = 1;
+
+        onPath[s] = 1;
+
+        TNode x = meet;
+
+        for (TNode v=meet;v!=t;)
+        {
+            v = EndNode(succ[v]);
+
+            if (onPath[v]) x = v;
+        }
+
+        delete[] onPath;
+
+        for (TNode v=x;v!=t;)
+        {
+            TArc a = succ[v];
+            TNode w = EndNode(a);
+
+            dist[w] = dist[v]+(distBack[v]-distBack[w]);
+            pred[w] = a;
+            v = w;
+        }
+    }
+
+    delete[] distBack;
+    delete[] succ;
+
+    CloseFold(ModBidirectional);
+
+    return (meet!=NoNode);
+}
+
+
+bool abstractMixedGraph::SPX_AStar(TOptSPX characteristic,TNode s,TNode t)
+    throw(ERRange,ERRejected)
+{
+    #if defined(_FAILSAVE_)
+
+    if (s>=n) NoSuchNode("SPX_AStar",s);
+
+    if (t>=n) NoSuchNode("SPX_AStar",t);
+
+    #endif
+
+    if (frozen)
+    {
+        frozenScanner I(*frozen);
+        return SPX_AStar(I,characteristic,s,t);
+    }
+
+    if (Representation() && IsSparse())
+    {
+        sparseScanner I(*this);
+        return SPX_AStar(I,characteristic,s,t);
+    }
+
+    genericScanner I(*this);
+    return SPX_AStar(I,characteristic,s,t);
+}
+
+
+template <class TScanner>
+bool abstractMixedGraph::SPX_AStar(const TScanner& I,TOptSPX characteristic,
+    TNode s,TNode t) throw(ERRange,ERRejected)
+{
+    OpenFold(ModAStar,SHOW_TITLE);
+
+    #if defined(_PROGRESS_)
+
+    InitProgressCounter(n);
+
+    #endif
+
+    TFloat* dist = InitDistanceLabels();
+    TFloat* potential = GetPotentials();
+    TArc* pred = InitPredecessors();
+
+    // The geometric distances to t, scaled by ratio, are consistent estimates
+    // for the plain length labels. They are computed when a node is reached
+    TMetricType metricType = MetricType();
+    TFloat ratio = 0;
+
+    if (characteristic==SPX_PLAIN || (characteristic==SPX_SUBGRAPH && !potential))
+    {
+        ratio = MetricLengthRatio();
+    }
+
+    if (ratio<=0)
+    {
+        LogEntry(LOG_METH2,"...No distance estimates available");
+        ratio = 0;
+    }
+
+    TFloat* estimate = new TFloat[n];
+    char* expanded = new char[n];
+
+    for (TNode v=0;v<n;v++)
+    {
+        estimate[v] = -1;
+        expanded[v] = 0;
+    }
+
+    goblinQueue<TNode,TFloat> *Q = NULL;
+
+    if (ratio==0 && characteristic==SPX_PLAIN && IntegralLengths())
+    {
+        Q = NewMonotoneNodeHeap();
+    }
+    else Q = NewNodeHeap();
+
+    estimate[s] = (ratio>0) ? ratio*MetricDistance(metricType,s,t) : 0;
+    dist[s] = 0;
+    Q -> Insert(s,estimate[s]);
+
+    bool found = false;
+
+    while (!(Q->Empty()))
+    {
+        TNode u = Q->Delete();
+        expanded[u] = 1;
+
+        if (u==t)
+        {
+            found = true;
+            break;
+        }
+
+        for (TArc k=I.First(u);k!=NoArc;k=I.Next(u,k))
+        {
+            TNode v = I.EndNode(k);
+
+            // Since the estimates are consistent, expanded nodes are final
+            if (expanded[v]) continue;
+
+            TArc a = I.Arc(k);
+            TFloat l = (characteristic==SPX_PLAIN) ? I.Length(k) : RedLength(potential,a);
+            TFloat dd = dist[u]+l;
+
+            if (   dist[v]<=dd
+                || !((characteristic==SPX_PLAIN) ? I.PlainEligible(k) : Eligible(characteristic,a))
+               )
+            {
+                continue;
+            }
+
+            #if defined(_FAILSAVE_)
+
+            if (l<-CT.epsilon)
+            {
+                CloseFold(ModAStar);
+                Error(ERR_REJECTED,"SPX_AStar","Negative arc length");
+            }
+
+            #endif
+
+            if (dist[v]==InfFloat)
+            {
+                estimate[v] = (ratio>0) ? ratio*MetricDistance(metricType,v,t) : 0;
+                Q->Insert(v,dd+estimate[v]);
+            }
+            else Q->ChangeKey(v,dd+estimate[v]);
+
+            dist[v] = dd;
+            pred[v] = a;
+        }
+
+        Trace(1);
+    }
+
+    delete Q;
+    delete[] estimate;
+    delete[] expanded;
+
+    CloseFold(ModAStar);
+
+    return found;
+}
+
+
 TNode abstractMixedGraph::VoronoiRegions(const indexSet<TNode>& Terminals)
     throw(ERRejected)
 {
@@ -469,7 +917,7 @@ bool abstractMixedGraph::SPX_BellmanFord(TOptSPX characteristic,TNode s,TNode t)
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"Iteration %ld:",i);
+            sprintf(CT.logBuffer,"Iteration %ld:",(unsigned long)i);
             LogEntry(LOG_METH2,CT.logBuffer);
         }
 
@@ -495,7 +943,7 @@ bool abstractMixedGraph::SPX_BellmanFord(TOptSPX characteristic,TNode s,TNode t)
                 if (CT.logMeth>1)
                 {
                     sprintf(CT.logBuffer,"Label d[%ld] updated to %g",
-                        v,thisLabel);
+                        (unsigned long)v,thisLabel);
                     LogEntry(LOG_METH2,CT.logBuffer);
                 }
 
@@ -625,7 +1073,7 @@ TNode abstractMixedGraph::NegativeCycle(TOptSPX characteristic,TNode source,TFlo
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"Iteration %ld:",itCount);
+            sprintf(CT.logBuffer,"Iteration %ld:",(unsigned long)itCount);
             LogEntry(LOG_METH2,CT.logBuffer);
         }
 
@@ -660,7 +1108,7 @@ TNode abstractMixedGraph::NegativeCycle(TOptSPX characteristic,TNode source,TFlo
                         if (CT.logMeth>1)
                         {
                             sprintf(CT.logBuffer,"Label d[%ld] updated to %g",
-                                w,thisLabel);
+                                (unsigned long)w,thisLabel);
                             LogEntry(LOG_METH2,CT.logBuffer);
                         }
 
@@ -697,7 +1145,7 @@ TNode abstractMixedGraph::NegativeCycle(TOptSPX characteristic,TNode source,TFlo
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"...Node on a negative cycle: %ld",root);
+            sprintf(CT.logBuffer,"...Node on a negative cycle: %ld",(unsigned long)root);
             LogEntry(LOG_RES,CT.logBuffer);
         }
 
@@ -927,7 +1375,7 @@ TNode abstractDiGraph::DAGSearch(TOptDAGSearch opt,TNode s,TNode t)
 
         if (opt!=DAG_TOPSORT && CT.logMeth>1 && dist[v]<InfFloat)
         {
-            sprintf(CT.logBuffer," %ld[%g]",v,dist[v]);
+            sprintf(CT.logBuffer," %ld[%g]",(unsigned long)v,dist[v]);
             LogAppend(LH,CT.logBuffer);
         }
 
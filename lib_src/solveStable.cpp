@@ -180,7 +180,7 @@ void branchStable::Raise(TNode i) throw(ERRange)
 
         if (chi[w]==2)
         {
-            sprintf(CT.logBuffer,"Conflicting nodes: %ld, %ld",i,w);
+            sprintf(CT.logBuffer,"Conflicting nodes: %ld, %ld",(unsigned long)i,(unsigned long)w);
             InternalError1("Raise");
         }
 
@@ -289,7 +289,7 @@ TNode abstractMixedGraph::StableSet() throw()
 
     if (CT.logMeth && !isCover)
     {
-        sprintf(CT.logBuffer,"...Starting with stable set of size %ld",cardInitial);
+        sprintf(CT.logBuffer,"...Starting with stable set of size %ld",(unsigned long)cardInitial);
         LogEntry(LOG_METH,CT.logBuffer);
     }
 
@@ -352,7 +352,7 @@ TNode abstractMixedGraph::StableSet() throw()
     if (cardinality>cardInitial)
     {
         sprintf(CT.logBuffer,
-            "...Stable set has cardinality %ld",cardinality);
+            "...Stable set has cardinality %ld",(unsigned long)cardinality);
         LogEntry(LOG_RES,CT.logBuffer);
     }
 
@@ -424,7 +424,7 @@ TNode abstractMixedGraph::Clique() throw()
 
     if (CT.logMeth && !isColoured)
     {
-        sprintf(CT.logBuffer,"...Starting with %ld-clique",cardInitial);
+        sprintf(CT.logBuffer,"...Starting with %ld-clique",(unsigned long)cardInitial);
         LogEntry(LOG_METH,CT.logBuffer);
     }
 
@@ -503,7 +503,7 @@ TNode abstractMixedGraph::Clique() throw()
     if (cardinality>cardInitial)
     {
         sprintf(CT.logBuffer,
-            "...Improved clique has cardinality %ld",cardinality);
+            "...Improved clique has cardinality %ld",(unsigned long)cardinality);
         LogEntry(LOG_RES,CT.logBuffer);
     }
 
@@ -26,7 +26,7 @@ TFloat abstractMixedGraph::SteinerTree(const indexSet<TNode>& Terminals,TNode ro
 
     if (root!=NoNode)
     {
-        sprintf(CT.logBuffer,"Computing minimum %ld-Steiner tree...",root);
+        sprintf(CT.logBuffer,"Computing minimum %ld-Steiner tree...",(unsigned long)root);
         LogEntry(LOG_METH,CT.logBuffer);
     }
     else
@@ -110,7 +110,7 @@ TFloat abstractMixedGraph::STT_Heuristic(const indexSet<TNode>& Terminals,TNode
 
     if (root!=NoNode && (root>=n || !Terminals.IsMember(root)))
     {
-        sprintf(CT.logBuffer,"Inappropriate root node: %ld",root);
+        sprintf(CT.logBuffer,"Inappropriate root node: %ld",(unsigned long)root);
         Error(ERR_RANGE,"STT_Heuristic",CT.logBuffer);
     }
 
@@ -173,7 +173,7 @@ TFloat abstractMixedGraph::STT_TrimLeaves(const indexSet<TNode>& Terminals,TArc*
             odg[x]--;
             pred[w] = NoArc;
 
-            sprintf(CT.logBuffer,"Node %ld deleted",w);
+            sprintf(CT.logBuffer,"Node %ld deleted",(unsigned long)w);
             LogEntry(LOG_METH,CT.logBuffer);
 
             w = x;
@@ -202,7 +202,7 @@ TFloat abstractMixedGraph::STT_Enumerate(const indexSet<TNode>& Terminals,TNode
 
     if (root!=NoNode && (root>=n || !Terminals.IsMember(root)))
     {
-        sprintf(CT.logBuffer,"Inappropriate root node: %ld",root);
+        sprintf(CT.logBuffer,"Inappropriate root node: %ld",(unsigned long)root);
         Error(ERR_RANGE,"STT_Enumerate",CT.logBuffer);
     }
 
@@ -212,14 +212,14 @@ TFloat abstractMixedGraph::STT_Enumerate(const indexSet<TNode>& Terminals,TNode
 
     LogEntry(LOG_METH,"(Steiner node enumeration)");
 
-    sprintf(CT.logBuffer,"Root node is %ld",root);
+    sprintf(CT.logBuffer,"Root node is %ld",(unsigned long)root);
     LogEntry(LOG_METH,CT.logBuffer);
 
     TNode k = 0;
     for (TNode v=0;v<n;v++)
         if (!Terminals.IsMember(v)) k++;
 
-    sprintf(CT.logBuffer,"%ld Steiner nodes detected",k);
+    sprintf(CT.logBuffer,"%ld Steiner nodes detected",(unsigned long)k);
     LogEntry(LOG_METH,CT.logBuffer);
     CT.SuppressLogging();
 
@@ -326,7 +326,7 @@ TFloat abstractGraph::STT_Heuristic(const indexSet<TNode>& Terminals,TNode root)
 
     if (root!=NoNode && (root>=n || !Terminals.IsMember(root)))
     {
-        sprintf(CT.logBuffer,"Inappropriate root node: %ld",root);
+        sprintf(CT.logBuffer,"Inappropriate root node: %ld",(unsigned long)root);
         Error(ERR_RANGE,"STT_Heuristic",CT.logBuffer);
     }
 
@@ -422,7 +422,7 @@ TFloat abstractGraph::STT_Enumerate(const indexSet<TNode>& Terminals,TNode root)
 
     if (root!=NoNode && (root>=n || !Terminals.IsMember(root)))
     {
-        sprintf(CT.logBuffer,"Inappropriate root node: %ld",root);
+        sprintf(CT.logBuffer,"Inappropriate root node: %ld",(unsigned long)root);
         Error(ERR_RANGE,"STT_Enumerate",CT.logBuffer);
     }
 
@@ -438,14 +438,14 @@ TFloat abstractGraph::STT_Enumerate(const indexSet<TNode>& Terminals,TNode root)
 
     LogEntry(LOG_METH,"(Steiner node enumeration)");
 
-    sprintf(CT.logBuffer,"Root node is %ld",root);
+    sprintf(CT.logBuffer,"Root node is %ld",(unsigned long)root);
     LogEntry(LOG_METH,CT.logBuffer);
 
     TNode k = 0;
     for (TNode v=0;v<n;v++)
         if (!Terminals.IsMember(v)) k++;
 
-    sprintf(CT.logBuffer,"%ld Steiner nodes detected",k);
+    sprintf(CT.logBuffer,"%ld Steiner nodes detected",(unsigned long)k);
     LogEntry(LOG_METH,CT.logBuffer);
     CT.SuppressLogging();
 
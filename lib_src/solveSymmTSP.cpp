@@ -15,6 +15,8 @@
 #include "denseGraph.h"
 #include "binaryHeap.h"
 #include "dynamicQueue.h"
+#include "staticQueue.h"
+#include "twoLevelTour.h"
 
 
 branchSymmTSP::branchSymmTSP(abstractGraph& _G,TNode _root,
@@ -179,7 +181,7 @@ void branchSymmTSP::SetCandidateGraph(int nCandidates) throw()
 
     if (CT.logRes)
     {
-        sprintf(CT.logBuffer,"...Candidate subgraph has %ld arcs",X->M());
+        sprintf(CT.logBuffer,"...Candidate subgraph has %ld arcs",(unsigned long)X->M());
         LogEntry(LOG_RES,CT.logBuffer);
     }
 }
@@ -455,6 +457,15 @@ TFloat branchSymmTSP::SolveRelaxation() throw()
         return InfFloat;
     }
 
+    // Read the scheme state once and consistently. The scheme may be
+    // updated by other threads during parallel node evaluation
+    TArc thisIterations = 0;
+    branchScheme<TArc,TFloat>::TSearchState thisState =
+        branchScheme<TArc,TFloat>::INITIAL_DFS;
+    TFloat savedObjective = InfFloat;
+
+    if (scheme!=NULL) scheme -> Snapshot(thisIterations,thisState,savedObjective);
+
     TFloat objective = InfFloat;
     try
     {
@@ -462,17 +473,17 @@ TFloat branchSymmTSP::SolveRelaxation() throw()
 
         if (    scheme != NULL
              && relaxationMethod >= X->TSP_RELAX_FAST
-             && scheme->nIterations > 1
+             && thisIterations > 1
              && unfixed > 0
-             && scheme->SearchState() != scheme->INITIAL_DFS
-             && objective < scheme->savedObjective-1+CT.epsilon
+             && thisState != scheme->INITIAL_DFS
+             && objective < savedObjective-1+CT.epsilon
            )
         {
             // Apply subgradient optimization for most effective pruning
 
             X -> InitSubgraph();
             X -> ReleasePredecessors();
-            TFloat upperBound = scheme->savedObjective;
+            TFloat upperBound = savedObjective;
             objective = X->TSP_SubOpt1Tree(relaxationMethod,root,upperBound,true);
             X -> MinTree(X->MST_DEFAULT,X->MST_ONE_CYCLE_REDUCED,root);
         }
@@ -664,7 +675,7 @@ TFloat abstractGraph::TSP_SubOpt1Tree(TRelaxTSP method,TNode root,TFloat& bestUp
     TNode bestDev = n;
     unsigned int step = 0;
 
-    sprintf(CT.logBuffer,"Computing minimum %ld-tree...",root);
+    sprintf(CT.logBuffer,"Computing minimum %ld-tree...",(unsigned long)root);
     LogEntry(LOG_METH,CT.logBuffer);
     CT.SuppressLogging();
     TFloat thisBound = MinTree(MST_DEFAULT,MST_ONE_CYCLE_REDUCED,root);
@@ -733,7 +744,7 @@ TFloat abstractGraph::TSP_SubOpt1Tree(TRelaxTSP method,TNode root,TFloat& bestUp
 
         if (step>1)
         {
-            sprintf(CT.logBuffer,"Computing minimum %ld-tree...",root);
+            sprintf(CT.logBuffer,"Computing minimum %ld-tree...",(unsigned long)root);
             LogEntry(LOG_METH,CT.logBuffer);
             CT.SuppressLogging();
             thisBound = MinTree(MST_DEFAULT,MST_ONE_CYCLE_REDUCED,root);
@@ -788,7 +799,7 @@ TFloat abstractGraph::TSP_SubOpt1Tree(TRelaxTSP method,TNode root,TFloat& bestUp
 
         if (CT.logMeth>=2)
         {
-            sprintf(CT.logBuffer,"Nodes with incorrect degrees: %ld",dev);
+            sprintf(CT.logBuffer,"Nodes with incorrect degrees: %ld",(unsigned long)dev);
             LogEntry(LOG_METH2,CT.logBuffer);
         }
 
@@ -1154,7 +1165,7 @@ TFloat abstractGraph::TSP_HeuristicChristofides(TNode r) throw(ERRange)
 
     if (CT.logRes)
     {
-        sprintf(CT.logBuffer,"Spanning tree has %ld odd vertices",no);
+        sprintf(CT.logBuffer,"Spanning tree has %ld odd vertices",(unsigned long)no);
         LogEntry(LOG_RES,CT.logBuffer);
     }
 
@@ -1238,7 +1249,7 @@ TFloat abstractGraph::TSP_HeuristicChristofides(TNode r) throw(ERRange)
                 if (CT.logMeth>1)
                 {
                     sprintf(CT.logBuffer,
-                        "Adding arc %ld with end node %ld",a,u);
+                        "Adding arc %ld with end node %ld",(unsigned long)a,(unsigned long)u);
                     LogEntry(LOG_METH2,CT.logBuffer);
                 }
 
@@ -1265,7 +1276,7 @@ TFloat abstractGraph::TSP_HeuristicChristofides(TNode r) throw(ERRange)
                     if (CT.logMeth>1)
                     {
                         sprintf(CT.logBuffer,
-                            "Adding arc %ld with end node %ld",a,v);
+                            "Adding arc %ld with end node %ld",(unsigned long)a,(unsigned long)v);
                         LogEntry(LOG_METH2,CT.logBuffer);
                     }
 
@@ -1287,7 +1298,7 @@ TFloat abstractGraph::TSP_HeuristicChristofides(TNode r) throw(ERRange)
                     if (CT.logMeth>1)
                     {
                         sprintf(CT.logBuffer,
-                            "Shifting arc %ld with end node %ld",a,u);
+                            "Shifting arc %ld with end node %ld",(unsigned long)a,(unsigned long)u);
                         LogEntry(LOG_METH2,CT.logBuffer);
                     }
 
@@ -1344,7 +1355,7 @@ TFloat abstractGraph::TSP_HeuristicChristofides(TNode r) throw(ERRange)
     delete[] map;
     delete[] revmap;
 
-    if (CT.methLocal==LOCAL_OPTIMIZE) sum = TSP_LocalSearch(pred);
+    if (CT.methLocal>=LOCAL_OPTIMIZE) sum = TSP_LocalSearch(pred);
 
     CloseFold(ModChristofides);
 
@@ -1394,7 +1405,7 @@ bool abstractGraph::TSP_2Exchange(TArc* pred,TFloat limit) throw(ERRejected)
                     LogEntry(LOG_METH2,CT.logBuffer);
                     sprintf(CT.logBuffer,
                         "New tour: ... %ld %ld ... %ld %ld ...",
-                        u1,u2,v1,v2);
+                        (unsigned long)u1,(unsigned long)u2,(unsigned long)v1,(unsigned long)v2);
                     LogEntry(LOG_METH2,CT.logBuffer);
                 }
 
@@ -1437,3 +1448,627 @@ bool abstractGraph::TSP_2Exchange(TArc* pred,TFloat limit) throw(ERRejected)
 
     return false;
 }
+
+
+// Maximum number of path reversals in a single Lin-Kernighan move
+static const int LK_MAX_DEPTH = 50;
+
+// Maximum length of the paths shifted by Or-opt moves
+static const int OR_MAX_LENGTH = 3;
+
+
+/// \brief  Working data of the Lin-Kernighan / Or-opt tour improvement
+///
+/// The tour is kept in a two-level list. Every node has a list of candidate
+/// neighbours, sorted by increasing length of the connecting edges. Nodes are
+/// examined in the order of a queue. A node is removed from the queue when no
+/// improving move starts at it ("don't look bit"), and is inserted again when
+/// an incident tour edge changes.
+
+class linKernighanSearch
+{
+private:
+
+    abstractGraph&  G;
+    TNode           n;
+    TNode           width;      // Length of the candidate lists
+    TNode*          cand;       // Candidate neighbours, NoNode padded
+    TFloat*         candDist;   // Lengths of the candidate edges
+    TFloat          epsilon;
+    bool            dir;        // Scan the tour backwards
+
+    twoLevelTour    T;
+    staticQueue<TNode,TFloat> Q;
+
+    TNode           addedU[LK_MAX_DEPTH];
+    TNode           addedV[LK_MAX_DEPTH];
+    TNode           flipA[LK_MAX_DEPTH];
+    TNode           flipB[LK_MAX_DEPTH];
+    TNode           touched[3*LK_MAX_DEPTH];
+
+public:
+
+    unsigned long   nMoves;
+
+    linKernighanSearch(abstractGraph& _G,const TNode* order,int nCandidates) throw();
+    ~linKernighanSearch() throw();
+
+    void    Optimize() throw();
+    TNode   Next(TNode v) const throw() {return T.Next(v);};
+
+private:
+
+    TFloat  Dist(TNode u,TNode v) const throw();
+    TNode   Succ(TNode v) const throw() {return (dir) ? T.Prev(v) : T.Next(v);};
+    TNode   Pred(TNode v) const throw() {return (dir) ? T.Next(v) : T.Prev(v);};
+    void    Flip(TNode a,TNode b) throw();
+    void    Activate(TNode v) throw();
+    void    InsertCandidate(TNode v,TNode w,TFloat l,TNode limit) throw();
+    void    NearestByIncidences(TNode nCandidates) throw();
+    void    NearestByGrid(TNode nCandidates) throw();
+    bool    WasAdded(TNode u,TNode v,int nAdded) const throw();
+    bool    LinKernighanMove(TNode t1) throw();
+    bool    OrOptMove(TNode t1) throw();
+
+};
+
+
+linKernighanSearch::linKernighanSearch(abstractGraph& _G,const TNode* order,
+    int nCandidates) throw() :
+    G(_G), n(_G.N()), T(_G.N(),_G.Context()), Q(_G.N(),_G.Context())
+{
+    if (nCandidates<1) nCandidates = 5;
+
+    // Tour neighbours are always added to the candidate lists
+    width = TNode(nCandidates)+2;
+    cand = new TNode[n*width];
+    candDist = new TFloat[n*width];
+    epsilon = G.Context().epsilon;
+    dir = false;
+    nMoves = 0;
+
+    for (TNode i=0;i<n*width;i++) cand[i] = NoNode;
+
+    abstractMixedGraph::TMetricType metricType = G.MetricType();
+
+    if (   G.IsDense()
+        && (   metricType==abstractMixedGraph::METRIC_MANHATTAN
+            || metricType==abstractMixedGraph::METRIC_EUCLIDIAN
+            || metricType==abstractMixedGraph::METRIC_MAXIMUM
+           )
+       )
+    {
+        NearestByGrid(TNode(nCandidates));
+    }
+    else NearestByIncidences(TNode(nCandidates));
+
+    for (TNode i=0;i<n;i++)
+    {
+        TNode u = order[i];
+        TNode v = order[(i+1)%n];
+
+        TFloat l = Dist(u,v);
+        InsertCandidate(u,v,l,width);
+        InsertCandidate(v,u,l,width);
+    }
+
+    T.Init(order);
+
+    for (TNode i=0;i<n;i++) Q.Insert(order[i]);
+}
+
+
+linKernighanSearch::~linKernighanSearch() throw()
+{
+    delete[] cand;
+    delete[] candDist;
+}
+
+
+TFloat linKernighanSearch::Dist(TNode u,TNode v) const throw()
+{
+    TArc a = G.Adjacency(u,v);
+
+    return (a==NoArc) ? InfFloat : G.Length(a);
+}
+
+
+void linKernighanSearch::InsertCandidate(TNode v,TNode w,TFloat l,TNode limit)
+    throw()
+{
+    // Keep the first limit entries of the list of v sorted by length
+    TNode* list = cand+v*width;
+    TFloat* dist = candDist+v*width;
+    TNode i = 0;
+
+    while (i<width && list[i]!=NoNode)
+    {
+        if (list[i]==w)
+        {
+            if (dist[i]<=l) return;
+
+            // Parallel edge: Remove the longer entry
+            while (i+1<width && list[i+1]!=NoNode)
+            {
+                list[i] = list[i+1];
+                dist[i] = dist[i+1];
+                i++;
+            }
+
+            list[i] = NoNode;
+            break;
+        }
+
+        i++;
+    }
+
+    if (i>=limit)
+    {
+        if (dist[limit-1]<=l) return;
+
+        i = limit-1;
+    }
+
+    while (i>0 && dist[i-1]>l)
+    {
+        list[i] = list[i-1];
+        dist[i] = dist[i-1];
+        i--;
+    }
+
+    list[i] = w;
+    dist[i] = l;
+}
+
+
+void linKernighanSearch::NearestByIncidences(TNode nCandidates) throw()
+{
+    THandle H = G.Investigate();
+
+    for (TNode v=0;v<n;v++)
+    {
+        while (G.Active(H,v))
+        {
+            TArc a = G.Read(H,v);
+            TNode w = G.EndNode(a);
+
+            if (w!=v) InsertCandidate(v,w,G.Length(a),nCandidates);
+        }
+    }
+
+    G.Close(H);
+}
+
+
+void linKernighanSearch::NearestByGrid(TNode nCandidates) throw()
+{
+    // Complete geometric graph: Bucket the nodes into a square grid and, for
+    // every node, search the grid cells in rings of increasing distance. The
+    // search stops when the remaining cells cannot contain nearer nodes
+
+    TNode nGrid = TNode(sqrt(n/2.0));
+    if (nGrid<1) nGrid = 1;
+
+    TFloat minX = InfFloat;
+    TFloat maxX = -InfFloat;
+    TFloat minY = InfFloat;
+    TFloat maxY = -InfFloat;
+    TNode* cell = new TNode[n];
+
+    for (TNode v=0;v<n;v++)
+    {
+        TFloat cx = G.C(v,0);
+        TFloat cy = G.C(v,1);
+
+        if (cx<minX) minX = cx;
+        if (cx>maxX) maxX = cx;
+        if (cy<minY) minY = cy;
+        if (cy>maxY) maxY = cy;
+    }
+
+    TFloat cellWidth = (maxX-minX)/nGrid;
+    TFloat cellHeight = (maxY-minY)/nGrid;
+
+    if (cellWidth<=0) cellWidth = 1;
+    if (cellHeight<=0) cellHeight = 1;
+
+    TNode* cellFirst = new TNode[nGrid*nGrid+1];
+    TNode* cellNodes = new TNode[n];
+
+    for (TNode i=0;i<=nGrid*nGrid;i++) cellFirst[i] = 0;
+
+    for (TNode v=0;v<n;v++)
+    {
+        TNode i = TNode((G.C(v,0)-minX)/cellWidth);
+        TNode j = TNode((G.C(v,1)-minY)/cellHeight);
+
+        if (i>=nGrid) i = nGrid-1;
+        if (j>=nGrid) j = nGrid-1;
+
+        cell[v] = i*nGrid+j;
+        cellFirst[cell[v]+1]++;
+    }
+
+    for (TNode i=0;i<nGrid*nGrid;i++) cellFirst[i+1] += cellFirst[i];
+
+    for (TNode v=0;v<n;v++) cellNodes[cellFirst[cell[v]]++] = v;
+
+    for (TNode i=nGrid*nGrid;i>0;i--) cellFirst[i] = cellFirst[i-1];
+
+    cellFirst[0] = 0;
+
+    // Edge lengths are rounded, hence the lower bound is reduced by one
+    TFloat ringWidth = (cellWidth<cellHeight) ? cellWidth : cellHeight;
+    TNode maxFound = (nCandidates<n-1) ? nCandidates : n-1;
+
+    for (TNode v=0;v<n;v++)
+    {
+        long ci = cell[v]/nGrid;
+        long cj = cell[v]%nGrid;
+        TNode found = 0;
+
+        for (long r=0;r<=long(nGrid);r++)
+        {
+            for (long i=ci-r;i<=ci+r;i++)
+            {
+                if (i<0 || i>=long(nGrid)) continue;
+
+                for (long j=cj-r;j<=cj+r;j++)
+                {
+                    if (j<0 || j>=long(nGrid)) continue;
+
+                    if (i!=ci-r && i!=ci+r && j!=cj-r && j!=cj+r) continue;
+
+                    TNode c = TNode(i*nGrid+j);
+
+                    for (TNode k=cellFirst[c];k<cellFirst[c+1];k++)
+                    {
+                        TNode w = cellNodes[k];
+
+                        if (w==v) continue;
+
+                        InsertCandidate(v,w,Dist(v,w),nCandidates);
+                        found++;
+                    }
+                }
+            }
+
+            if (   found>=maxFound
+                && (   maxFound<nCandidates
+                    || candDist[v*width+nCandidates-1]<=r*ringWidth-1
+                   )
+               )
+            {
+                break;
+            }
+        }
+    }
+
+    delete[] cell;
+    delete[] cellFirst;
+    delete[] cellNodes;
+}
+
+
+void linKernighanSearch::Flip(TNode a,TNode b) throw()
+{
+    if (dir)
+    {
+        T.Reverse(b,a);
+    }
+    else T.Reverse(a,b);
+}
+
+
+void linKernighanSearch::Activate(TNode v) throw()
+{
+    if (!Q.IsMember(v)) Q.Insert(v);
+}
+
+
+bool linKernighanSearch::WasAdded(TNode u,TNode v,int nAdded) const throw()
+{
+    for (int i=0;i<nAdded;i++)
+    {
+        if (   (addedU[i]==u && addedV[i]==v)
+            || (addedU[i]==v && addedV[i]==u)
+           )
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+bool linKernighanSearch::LinKernighanMove(TNode t1) throw()
+{
+    // Every step replaces the edges t1t2 and t4t3 by t2t3 and t1t4 by
+    // reversing the path from t2 to t4. The edge t1t4 is removed again
+    // in the next step, so that the sequence of reversals forms a single
+    // Lin-Kernighan move. All steps but the first one are greedy
+
+    TNode t2 = Succ(t1);
+    TFloat d12 = Dist(t1,t2);
+    TNode* list = cand+t2*width;
+
+    for (TNode i=0;i<width && list[i]!=NoNode;i++)
+    {
+        TNode t3 = list[i];
+        TFloat gOpen = d12-candDist[t2*width+i];
+
+        if (gOpen<=epsilon) break;
+
+        if (t3==t1 || t3==Succ(t2)) continue;
+
+        TNode t2c = t2;
+        TNode t4 = Pred(t3);
+        TFloat bestGain = 0;
+        int bestDepth = 0;
+        int depth = 0;
+
+        while (true)
+        {
+            gOpen += Dist(t4,t3);
+            Flip(t2c,t4);
+
+            addedU[depth] = t2c;
+            addedV[depth] = t3;
+            flipA[depth] = t4;
+            flipB[depth] = t2c;
+            touched[3*depth] = t2c;
+            touched[3*depth+1] = t3;
+            touched[3*depth+2] = t4;
+            depth++;
+
+            TFloat closedGain = gOpen-Dist(t4,t1);
+
+            if (closedGain>bestGain+epsilon)
+            {
+                bestGain = closedGain;
+                bestDepth = depth;
+            }
+
+            if (depth>=LK_MAX_DEPTH) break;
+
+            // Now t4 is the successor of t1
+            t2c = t4;
+            TNode* list2 = cand+t2c*width;
+            TNode t3Next = NoNode;
+            TNode t4Next = NoNode;
+            TFloat bestTrial = -InfFloat;
+
+            for (TNode j=0;j<width && list2[j]!=NoNode;j++)
+            {
+                TNode x = list2[j];
+                TFloat d2x = candDist[t2c*width+j];
+                TFloat g = gOpen-d2x;
+
+                if (g<=epsilon) break;
+
+                if (x==t1 || x==Succ(t2c)) continue;
+
+                TNode y = Pred(x);
+
+                if (WasAdded(y,x,depth)) continue;
+
+                TFloat trial = Dist(y,x)-d2x;
+
+                if (trial>bestTrial)
+                {
+                    bestTrial = trial;
+                    t3Next = x;
+                    t4Next = y;
+                }
+            }
+
+            if (t3Next==NoNode) break;
+
+            gOpen -= Dist(t2c,t3Next);
+            t3 = t3Next;
+            t4 = t4Next;
+        }
+
+        // Undo all reversals after the best tour
+        while (depth>bestDepth)
+        {
+            depth--;
+            Flip(flipA[depth],flipB[depth]);
+        }
+
+        if (bestDepth>0)
+        {
+            Activate(t1);
+            Activate(t2);
+
+            for (int j=0;j<3*bestDepth;j++) Activate(touched[j]);
+
+            #if defined(_LOGGING_)
+
+            if (G.Context().logMeth>1)
+            {
+                sprintf(G.Context().logBuffer,
+                    "Local improvement (%g units, %d-step Lin-Kernighan move)",
+                    bestGain,bestDepth);
+                G.Context().LogEntry(LOG_METH2,G.Handle(),G.Context().logBuffer);
+            }
+
+            #endif
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+bool linKernighanSearch::OrOptMove(TNode t1) throw()
+{
+    // Shift the path s1,..,s2 to the tour edge xy, in either orientation
+
+    TNode s1 = t1;
+    TNode s2 = t1;
+
+    for (int length=1;length<=OR_MAX_LENGTH && TNode(length+3)<=n;length++)
+    {
+        if (length>1) s2 = Succ(s2);
+
+        TNode sMid = (length==3) ? Succ(s1) : s1;
+        TNode p = Pred(s1);
+        TNode nx = Succ(s2);
+        TFloat removeGain = Dist(p,s1)+Dist(s2,nx)-Dist(p,nx);
+
+        if (removeGain<=epsilon) continue;
+
+        for (int end=0;end<2;end++)
+        {
+            TNode* list = cand+((end==0) ? s1 : s2)*width;
+
+            for (TNode i=0;i<width && list[i]!=NoNode;i++)
+            {
+                TNode c = list[i];
+
+                if (c==s1 || c==s2 || c==sMid) continue;
+
+                for (int side=0;side<2;side++)
+                {
+                    TNode x = (side==0) ? c : Pred(c);
+                    TNode y = (side==0) ? Succ(c) : c;
+
+                    if (   x==s1 || x==s2 || x==sMid
+                        || y==s1 || y==s2 || y==sMid
+                       )
+                    {
+                        continue;
+                    }
+
+                    TFloat dxy = Dist(x,y);
+                    TFloat addForward = Dist(x,s1)+Dist(s2,y)-dxy;
+                    TFloat addReverse = Dist(x,s2)+Dist(s1,y)-dxy;
+
+                    if (removeGain-addForward<=epsilon && removeGain-addReverse<=epsilon)
+                        continue;
+
+                    TFloat gain = 0;
+
+                    // The path from nx to x is reversed twice
+                    if (addReverse<=addForward)
+                    {
+                        gain = removeGain-addReverse;
+                        Flip(s1,x);
+                        Flip(x,nx);
+                    }
+                    else
+                    {
+                        gain = removeGain-addForward;
+                        Flip(s1,s2);
+                        Flip(s2,x);
+                        Flip(x,nx);
+                    }
+
+                    Activate(p);
+                    Activate(nx);
+                    Activate(s1);
+                    Activate(s2);
+                    Activate(x);
+                    Activate(y);
+
+                    #if defined(_LOGGING_)
+
+                    if (G.Context().logMeth>1)
+                    {
+                        sprintf(G.Context().logBuffer,
+                            "Local improvement (%g units, Or-opt move)",gain);
+                        G.Context().LogEntry(LOG_METH2,G.Handle(),G.Context().logBuffer);
+                    }
+
+                    #endif
+
+                    return true;
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
+
+void linKernighanSearch::Optimize() throw()
+{
+    while (G.Context().SolverRunning() && !Q.Empty())
+    {
+        TNode t1 = Q.Delete();
+
+        for (int i=0;i<2;i++)
+        {
+            dir = (i==1);
+
+            if (LinKernighanMove(t1) || OrOptMove(t1))
+            {
+                nMoves++;
+                Activate(t1);
+                break;
+            }
+        }
+    }
+
+    dir = false;
+}
+
+
+bool abstractGraph::TSP_LinKernighan(TArc* pred) throw(ERRejected)
+{
+    #if defined(_FAILSAVE_)
+
+    if (!pred) Error(ERR_REJECTED,"TSP_LinKernighan","Missing tour");
+
+    #endif
+
+    if (n<4) return false;
+
+    TNode* order = new TNode[n];
+    TNode v = 0;
+
+    for (TNode i=n;i>0;)
+    {
+        order[--i] = v;
+        v = StartNode(pred[v]);
+
+        if (v==0 && i>0)
+        {
+            delete[] order;
+            Error(ERR_REJECTED,"TSP_LinKernighan","Tour is incomplete");
+        }
+    }
+
+    OpenFold(ModLinKernighan);
+
+    linKernighanSearch S(*this,order,CT.methCandidates);
+    S.Optimize();
+
+    if (S.nMoves>0)
+    {
+        for (TNode i=0;i<n;i++)
+        {
+            TNode w = S.Next(order[i]);
+            pred[w] = Adjacency(order[i],w);
+        }
+    }
+
+    delete[] order;
+
+    if (CT.logMeth>1)
+    {
+        sprintf(CT.logBuffer,"...%lu improving moves",S.nMoves);
+        LogEntry(LOG_METH2,CT.logBuffer);
+    }
+
+    if (S.nMoves>0) Trace();
+
+    CloseFold(ModLinKernighan);
+
+    return (S.nMoves>0);
+}
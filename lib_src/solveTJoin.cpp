@@ -42,7 +42,7 @@ void abstractGraph::ComputeTJoin(const indexSet<TNode>& Terminals) throw(ERRejec
 
     if (CT.logMeth)
     {
-        sprintf(CT.logBuffer,"Problem has %ld odd vertices",no);
+        sprintf(CT.logBuffer,"Problem has %ld odd vertices",(unsigned long)no);
         LogEntry(LOG_METH,CT.logBuffer);
     }
 
@@ -165,7 +165,7 @@ void abstractGraph::ComputeTJoin(const indexSet<TNode>& Terminals) throw(ERRejec
         if (CT.logMeth>1)
         {
             LogEntry(LOG_METH2,"Adding the path (in reverse order):");
-            sprintf(CT.logBuffer,"  (%ld",v);
+            sprintf(CT.logBuffer,"  (%ld",(unsigned long)v);
             LH = LogStart(LOG_METH2,CT.logBuffer);
         }
 
@@ -183,7 +183,7 @@ void abstractGraph::ComputeTJoin(const indexSet<TNode>& Terminals) throw(ERRejec
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,",%ld",v);
+                sprintf(CT.logBuffer,",%ld",(unsigned long)v);
                 LogAppend(LH,CT.logBuffer);
             }
 
@@ -59,7 +59,7 @@ TCap abstractDiGraph::TreePacking(TNode root) throw(ERRange)
         step++;
 
         sprintf(CT.logBuffer,
-            "Computing the %ldth spanning %ld-arborescence...",step,root);
+            "Computing the %ldth spanning %ld-arborescence...",step,(unsigned long)root);
         LogEntry(LOG_METH,CT.logBuffer);
         OpenFold();
 
@@ -38,10 +38,20 @@ biGraph::biGraph(const char* fileName,goblinController& _CT) throw(ERFile,ERPars
     LogEntry(LOG_IO,"Loading bigraph...");
     if (!CT.logIO && CT.logMem) LogEntry(LOG_MEM,"Loading bigraph...");
 
-    goblinImport F(fileName,CT);
-
-    F.Scan("bigraph");
-    ReadAllData(F);
+    if (goblinBinaryImport::IsBinaryFile(fileName))
+    {
+        goblinBinaryImport F(fileName,CT);
+        F.CheckObjectClass("bigraph");
+        ReadBinary(F);
+        n1 = TNode(F.Header().n1);
+        n2 = n-n1;
+    }
+    else
+    {
+        goblinImport F(fileName,CT);
+        F.Scan("bigraph");
+        ReadAllData(F);
+    }
 
     if (CT.sourceNode<n) SetSourceNode(CT.sourceNode);
     else SetSourceNode(NoNode);
@@ -88,7 +98,7 @@ biGraph::biGraph(abstractBiGraph &G,TOption options) throw() :
 {
     X.SetCapacity(G.N(),G.M());
 
-    TIndex* originalArc = (options & OPT_MAPPINGS) ? new TArc[G.M()] : NULL;
+    TIndex* originalArc = (options & OPT_MAPPINGS) ? new TIndex[G.M()] : NULL;
 
     if (options & OPT_CLONE)
     {
@@ -254,8 +264,8 @@ inducedBigraph::inducedBigraph(abstractMixedGraph& G,
 {
     X.SetCapacity(G.N(),G.M());
 
-    TIndex* originalNode = (options & OPT_MAPPINGS) ? new TNode[G.N()] : NULL;
-    TIndex* originalArc  = (options & OPT_MAPPINGS) ? new TArc[G.M()]  : NULL;
+    TIndex* originalNode = (options & OPT_MAPPINGS) ? new TIndex[G.N()] : NULL;
+    TIndex* originalArc  = (options & OPT_MAPPINGS) ? new TIndex[G.M()]  : NULL;
 
     TNode* mapNodes = new TNode[G.N()];
 
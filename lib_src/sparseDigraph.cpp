@@ -40,10 +40,18 @@ diGraph::diGraph(const char* fileName,goblinController& _CT) throw(ERFile,ERPars
     LogEntry(LOG_IO,"Loading digraph...");
     if (!CT.logIO && CT.logMem) LogEntry(LOG_MEM,"Loading digraph...");
 
-    goblinImport F(fileName,CT);
-
-    F.Scan("digraph");
-    ReadAllData(F);
+    if (goblinBinaryImport::IsBinaryFile(fileName))
+    {
+        goblinBinaryImport F(fileName,CT);
+        F.CheckObjectClass("digraph");
+        ReadBinary(F);
+    }
+    else
+    {
+        goblinImport F(fileName,CT);
+        F.Scan("digraph");
+        ReadAllData(F);
+    }
 
     if (CT.sourceNode<n) SetSourceNode(CT.sourceNode);
     else SetSourceNode(NoNode);
@@ -81,7 +89,7 @@ diGraph::diGraph(abstractMixedGraph& G,TOption options) throw() :
 
     X.SetCapacity(G.N(),2*G.M());
 
-    TIndex* originalArc = (options & OPT_MAPPINGS) ? new TArc[2*G.M()] : NULL;
+    TIndex* originalArc = (options & OPT_MAPPINGS) ? new TIndex[2*G.M()] : NULL;
 
     if (options & OPT_CLONE)
     {
@@ -360,7 +368,7 @@ inducedOrientation::inducedOrientation(abstractMixedGraph &G,TOption options) th
 {
     LogEntry(LOG_MAN,"Orienting graph arcs by layers...");
 
-    TIndex* originalArc = (options & OPT_MAPPINGS) ? new TArc[G.M()] : NULL;
+    TIndex* originalArc = (options & OPT_MAPPINGS) ? new TIndex[G.M()] : NULL;
 
     for (TArc a=0;a<2*G.M();a++)
     {
@@ -40,10 +40,18 @@ graph::graph(const char* fileName,goblinController& _CT) throw(ERFile,ERParse) :
 
     if (!CT.logIO && CT.logMem) LogEntry(LOG_MEM,"Loading graph...");
 
-    goblinImport F(fileName,CT);
-
-    F.Scan("graph");
-    ReadAllData(F);
+    if (goblinBinaryImport::IsBinaryFile(fileName))
+    {
+        goblinBinaryImport F(fileName,CT);
+        F.CheckObjectClass("graph");
+        ReadBinary(F);
+    }
+    else
+    {
+        goblinImport F(fileName,CT);
+        F.Scan("graph");
+        ReadAllData(F);
+    }
 
     if (CT.sourceNode<n) SetSourceNode(CT.sourceNode);
     else SetSourceNode(NoNode);
@@ -77,7 +85,7 @@ graph::graph(abstractMixedGraph& G,TOption options) throw() :
 {
     X.SetCapacity(G.N(),G.M());
 
-    TIndex* originalArc = (options & OPT_MAPPINGS) ? new TArc[G.M()] : NULL;
+    TIndex* originalArc = (options & OPT_MAPPINGS) ? new TIndex[G.M()] : NULL;
 
     if (options & OPT_CLONE)
     {
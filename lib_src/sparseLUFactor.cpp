@@ -0,0 +1,691 @@
+
+//  This file forms part of the GOBLIN C++ Class Library.
+//
+//  Initially written by the GOBLIN developers, October 2026
+//
+//  Copying, compiling, distribution and modification
+//  of this source code is permitted only in accordance
+//  with the GOBLIN general licence information.
+
+/// \file   sparseLUFactor.cpp
+/// \brief  #sparseLUFactor class implementation
+
+#include "sparseLUFactor.h"
+
+
+// Candidate pivots must not be smaller than this fraction of the
+// largest absolute value in their column
+static const TFloat PIVOT_THRESHOLD = 0.1;
+
+// Candidate pivots must not be smaller than this absolute value
+static const TFloat PIVOT_TOLERANCE = 1e-11;
+
+// Number of rows and columns in the Markowitz search after which
+// the best candidate found so far is accepted
+static const TIndex MAX_SEARCH = 4;
+
+// Maximum number of eta vectors before a refactorization is required
+static const TIndex MAX_UPDATES = 100;
+
+
+sparseLUFactor::sparseLUFactor(TIndex nn,goblinController& thisContext)
+    throw() : managedObject(thisContext)
+{
+    n = nn;
+
+    colLen   = new TIndex[n];
+    colCap   = new TIndex[n];
+    colRow   = new TIndex*[n];
+    colVal   = new TFloat*[n];
+    rowLen   = new TIndex[n];
+    rowCap   = new TIndex[n];
+    rowCol   = new TIndex*[n];
+
+    rowFirst = new TIndex[n+1];
+    rowNext  = new TIndex[n];
+    rowPrev  = new TIndex[n];
+    colFirst = new TIndex[n+1];
+    colNext  = new TIndex[n];
+    colPrev  = new TIndex[n];
+
+    pivRow   = new TIndex[n];
+    pivCol   = new TIndex[n];
+    pivVal   = new TFloat[n];
+
+    lFirst   = new TIndex[n+1];
+    lCap     = n+1;
+    lIndex   = new TIndex[lCap];
+    lVal     = new TFloat[lCap];
+
+    uFirst   = new TIndex[n+1];
+    uCap     = n+1;
+    uIndex   = new TIndex[uCap];
+    uVal     = new TFloat[uCap];
+
+    nEta     = 0;
+    etaMax   = MAX_UPDATES;
+    etaPos   = new TIndex[etaMax];
+    etaPivot = new TFloat[etaMax];
+    etaFirst = new TIndex[etaMax+1];
+    etaCap   = n+1;
+    etaIndex = new TIndex[etaCap];
+    etaVal   = new TFloat[etaCap];
+    etaFirst[0] = 0;
+
+    mark     = new TIndex[n];
+    work     = new TFloat[n];
+
+    for (TIndex i=0;i<n;i++)
+    {
+        colLen[i] = colCap[i] = 0;
+        colRow[i] = NULL;
+        colVal[i] = NULL;
+        rowLen[i] = rowCap[i] = 0;
+        rowCol[i] = NULL;
+        mark[i] = 0;
+    }
+
+    Identity();
+
+    LogEntry(LOG_MEM,"...LU factorization allocated");
+}
+
+
+sparseLUFactor::~sparseLUFactor() throw()
+{
+    for (TIndex i=0;i<n;i++)
+    {
+        delete[] colRow[i];
+        delete[] colVal[i];
+        delete[] rowCol[i];
+    }
+
+    delete[] colLen;
+    delete[] colCap;
+    delete[] colRow;
+    delete[] colVal;
+    delete[] rowLen;
+    delete[] rowCap;
+    delete[] rowCol;
+
+    delete[] rowFirst;
+    delete[] rowNext;
+    delete[] rowPrev;
+    delete[] colFirst;
+    delete[] colNext;
+    delete[] colPrev;
+
+    delete[] pivRow;
+    delete[] pivCol;
+    delete[] pivVal;
+
+    delete[] lFirst;
+    delete[] lIndex;
+    delete[] lVal;
+
+    delete[] uFirst;
+    delete[] uIndex;
+    delete[] uVal;
+
+    delete[] etaPos;
+    delete[] etaPivot;
+    delete[] etaFirst;
+    delete[] etaIndex;
+    delete[] etaVal;
+
+    delete[] mark;
+    delete[] work;
+
+    LogEntry(LOG_MEM,"...LU factorization disallocated");
+}
+
+
+unsigned long sparseLUFactor::Size() const throw()
+{
+    return
+          sizeof(sparseLUFactor)
+        + managedObject::Allocated()
+        + sparseLUFactor::Allocated();
+}
+
+
+unsigned long sparseLUFactor::Allocated() const throw()
+{
+    unsigned long tmpSize =
+          n*(13*sizeof(TIndex)+2*sizeof(TIndex*)+sizeof(TFloat*)+2*sizeof(TFloat))
+        + 2*(n+1)*sizeof(TIndex)
+        + (lCap+uCap+etaCap)*(sizeof(TIndex)+sizeof(TFloat))
+        + etaMax*(2*sizeof(TIndex)+sizeof(TFloat));
+
+    for (TIndex i=0;i<n;i++)
+        tmpSize += colCap[i]*(sizeof(TIndex)+sizeof(TFloat))+rowCap[i]*sizeof(TIndex);
+
+    return tmpSize;
+}
+
+
+void sparseLUFactor::Init() throw()
+{
+    for (TIndex i=0;i<n;i++) colLen[i] = rowLen[i] = 0;
+}
+
+
+void sparseLUFactor::AppendToColumn(TIndex j,TIndex i,TFloat val) throw()
+{
+    if (colLen[j]==colCap[j])
+    {
+        colCap[j] = (colCap[j]==0) ? 4 : 2*colCap[j];
+        colRow[j] = (TIndex*)GoblinRealloc(colRow[j],colCap[j]*sizeof(TIndex));
+        colVal[j] = (TFloat*)GoblinRealloc(colVal[j],colCap[j]*sizeof(TFloat));
+    }
+
+    colRow[j][colLen[j]] = i;
+    colVal[j][colLen[j]] = val;
+    colLen[j]++;
+}
+
+
+void sparseLUFactor::AppendToRow(TIndex i,TIndex j) throw()
+{
+    if (rowLen[i]==rowCap[i])
+    {
+        rowCap[i] = (rowCap[i]==0) ? 4 : 2*rowCap[i];
+        rowCol[i] = (TIndex*)GoblinRealloc(rowCol[i],rowCap[i]*sizeof(TIndex));
+    }
+
+    rowCol[i][rowLen[i]] = j;
+    rowLen[i]++;
+}
+
+
+void sparseLUFactor::RemoveFromRow(TIndex i,TIndex j) throw()
+{
+    for (TIndex q=0;q<rowLen[i];q++)
+    {
+        if (rowCol[i][q]!=j) continue;
+
+        rowLen[i]--;
+        rowCol[i][q] = rowCol[i][rowLen[i]];
+        return;
+    }
+}
+
+
+TFloat sparseLUFactor::RemoveFromColumn(TIndex j,TIndex i) throw()
+{
+    for (TIndex q=0;q<colLen[j];q++)
+    {
+        if (colRow[j][q]!=i) continue;
+
+        TFloat val = colVal[j][q];
+        colLen[j]--;
+        colRow[j][q] = colRow[j][colLen[j]];
+        colVal[j][q] = colVal[j][colLen[j]];
+        return val;
+    }
+
+    return 0;
+}
+
+
+void sparseLUFactor::RowListInsert(TIndex i) throw()
+{
+    TIndex len = rowLen[i];
+
+    rowPrev[i] = NoIndex;
+    rowNext[i] = rowFirst[len];
+    if (rowFirst[len]!=NoIndex) rowPrev[rowFirst[len]] = i;
+    rowFirst[len] = i;
+}
+
+
+void sparseLUFactor::RowListDelete(TIndex i) throw()
+{
+    if (rowPrev[i]!=NoIndex) rowNext[rowPrev[i]] = rowNext[i];
+    else rowFirst[rowLen[i]] = rowNext[i];
+
+    if (rowNext[i]!=NoIndex) rowPrev[rowNext[i]] = rowPrev[i];
+}
+
+
+void sparseLUFactor::ColListInsert(TIndex j) throw()
+{
+    TIndex len = colLen[j];
+
+    colPrev[j] = NoIndex;
+    colNext[j] = colFirst[len];
+    if (colFirst[len]!=NoIndex) colPrev[colFirst[len]] = j;
+    colFirst[len] = j;
+}
+
+
+void sparseLUFactor::ColListDelete(TIndex j) throw()
+{
+    if (colPrev[j]!=NoIndex) colNext[colPrev[j]] = colNext[j];
+    else colFirst[colLen[j]] = colNext[j];
+
+    if (colNext[j]!=NoIndex) colPrev[colNext[j]] = colPrev[j];
+}
+
+
+void sparseLUFactor::SetColumn(TIndex j,TIndex len,const TIndex* index,
+    const TFloat* val) throw(ERRange)
+{
+    #if defined(_FAILSAVE_)
+
+    if (j>=n) NoSuchIndex("SetColumn",j);
+
+    #endif
+
+    colLen[j] = 0;
+
+    for (TIndex q=0;q<len;q++)
+    {
+        #if defined(_FAILSAVE_)
+
+        if (index[q]>=n) NoSuchIndex("SetColumn",index[q]);
+
+        #endif
+
+        if (val[q]!=0) AppendToColumn(j,index[q],val[q]);
+    }
+}
+
+
+void sparseLUFactor::Identity() throw()
+{
+    for (TIndex k=0;k<n;k++)
+    {
+        pivRow[k] = pivCol[k] = k;
+        pivVal[k] = 1;
+        lFirst[k] = uFirst[k] = 0;
+    }
+
+    lFirst[n] = uFirst[n] = 0;
+    nEta = 0;
+}
+
+
+bool sparseLUFactor::SearchPivot(TIndex& r,TIndex& c) const throw()
+{
+    // Markowitz search with threshold pivoting. Rows and columns are
+    // examined by increasing lengths. After all rows and columns of
+    // length less than len have been examined, every remaining candidate
+    // has a Markowitz count of at least (len-1)^2
+
+    r = c = NoIndex;
+
+    TIndex bestCost = NoIndex;
+    TIndex nSearched = 0;
+
+    for (TIndex len=1;len<=n;len++)
+    {
+        for (TIndex j=colFirst[len];j!=NoIndex;j=colNext[j])
+        {
+            TFloat colMax = 0;
+
+            for (TIndex q=0;q<len;q++)
+                if (fabs(colVal[j][q])>colMax) colMax = fabs(colVal[j][q]);
+
+            for (TIndex q=0;q<len;q++)
+            {
+                TFloat thisVal = fabs(colVal[j][q]);
+
+                if (thisVal<PIVOT_TOLERANCE || thisVal<PIVOT_THRESHOLD*colMax)
+                    continue;
+
+                TIndex thisCost = (rowLen[colRow[j][q]]-1)*(len-1);
+
+                if (thisCost<bestCost)
+                {
+                    bestCost = thisCost;
+                    r = colRow[j][q];
+                    c = j;
+                }
+            }
+
+            if (bestCost==NoIndex) continue;
+
+            nSearched++;
+
+            if (bestCost<=(len-1)*(len-1) || nSearched>=MAX_SEARCH) return true;
+        }
+
+        for (TIndex i=rowFirst[len];i!=NoIndex;i=rowNext[i])
+        {
+            for (TIndex p=0;p<len;p++)
+            {
+                TIndex j = rowCol[i][p];
+                TFloat colMax = 0;
+                TFloat thisVal = 0;
+
+                for (TIndex q=0;q<colLen[j];q++)
+                {
+                    if (fabs(colVal[j][q])>colMax) colMax = fabs(colVal[j][q]);
+                    if (colRow[j][q]==i) thisVal = fabs(colVal[j][q]);
+                }
+
+                if (thisVal<PIVOT_TOLERANCE || thisVal<PIVOT_THRESHOLD*colMax)
+                    continue;
+
+                TIndex thisCost = (len-1)*(colLen[j]-1);
+
+                if (thisCost<bestCost)
+                {
+                    bestCost = thisCost;
+                    r = i;
+                    c = j;
+                }
+            }
+
+            if (bestCost==NoIndex) continue;
+
+            nSearched++;
+
+            if (bestCost<=len*(len-1) || nSearched>=MAX_SEARCH) return true;
+        }
+    }
+
+    return (bestCost!=NoIndex);
+}
+
+
+void sparseLUFactor::Eliminate(TIndex k,TIndex r,TIndex c) throw()
+{
+    pivRow[k] = r;
+    pivCol[k] = c;
+
+    RowListDelete(r);
+    ColListDelete(c);
+
+    // Move the pivot row to U and remove it from the active submatrix
+
+    if (uFirst[k]+rowLen[r]>uCap)
+    {
+        while (uFirst[k]+rowLen[r]>uCap) uCap *= 2;
+
+        uIndex = (TIndex*)GoblinRealloc(uIndex,uCap*sizeof(TIndex));
+        uVal   = (TFloat*)GoblinRealloc(uVal,uCap*sizeof(TFloat));
+    }
+
+    TIndex uNext = uFirst[k];
+
+    for (TIndex p=0;p<rowLen[r];p++)
+    {
+        TIndex j = rowCol[r][p];
+
+        if (j==c)
+        {
+            pivVal[k] = RemoveFromColumn(c,r);
+            continue;
+        }
+
+        ColListDelete(j);
+        uIndex[uNext] = j;
+        uVal[uNext] = RemoveFromColumn(j,r);
+        uNext++;
+    }
+
+    uFirst[k+1] = uNext;
+    rowLen[r] = 0;
+
+    // Move the multipliers to L and remove the pivot column from the active submatrix
+
+    if (lFirst[k]+colLen[c]>lCap)
+    {
+        while (lFirst[k]+colLen[c]>lCap) lCap *= 2;
+
+        lIndex = (TIndex*)GoblinRealloc(lIndex,lCap*sizeof(TIndex));
+        lVal   = (TFloat*)GoblinRealloc(lVal,lCap*sizeof(TFloat));
+    }
+
+    TIndex lNext = lFirst[k];
+
+    for (TIndex q=0;q<colLen[c];q++)
+    {
+        TIndex i = colRow[c][q];
+
+        RowListDelete(i);
+        RemoveFromRow(i,c);
+        lIndex[lNext] = i;
+        lVal[lNext] = colVal[c][q]/pivVal[k];
+        lNext++;
+    }
+
+    lFirst[k+1] = lNext;
+    colLen[c] = 0;
+
+    // Update the remaining columns of the pivot row
+
+    for (TIndex p=uFirst[k];p<uFirst[k+1];p++)
+    {
+        TIndex j = uIndex[p];
+        TFloat u = uVal[p];
+
+        for (TIndex q=0;q<colLen[j];q++) mark[colRow[j][q]] = q+1;
+
+        for (TIndex q=lFirst[k];q<lFirst[k+1];q++)
+        {
+            TIndex i = lIndex[q];
+
+            if (mark[i]>0)
+            {
+                colVal[j][mark[i]-1] -= lVal[q]*u;
+            }
+            else
+            {
+                AppendToColumn(j,i,-lVal[q]*u);
+                AppendToRow(i,j);
+            }
+        }
+
+        for (TIndex q=0;q<colLen[j];q++) mark[colRow[j][q]] = 0;
+
+        ColListInsert(j);
+    }
+
+    for (TIndex q=lFirst[k];q<lFirst[k+1];q++) RowListInsert(lIndex[q]);
+}
+
+
+void sparseLUFactor::Factorize() throw(ERRejected)
+{
+    OpenFold(ModLUFactor,NO_INDENT);
+
+    // Set up the row patterns and the lists of rows and columns by length
+
+    for (TIndex i=0;i<n;i++) rowLen[i] = 0;
+
+    for (TIndex j=0;j<n;j++)
+        for (TIndex q=0;q<colLen[j];q++) AppendToRow(colRow[j][q],j);
+
+    for (TIndex len=0;len<=n;len++) rowFirst[len] = colFirst[len] = NoIndex;
+
+    for (TIndex i=0;i<n;i++)
+    {
+        RowListInsert(i);
+        ColListInsert(i);
+    }
+
+    lFirst[0] = uFirst[0] = 0;
+    nEta = 0;
+
+    for (TIndex k=0;k<n;k++)
+    {
+        TIndex r = NoIndex;
+        TIndex c = NoIndex;
+
+        if (   rowFirst[0]!=NoIndex || colFirst[0]!=NoIndex
+            || !SearchPivot(r,c)
+           )
+        {
+            // Leave a consistent factorization behind
+
+            Identity();
+            CloseFold(ModLUFactor,NO_INDENT);
+
+            Error(ERR_REJECTED,"Factorize","Matrix is singular");
+        }
+
+        Eliminate(k,r,c);
+    }
+
+    #if defined(_LOGGING_)
+
+    if (CT.logMeth>1)
+    {
+        sprintf(CT.logBuffer,"...Factorized with %lu non-zeros in L and %lu in U",
+            lFirst[n],uFirst[n]+n);
+        LogEntry(LOG_METH2,CT.logBuffer);
+    }
+
+    #endif
+
+    CloseFold(ModLUFactor,NO_INDENT);
+}
+
+
+void sparseLUFactor::Update(TIndex p,const TFloat* alpha) throw(ERRange,ERRejected)
+{
+    #if defined(_FAILSAVE_)
+
+    if (p>=n) NoSuchIndex("Update",p);
+
+    if (fabs(alpha[p])<PIVOT_TOLERANCE)
+        Error(ERR_REJECTED,"Update","Pivot element too small");
+
+    #endif
+
+    if (nEta==etaMax)
+    {
+        etaMax *= 2;
+        etaPos   = (TIndex*)GoblinRealloc(etaPos,etaMax*sizeof(TIndex));
+        etaPivot = (TFloat*)GoblinRealloc(etaPivot,etaMax*sizeof(TFloat));
+        etaFirst = (TIndex*)GoblinRealloc(etaFirst,(etaMax+1)*sizeof(TIndex));
+    }
+
+    TIndex etaNext = etaFirst[nEta];
+
+    for (TIndex i=0;i<n;i++)
+    {
+        if (i==p || alpha[i]==0) continue;
+
+        if (etaNext==etaCap)
+        {
+            etaCap *= 2;
+            etaIndex = (TIndex*)GoblinRealloc(etaIndex,etaCap*sizeof(TIndex));
+            etaVal   = (TFloat*)GoblinRealloc(etaVal,etaCap*sizeof(TFloat));
+        }
+
+        etaIndex[etaNext] = i;
+        etaVal[etaNext] = alpha[i];
+        etaNext++;
+    }
+
+    etaPos[nEta] = p;
+    etaPivot[nEta] = alpha[p];
+    etaFirst[nEta+1] = etaNext;
+    nEta++;
+}
+
+
+bool sparseLUFactor::RefactorizationRequired() const throw()
+{
+    return (nEta>=MAX_UPDATES || etaFirst[nEta]>lFirst[n]+uFirst[n]+n);
+}
+
+
+void sparseLUFactor::FTran(TFloat* x) const throw()
+{
+    // Apply the elimination steps to the right-hand side
+
+    for (TIndex k=0;k<n;k++)
+    {
+        TFloat xr = x[pivRow[k]];
+
+        if (xr==0) continue;
+
+        for (TIndex q=lFirst[k];q<lFirst[k+1];q++)
+            x[lIndex[q]] -= lVal[q]*xr;
+    }
+
+    // Back substitution with the pivot rows
+
+    for (TIndex k=n;k>0;)
+    {
+        k--;
+
+        TFloat thisVal = x[pivRow[k]];
+
+        for (TIndex q=uFirst[k];q<uFirst[k+1];q++)
+            thisVal -= uVal[q]*work[uIndex[q]];
+
+        work[pivCol[k]] = thisVal/pivVal[k];
+    }
+
+    for (TIndex i=0;i<n;i++) x[i] = work[i];
+
+    // Apply the update file
+
+    for (TIndex t=0;t<nEta;t++)
+    {
+        TIndex p = etaPos[t];
+        TFloat xp = x[p]/etaPivot[t];
+
+        x[p] = xp;
+
+        if (xp==0) continue;
+
+        for (TIndex q=etaFirst[t];q<etaFirst[t+1];q++)
+            x[etaIndex[q]] -= etaVal[q]*xp;
+    }
+}
+
+
+void sparseLUFactor::BTran(TFloat* x) const throw()
+{
+    // Apply the update file in reverse order
+
+    for (TIndex t=nEta;t>0;)
+    {
+        t--;
+
+        TIndex p = etaPos[t];
+        TFloat thisVal = x[p];
+
+        for (TIndex q=etaFirst[t];q<etaFirst[t+1];q++)
+            thisVal -= etaVal[q]*x[etaIndex[q]];
+
+        x[p] = thisVal/etaPivot[t];
+    }
+
+    // Forward substitution with the transposed pivot rows
+
+    for (TIndex k=0;k<n;k++)
+    {
+        TFloat thisVal = x[pivCol[k]]/pivVal[k];
+
+        work[pivRow[k]] = thisVal;
+
+        if (thisVal==0) continue;
+
+        for (TIndex q=uFirst[k];q<uFirst[k+1];q++)
+            x[uIndex[q]] -= uVal[q]*thisVal;
+    }
+
+    // Apply the transposed elimination steps in reverse order
+
+    for (TIndex k=n;k>0;)
+    {
+        k--;
+
+        TFloat thisVal = 0;
+
+        for (TIndex q=lFirst[k];q<lFirst[k+1];q++)
+            thisVal += lVal[q]*work[lIndex[q]];
+
+        work[pivRow[k]] -= thisVal;
+    }
+
+    for (TIndex i=0;i<n;i++) x[i] = work[i];
+}
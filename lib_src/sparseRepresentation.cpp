@@ -72,6 +72,92 @@ void sparseRepresentation::ReadIncidences(goblinImport& F)
 }
 
 
+void sparseRepresentation::ReadBinary(const goblinBinaryImport& F)
+    throw(ERParse)
+{
+    unsigned long blockSN = F.FindBlock(BIN_POOL_REPRESENTATION,TokReprStartNode);
+    unsigned long blockRight = F.FindBlock(BIN_POOL_REPRESENTATION,TokReprRight);
+    unsigned long blockFirst = F.FindBlock(BIN_POOL_REPRESENTATION,TokReprFirst);
+    unsigned long blockSub = F.FindBlock(BIN_POOL_REGISTERS,TokRegSubgraph);
+
+    if (   blockSN==F.NumBlocks() || F.Block(blockSN).baseType!=TYPE_NODE_INDEX
+        || F.Block(blockSN).length!=2*mAct
+        || blockRight==F.NumBlocks() || F.Block(blockRight).baseType!=TYPE_ARC_INDEX
+        || F.Block(blockRight).length!=2*mAct
+        || blockFirst==F.NumBlocks() || F.Block(blockFirst).baseType!=TYPE_ARC_INDEX
+        || F.Block(blockFirst).length!=nAct
+       )
+    {
+        Error(ERR_PARSE,"ReadBinary","Missing or inconsistent incidence lists");
+    }
+
+    SN = (TNode*)GoblinRealloc(SN,2*mMax*sizeof(TNode));
+    right = (TArc*)GoblinRealloc(right,2*mMax*sizeof(TArc));
+    first = (TArc*)GoblinRealloc(first,nMax*sizeof(TArc));
+
+    memcpy(SN,F.Data(blockSN),2*mAct*sizeof(TNode));
+    memcpy(right,F.Data(blockRight),2*mAct*sizeof(TArc));
+    memcpy(first,F.Data(blockFirst),nAct*sizeof(TArc));
+
+    #if defined(_FAILSAVE_)
+
+    for (TArc a=0;a<2*mAct;a++)
+    {
+        if ((SN[a]>=nAct && SN[a]!=NoNode) || right[a]>=2*mAct)
+        {
+            Error(ERR_PARSE,"ReadBinary","Incidence lists are corrupted");
+        }
+    }
+
+    for (TNode v=0;v<nAct;v++)
+    {
+        if (first[v]>=2*mAct && first[v]!=NoArc)
+        {
+            Error(ERR_PARSE,"ReadBinary","Incidence lists are corrupted");
+        }
+    }
+
+    #endif
+
+    if (blockSub<F.NumBlocks())
+    {
+        if (   F.Block(blockSub).baseType!=TYPE_FLOAT_VALUE
+            || F.Block(blockSub).length!=mAct
+           )
+        {
+            Error(ERR_PARSE,"ReadBinary","Inconsistent subgraph");
+        }
+
+        if (!sub) sub = new TFloat[mMax];
+
+        memcpy(sub,F.Data(blockSub),mAct*sizeof(TFloat));
+    }
+
+    LogEntry(LOG_MEM,"...Incidence lists allocated");
+}
+
+
+void sparseRepresentation::WriteBinary(goblinExport& F) const throw()
+{
+    TNode noNode = NoNode;
+    TArc noArc = NoArc;
+
+    F.WriteBinaryBlock(BIN_POOL_REPRESENTATION,TokReprStartNode,TYPE_NODE_INDEX,
+        2*mAct,SN,&noNode);
+    F.WriteBinaryBlock(BIN_POOL_REPRESENTATION,TokReprRight,TYPE_ARC_INDEX,
+        2*mAct,right,&noArc);
+    F.WriteBinaryBlock(BIN_POOL_REPRESENTATION,TokReprFirst,TYPE_ARC_INDEX,
+        nAct,first,&noArc);
+
+    if (sub)
+    {
+        TFloat zero = 0;
+        F.WriteBinaryBlock(BIN_POOL_REGISTERS,TokRegSubgraph,TYPE_FLOAT_VALUE,
+            mAct,sub,&zero);
+    }
+}
+
+
 void sparseRepresentation::SetCapacity(TNode _n,TArc _m)
     throw(ERRejected)
 {
@@ -150,6 +236,7 @@ TArc sparseRepresentation::InsertArc(TNode u,TNode v,TCap _u,TFloat _c,TCap _l)
     throw(ERRange,ERRejected)
 {
     G.ReleaseInvestigators();
+    G.Unfreeze();
 
     #if defined(_FAILSAVE_)
 
@@ -219,6 +306,7 @@ TNode sparseRepresentation::InsertNode()
     throw(ERRejected)
 {
     G.ReleaseInvestigators();
+    G.Unfreeze();
 
     #if defined(_FAILSAVE_)
 
@@ -419,6 +507,8 @@ void sparseRepresentation::ExplicitParallels() throw()
 void sparseRepresentation::SwapArcs(TArc a1,TArc a2)
     throw(ERRange)
 {
+    G.Unfreeze();
+
     #if defined(_FAILSAVE_)
 
     if (a1>=2*mAct) NoSuchArc("SwapArcs",a1);
@@ -434,11 +524,17 @@ void sparseRepresentation::SwapArcs(TArc a1,TArc a2)
     TNode v1 = SN[a1^1];
     TNode v2 = SN[a2^1];
 
+    G.UnmarkAdjacency(a1);
+    G.UnmarkAdjacency(a2);
+
     SN[a1] = u2;
     SN[a2] = u1;
     SN[a1^1] = v2;
     SN[a2^1] = v1;
 
+    if (u2!=NoNode) G.MarkAdjacency(u2,v2,a1);
+    if (u1!=NoNode) G.MarkAdjacency(u1,v1,a2);
+
     if (u1!=NoNode)
     {
         if (first[u1]==a1) first[u1] = a2;
@@ -622,6 +718,8 @@ void sparseRepresentation::SwapArcs(TArc a1,TArc a2)
 void sparseRepresentation::SwapNodes(TNode u,TNode v)
     throw(ERRange)
 {
+    G.Unfreeze();
+
     #if defined(_FAILSAVE_)
 
     if (u>=lAct) NoSuchNode("SwapNodes",u);
@@ -673,6 +771,8 @@ void sparseRepresentation::SwapNodes(TNode u,TNode v)
         return;
     }
 
+    G.ReleaseAdjacencies();
+
 
     TArc  a =  first[u];
 
@@ -714,6 +814,8 @@ void sparseRepresentation::SwapNodes(TNode u,TNode v)
 void sparseRepresentation::CancelArc(TArc a)
     throw(ERRange,ERRejected)
 {
+    G.Unfreeze();
+
     #if defined(_FAILSAVE_)
 
     if (a>=2*mAct) NoSuchArc("CancelArc",a);
@@ -724,7 +826,7 @@ void sparseRepresentation::CancelArc(TArc a)
 
     TArc ad = a;
 
-    G.MarkAdjacency(SN[a],SN[a^1],NoArc);
+    G.UnmarkAdjacency(a);
     G.ReleaseEmbedding();
 
     TArc aExtNew = right[ad^1];
@@ -1210,19 +1312,22 @@ void sparseRepresentation::DeleteNodes()
 void sparseRepresentation::ContractArc(TArc ac)
     throw(ERRange,ERRejected)
 {
+    G.Unfreeze();
+
     #if defined(_FAILSAVE_)
 
     if (ac>=2*mAct) NoSuchArc("ContractArc",ac);
 
     if (SN[ac]==SN[ac^1])
     {
-        sprintf(CT.logBuffer,"Arc is a loop: %ld",ac);
+        sprintf(CT.logBuffer,"Arc is a loop: %ld",(unsigned long)ac);
         Error(ERR_REJECTED,"ContractArc",CT.logBuffer);
     }
 
     #endif
 
     ReleaseBendNodes(ac);
+    G.ReleaseAdjacencies();
 
     TNode u = SN[ac];
     TNode v = SN[ac^1];
@@ -1261,6 +1366,8 @@ void sparseRepresentation::ContractArc(TArc ac)
 void sparseRepresentation::IdentifyNodes(TNode u,TNode v)
     throw(ERRange,ERRejected)
 {
+    G.Unfreeze();
+
     #if defined(_FAILSAVE_)
 
     if (u>=nAct) NoSuchNode("IdentifyNodes",u);
@@ -1269,6 +1376,8 @@ void sparseRepresentation::IdentifyNodes(TNode u,TNode v)
 
     #endif
 
+    G.ReleaseAdjacencies();
+
     TArc a1 = first[u];
     TArc a2 = first[v];
     TArc a = a2;
@@ -1346,6 +1455,8 @@ TArc sparseRepresentation::First(TNode v)
 void sparseRepresentation::SetFirst(TNode v,TArc a)
     throw(ERRange,ERRejected)
 {
+    G.Unfreeze();
+
     #if defined(_FAILSAVE_)
 
     if (v>=nAct) NoSuchNode("SetFirst",v);
@@ -1374,6 +1485,8 @@ TArc sparseRepresentation::Right(TArc a)
 void sparseRepresentation::SetRight(TArc a1,TArc a2,TArc a3)
     throw(ERRange,ERRejected)
 {
+    G.Unfreeze();
+
     if (a1==a2) return;
 
     if (a3==NoArc) a3 = a2;
@@ -1407,6 +1520,8 @@ void sparseRepresentation::SetRight(TArc a1,TArc a2,TArc a3)
 void sparseRepresentation::RouteArc(TArc a,TNode u,TNode v)
     throw(ERRange,ERRejected)
 {
+    G.Unfreeze();
+
     #if defined(_FAILSAVE_)
 
     if (a>=2*mAct) NoSuchArc("RouteArc",a);
@@ -1521,6 +1636,8 @@ TArc sparseRepresentation::Left(TArc ac)
 void sparseRepresentation::ReorderIncidences(const TArc* next,bool nodeOriented)
     throw()
 {
+    G.Unfreeze();
+
     for (TArc a=0;a<2*mAct;a++)
     {
         TArc a2 = next[a];
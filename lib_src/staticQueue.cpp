@@ -100,7 +100,7 @@ char* staticQueue<TItem,TKey>::Display() const throw()
                 LH = this->LogStart(MSG_TRACE2,"   ");
             }
 
-            sprintf(this->CT.logBuffer,"%ld, ",i);
+            sprintf(this->CT.logBuffer,"%ld, ",(unsigned long)i);
             this -> LogAppend(LH,this->CT.logBuffer);
 
             counter++;
@@ -112,7 +112,7 @@ char* staticQueue<TItem,TKey>::Display() const throw()
             LH = this->LogStart(MSG_TRACE2,"   ");
         }
 
-        sprintf(this->CT.logBuffer,"%ld (last in)",i);
+        sprintf(this->CT.logBuffer,"%ld (last in)",(unsigned long)i);
         this -> LogEnd(LH,this->CT.logBuffer);
     }
 
@@ -150,7 +150,7 @@ void staticQueue<TItem,TKey>::Insert(TItem w,TKey alpha,TOptInsert mode) throw(E
     {
         if (mode==INSERT_NO_THROW) return;
 
-        sprintf(this->CT.logBuffer,"%ld is already on the queue",w);
+        sprintf(this->CT.logBuffer,"%ld is already on the queue",(unsigned long)w);
         this -> Error(ERR_CHECK,"Insert",this->CT.logBuffer);
     }
 
@@ -100,7 +100,7 @@ char* staticStack<TItem,TKey>::Display() const throw()
                 LH = this->LogStart(MSG_TRACE2,"   ");
             }
 
-            sprintf(this->CT.logBuffer,"%ld, ",i);
+            sprintf(this->CT.logBuffer,"%ld, ",(unsigned long)i);
             this -> LogAppend(LH,this->CT.logBuffer);
 
             counter++;
@@ -112,7 +112,7 @@ char* staticStack<TItem,TKey>::Display() const throw()
             LH = this->LogStart(MSG_TRACE2,"   ");
         }
 
-        sprintf(this->CT.logBuffer,"%ld (bottom)",i);
+        sprintf(this->CT.logBuffer,"%ld (bottom)",(unsigned long)i);
         this -> LogEnd(LH,this->CT.logBuffer);
     }
 
@@ -150,7 +150,7 @@ void staticStack<TItem,TKey>::Insert(TItem w,TKey alpha,TOptInsert mode) throw(E
     {
         if (mode==INSERT_NO_THROW) return;
 
-        sprintf(this->CT.logBuffer,"%ld is already on the stack",w);
+        sprintf(this->CT.logBuffer,"%ld is already on the stack",(unsigned long)w);
         this -> Error(ERR_CHECK,"Insert",this->CT.logBuffer);
     }
 
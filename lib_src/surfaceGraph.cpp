@@ -477,9 +477,9 @@ void surfaceGraph::Traverse(TArc* pred,TArc aIn,TArc aOut) throw()
 
     if (v!=StartNode(aOut))
     {
-        sprintf(CT.logBuffer,"Mismatching end nodes of arcs %ld,%ld",aIn,aOut);
+        sprintf(CT.logBuffer,"Mismatching end nodes of arcs %ld,%ld",(unsigned long)aIn,(unsigned long)aOut);
         Error(MSG_WARN,"Traverse",CT.logBuffer);
-        sprintf(CT.logBuffer,"Found end nodes: %ld,%ld",v,StartNode(aOut));
+        sprintf(CT.logBuffer,"Found end nodes: %ld,%ld",(unsigned long)v,(unsigned long)StartNode(aOut));
         InternalError1("Traverse");
     }
 
@@ -491,7 +491,7 @@ void surfaceGraph::Traverse(TArc* pred,TArc aIn,TArc aOut) throw()
 
         if (CT.logMeth>1)
         {
-            sprintf(CT.logBuffer,"pred[%ld] = %ld",v,aIn);
+            sprintf(CT.logBuffer,"pred[%ld] = %ld",(unsigned long)v,(unsigned long)aIn);
             LogEntry(LOG_METH2,CT.logBuffer);
         }
 
@@ -512,7 +512,7 @@ void surfaceGraph::Traverse(TArc* pred,TArc aIn,TArc aOut) throw()
         if (CT.logMeth>1)
         {
             sprintf(CT.logBuffer,
-                "Prop of blossom %ld changes to %ld",v,bprop[b]);
+                "Prop of blossom %ld changes to %ld",(unsigned long)v,(unsigned long)bprop[b]);
             LogEntry(LOG_METH2,CT.logBuffer);
         }
 
@@ -530,7 +530,7 @@ void surfaceGraph::Expand(TArc* pred,TArc aIn,TArc aOut) throw()
 
     if (CT.logMeth>1)
     {
-        sprintf(CT.logBuffer,"Expand(%ld,%ld) started...",aIn,aOut);
+        sprintf(CT.logBuffer,"Expand(%ld,%ld) started...",(unsigned long)aIn,(unsigned long)aOut);
         LogEntry(LOG_METH2,CT.logBuffer);
         OpenFold();
     }
@@ -731,7 +731,7 @@ void surfaceGraph::ExpandAndAugment(TArc aIn,TArc aOut) throw()
 
     if (CT.logMeth>1)
     {
-        sprintf(CT.logBuffer,"pred[%ld] = %ld",v,aOut);
+        sprintf(CT.logBuffer,"pred[%ld] = %ld",(unsigned long)v,(unsigned long)aOut);
         LogEntry(LOG_METH2,CT.logBuffer);
         CloseFold();
     }
@@ -776,7 +776,7 @@ void surfaceGraph::CheckDual() throw()
         {
             Error(MSG_WARN,"ComputeEpsilon","Diverging length labels");
             sprintf(CT.logBuffer,"Arc %ld with end nodes %ld and %ld",
-                a,G.StartNode(a),G.EndNode(a));
+                (unsigned long)a,(unsigned long)G.StartNode(a),(unsigned long)G.EndNode(a));
             Error(MSG_WARN," ",CT.logBuffer);
             sprintf(CT.logBuffer,"Explicit label %g, implicit label %g",
                 ModLength(a),ret);
@@ -788,10 +788,10 @@ void surfaceGraph::CheckDual() throw()
             sprintf(CT.logBuffer,"Negative modified length: %g",ret);
             Error(MSG_WARN,"ComputeEpsilon",CT.logBuffer);
             sprintf(CT.logBuffer,"Arc %ld with end nodes %ld and %ld",
-                a,G.StartNode(a),G.EndNode(a));
+                (unsigned long)a,(unsigned long)G.StartNode(a),(unsigned long)G.EndNode(a));
             Error(MSG_WARN," ",CT.logBuffer);
             sprintf(CT.logBuffer,"Arc %ld with end nodes %ld and %ld",
-                a,StartNode(a),EndNode(a));
+                (unsigned long)a,(unsigned long)StartNode(a),(unsigned long)EndNode(a));
             InternalError1("CheckDual");
         }
     }
@@ -818,7 +818,7 @@ TArc surfaceGraph::FindSupport(TFloat* dist,TNode s,TArc a,
 
     if (CT.logMeth>1)
     {
-        sprintf(CT.logBuffer,"Q[%ld] = %ld",y^1,Q[y^1]);
+        sprintf(CT.logBuffer,"Q[%ld] = %ld",(unsigned long)(y^1),(unsigned long)Q[y^1]);
         LogEntry(LOG_METH2,CT.logBuffer);
     }
 
@@ -836,9 +836,9 @@ TArc surfaceGraph::FindSupport(TFloat* dist,TNode s,TArc a,
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"Q[%ld] = %ld",x,Q[x]);
+                sprintf(CT.logBuffer,"Q[%ld] = %ld",(unsigned long)x,(unsigned long)Q[x]);
                 LogEntry(LOG_METH2,CT.logBuffer);
-                sprintf(CT.logBuffer,"Q[%ld] = %ld",x^1,Q[x^1]);
+                sprintf(CT.logBuffer,"Q[%ld] = %ld",(unsigned long)(x^1),(unsigned long)Q[x^1]);
                 LogEntry(LOG_METH2,CT.logBuffer);
             }
 
@@ -860,9 +860,9 @@ TArc surfaceGraph::FindSupport(TFloat* dist,TNode s,TArc a,
 
             if (CT.logMeth>1)
             {
-                sprintf(CT.logBuffer,"Q[%ld] = %ld",y,Q[y]);
+                sprintf(CT.logBuffer,"Q[%ld] = %ld",(unsigned long)y,(unsigned long)Q[y]);
                 LogEntry(LOG_METH2,CT.logBuffer);
-                sprintf(CT.logBuffer,"Q[%ld] = %ld",y^1,Q[y^1]);
+                sprintf(CT.logBuffer,"Q[%ld] = %ld",(unsigned long)(y^1),(unsigned long)Q[y^1]);
                 LogEntry(LOG_METH2,CT.logBuffer);
             }
 
@@ -884,9 +884,9 @@ TArc surfaceGraph::FindSupport(TFloat* dist,TNode s,TArc a,
 
         if (CT.logMeth>1)
         {
-                sprintf(CT.logBuffer,"Q[%ld] = %ld",x,Q[x]);
+                sprintf(CT.logBuffer,"Q[%ld] = %ld",(unsigned long)x,(unsigned long)Q[x]);
                 LogEntry(LOG_METH2,CT.logBuffer);
-                sprintf(CT.logBuffer,"Q[%ld] = %ld",x^1,Q[x^1]);
+                sprintf(CT.logBuffer,"Q[%ld] = %ld",(unsigned long)(x^1),(unsigned long)Q[x^1]);
                 LogEntry(LOG_METH2,CT.logBuffer);
         }
 
@@ -899,7 +899,7 @@ TArc surfaceGraph::FindSupport(TFloat* dist,TNode s,TArc a,
 
     if (CT.logMeth>1)
     {
-        sprintf(CT.logBuffer,"Q[%ld] = %ld",x,Q[x]);
+        sprintf(CT.logBuffer,"Q[%ld] = %ld",(unsigned long)x,(unsigned long)Q[x]);
         LogEntry(LOG_METH2,CT.logBuffer);
     }
 
@@ -941,7 +941,7 @@ TFloat surfaceGraph::ComputeEpsilon(TFloat* dist) throw()
             Error(MSG_WARN,"ComputeEpsilon",CT.logBuffer);
             sprintf(CT.logBuffer,"Implicit modified length %g",RModLength(a));
             Error(MSG_WARN," ",CT.logBuffer);
-            sprintf(CT.logBuffer,"Arc %ld with end nodes %ld and %ld",a,u,v);
+            sprintf(CT.logBuffer,"Arc %ld with end nodes %ld and %ld",(unsigned long)a,(unsigned long)u,(unsigned long)v);
             InternalError1("ComputeEpsilon");
         }
 
@@ -956,7 +956,7 @@ TFloat surfaceGraph::ComputeEpsilon(TFloat* dist) throw()
                 {
                     Error(MSG_WARN,"ComputeEpsilon","No dual improvement");
                     sprintf(CT.logBuffer,"Arc %ld with end nodes %ld and %ld",
-                        a,u,v);
+                        (unsigned long)a,(unsigned long)u,(unsigned long)v);
                     InternalError1("ComputeEpsilon");
                 }
 
@@ -971,7 +971,7 @@ TFloat surfaceGraph::ComputeEpsilon(TFloat* dist) throw()
                 {
                     Error(MSG_WARN,"ComputeEpsilon","No dual improvement");
                     sprintf(CT.logBuffer,"Arc %ld with end nodes %ld and %ld",
-                        a,u,v);
+                        (unsigned long)a,(unsigned long)u,(unsigned long)v);
                     InternalError1("ComputeEpsilon");
                 }
 
@@ -1096,7 +1096,7 @@ void surfaceGraph::PrimalDual0(TNode s) throw(ERRange)
 
                 if (CT.logMeth>1)
                 {
-                    sprintf(CT.logBuffer,"Searching node %ld...",u);
+                    sprintf(CT.logBuffer,"Searching node %ld...",(unsigned long)u);
                     LogEntry(LOG_METH2,CT.logBuffer);
                     OpenFold();
                 }
@@ -1120,7 +1120,7 @@ void surfaceGraph::PrimalDual0(TNode s) throw(ERRange)
                             if (CT.logMeth>1)
                             {
                                 sprintf(CT.logBuffer,
-                                    "Prop %ld with end node %ld found",a,v);
+                                    "Prop %ld with end node %ld found",(unsigned long)a,(unsigned long)v);
                                 LogEntry(LOG_METH2,CT.logBuffer);
                             }
 
@@ -1143,7 +1143,7 @@ void surfaceGraph::PrimalDual0(TNode s) throw(ERRange)
                     if (CT.logMeth>1)
                     {
                         sprintf(CT.logBuffer,
-                            "Petal %ld with end node %ld found",a,v);
+                            "Petal %ld with end node %ld found",(unsigned long)a,(unsigned long)v);
                         LogEntry(LOG_METH2,CT.logBuffer);
                         OpenFold();
                     }
@@ -1204,7 +1204,7 @@ void surfaceGraph::PrimalDual0(TNode s) throw(ERRange)
 
                     if (CT.logMeth>1)
                     {
-                        sprintf(CT.logBuffer,"Shrinking %ld",base);
+                        sprintf(CT.logBuffer,"Shrinking %ld",(unsigned long)base);
                         LH = LogStart(LOG_METH2,CT.logBuffer);
                     }
 
@@ -1221,7 +1221,7 @@ void surfaceGraph::PrimalDual0(TNode s) throw(ERRange)
 
                         if (CT.logMeth>1)
                         {
-                            sprintf(CT.logBuffer,",%ld",y);
+                            sprintf(CT.logBuffer,",%ld",(unsigned long)y);
                             LogAppend(LH,CT.logBuffer);
                         }
 
@@ -1234,7 +1234,7 @@ void surfaceGraph::PrimalDual0(TNode s) throw(ERRange)
 
                     if (CT.logMeth>1)
                     {
-                        sprintf(CT.logBuffer," into node %ld",z);
+                        sprintf(CT.logBuffer," into node %ld",(unsigned long)z);
                         LogEnd(LH,CT.logBuffer);
                     }
 
@@ -1286,7 +1286,7 @@ void surfaceGraph::PrimalDual0(TNode s) throw(ERRange)
 
                         if (CT.logMeth>1)
                         {
-                            sprintf(CT.logBuffer,"pi[%ld] = %g",v,pi[v]);
+                            sprintf(CT.logBuffer,"pi[%ld] = %g",(unsigned long)v,pi[v]);
                             LogEntry(LOG_METH2,CT.logBuffer);
                         }
 
@@ -1331,7 +1331,7 @@ void surfaceGraph::PrimalDual0(TNode s) throw(ERRange)
 
                         if (CT.logMeth)
                         {
-                            sprintf(CT.logBuffer,"Expanding node %ld...",v);
+                            sprintf(CT.logBuffer,"Expanding node %ld...",(unsigned long)v);
                             LogEntry(LOG_METH,CT.logBuffer);
                         }
 
@@ -1383,7 +1383,7 @@ void surfaceGraph::Explore(TFloat* dist,goblinQueue<TArc,TFloat> &Q,
                 {
                     sprintf(CT.logBuffer,
                         "Arc %ld joining %ld and %ld has modified length %g",
-                        a,G.StartNode(a),G.EndNode(a),thisLength);
+                        (unsigned long)a,(unsigned long)G.StartNode(a),(unsigned long)G.EndNode(a),thisLength);
                     InternalError1("Explore");
                 }
             }
@@ -1434,7 +1434,7 @@ TFloat surfaceGraph::ComputeEpsilon1(TFloat* dist) throw()
                     Error(MSG_WARN,"ComputeEpsilon1",
                         "Reduced cost labels are corrupted");
                     sprintf(CT.logBuffer,"Arc %ld with end nodes %ld and %ld",
-                        a,u,v);
+                        (unsigned long)a,(unsigned long)u,(unsigned long)v);
                     Error(MSG_WARN," ",CT.logBuffer);
                     sprintf(CT.logBuffer,"Modified length labels %g and %g",
                         ModLength(a),RModLength(a));
@@ -1453,7 +1453,7 @@ TFloat surfaceGraph::ComputeEpsilon1(TFloat* dist) throw()
                     Error(MSG_WARN,"ComputeEpsilon1",
                         "Reduced cost labels are corrupted");
                     sprintf(CT.logBuffer,"Arc %ld with end nodes %ld and %ld",
-                        a,u,v);
+                        (unsigned long)a,(unsigned long)u,(unsigned long)v);
                     Error(MSG_WARN," ",CT.logBuffer);
                     sprintf(CT.logBuffer,"Modified length labels %g and %g",
                         ModLength(a),RModLength(a));
@@ -1592,7 +1592,7 @@ void surfaceGraph::PrimalDual1(TNode s) throw(ERRange)
                         {
                             sprintf(CT.logBuffer,
                                 "Prop %ld with end nodes %ld and %ld found",
-                                a,u,v);
+                                (unsigned long)a,(unsigned long)u,(unsigned long)v);
                             LogEntry(LOG_METH2,CT.logBuffer);
                         }
 
@@ -1615,7 +1615,7 @@ void surfaceGraph::PrimalDual1(TNode s) throw(ERRange)
                 {
                     sprintf(CT.logBuffer,
                         "Petal %ld with end nodes %ld and %ld found",
-                        a,u,v);
+                        (unsigned long)a,(unsigned long)u,(unsigned long)v);
                     LogEntry(LOG_METH2,CT.logBuffer);
                     OpenFold();
                 }
@@ -1670,7 +1670,7 @@ void surfaceGraph::PrimalDual1(TNode s) throw(ERRange)
 
                 if (CT.logMeth>1)
                 {
-                    sprintf(CT.logBuffer,"Shrinking %ld",base);
+                    sprintf(CT.logBuffer,"Shrinking %ld",(unsigned long)base);
                     LH = LogStart(LOG_METH2,CT.logBuffer);
                 }
 
@@ -1688,7 +1688,7 @@ void surfaceGraph::PrimalDual1(TNode s) throw(ERRange)
 
                     if (CT.logMeth>1)
                     {
-                        sprintf(CT.logBuffer,",%ld",y);
+                        sprintf(CT.logBuffer,",%ld",(unsigned long)y);
                         LogAppend(LH,CT.logBuffer);
                     }
 
@@ -1703,7 +1703,7 @@ void surfaceGraph::PrimalDual1(TNode s) throw(ERRange)
 
                 if (CT.logMeth>1)
                 {
-                    sprintf(CT.logBuffer," into node %ld",z);
+                    sprintf(CT.logBuffer," into node %ld",(unsigned long)z);
                     LogEnd(LH,CT.logBuffer);
                 }
 
@@ -1784,7 +1784,7 @@ void surfaceGraph::PrimalDual1(TNode s) throw(ERRange)
 
                         if (CT.logMeth>1)
                         {
-                            sprintf(CT.logBuffer,"pi[%ld] = %g",v,pi[v]);
+                            sprintf(CT.logBuffer,"pi[%ld] = %g",(unsigned long)v,pi[v]);
                             LogEntry(LOG_METH2,CT.logBuffer);
                         }
 
@@ -1843,7 +1843,7 @@ void surfaceGraph::PrimalDual1(TNode s) throw(ERRange)
 
                         if (CT.logMeth)
                         {
-                            sprintf(CT.logBuffer,"Expanding node %ld...",v);
+                            sprintf(CT.logBuffer,"Expanding node %ld...",(unsigned long)v);
                             LogEntry(LOG_METH,CT.logBuffer);
                         }
 
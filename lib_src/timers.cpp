@@ -11,11 +11,21 @@
 /// \brief  #goblinTimer class implementation
 
 #include "timers.h"
+#include "goblinController.h"
 
 
 #if defined(_TIMERS_)
 
 
+const char* goblinTimer::counterName[goblinTimer::NoCounter] =
+{
+    "Push operations",
+    "Relabel operations",
+    "Global relabels",
+    "Gap relabels"
+};
+
+
 goblinTimer::goblinTimer(goblinTimer** thisGlobalTimer) throw()
 {
     clockTick = sysconf(_SC_CLK_TCK)/double(1000);
@@ -49,12 +59,17 @@ void goblinTimer::Reset() throw(ERRejected)
     nRounds = 0;
     nestingDepth = 0;
 
+    for (unsigned i=0;i<NoCounter;i++) opCounter[i] = 0;
+
     ResetBounds();
 }
 
 
 bool goblinTimer::Enable() throw()
 {
+    // Timers are not maintained by the worker threads of parallel solver methods
+    if (goblinController::WorkerThread()) return false;
+
     if (nestingDepth==0)
     {
         enabled = true;
@@ -73,6 +88,8 @@ bool goblinTimer::Enable() throw()
 
         progressCounter = 0;
         maxCounter = 0;
+
+        for (unsigned i=0;i<NoCounter;i++) opCounter[i] = 0;
     }
 
     nestingDepth++;
@@ -83,6 +100,8 @@ bool goblinTimer::Enable() throw()
 
 bool goblinTimer::Disable() throw()
 {
+    if (goblinController::WorkerThread()) return false;
+
     if (nestingDepth>0)
     {
         nestingDepth--;
@@ -0,0 +1,375 @@
+
+//  This file forms part of the GOBLIN C++ Class Library.
+//
+//  Initially written by the GOBLIN developers, October 2026
+//
+//  Copying, compiling, distribution and modification
+//  of this source code is permitted only in accordance
+//  with the GOBLIN general licence information.
+
+/// \file   twoLevelTour.cpp
+/// \brief  #twoLevelTour class implementation
+
+#include "twoLevelTour.h"
+
+
+twoLevelTour::twoLevelTour(TNode nn,goblinController& thisContext)
+    throw() : managedObject(thisContext)
+{
+    n = nn;
+    nSeg = nFree = 0;
+    reversed = false;
+
+    segTarget = TNode(sqrt(double(n)));
+    if (segTarget<1) segTarget = 1;
+
+    seg      = new TNode[n];
+    id       = new TNode[n];
+    next     = new TNode[n];
+    prev     = new TNode[n];
+
+    segFirst = new TNode[n];
+    segLast  = new TNode[n];
+    segSize  = new TNode[n];
+    segRev   = new char[n];
+    segNext  = new TNode[n];
+    segPrev  = new TNode[n];
+    segRank  = new TNode[n];
+    segFree  = new TNode[n];
+
+    buffer   = new TNode[n];
+
+    LogEntry(LOG_MEM,"...Two-level tour allocated");
+}
+
+
+twoLevelTour::~twoLevelTour() throw()
+{
+    delete[] seg;
+    delete[] id;
+    delete[] next;
+    delete[] prev;
+
+    delete[] segFirst;
+    delete[] segLast;
+    delete[] segSize;
+    delete[] segRev;
+    delete[] segNext;
+    delete[] segPrev;
+    delete[] segRank;
+    delete[] segFree;
+
+    delete[] buffer;
+
+    LogEntry(LOG_MEM,"...Two-level tour disallocated");
+}
+
+
+unsigned long twoLevelTour::Size() const throw()
+{
+    return
+          sizeof(twoLevelTour)
+        + managedObject::Allocated()
+        + twoLevelTour::Allocated();
+}
+
+
+unsigned long twoLevelTour::Allocated() const throw()
+{
+    return n*(13*sizeof(TNode)+sizeof(char));
+}
+
+
+void twoLevelTour::Init(const TNode* order) throw(ERRejected)
+{
+    for (TNode v=0;v<n;v++) seg[v] = NoNode;
+
+    reversed = false;
+    nSeg = 0;
+
+    TNode s = NoNode;
+    TNode last = NoNode;
+
+    for (TNode i=0;i<n;i++)
+    {
+        TNode v = order[i];
+
+        #if defined(_FAILSAVE_)
+
+        if (v>=n || seg[v]!=NoNode)
+            Error(ERR_REJECTED,"Init","Not a permutation");
+
+        #endif
+
+        if (i%segTarget==0)
+        {
+            s = nSeg++;
+            segFirst[s] = v;
+            segSize[s] = 0;
+            segRev[s] = 0;
+            prev[v] = NoNode;
+        }
+        else
+        {
+            next[last] = v;
+            prev[v] = last;
+        }
+
+        seg[v] = s;
+        id[v] = i;
+        next[v] = NoNode;
+        segLast[s] = v;
+        segSize[s]++;
+        last = v;
+    }
+
+    for (s=0;s<nSeg;s++)
+    {
+        segNext[s] = (s+1)%nSeg;
+        segPrev[s] = (s+nSeg-1)%nSeg;
+        segRank[s] = s;
+    }
+
+    nFree = 0;
+
+    for (s=n;s>nSeg;) segFree[nFree++] = --s;
+}
+
+
+TNode twoLevelTour::SegSucc(TNode v) const throw()
+{
+    TNode s = seg[v];
+    TNode w = (segRev[s]) ? prev[v] : next[v];
+
+    if (w!=NoNode) return w;
+
+    TNode t = segNext[s];
+
+    return (segRev[t]) ? segLast[t] : segFirst[t];
+}
+
+
+TNode twoLevelTour::SegPred(TNode v) const throw()
+{
+    TNode s = seg[v];
+    TNode w = (segRev[s]) ? next[v] : prev[v];
+
+    if (w!=NoNode) return w;
+
+    TNode t = segPrev[s];
+
+    return (segRev[t]) ? segFirst[t] : segLast[t];
+}
+
+
+TNode twoLevelTour::Next(TNode v) const throw()
+{
+    return (reversed) ? SegPred(v) : SegSucc(v);
+}
+
+
+TNode twoLevelTour::Prev(TNode v) const throw()
+{
+    return (reversed) ? SegSucc(v) : SegPred(v);
+}
+
+
+bool twoLevelTour::SegPrecedes(TNode u,TNode v) const throw()
+{
+    TNode su = seg[u];
+    TNode sv = seg[v];
+
+    if (su!=sv) return (segRank[su]<segRank[sv]);
+
+    return (segRev[su]) ? (id[u]>id[v]) : (id[u]<id[v]);
+}
+
+
+bool twoLevelTour::SegBetween(TNode a,TNode b,TNode c) const throw()
+{
+    if (!SegPrecedes(c,a))
+        return (!SegPrecedes(b,a) && !SegPrecedes(c,b));
+
+    return (!SegPrecedes(b,a) || !SegPrecedes(c,b));
+}
+
+
+bool twoLevelTour::Between(TNode a,TNode b,TNode c) const throw()
+{
+    return (reversed) ? SegBetween(c,b,a) : SegBetween(a,b,c);
+}
+
+
+void twoLevelTour::Split(TNode s,TNode u) throw()
+{
+    // Split segment s between u and next[u]. The smaller part is moved
+    // to a new segment, so that the node indices need not be updated
+
+    TNode w = next[u];
+    TNode sizeA = id[u]-id[segFirst[s]]+1;
+    TNode sizeB = segSize[s]-sizeA;
+    TNode t = segFree[--nFree];
+    bool tIsPrefix = (sizeA<=sizeB);
+
+    next[u] = NoNode;
+    prev[w] = NoNode;
+    segRev[t] = segRev[s];
+
+    if (tIsPrefix)
+    {
+        segFirst[t] = segFirst[s];
+        segLast[t] = u;
+        segSize[t] = sizeA;
+        segFirst[s] = w;
+        segSize[s] = sizeB;
+    }
+    else
+    {
+        segFirst[t] = w;
+        segLast[t] = segLast[s];
+        segSize[t] = sizeB;
+        segLast[s] = u;
+        segSize[s] = sizeA;
+    }
+
+    for (TNode x=segFirst[t];x!=NoNode;x=next[x]) seg[x] = t;
+
+    if (tIsPrefix==!segRev[s])
+    {
+        // Insert t before s
+        TNode p = segPrev[s];
+        segNext[p] = t;
+        segPrev[t] = p;
+        segNext[t] = s;
+        segPrev[s] = t;
+    }
+    else
+    {
+        // Insert t after s
+        TNode q = segNext[s];
+        segPrev[q] = t;
+        segNext[t] = q;
+        segPrev[t] = s;
+        segNext[s] = t;
+    }
+
+    nSeg++;
+}
+
+
+void twoLevelTour::SplitBefore(TNode v) throw()
+{
+    TNode s = seg[v];
+
+    if (!segRev[s])
+    {
+        if (prev[v]!=NoNode) Split(s,prev[v]);
+    }
+    else
+    {
+        if (next[v]!=NoNode) Split(s,v);
+    }
+}
+
+
+void twoLevelTour::ReverseSegments(TNode s1,TNode s2) throw()
+{
+    TNode before = segPrev[s1];
+    TNode after = segNext[s2];
+    TNode s = s1;
+
+    while (true)
+    {
+        TNode sNext = segNext[s];
+        segNext[s] = segPrev[s];
+        segPrev[s] = sNext;
+        segRev[s] ^= 1;
+
+        if (s==s2) break;
+
+        s = sNext;
+    }
+
+    segNext[before] = s2;
+    segPrev[s2] = before;
+    segNext[s1] = after;
+    segPrev[after] = s1;
+}
+
+
+void twoLevelTour::UpdateRanks() throw()
+{
+    TNode s0 = seg[0];
+    TNode s = s0;
+    TNode r = 0;
+
+    do
+    {
+        segRank[s] = r++;
+        s = segNext[s];
+    }
+    while (s!=s0);
+}
+
+
+void twoLevelTour::ReverseSegPath(TNode a,TNode b) throw()
+{
+    if (a==b) return;
+
+    if (SegSucc(b)==a)
+    {
+        reversed = !reversed;
+        return;
+    }
+
+    // Let the path start and end at segment boundaries
+    TNode c = SegSucc(b);
+    SplitBefore(a);
+    SplitBefore(c);
+    UpdateRanks();
+
+    TNode sa = seg[a];
+    TNode sb = seg[b];
+    TNode k = (segRank[sb]+nSeg-segRank[sa])%nSeg+1;
+
+    if (2*k<=nSeg)
+    {
+        ReverseSegments(sa,sb);
+    }
+    else
+    {
+        // Reversing the complementary path is equivalent up to orientation
+        ReverseSegments(seg[c],segPrev[sa]);
+        reversed = !reversed;
+    }
+
+    if (nSeg>2*((n-1)/segTarget+1))
+    {
+        Rebalance();
+    }
+    else UpdateRanks();
+}
+
+
+void twoLevelTour::Reverse(TNode a,TNode b) throw()
+{
+    if (reversed)
+    {
+        ReverseSegPath(b,a);
+    }
+    else ReverseSegPath(a,b);
+}
+
+
+void twoLevelTour::Rebalance() throw()
+{
+    TNode v = 0;
+
+    for (TNode i=0;i<n;i++)
+    {
+        buffer[i] = v;
+        v = Next(v);
+    }
+
+    Init(buffer);
+}
@@ -0,0 +1,1004 @@
+
+//  This file forms part of the GOBLIN C++ Class Library.
+//
+//  Initially written by the GOBLIN developers, October 2026
+//
+//  Copying, compiling, distribution and modification
+//  of this source code is permitted only in accordance
+//  with the GOBLIN general licence information.
+
+/// \file weightedBlossom.cpp
+/// \brief Native primal-dual blossom method for minimum cost perfect matching
+
+#include "abstractGraph.h"
+#include <vector>
+#include <algorithm>
+
+
+/// \brief  Event of an alternating tree search
+///
+/// The key is the value of the dual offset at which the edge or the blossom
+/// becomes tight. The ordering is reversed so that the standard heap
+/// functions provide the minimum key.
+
+struct TBlossomEvent
+{
+    TFloat  key;
+    TArc    index;  // An arc index, or a blossom index for EVENT_EXPAND
+    char    type;
+
+    bool operator<(const TBlossomEvent& other) const {return key>other.key;};
+};
+
+
+/// \brief  Edmonds' blossom method working on plain arrays
+///
+/// Nodes are indexed 0,1,..,n-1, and the blossoms n,n+1,..,2n-1. An arc
+/// index 2a or 2a+1 refers to the original edge a and an orientation, so that
+/// arc^1 is the reverse arc. The arc mate[v] points from the mate of v to v,
+/// and labelArc[b] points from the tree parent into the blossom b. For a
+/// non-trivial blossom b, the arc childArc[b][i] leads from the sub-blossom
+/// child[b][i] to the cyclic successor, and child[b][0] contains the base.
+///
+/// Every exposed node is the root of an alternating tree, identified by the
+/// root node index. All trees share the same dual offset delta, and the dual
+/// variables of the tree nodes and blossoms are not updated explicitly: A node
+/// which has been labeled at the offset t holds its stored dual value plus or
+/// minus (delta-t). When two trees are joined by a tight edge, the matching is
+/// augmented and only these two trees are dissolved.
+
+class blossomMatching : public managedObject
+{
+private:
+
+    abstractGraph&  G;
+
+    TNode       n;
+    TArc        m;
+
+    TArc*       first;      // Positions of the arcs by start nodes
+    TArc*       adjArc;     // Arcs sorted by start nodes
+    TNode*      head;       // End nodes of all arcs
+    TFloat*     cost;       // Edge lengths
+
+    TArc*       mate;
+    TNode*      inBlossom;  // Top-level blossom of every node
+    TNode*      parent;     // Enclosing blossoms, or NoNode for top-level blossoms
+    TNode*      base;
+    char*       label;      // One of LABEL_NONE, LABEL_EVEN, LABEL_ODD
+    TArc*       labelArc;
+    TNode*      tree;       // Root nodes of the labeled blossoms
+    TNode*      mark;       // Time stamps for the search for a common ancestor
+    TNode       markStamp;
+
+    std::vector<TNode>*  child;
+    std::vector<TArc>*   childArc;
+    TNode*      freeBlossom;
+    TNode       nFree;
+
+    TFloat*     y;          // Node potentials
+    TFloat*     yTime;
+    signed char*    ySign;
+    TFloat*     z;          // Blossom potentials
+    TFloat*     zTime;
+    signed char*    zSign;
+
+    TFloat      delta;      // Dual offset
+    TFloat      epsilon;
+
+    std::vector<TBlossomEvent>  Q;
+    std::vector<TNode>* member; // Labeled blossoms of every tree, possibly outdated
+    std::vector<TNode>  leaves;
+
+    unsigned long   nShrink;
+    unsigned long   nExpand;
+    unsigned long   nAugment;
+
+public:
+
+    enum {LABEL_NONE = 0, LABEL_EVEN = 1, LABEL_ODD = 2};
+    enum {EVENT_GROW = 0, EVENT_EVEN = 1, EVENT_EXPAND = 2};
+
+    blossomMatching(abstractGraph& GC) throw();
+    ~blossomMatching() throw();
+
+    unsigned long   Size() const throw() {return 0;};
+
+    TNode   GreedyStart() throw();
+    bool    Solve() throw();
+    TFloat  ExportMatching() throw();
+
+private:
+
+    TNode   Tail(TArc a) const throw() {return head[a^1];};
+    TFloat  Y(TNode v) const throw()
+                {return y[v]+ySign[v]*(delta-yTime[v]);};
+    TFloat  Z(TNode b) const throw()
+                {return z[b-n]+zSign[b-n]*(delta-zTime[b-n]);};
+    TFloat  Slack(TArc a) const throw()
+                {return cost[a>>1]-Y(head[a])-Y(head[a^1]);};
+
+    void    SetYSign(TNode v,signed char sign) throw();
+    void    SetZSign(TNode b,signed char sign) throw();
+    void    CollectLeaves(TNode b,std::vector<TNode>& list) throw();
+    void    PushEvent(TFloat key,TArc index,char type) throw();
+
+    void    Scan(TNode v) throw();
+    void    AssignEven(TNode b,TArc a,TNode r) throw();
+    void    AssignOdd(TNode b,TArc a,TNode r,bool labelMate) throw();
+    TNode   FindCommonBase(TNode v,TNode w) throw();
+    void    Shrink(TNode b0,TArc a) throw();
+    void    ExpandOdd(TNode b) throw();
+    void    ExpandZero(TNode b) throw();
+    void    AugmentBlossom(TNode b,TNode v) throw();
+    void    Augment(TArc a) throw();
+    void    Dissolve(TNode r) throw();
+
+};
+
+
+blossomMatching::blossomMatching(abstractGraph& GC) throw() :
+    managedObject(GC.Context()), G(GC), n(GC.N()), m(GC.M())
+{
+    first  = new TArc[n+1];
+    adjArc = new TArc[2*m];
+    head   = new TNode[2*m];
+    cost   = new TFloat[m];
+
+    // Sort the arcs by their start nodes. Loops and edges with zero
+    // capacity are omitted
+
+    for (TNode v=0;v<=n;v++) first[v] = 0;
+
+    for (TArc a=0;a<m;a++)
+    {
+        TNode u = G.StartNode(2*a);
+        TNode v = G.EndNode(2*a);
+
+        head[2*a] = v;
+        head[2*a+1] = u;
+        cost[a] = G.Length(2*a);
+
+        if (u==v || G.UCap(2*a)<1) continue;
+
+        first[u+1]++;
+        first[v+1]++;
+    }
+
+    for (TNode v=0;v<n;v++) first[v+1] += first[v];
+
+    for (TArc a=0;a<m;a++)
+    {
+        TNode u = head[2*a+1];
+        TNode v = head[2*a];
+
+        if (u==v || G.UCap(2*a)<1) continue;
+
+        adjArc[first[u]++] = 2*a;
+        adjArc[first[v]++] = 2*a+1;
+    }
+
+    for (TNode v=n;v>0;v--) first[v] = first[v-1];
+
+    first[0] = 0;
+
+    mate      = new TArc[n];
+    inBlossom = new TNode[n];
+    parent    = new TNode[2*n];
+    base      = new TNode[2*n];
+    label     = new char[2*n];
+    labelArc  = new TArc[2*n];
+    tree      = new TNode[2*n];
+    mark      = new TNode[2*n];
+    child     = new std::vector<TNode>[n];
+    childArc  = new std::vector<TArc>[n];
+    freeBlossom = new TNode[n];
+    member    = new std::vector<TNode>[n];
+
+    y     = new TFloat[n];
+    yTime = new TFloat[n];
+    ySign = new signed char[n];
+    z     = new TFloat[n];
+    zTime = new TFloat[n];
+    zSign = new signed char[n];
+
+    for (TNode v=0;v<n;v++)
+    {
+        mate[v] = NoArc;
+        inBlossom[v] = v;
+        y[v] = yTime[v] = 0;
+        ySign[v] = 0;
+        z[v] = zTime[v] = 0;
+        zSign[v] = 0;
+        freeBlossom[v] = 2*n-1-v;
+    }
+
+    for (TNode b=0;b<2*n;b++)
+    {
+        parent[b] = NoNode;
+        base[b] = (b<n) ? b : NoNode;
+        label[b] = LABEL_NONE;
+        labelArc[b] = NoArc;
+        tree[b] = NoNode;
+        mark[b] = 0;
+    }
+
+    nFree = n;
+    markStamp = 0;
+    delta = 0;
+    epsilon = CT.epsilon;
+    nShrink = nExpand = nAugment = 0;
+}
+
+
+blossomMatching::~blossomMatching() throw()
+{
+    delete[] first;
+    delete[] adjArc;
+    delete[] head;
+    delete[] cost;
+    delete[] mate;
+    delete[] inBlossom;
+    delete[] parent;
+    delete[] base;
+    delete[] label;
+    delete[] labelArc;
+    delete[] tree;
+    delete[] mark;
+    delete[] child;
+    delete[] childArc;
+    delete[] freeBlossom;
+    delete[] member;
+    delete[] y;
+    delete[] yTime;
+    delete[] ySign;
+    delete[] z;
+    delete[] zTime;
+    delete[] zSign;
+}
+
+
+TNode blossomMatching::GreedyStart() throw()
+{
+    // Start with the half edge lengths as node potentials. Then raise every
+    // node potential up to the first tight edge, and match the node along
+    // this edge if the other end node is still exposed
+
+    for (TNode v=0;v<n;v++)
+    {
+        y[v] = InfFloat;
+
+        for (TArc i=first[v];i<first[v+1];i++)
+        {
+            TFloat thisCost = cost[adjArc[i]>>1]/2;
+
+            if (thisCost<y[v]) y[v] = thisCost;
+        }
+
+        if (y[v]==InfFloat) y[v] = 0;
+    }
+
+    TNode nMatched = 0;
+
+    for (TNode v=0;v<n;v++)
+    {
+        TFloat minSlack = InfFloat;
+        TArc tightArc = NoArc;
+
+        for (TArc i=first[v];i<first[v+1];i++)
+        {
+            TArc a = adjArc[i];
+            TFloat thisSlack = Slack(a);
+
+            if (   thisSlack<minSlack-epsilon
+                || (thisSlack<minSlack+epsilon && tightArc!=NoArc
+                    && mate[head[tightArc]]!=NoArc && mate[head[a]]==NoArc)
+               )
+            {
+                minSlack = thisSlack;
+                tightArc = a;
+            }
+        }
+
+        if (tightArc==NoArc) continue;
+
+        y[v] += minSlack;
+
+        TNode w = head[tightArc];
+
+        if (mate[v]==NoArc && mate[w]==NoArc)
+        {
+            mate[w] = tightArc;
+            mate[v] = tightArc^1;
+            nMatched += 2;
+        }
+    }
+
+    return nMatched;
+}
+
+
+void blossomMatching::SetYSign(TNode v,signed char sign) throw()
+{
+    y[v] = Y(v);
+    yTime[v] = delta;
+    ySign[v] = sign;
+}
+
+
+void blossomMatching::SetZSign(TNode b,signed char sign) throw()
+{
+    z[b-n] = Z(b);
+    zTime[b-n] = delta;
+    zSign[b-n] = sign;
+}
+
+
+void blossomMatching::CollectLeaves(TNode b,std::vector<TNode>& list) throw()
+{
+    list.clear();
+
+    if (b<n)
+    {
+        list.push_back(b);
+        return;
+    }
+
+    // Use the list itself as the stack of non-trivial sub-blossoms, which are
+    // replaced by their nodes in a second pass
+
+    std::vector<TNode> stack(1,b);
+
+    while (!stack.empty())
+    {
+        TNode c = stack.back();
+        stack.pop_back();
+
+        std::vector<TNode>& thisChild = child[c-n];
+
+        for (size_t i=0;i<thisChild.size();i++)
+        {
+            if (thisChild[i]<n) list.push_back(thisChild[i]);
+            else stack.push_back(thisChild[i]);
+        }
+    }
+}
+
+
+void blossomMatching::PushEvent(TFloat key,TArc index,char type) throw()
+{
+    TBlossomEvent thisEvent;
+    thisEvent.key = key;
+    thisEvent.index = index;
+    thisEvent.type = type;
+
+    Q.push_back(thisEvent);
+    std::push_heap(Q.begin(),Q.end());
+}
+
+
+void blossomMatching::Scan(TNode v) throw()
+{
+    TNode bv = inBlossom[v];
+
+    for (TArc i=first[v];i<first[v+1];i++)
+    {
+        TArc a = adjArc[i];
+        TNode bu = inBlossom[head[a]];
+
+        if (bu==bv) continue;
+
+        if (label[bu]==LABEL_EVEN)
+        {
+            PushEvent(delta+Slack(a)/2,a,EVENT_EVEN);
+        }
+        else if (label[bu]==LABEL_NONE)
+        {
+            PushEvent(delta+Slack(a),a,EVENT_GROW);
+        }
+    }
+}
+
+
+void blossomMatching::AssignEven(TNode b,TArc a,TNode r) throw()
+{
+    label[b] = LABEL_EVEN;
+    labelArc[b] = a;
+    tree[b] = r;
+    member[r].push_back(b);
+
+    if (b>=n) SetZSign(b,2);
+
+    CollectLeaves(b,leaves);
+
+    for (size_t i=0;i<leaves.size();i++)
+    {
+        SetYSign(leaves[i],1);
+        Scan(leaves[i]);
+    }
+}
+
+
+void blossomMatching::AssignOdd(TNode b,TArc a,TNode r,bool labelMate) throw()
+{
+    label[b] = LABEL_ODD;
+    labelArc[b] = a;
+    tree[b] = r;
+    member[r].push_back(b);
+
+    CollectLeaves(b,leaves);
+
+    for (size_t i=0;i<leaves.size();i++) SetYSign(leaves[i],-1);
+
+    if (b>=n)
+    {
+        SetZSign(b,-2);
+        PushEvent(delta+Z(b)/2,b,EVENT_EXPAND);
+    }
+
+    if (!labelMate) return;
+
+    TArc aMate = mate[base[b]];
+    AssignEven(inBlossom[Tail(aMate)],aMate^1,r);
+}
+
+
+TNode blossomMatching::FindCommonBase(TNode v,TNode w) throw()
+{
+    // Trace back from v and w alternately, until a blossom is reached
+    // for the second time
+
+    markStamp++;
+    TNode commonBase = NoNode;
+
+    while (v!=NoNode || w!=NoNode)
+    {
+        TNode b = inBlossom[v];
+
+        if (mark[b]==markStamp)
+        {
+            commonBase = base[b];
+            break;
+        }
+
+        mark[b] = markStamp;
+
+        if (labelArc[b]==NoArc) v = NoNode;
+        else
+        {
+            b = inBlossom[Tail(labelArc[b])];
+            v = Tail(labelArc[b]);
+        }
+
+        if (w!=NoNode)
+        {
+            TNode swap = v;
+            v = w;
+            w = swap;
+        }
+    }
+
+    return commonBase;
+}
+
+
+void blossomMatching::Shrink(TNode b0,TArc a) throw()
+{
+    TNode bb = inBlossom[b0];
+    TNode bv = inBlossom[Tail(a)];
+    TNode bw = inBlossom[head[a]];
+    TNode b = freeBlossom[--nFree];
+
+    base[b] = b0;
+    parent[b] = NoNode;
+    parent[bb] = b;
+
+    std::vector<TNode>& path = child[b-n];
+    std::vector<TArc>& pathArc = childArc[b-n];
+    path.clear();
+    pathArc.clear();
+
+    while (bv!=bb)
+    {
+        parent[bv] = b;
+        path.push_back(bv);
+        pathArc.push_back(labelArc[bv]);
+        bv = inBlossom[Tail(labelArc[bv])];
+    }
+
+    path.push_back(bb);
+    std::reverse(path.begin(),path.end());
+    std::reverse(pathArc.begin(),pathArc.end());
+    pathArc.push_back(a);
+
+    while (bw!=bb)
+    {
+        parent[bw] = b;
+        path.push_back(bw);
+        pathArc.push_back(labelArc[bw]^1);
+        bw = inBlossom[Tail(labelArc[bw])];
+    }
+
+    // The sub-blossom potentials become constant. The nodes of the odd
+    // sub-blossoms become even and must be scanned
+
+    for (size_t i=0;i<path.size();i++)
+    {
+        if (path[i]>=n) SetZSign(path[i],0);
+    }
+
+    label[b] = LABEL_EVEN;
+    labelArc[b] = labelArc[bb];
+    z[b-n] = 0;
+    zTime[b-n] = delta;
+    zSign[b-n] = 2;
+    tree[b] = tree[bb];
+    member[tree[b]].push_back(b);
+
+    std::vector<TNode> list;
+    std::vector<TNode> scanList;
+    CollectLeaves(b,list);
+
+    for (size_t i=0;i<list.size();i++)
+    {
+        TNode v = list[i];
+
+        if (label[inBlossom[v]]==LABEL_ODD)
+        {
+            SetYSign(v,1);
+            scanList.push_back(v);
+        }
+
+        inBlossom[v] = b;
+    }
+
+    for (size_t i=0;i<scanList.size();i++) Scan(scanList[i]);
+
+    nShrink++;
+}
+
+
+void blossomMatching::ExpandOdd(TNode b) throw()
+{
+    std::vector<TNode> path = child[b-n];
+    std::vector<TArc> pathArc = childArc[b-n];
+    long k = path.size();
+
+    for (long i=0;i<k;i++)
+    {
+        TNode c = path[i];
+        parent[c] = NoNode;
+        label[c] = LABEL_NONE;
+        tree[c] = NoNode;
+
+        if (c<n)
+        {
+            inBlossom[c] = c;
+            continue;
+        }
+
+        CollectLeaves(c,leaves);
+
+        for (size_t l=0;l<leaves.size();l++) inBlossom[leaves[l]] = c;
+    }
+
+    // Relabel the sub-blossoms on the even length path from the entry
+    // sub-blossom to the base sub-blossom
+
+    TNode entryChild = inBlossom[head[labelArc[b]]];
+    long j = std::find(path.begin(),path.end(),entryChild)-path.begin();
+    long jStep = -1;
+    TArc trick = 1;
+
+    if (j & 1)
+    {
+        j -= k;
+        jStep = 1;
+        trick = 0;
+    }
+
+    TArc a = labelArc[b];
+    TNode r = tree[b];
+
+    while (j!=0)
+    {
+        AssignOdd(inBlossom[head[a]],a,r,true);
+        j += jStep;
+        a = pathArc[((j-long(trick))%k+k)%k]^trick;
+        j += jStep;
+    }
+
+    AssignOdd(path[0],a,r,false);
+
+    // The remaining sub-blossoms become unlabeled. Their edges to even
+    // nodes must be reconsidered
+
+    j += jStep;
+
+    while (path[(j%k+k)%k]!=entryChild)
+    {
+        TNode c = path[(j%k+k)%k];
+        std::vector<TNode> list;
+        CollectLeaves(c,list);
+
+        for (size_t l=0;l<list.size();l++) SetYSign(list[l],0);
+
+        for (size_t l=0;l<list.size();l++)
+        {
+            TNode v = list[l];
+
+            for (TArc i=first[v];i<first[v+1];i++)
+            {
+                TArc a2 = adjArc[i];
+
+                if (label[inBlossom[head[a2]]]==LABEL_EVEN)
+                {
+                    PushEvent(delta+Slack(a2),a2^1,EVENT_GROW);
+                }
+            }
+        }
+
+        j += jStep;
+    }
+
+    SetZSign(b,0);
+    label[b] = LABEL_NONE;
+    tree[b] = NoNode;
+    base[b] = NoNode;
+    child[b-n].clear();
+    childArc[b-n].clear();
+    freeBlossom[nFree++] = b;
+
+    nExpand++;
+}
+
+
+void blossomMatching::ExpandZero(TNode b) throw()
+{
+    std::vector<TNode> path;
+    path.swap(child[b-n]);
+
+    for (size_t i=0;i<path.size();i++)
+    {
+        TNode c = path[i];
+        parent[c] = NoNode;
+        label[c] = LABEL_NONE;
+        tree[c] = NoNode;
+
+        if (c<n) inBlossom[c] = c;
+        else if (Z(c)<=epsilon) ExpandZero(c);
+        else
+        {
+            CollectLeaves(c,leaves);
+
+            for (size_t l=0;l<leaves.size();l++) inBlossom[leaves[l]] = c;
+        }
+    }
+
+    label[b] = LABEL_NONE;
+    base[b] = NoNode;
+    childArc[b-n].clear();
+    freeBlossom[nFree++] = b;
+}
+
+
+void blossomMatching::AugmentBlossom(TNode b,TNode v) throw()
+{
+    // Rotate the blossom b so that v becomes the base node, and flip the
+    // matched and unmatched edges on the even length path to the old base
+
+    TNode t = v;
+
+    while (parent[t]!=b) t = parent[t];
+
+    if (t>=n) AugmentBlossom(t,v);
+
+    std::vector<TNode>& path = child[b-n];
+    std::vector<TArc>& pathArc = childArc[b-n];
+    long k = path.size();
+    long i = std::find(path.begin(),path.end(),t)-path.begin();
+    long j = i;
+    long jStep = -1;
+    TArc trick = 1;
+
+    if (i & 1)
+    {
+        j -= k;
+        jStep = 1;
+        trick = 0;
+    }
+
+    while (j!=0)
+    {
+        j += jStep;
+        t = path[(j%k+k)%k];
+        TArc a = pathArc[((j-long(trick))%k+k)%k]^trick;
+
+        if (t>=n) AugmentBlossom(t,Tail(a));
+
+        j += jStep;
+        t = path[(j%k+k)%k];
+
+        if (t>=n) AugmentBlossom(t,head[a]);
+
+        mate[Tail(a)] = a^1;
+        mate[head[a]] = a;
+    }
+
+    std::rotate(path.begin(),path.begin()+i,path.end());
+    std::rotate(pathArc.begin(),pathArc.begin()+i,pathArc.end());
+    base[b] = base[path[0]];
+}
+
+
+void blossomMatching::Augment(TArc a) throw()
+{
+    // Flip the matched and unmatched edges on the paths from both end nodes
+    // of a to the respective tree roots
+
+    for (int side=0;side<2;side++)
+    {
+        TNode s = (side==0) ? Tail(a) : head[a];
+        TArc p = (side==0) ? (a^1) : a;
+
+        while (true)
+        {
+            TNode bs = inBlossom[s];
+
+            if (bs>=n) AugmentBlossom(bs,s);
+
+            mate[s] = p;
+
+            if (labelArc[bs]==NoArc) break;
+
+            TNode bt = inBlossom[Tail(labelArc[bs])];
+            TArc at = labelArc[bt];
+            TNode j = head[at];
+
+            s = Tail(at);
+
+            if (bt>=n) AugmentBlossom(bt,j);
+
+            mate[j] = at;
+            p = at^1;
+        }
+    }
+
+    nAugment++;
+}
+
+
+void blossomMatching::Dissolve(TNode r) throw()
+{
+    std::vector<TNode> list;
+    list.swap(member[r]);
+
+    std::vector<TNode> nodes;
+
+    for (size_t i=0;i<list.size();i++)
+    {
+        TNode b = list[i];
+
+        if (base[b]==NoNode || parent[b]!=NoNode || tree[b]!=r) continue;
+
+        CollectLeaves(b,leaves);
+
+        for (size_t l=0;l<leaves.size();l++)
+        {
+            SetYSign(leaves[l],0);
+            nodes.push_back(leaves[l]);
+        }
+
+        if (b>=n) SetZSign(b,0);
+
+        label[b] = LABEL_NONE;
+        tree[b] = NoNode;
+    }
+
+    // Dissolve the top-level blossoms with zero potentials
+
+    for (size_t i=0;i<list.size();i++)
+    {
+        TNode b = list[i];
+
+        if (   b>=n && base[b]!=NoNode && parent[b]==NoNode
+            && tree[b]==NoNode && Z(b)<=epsilon
+           )
+        {
+            ExpandZero(b);
+        }
+    }
+
+    // The former tree nodes are now unlabeled. Their edges to the even
+    // nodes of the other trees must be reconsidered
+
+    for (size_t i=0;i<nodes.size();i++)
+    {
+        TNode v = nodes[i];
+
+        for (TArc k=first[v];k<first[v+1];k++)
+        {
+            TArc a = adjArc[k];
+
+            if (label[inBlossom[head[a]]]==LABEL_EVEN)
+            {
+                PushEvent(delta+Slack(a),a^1,EVENT_GROW);
+            }
+        }
+    }
+}
+
+
+bool blossomMatching::Solve() throw()
+{
+    TNode nMatched = GreedyStart();
+
+    if (CT.logMeth>1)
+    {
+        sprintf(CT.logBuffer,"...Greedy start matches %lu of %lu nodes",
+            (unsigned long)nMatched,(unsigned long)n);
+        LogEntry(LOG_METH2,CT.logBuffer);
+    }
+
+    #if defined(_PROGRESS_)
+
+    InitProgressCounter(n-nMatched);
+
+    #endif
+
+    TNode nExposed = n-nMatched;
+
+    for (TNode r=0;r<n;r++)
+    {
+        if (mate[r]==NoArc) AssignEven(r,NoArc,r);
+    }
+
+    while (nExposed>0 && !Q.empty() && CT.SolverRunning())
+    {
+        TBlossomEvent thisEvent = Q.front();
+        std::pop_heap(Q.begin(),Q.end());
+        Q.pop_back();
+
+        // All dual constraints are represented by events with exact keys.
+        // Outdated events have smaller keys, so that the offset can be
+        // advanced before validation
+
+        if (thisEvent.key>delta) delta = thisEvent.key;
+
+        if (thisEvent.type==EVENT_EXPAND)
+        {
+            TNode b = thisEvent.index;
+
+            if (base[b]==NoNode || parent[b]!=NoNode || label[b]!=LABEL_ODD) continue;
+
+            TFloat thisZ = Z(b);
+
+            if (thisZ>epsilon)
+            {
+                PushEvent(delta+thisZ/2,b,EVENT_EXPAND);
+                continue;
+            }
+
+            ExpandOdd(b);
+            continue;
+        }
+
+        TArc a = thisEvent.index;
+        TNode bv = inBlossom[Tail(a)];
+        TNode bu = inBlossom[head[a]];
+
+        if (bu==bv || label[bv]!=LABEL_EVEN) continue;
+
+        if (thisEvent.type==EVENT_GROW)
+        {
+            if (label[bu]!=LABEL_NONE) continue;
+
+            TFloat thisSlack = Slack(a);
+
+            if (thisSlack>epsilon)
+            {
+                PushEvent(delta+thisSlack,a,EVENT_GROW);
+                continue;
+            }
+
+            AssignOdd(bu,a,tree[bv],true);
+            continue;
+        }
+
+        if (label[bu]!=LABEL_EVEN) continue;
+
+        TFloat thisSlack = Slack(a);
+
+        if (thisSlack>epsilon)
+        {
+            PushEvent(delta+thisSlack/2,a,EVENT_EVEN);
+            continue;
+        }
+
+        if (tree[bu]==tree[bv])
+        {
+            Shrink(FindCommonBase(Tail(a),head[a]),a);
+            continue;
+        }
+
+        TNode ru = tree[bu];
+        TNode rv = tree[bv];
+
+        Augment(a);
+        Dissolve(ru);
+        Dissolve(rv);
+        nExposed -= 2;
+
+        #if defined(_PROGRESS_)
+
+        ProgressStep(2);
+
+        #endif
+    }
+
+    if (CT.logMeth>1)
+    {
+        sprintf(CT.logBuffer,"...%lu augmentations, %lu blossoms shrunk, %lu blossoms expanded",
+            nAugment,nShrink,nExpand);
+        LogEntry(LOG_METH2,CT.logBuffer);
+    }
+
+    if (nExposed>0)
+    {
+        if (CT.SolverRunning()) LogEntry(LOG_RES,"...Graph does not have a perfect matching");
+
+        return false;
+    }
+
+    return true;
+}
+
+
+TFloat blossomMatching::ExportMatching() throw()
+{
+    G.InitSubgraph();
+    TFloat weight = 0;
+
+    for (TNode v=0;v<n;v++)
+    {
+        TArc a = mate[v];
+
+        if (a==NoArc || head[a^1]<v) continue;
+
+        G.SetSub(a&~TArc(1),1);
+        weight += cost[a>>1];
+    }
+
+    return weight;
+}
+
+
+bool abstractGraph::PMWeightedBlossom() throw()
+{
+    LogEntry(LOG_METH,"(Native blossom method)");
+    OpenFold();
+
+    bool ret = false;
+
+    if (n%2==0)
+    {
+        blossomMatching M(*this);
+        ret = M.Solve();
+        TFloat weight = M.ExportMatching();
+
+        if (ret && CT.logRes)
+        {
+            sprintf(CT.logBuffer,"...Perfect matching of weight %g found",weight);
+            LogEntry(LOG_RES,CT.logBuffer);
+        }
+    }
+    else
+    {
+        InitSubgraph();
+        LogEntry(LOG_RES,"...Odd number of nodes");
+    }
+
+    CloseFold();
+
+    return ret;
+}
@@ -0,0 +1,154 @@
+
+// --------------------------------------------------------------------------
+//  Regression checks for the parallel component methods. Small graphs are
+//  evaluated by the DFS methods and by the parallel methods, and the return
+//  values and colouring conventions are compared
+// --------------------------------------------------------------------------
+
+
+#include <goblin.h>
+
+
+static int nFailed = 0;
+
+
+void Check(bool condition,const char* label)
+{
+    if (!condition)
+    {
+        cout << "...Failed: " << label << endl;
+        nFailed++;
+    }
+}
+
+
+int main(int ParamCount,const char* ParamStr[])
+{
+    goblinController &CT = goblinDefaultContext;
+
+    CT.Configure(ParamCount,ParamStr);
+    CT.logMeth = CT.logRes = CT.logMem = CT.logMan = CT.logWarn = 0;
+    CT.traceLevel = 0;
+
+
+    // Edgeless graphs do not have an edge colour register. The parallel
+    // method must return without allocating one
+
+    for (int meth=0;meth<2;meth++)
+    {
+        CT.methComponents = meth;
+
+        graph G(5,CT);
+        Check(G.CutNodes()==G.DFS_DISCONNECTED,"Edgeless graph is disconnected");
+
+        graph H(1,CT);
+        Check(H.CutNodes()==H.DFS_BICONNECTED,"Single node is biconnected");
+    }
+
+
+    // A single edge with a loop forms one block and one 2-edge connected
+    // component. Blocks and components are numbered from 1
+
+    for (int meth=0;meth<2;meth++)
+    {
+        CT.methComponents = meth;
+
+        graph G(2,CT);
+        G.InsertArc(0,1);
+        G.InsertArc(0,0);
+
+        Check(G.CutNodes()==G.DFS_BICONNECTED,"Single edge is biconnected");
+        Check(G.GetNodeColours()[0]==1 && G.GetNodeColours()[1]==1,"Block numbered from 1");
+        Check(G.GetEdgeColours()[1]==1,"Loop coloured by the block");
+
+        Check(G.Biconnected(),"Single edge is 2-edge connected");
+        Check(G.GetNodeColours()[0]==1 && G.GetNodeColours()[1]==1,"Component numbered from 1");
+    }
+
+
+    // A loop at an isolated node is coloured 0, and the isolated nodes
+    // remain uncoloured
+
+    for (int meth=0;meth<2;meth++)
+    {
+        CT.methComponents = meth;
+
+        graph G(4,CT);
+        G.InsertArc(0,0);
+        G.InsertArc(1,2);
+        G.InsertArc(2,3);
+
+        Check(G.CutNodes()==G.DFS_DISCONNECTED,"Graph is disconnected");
+
+        TNode* nodeColour = G.GetNodeColours();
+        TArc* edgeColour = G.GetEdgeColours();
+
+        Check(nodeColour[0]==NoNode,"Isolated node is uncoloured");
+        Check(nodeColour[2]==G.CONN_CUT_NODE,"Cut node is coloured 0");
+        Check(nodeColour[1]!=nodeColour[3] && nodeColour[1]>0 && nodeColour[3]>0,
+            "Blocks are distinguished");
+        Check(edgeColour[0]==0,"Loop at isolated node is coloured 0");
+
+        Check(!G.Biconnected(),"Path is not 2-edge connected");
+
+        nodeColour = G.GetNodeColours();
+
+        Check(nodeColour[0]==NoNode,"Isolated node is uncoloured");
+        Check(   nodeColour[1]!=nodeColour[2] && nodeColour[2]!=nodeColour[3]
+              && nodeColour[1]!=nodeColour[3],
+            "Bridges separate the components");
+    }
+
+
+    // Random graphs: Both methods must agree on the return values
+    // and on the cut nodes
+
+    for (unsigned i=0;i<200;i++)
+    {
+        TNode n = 2+TNode(CT.Rand(20));
+        TArc m = 1+TArc(CT.Rand(2*n));
+
+        graph G(n,CT);
+
+        for (TArc a=0;a<m;a++) G.InsertArc(TNode(CT.Rand(n)),TNode(CT.Rand(n)));
+
+        CT.methComponents = 0;
+        abstractMixedGraph::TRetDFS retDFS = G.CutNodes();
+        TNode* cutDFS = new TNode[n];
+
+        for (TNode v=0;v<n;v++) cutDFS[v] = G.GetNodeColours()[v];
+
+        bool biconnectedDFS = G.Biconnected();
+
+        CT.methComponents = 1;
+        abstractMixedGraph::TRetDFS retParallel = G.CutNodes();
+
+        if (retDFS==G.DFS_ALMOST_BICONNECTED) retDFS = G.DFS_MULTIPLE_BLOCKS;
+
+        Check(retDFS==retParallel,"Same CutNodes() return value");
+
+        for (TNode v=0;v<n;v++)
+        {
+            TNode c = G.GetNodeColours()[v];
+
+            Check((c==0)==(cutDFS[v]==0) && (c==NoNode)==(cutDFS[v]==NoNode),
+                "Same cut nodes");
+        }
+
+        Check(G.Biconnected()==biconnectedDFS,"Same Biconnected() return value");
+
+        delete[] cutDFS;
+    }
+
+    CT.methComponents = 0;
+
+    if (nFailed>0)
+    {
+        cout << nFailed << " checks failed" << endl;
+        return -1;
+    }
+
+    cout << "...All checks passed" << endl;
+
+    return 0;
+}
@@ -0,0 +1,143 @@
+
+// --------------------------------------------------------------------------
+//  Regression checks for the parallel push/relabel method. Random b-flow
+//  problems start from a non-zero subgraph, so that the auxiliary networks
+//  of AdmissibleBFlow() have node imbalances. The feasibility tests and the
+//  min-cost flow values must match the sequential push/relabel method
+// --------------------------------------------------------------------------
+
+
+#include <goblin.h>
+
+
+static int nFailed = 0;
+
+
+void Check(bool condition,const char* label)
+{
+    if (!condition)
+    {
+        cout << "...Failed: " << label << endl;
+        nFailed++;
+    }
+}
+
+
+// Restores the initial subgraph. Timer bounds are cleared since they are
+// kept from the previous solver call
+
+void Restart(abstractMixedGraph& G,goblinController& CT,const TFloat* sub)
+{
+    for (unsigned i=0;i<NoTimer;i++) CT.globalTimer[i]->Reset();
+
+    for (TArc a=0;a<G.M();a++) G.SetSub(2*a,sub[a]);
+}
+
+
+int main(int ParamCount,const char* ParamStr[])
+{
+    goblinController &CT = goblinDefaultContext;
+
+    CT.Configure(ParamCount,ParamStr);
+    CT.logMeth = CT.logRes = CT.logMem = CT.logMan = CT.logWarn = 0;
+    CT.traceLevel = 0;
+
+    int savedMXF = CT.methMXF;
+    int savedMCF = CT.methMCF;
+    CT.methMCF = abstractMixedGraph::MCF_BF_CYCLE;
+
+
+    // A single arc whose flow already exceeds the demand. The excess must be
+    // routed back, the other node is left with a deficit
+
+    for (int meth=0;meth<2;meth++)
+    {
+        CT.methMXF = (meth==0) ? abstractMixedGraph::MXF_PREFLOW_FIFO
+                               : abstractMixedGraph::MXF_PREFLOW_PARALLEL;
+
+        diGraph G(2,CT);
+        G.InsertArc(0,1,10,1);
+        G.Representation() -> SetDemand(0,-3);
+        G.Representation() -> SetDemand(1,3);
+
+        TFloat sub[1] = {7};
+        Restart(G,CT,sub);
+
+        Check(G.AdmissibleBFlow(),"Single arc is feasible");
+    }
+
+
+    // Random instances with up to 4 threads. Parallel arcs are avoided since
+    // the FIFO method does not support them
+
+    for (unsigned i=0;i<200;i++)
+    {
+        TNode n = 5+TNode(CT.Rand(30));
+        TArc m = n+TArc(CT.Rand(n));
+
+        diGraph G(n,CT);
+        bool* adjacent = new bool[n*n];
+
+        for (TNode v=0;v<n*n;v++) adjacent[v] = false;
+
+        for (TArc a=0;a<m;a++)
+        {
+            TNode u = TNode(CT.Rand(n));
+            TNode v = TNode(CT.Rand(n));
+
+            if (u==v || adjacent[u*n+v]) continue;
+
+            adjacent[u*n+v] = true;
+            G.InsertArc(u,v,1+TCap(CT.Rand(20)),TFloat(CT.Rand(10)));
+        }
+
+        delete[] adjacent;
+
+        for (TNode j=0;j<n/2;j++)
+        {
+            TNode u = TNode(CT.Rand(n));
+            TNode v = TNode(CT.Rand(n));
+            TCap b = 1+TCap(CT.Rand(20));
+
+            G.Representation() -> SetDemand(u,G.Demand(u)+b);
+            G.Representation() -> SetDemand(v,G.Demand(v)-b);
+        }
+
+        TFloat* sub = new TFloat[G.M()];
+
+        for (TArc a=0;a<G.M();a++)
+            sub[a] = TFloat(CT.Rand(unsigned(G.UCap(2*a))+1));
+
+        CT.maxThreads = 1+i%4;
+
+        CT.methMXF = abstractMixedGraph::MXF_PREFLOW_FIFO;
+        Restart(G,CT,sub);
+        bool feasibleSequential = G.AdmissibleBFlow();
+        Restart(G,CT,sub);
+        TFloat costSequential = G.MinCostBFlow();
+
+        CT.methMXF = abstractMixedGraph::MXF_PREFLOW_PARALLEL;
+        Restart(G,CT,sub);
+        bool feasibleParallel = G.AdmissibleBFlow();
+        Restart(G,CT,sub);
+        TFloat costParallel = G.MinCostBFlow();
+
+        Check(feasibleSequential==feasibleParallel,"Same AdmissibleBFlow() return value");
+        Check(costSequential==costParallel,"Same MinCostBFlow() value");
+
+        delete[] sub;
+    }
+
+    CT.methMXF = savedMXF;
+    CT.methMCF = savedMCF;
+
+    if (nFailed>0)
+    {
+        cout << nFailed << " checks failed" << endl;
+        return -1;
+    }
+
+    cout << "...All checks passed" << endl;
+
+    return 0;
+}
@@ -0,0 +1,219 @@
+
+// --------------------------------------------------------------------------
+//  Concurrency checks for the controller state. Shortest path and max-flow
+//  problems are solved by several threads at the same time, first in distinct
+//  contexts, then in a single shared context. The results and the log
+//  transcripts must match a sequential run of the same instances
+// --------------------------------------------------------------------------
+
+
+#include <goblin.h>
+#include <pthread.h>
+#include <string>
+
+
+const unsigned NUM_THREADS = 4;
+const unsigned NUM_ROUNDS = 5;
+
+static int nFailed = 0;
+
+// Every thread collects its own log transcript
+static __thread std::string* threadLog = NULL;
+
+
+void Check(bool condition,const char* label)
+{
+    if (!condition)
+    {
+        cout << "...Failed: " << label << endl;
+        nFailed++;
+    }
+}
+
+
+void myLogEventHandler(msgType msg,TModule,THandle,char* logText)
+{
+    if (!threadLog) return;
+
+    if (msg!=MSG_APPEND) *threadLog += "\n";
+
+    *threadLog += logText;
+}
+
+
+struct TInstance
+{
+    unsigned    seed;
+    diGraph*    G;
+    TFloat      pathLength;
+    TFloat      flowValue;
+    std::string log;
+};
+
+
+void Solve(abstractMixedGraph& G,TInstance& I)
+{
+    G.ShortestPath(0,1);
+    I.pathLength = G.Dist(1);
+    I.flowValue = G.MaxFlow(0,1);
+}
+
+
+void Generate(goblinController& CT,TInstance& I)
+{
+    CT.SetRandomSeed(I.seed);
+    CT.randUCap = 1;
+    CT.randLength = 1;
+
+    I.G = new diGraph(200,CT);
+    I.G -> RandomArcs(2000);
+}
+
+
+// Distinct contexts: Every thread generates and solves its own instances
+
+void* SolveInContext(void* arg)
+{
+    TInstance* I = static_cast<TInstance*>(arg);
+
+    goblinController CT(goblinDefaultContext);
+    CT.logEventHandler = &myLogEventHandler;
+
+    threadLog = &(I->log);
+
+    for (unsigned i=0;i<NUM_ROUNDS;i++)
+    {
+        Generate(CT,*I);
+        Solve(*I->G,*I);
+        delete I->G;
+    }
+
+    threadLog = NULL;
+
+    return NULL;
+}
+
+
+// Shared context: The instances are generated in advance, and all
+// threads but the main thread are declared as worker threads
+
+void* SolveInWorker(void* arg)
+{
+    TInstance* I = static_cast<TInstance*>(arg);
+
+    goblinController::SetWorkerThread(true);
+    threadLog = &(I->log);
+
+    for (unsigned i=0;i<NUM_ROUNDS;i++) Solve(*I->G,*I);
+
+    threadLog = NULL;
+    goblinController::SetWorkerThread(false);
+
+    return NULL;
+}
+
+
+int main(int ParamCount,const char* ParamStr[])
+{
+    goblinController &CT = goblinDefaultContext;
+
+    CT.Configure(ParamCount,ParamStr);
+    CT.traceLevel = 0;
+    CT.logMem = CT.logMan = CT.logIO = CT.logTimers = 0;
+    CT.logMeth = CT.logRes = 1;
+    CT.logEventHandler = &myLogEventHandler;
+
+    TInstance reference[NUM_THREADS];
+    TInstance concurrent[NUM_THREADS];
+
+
+    // Sequential reference run
+
+    for (unsigned k=0;k<NUM_THREADS;k++)
+    {
+        reference[k].seed = concurrent[k].seed = 17*k+1;
+        SolveInContext(&reference[k]);
+    }
+
+
+    // Distinct contexts in concurrent threads
+
+    pthread_t thread[NUM_THREADS];
+
+    for (unsigned k=0;k<NUM_THREADS;k++)
+        pthread_create(&thread[k],NULL,SolveInContext,&concurrent[k]);
+
+    for (unsigned k=0;k<NUM_THREADS;k++) pthread_join(thread[k],NULL);
+
+    for (unsigned k=0;k<NUM_THREADS;k++)
+    {
+        Check(concurrent[k].pathLength==reference[k].pathLength,"Same shortest path length");
+        Check(concurrent[k].flowValue==reference[k].flowValue,"Same maximum flow value");
+        Check(!reference[k].log.empty(),"Log transcript written");
+        Check(concurrent[k].log==reference[k].log,"Same log transcript");
+    }
+
+
+    // Shared context. The main thread solves the first instance and
+    // writes the log, the worker threads solve the other instances
+
+    int savedLogLevel = CT.logLevel;
+
+    for (unsigned k=0;k<NUM_THREADS;k++)
+    {
+        Generate(CT,concurrent[k]);
+        concurrent[k].log.clear();
+    }
+
+    // The first solver run starts from an empty subgraph and
+    // logs differently than the following runs
+
+    std::string sequentialLog;
+    Solve(*concurrent[0].G,concurrent[0]);
+    threadLog = &sequentialLog;
+    Solve(*concurrent[0].G,concurrent[0]);
+    threadLog = NULL;
+
+    for (unsigned k=1;k<NUM_THREADS;k++)
+        pthread_create(&thread[k],NULL,SolveInWorker,&concurrent[k]);
+
+    threadLog = &(concurrent[0].log);
+    for (unsigned i=0;i<NUM_ROUNDS;i++) Solve(*concurrent[0].G,concurrent[0]);
+    threadLog = NULL;
+
+    for (unsigned k=1;k<NUM_THREADS;k++) pthread_join(thread[k],NULL);
+
+    for (unsigned k=0;k<NUM_THREADS;k++)
+    {
+        Check(concurrent[k].pathLength==reference[k].pathLength,"Same shortest path length");
+        Check(concurrent[k].flowValue==reference[k].flowValue,"Same maximum flow value");
+
+        if (k>0) Check(concurrent[k].log.empty(),"No log entries by worker threads");
+
+        delete concurrent[k].G;
+    }
+
+    std::string expectedLog;
+    for (unsigned i=0;i<NUM_ROUNDS;i++) expectedLog += sequentialLog;
+
+    Check(concurrent[0].log==expectedLog,"Log transcript of the main thread");
+    Check(CT.logLevel==savedLogLevel,"Log level restored");
+    Check(!CT.compoundLogEntry,"No open compound log entry");
+    Check(CT.SolverRunning(),"Solvers not stopped");
+
+    // Timer nesting is not affected by the worker threads
+    for (unsigned i=0;i<NoTimer;i++)
+    {
+        Check(!CT.globalTimer[i]->Enabled(),"All timers stopped");
+    }
+
+    if (nFailed>0)
+    {
+        cout << nFailed << " checks failed" << endl;
+        return -1;
+    }
+
+    cout << "...All checks passed" << endl;
+
+    return 0;
+}
@@ -174,7 +174,7 @@ int Goblin_Sparse_Bigraph_Cmd (ClientData clientData,Tcl_Interp* interp,
         {
             TNode u = atol(argv[2]);
             TNode v = G -> SwapNode(u);
-            sprintf(interp->result,"%ld",v);
+            sprintf(interp->result,"%ld",(unsigned long)v);
             return TCL_OK;
         }
 
@@ -559,7 +559,7 @@ int Goblin_Bipartite_Cmd (abstractBiGraph *G,Tcl_Interp* interp,int argc,
             return TCL_ERROR;
         }
 
-        sprintf(interp->result,"%ld",G->N1());
+        sprintf(interp->result,"%ld",(unsigned long)G->N1());
         return TCL_OK;
     }
 
@@ -571,7 +571,7 @@ int Goblin_Bipartite_Cmd (abstractBiGraph *G,Tcl_Interp* interp,int argc,
             return TCL_ERROR;
         }
 
-        sprintf(interp->result,"%ld",G->N2());
+        sprintf(interp->result,"%ld",(unsigned long)G->N2());
         return TCL_OK;
     }
 
@@ -625,6 +625,24 @@ int Goblin_Undirected_Cmd (abstractGraph *G,Tcl_Interp* interp,int argc,
         return TCL_OK;
     }
 
+    if (strcmp(argv[1],"gomoryHuTree")==0)
+    {
+        if (argc!=3)
+        {
+            WrongNumberOfArguments(interp,argc,argv);
+            return TCL_ERROR;
+        }
+
+        diGraph *H = G->GomoryHuTree();
+
+        Tcl_CreateCommand(interp,const_cast<char*>(argv[2]),
+            Goblin_Sparse_Digraph_Cmd,(ClientData)H,
+            (Tcl_CmdDeleteProc *)Goblin_Delete_Sparse_Digraph);
+
+        interp->result = "";
+        return TCL_OK;
+    }
+
     if (strcmp(argv[1],"tiling")==0)
     {
         if (argc!=5)
@@ -837,7 +855,7 @@ int Goblin_Directed_Cmd (abstractDiGraph *G,Tcl_Interp* interp,int argc,
             return TCL_OK;
         }
 
-        sprintf(interp->result,"%ld",v);
+        sprintf(interp->result,"%ld",(unsigned long)v);
         return TCL_OK;
     }
 
@@ -857,7 +875,7 @@ int Goblin_Directed_Cmd (abstractDiGraph *G,Tcl_Interp* interp,int argc,
             return TCL_ERROR;
         }
 
-        sprintf(interp->result,"%ld",v);
+        sprintf(interp->result,"%ld",(unsigned long)v);
         return TCL_OK;
     }
 
@@ -1456,6 +1474,16 @@ int Goblin_Generic_Graph_Cmd (abstractMixedGraph *G,Tcl_Interp* interp,int argc,
                 G -> Layout_ForceDirected(
                         abstractMixedGraph::FDP_GEM,int(spacing));
             }
+            else if (CT->FindParam(argc,argv,"-barnesHut",3))
+            {
+                G -> Layout_ForceDirected(
+                        abstractMixedGraph::FDP_BARNES_HUT,int(spacing));
+            }
+            else if (CT->FindParam(argc,argv,"-multilevel",3))
+            {
+                G -> Layout_ForceDirected(
+                        abstractMixedGraph::FDP_MULTILEVEL,int(spacing));
+            }
             else
             {
                 G -> Layout_ForceDirected(
@@ -1747,7 +1775,7 @@ int Goblin_Generic_Graph_Cmd (abstractMixedGraph *G,Tcl_Interp* interp,int argc,
         {
             try
             {
-                sprintf(interp->result,"%ld",G -> ExtractCycles());
+                sprintf(interp->result,"%ld",(unsigned long)G -> ExtractCycles());
             }
             catch (ERCheck)
             {
@@ -1892,7 +1920,7 @@ int Goblin_Generic_Graph_Cmd (abstractMixedGraph *G,Tcl_Interp* interp,int argc,
             return TCL_ERROR;
         }
 
-        sprintf(interp->result,"%ld",G->N());
+        sprintf(interp->result,"%ld",(unsigned long)G->N());
         return TCL_OK;
     }
 
@@ -1904,7 +1932,7 @@ int Goblin_Generic_Graph_Cmd (abstractMixedGraph *G,Tcl_Interp* interp,int argc,
             return TCL_ERROR;
         }
 
-        sprintf(interp->result,"%ld",G->NI());
+        sprintf(interp->result,"%ld",(unsigned long)G->NI());
         return TCL_OK;
     }
 
@@ -1916,7 +1944,7 @@ int Goblin_Generic_Graph_Cmd (abstractMixedGraph *G,Tcl_Interp* interp,int argc,
             return TCL_ERROR;
         }
 
-        sprintf(interp->result,"%ld",G->M());
+        sprintf(interp->result,"%ld",(unsigned long)G->M());
         return TCL_OK;
     }
 
@@ -1929,7 +1957,7 @@ int Goblin_Generic_Graph_Cmd (abstractMixedGraph *G,Tcl_Interp* interp,int argc,
         }
 
         if (G->Source()==NoNode) interp->result = "*";
-        else sprintf(interp->result,"%ld",G->Source());
+        else sprintf(interp->result,"%ld",(unsigned long)G->Source());
 
         return TCL_OK;
     }
@@ -1943,7 +1971,7 @@ int Goblin_Generic_Graph_Cmd (abstractMixedGraph *G,Tcl_Interp* interp,int argc,
         }
 
         if (G->Target()==NoNode) interp->result = "*";
-        else sprintf(interp->result,"%ld",G->Target());
+        else sprintf(interp->result,"%ld",(unsigned long)G->Target());
 
         return TCL_OK;
     }
@@ -1957,7 +1985,7 @@ int Goblin_Generic_Graph_Cmd (abstractMixedGraph *G,Tcl_Interp* interp,int argc,
         }
 
         if (G->Root()==NoNode) interp->result = "*";
-        else sprintf(interp->result,"%ld",G->Root());
+        else sprintf(interp->result,"%ld",(unsigned long)G->Root());
 
         return TCL_OK;
     }
@@ -2131,12 +2159,38 @@ int Goblin_Generic_Graph_Cmd (abstractMixedGraph *G,Tcl_Interp* interp,int argc,
 
     if (strcmp(argv[1],"write")==0)
     {
-        if (argc!=3)
+        if (argc!=3 && argc!=5)
         {
             WrongNumberOfArguments(interp,argc,argv);
             return TCL_ERROR;
         }
 
+        if (argc==5)
+        {
+            if (strcmp(argv[2],"-format")!=0)
+            {
+                sprintf(interp->result,"Unknown option: %s",argv[2]);
+                return TCL_ERROR;
+            }
+
+            if (strcmp(argv[3],"binary")==0)
+            {
+                G -> WriteBinary(argv[4]);
+            }
+            else if (strcmp(argv[3],"native")==0)
+            {
+                G -> Write(argv[4]);
+            }
+            else
+            {
+                sprintf(interp->result,"Unknown file format: %s",argv[3]);
+                return TCL_ERROR;
+            }
+
+            interp->result = "";
+            return TCL_OK;
+        }
+
         G -> Write(argv[2]);
         interp->result = "";
         return TCL_OK;
@@ -2254,16 +2308,21 @@ int Goblin_Generic_Graph_Cmd (abstractMixedGraph *G,Tcl_Interp* interp,int argc,
         else
         {
             pos = CT->FindParam(argc,&argv[0],"-node",2);
-            abstractMixedGraph::TOptNodeSplitting mode =
-                (pos>0) ? G->MCC_UNIT_CAPACITIES : G->MCC_MAP_DEMANDS;
+            int mode = (pos>0) ? G->MCC_UNIT_CAPACITIES : G->MCC_MAP_DEMANDS;
+
+            pos = CT->FindParam(argc,&argv[0],"-allPairs",2);
+
+            if (pos>0) mode |= G->MCC_ALL_PAIRS;
 
             if (strongConnnectivity)
             {
-                retCap = G->StrongNodeConnectivity(sourceNode,targetNode,mode);
+                retCap = G->StrongNodeConnectivity(sourceNode,targetNode,
+                            abstractMixedGraph::TOptNodeSplitting(mode));
             }
             else
             {
-                retCap = G->NodeConnectivity(sourceNode,targetNode,mode);
+                retCap = G->NodeConnectivity(sourceNode,targetNode,
+                            abstractMixedGraph::TOptNodeSplitting(mode));
             }
         }
 
@@ -2363,7 +2422,7 @@ int Goblin_Generic_Graph_Cmd (abstractMixedGraph *G,Tcl_Interp* interp,int argc,
 
         if (chi>0)
         {
-            sprintf(interp->result,"%ld",chi);
+            sprintf(interp->result,"%ld",(unsigned long)chi);
             return TCL_OK;
         }
         else
@@ -2388,7 +2447,7 @@ int Goblin_Generic_Graph_Cmd (abstractMixedGraph *G,Tcl_Interp* interp,int argc,
 
         if (chi>0)
         {
-            sprintf(interp->result,"%ld",chi);
+            sprintf(interp->result,"%ld",(unsigned long)chi);
             return TCL_OK;
         }
         else
@@ -2413,7 +2472,7 @@ int Goblin_Generic_Graph_Cmd (abstractMixedGraph *G,Tcl_Interp* interp,int argc,
 
         if (chi>0)
         {
-            sprintf(interp->result,"%ld",chi);
+            sprintf(interp->result,"%ld",(unsigned long)chi);
             return TCL_OK;
         }
         else
@@ -2431,7 +2490,7 @@ int Goblin_Generic_Graph_Cmd (abstractMixedGraph *G,Tcl_Interp* interp,int argc,
             return TCL_ERROR;
         }
 
-        sprintf(interp->result,"%ld",G->StableSet());
+        sprintf(interp->result,"%ld",(unsigned long)G->StableSet());
         return TCL_OK;
     }
 
@@ -2443,7 +2502,7 @@ int Goblin_Generic_Graph_Cmd (abstractMixedGraph *G,Tcl_Interp* interp,int argc,
             return TCL_ERROR;
         }
 
-        sprintf(interp->result,"%ld",G->Clique());
+        sprintf(interp->result,"%ld",(unsigned long)G->Clique());
         return TCL_OK;
     }
 
@@ -2455,7 +2514,7 @@ int Goblin_Generic_Graph_Cmd (abstractMixedGraph *G,Tcl_Interp* interp,int argc,
             return TCL_ERROR;
         }
 
-        sprintf(interp->result,"%ld",G->VertexCover());
+        sprintf(interp->result,"%ld",(unsigned long)G->VertexCover());
         return TCL_OK;
     }
 
@@ -3035,7 +3094,7 @@ int Goblin_Generic_Graph_Cmd (abstractMixedGraph *G,Tcl_Interp* interp,int argc,
         TArc a = G->Adjacency(u,v);
 
         if (a==NoArc) interp->result = "*";
-        else sprintf(interp->result,"%ld",a);
+        else sprintf(interp->result,"%ld",(unsigned long)a);
 
         return TCL_OK;
     }
@@ -3067,7 +3126,7 @@ int Goblin_Node_Cmd (abstractMixedGraph *G,Tcl_Interp* interp,int argc,
             return TCL_ERROR;
         }
 
-        sprintf(interp->result,"%ld",G->InsertNode());
+        sprintf(interp->result,"%ld",(unsigned long)G->InsertNode());
         return TCL_OK;
     }
 
@@ -3096,7 +3155,7 @@ int Goblin_Node_Cmd (abstractMixedGraph *G,Tcl_Interp* interp,int argc,
     {
         TArc a = G->First(v);
         if (a==NoArc) interp->result = "*";
-        else sprintf(interp->result,"%ld",a);
+        else sprintf(interp->result,"%ld",(unsigned long)a);
         return TCL_OK;
     }
 
@@ -3121,7 +3180,7 @@ int Goblin_Node_Cmd (abstractMixedGraph *G,Tcl_Interp* interp,int argc,
     if (strcmp(argv[3],"colour")==0)
     {
         if (G->NodeColour(v)!=NoNode)
-            sprintf(interp->result,"%ld",G->NodeColour(v));
+            sprintf(interp->result,"%ld",(unsigned long)G->NodeColour(v));
         else interp->result = "*";
 
         return TCL_OK;
@@ -3154,7 +3213,7 @@ int Goblin_Node_Cmd (abstractMixedGraph *G,Tcl_Interp* interp,int argc,
 
         if (a!=NoArc)
         {
-            sprintf(interp->result,"%ld",a);
+            sprintf(interp->result,"%ld",(unsigned long)a);
         }
         else interp->result = "*";
 
@@ -3163,7 +3222,7 @@ int Goblin_Node_Cmd (abstractMixedGraph *G,Tcl_Interp* interp,int argc,
 
     if (strcmp(argv[3],"first")==0)
     {
-        sprintf(interp->result,"%ld",G->First(v));
+        sprintf(interp->result,"%ld",(unsigned long)G->First(v));
         return TCL_OK;
     }
 
@@ -3173,7 +3232,7 @@ int Goblin_Node_Cmd (abstractMixedGraph *G,Tcl_Interp* interp,int argc,
 
         if (w!=NoNode)
         {
-            sprintf(interp->result,"%ld",w);
+            sprintf(interp->result,"%ld",(unsigned long)w);
         }
         else interp->result = "*";
 
@@ -3330,7 +3389,7 @@ int Goblin_Arc_Cmd (abstractMixedGraph *G,Tcl_Interp* interp,int argc,
         TNode u = TArc(atol(argv[3]));
         TNode v = TArc(atol(argv[4]));
 
-        sprintf(interp->result,"%ld",G->InsertArc(u,v));
+        sprintf(interp->result,"%ld",(unsigned long)G->InsertArc(u,v));
         return TCL_OK;
     }
 
@@ -3410,7 +3469,7 @@ int Goblin_Arc_Cmd (abstractMixedGraph *G,Tcl_Interp* interp,int argc,
     if (strcmp(argv[3],"colour")==0)
     {
         if (G->EdgeColour(a)!=NoArc)
-            sprintf(interp->result,"%ld",G->EdgeColour(a));
+            sprintf(interp->result,"%ld",(unsigned long)G->EdgeColour(a));
         else interp->result = "*";
 
         return TCL_OK;
@@ -3424,19 +3483,19 @@ int Goblin_Arc_Cmd (abstractMixedGraph *G,Tcl_Interp* interp,int argc,
 
     if (strcmp(argv[3],"head")==0)
     {
-        sprintf(interp->result,"%ld",G->EndNode(a));
+        sprintf(interp->result,"%ld",(unsigned long)G->EndNode(a));
         return TCL_OK;
     }
 
     if (strcmp(argv[3],"tail")==0)
     {
-        sprintf(interp->result,"%ld",G->StartNode(a));
+        sprintf(interp->result,"%ld",(unsigned long)G->StartNode(a));
         return TCL_OK;
     }
 
     if (strcmp(argv[3],"right")==0)
     {
-        sprintf(interp->result,"%ld",G->Right(a,G->StartNode(a)));
+        sprintf(interp->result,"%ld",(unsigned long)G->Right(a,G->StartNode(a)));
         return TCL_OK;
     }
 
@@ -3446,7 +3505,7 @@ int Goblin_Arc_Cmd (abstractMixedGraph *G,Tcl_Interp* interp,int argc,
 
         if (x!=NoNode)
         {
-            sprintf(interp->result,"%ld",x);
+            sprintf(interp->result,"%ld",(unsigned long)x);
         }
         else
         {
@@ -3492,7 +3551,7 @@ int Goblin_Arc_Cmd (abstractMixedGraph *G,Tcl_Interp* interp,int argc,
             GR -> SetC(v,0,xx);
             GR -> SetC(v,1,yy);
 
-            sprintf(interp->result,"%ld",v);
+            sprintf(interp->result,"%ld",(unsigned long)v);
             return TCL_OK;
         }
 
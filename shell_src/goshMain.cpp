@@ -203,15 +203,18 @@ int Goblin_Init(Tcl_Interp *interp)
     Tcl_LinkVar(interp,"goblinMethSPX",(char*)&(CT->methSPX),TCL_LINK_INT);
     Tcl_LinkVar(interp,"goblinMethMST",(char*)&(CT->methMST),TCL_LINK_INT);
     Tcl_LinkVar(interp,"goblinMethMXF",(char*)&(CT->methMXF),TCL_LINK_INT);
+    Tcl_LinkVar(interp,"goblinMethMXFHeur",(char*)&(CT->methMXFHeur),TCL_LINK_INT);
     Tcl_LinkVar(interp,"goblinMethMCC",(char*)&(CT->methMCC),TCL_LINK_INT);
     Tcl_LinkVar(interp,"goblinMethMCFST",(char*)&(CT->methMCFST),TCL_LINK_INT);
     Tcl_LinkVar(interp,"goblinMethMCF",(char*)&(CT->methMCF),TCL_LINK_INT);
     Tcl_LinkVar(interp,"goblinMethNWPricing",(char*)&(CT->methNWPricing),TCL_LINK_INT);
+    Tcl_LinkVar(interp,"goblinCostScalingFactor",(char*)&(CT->costScalingFactor),TCL_LINK_INT);
     Tcl_LinkVar(interp,"goblinMethMaxBalFlow",(char*)&(CT->methMaxBalFlow),TCL_LINK_INT);
     Tcl_LinkVar(interp,"goblinMethBNS",(char*)&(CT->methBNS),TCL_LINK_INT);
     Tcl_LinkVar(interp,"goblinMethMinCBalFlow",(char*)&(CT->methMinCBalFlow),TCL_LINK_INT);
     Tcl_LinkVar(interp,"goblinMethPrimalDual",(char*)&(CT->methPrimalDual),TCL_LINK_INT);
     Tcl_LinkVar(interp,"goblinMethCandidates",(char*)&(CT->methCandidates),TCL_LINK_INT);
+    Tcl_LinkVar(interp,"goblinMethAssignment",(char*)&(CT->methAssignment),TCL_LINK_INT);
     Tcl_LinkVar(interp,"goblinMethColour",(char*)&(CT->methColour),TCL_LINK_INT);
     Tcl_LinkVar(interp,"goblinMethHeurTSP",(char*)&(CT->methHeurTSP),TCL_LINK_INT);
     Tcl_LinkVar(interp,"goblinMethRelaxTSP1",(char*)&(CT->methRelaxTSP1),TCL_LINK_INT);
@@ -222,6 +225,9 @@ int Goblin_Init(Tcl_Interp *interp)
     Tcl_LinkVar(interp,"goblinMethLocal",(char*)&(CT->methLocal),TCL_LINK_INT);
     Tcl_LinkVar(interp,"goblinMaxBBIterations",(char*)&(CT->maxBBIterations),TCL_LINK_INT);
     Tcl_LinkVar(interp,"goblinMaxBBNodes",(char*)&(CT->maxBBNodes),TCL_LINK_INT);
+    Tcl_LinkVar(interp,"goblinMethBranch",(char*)&(CT->methBranch),TCL_LINK_INT);
+    Tcl_LinkVar(interp,"goblinMethComponents",(char*)&(CT->methComponents),TCL_LINK_INT);
+    Tcl_LinkVar(interp,"goblinMaxThreads",(char*)&(CT->maxThreads),TCL_LINK_INT);
 
     Tcl_LinkVar(interp,"goblinMethLP",(char*)&(CT->methLP),TCL_LINK_INT);
     Tcl_LinkVar(interp,"goblinMethLPPricing",(char*)&(CT->methLPPricing),TCL_LINK_INT);
@@ -880,13 +886,35 @@ int Goblin_Cmd (ClientData clientData,Tcl_Interp* interp,int argc,
                     return TCL_OK;
                 }
 
-                sprintf(interp->result,"Unknown file format: %s",argv[formatIndex]);
-                return TCL_ERROR;
+                else if (strcmp(argv[formatIndex],"binary")!=0)
+                {
+                    sprintf(interp->result,"Unknown file format: %s",argv[formatIndex]);
+                    return TCL_ERROR;
+                }
+                else if (!goblinBinaryImport::IsBinaryFile(argv[argc-1]))
+                {
+                    interp->result = "Not a binary GOBLIN file";
+                    return TCL_ERROR;
+                }
             }
 
-            goblinImport F(argv[argc-1],*thisContext);
-            char* type = F.Scan();
-            F.DontComplain();
+            // Binary files are recognized by their header. The object type is
+            // determined in advance, the file constructors handle both formats
+            char type[17];
+
+            if (goblinBinaryImport::IsBinaryFile(argv[argc-1]))
+            {
+                goblinBinaryImport F(argv[argc-1],*thisContext);
+                strncpy(type,F.Header().objectClass,16);
+            }
+            else
+            {
+                goblinImport F(argv[argc-1],*thisContext);
+                strncpy(type,F.Scan(),16);
+                F.DontComplain();
+            }
+
+            type[16] = 0;
 
             int retCode = TCL_OK;
             interp->result = "";
@@ -984,6 +1012,67 @@ int Goblin_Cmd (ClientData clientData,Tcl_Interp* interp,int argc,
             return retCode;
         }
 
+        if (strcmp(argv[1],"convert")==0)
+        {
+            if (argc!=4 && argc!=6)
+            {
+                WrongNumberOfArguments(interp,argc,argv);
+                return TCL_ERROR;
+            }
+
+            // By default, native files are converted to the binary format and
+            // vice versa
+            bool toBinary = !goblinBinaryImport::IsBinaryFile(argv[argc-2]);
+
+            int formatIndex = CT->FindParam(argc,argv,"-format",2)+1;
+
+            if (formatIndex>1)
+            {
+                if (formatIndex>=argc-2)
+                {
+                    interp->result = "Missing format specification";
+                    return TCL_ERROR;
+                }
+                else if (strcmp(argv[formatIndex],"binary")==0)
+                {
+                    toBinary = true;
+                }
+                else if (strcmp(argv[formatIndex],"native")==0)
+                {
+                    toBinary = false;
+                }
+                else
+                {
+                    sprintf(interp->result,"Unknown file format: %s",argv[formatIndex]);
+                    return TCL_ERROR;
+                }
+            }
+
+            goblinController* thisContext = new goblinController(goblinDefaultContext);
+            abstractMixedGraph* G = NULL;
+
+            try
+            {
+                G = dynamic_cast<abstractMixedGraph*>(
+                        thisContext->ImportFromFile(argv[argc-2],goblinController::FMT_GOBLIN));
+
+                if (toBinary) G -> WriteBinary(argv[argc-1]);
+                else G -> Write(argv[argc-1]);
+            }
+            catch (...)
+            {
+                delete G;
+                delete thisContext;
+                throw;
+            }
+
+            delete G;
+            delete thisContext;
+
+            interp->result = "";
+            return TCL_OK;
+        }
+
         if (strcmp(argv[1],"alias")==0)
         {
             if (argc!=4)
@@ -1511,6 +1600,27 @@ int Goblin_Cmd (ClientData clientData,Tcl_Interp* interp,int argc,
                 return TCL_OK;
             }
 
+            if (strcmp(argv[3],"counter")==0)
+            {
+                if (argc!=5)
+                {
+                    WrongNumberOfArguments(interp,argc,argv);
+                    return TCL_ERROR;
+                }
+
+                unsigned j = atol(argv[4]);
+
+                if (j>=goblinTimer::NoCounter)
+                {
+                    sprintf(interp->result,"No such counter: %d",j);
+                    return TCL_ERROR;
+                }
+
+                sprintf(interp->result,"%lu",
+                    CT->globalTimer[i]->Counter(goblinTimer::TOperationCounter(j)));
+                return TCL_OK;
+            }
+
             if (argc!=4)
             {
                 WrongNumberOfArguments(interp,argc,argv);